@@ -0,0 +1,767 @@
+/* Host benchmark for the ESP32-SpeexDSP modules.
+
+   Build with the top-level CMakeLists.txt:
+      cmake -S . -B build && cmake --build build
+      ./build/speexdsp_bench [filter] [-n frames]
+
+   Each case prints frames/sec and ns/frame. An optional filter argument only
+   runs the cases whose name contains that substring. Configured with
+   -DSPEEXDSP_PROFILE=ON, the echo and preprocessor cases also print the time
+   per stage.
+*/
+
+#include "ESP32-SpeexDSP.h"
+#include "mem_tiers.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* mdf.c, used by the preprocessor (float build: spx_word32_t is float) */
+extern "C" {
+void speex_echo_get_residual(SpeexEchoState *st, float *residual_echo, int len);
+void speex_echo_get_residual_fused(SpeexEchoState *st, float *residual_echo, int len);
+}
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+const char *g_filter = NULL;
+int g_frames = 2000;
+/* Keeps results of otherwise unused computations alive */
+volatile int32_t g_sink;
+
+/* Deterministic noise so that runs are comparable */
+struct Lcg {
+    uint32_t state;
+    explicit Lcg(uint32_t seed) : state(seed) {}
+    int16_t next(int amplitude) {
+        state = state * 1664525u + 1013904223u;
+        return (int16_t)((int32_t)(state >> 16) % amplitude);
+    }
+};
+
+bool selected(const char *name) {
+    return !g_filter || strstr(name, g_filter) != NULL;
+}
+
+void report(const char *name, long frames, Clock::duration elapsed) {
+    double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    if (ns <= 0) ns = 1;
+    printf("%-40s %10.0f frames/s %12.0f ns/frame\n", name, frames * 1e9 / ns, ns / frames);
+}
+
+/* Stage breakdown of a state, when the library counts it */
+void report_profile(const SpeexProfile &profile) {
+    if (!profile.frames) return;
+    uint64_t total = 0;
+    for (int i = 0; i < profile.nb_stages; i++) total += profile.ticks[i];
+    if (!total) total = 1;
+    for (int i = 0; i < profile.nb_stages; i++) {
+        double ns = profile.ticks[i] * 1e9 / profile.ticks_per_second / profile.frames;
+        printf("  %-38s %12.0f ns/frame %5.1f %%\n", profile.names[i], ns, profile.ticks[i] * 100.0 / total);
+    }
+}
+
+/* Far end is noise, mic is a delayed and attenuated copy plus a little near-end noise */
+void make_echo_signals(int len, int delay, std::vector<int16_t> &far, std::vector<int16_t> &mic) {
+    Lcg rng(1234);
+    far.resize(len);
+    mic.resize(len);
+    for (int i = 0; i < len; i++) far[i] = rng.next(16000) - 8000;
+    for (int i = 0; i < len; i++) {
+        int echo = i >= delay ? far[i - delay] / 3 : 0;
+        mic[i] = (int16_t)(echo + rng.next(200));
+    }
+}
+
+void bench_echo(int frameSize, int filterLength, int rate) {
+    char name[64];
+    snprintf(name, sizeof(name), "echo_cancellation %d/%d@%d", frameSize, filterLength, rate);
+    if (!selected(name)) return;
+
+    const int blocks = 64;
+    std::vector<int16_t> far, mic, out(frameSize);
+    make_echo_signals(frameSize * blocks, frameSize / 2, far, mic);
+
+    SpeexEchoState *st = speex_echo_state_init(frameSize, filterLength);
+    speex_echo_ctl(st, SPEEX_ECHO_SET_SAMPLING_RATE, &rate);
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        int off = (i % blocks) * frameSize;
+        speex_echo_cancellation(st, &mic[off], &far[off], &out[0]);
+    }
+    report(name, g_frames, Clock::now() - start);
+    SpeexProfile profile;
+    if (speex_echo_ctl(st, SPEEX_ECHO_GET_PROFILE, &profile) == 0) report_profile(profile);
+    speex_echo_state_destroy(st);
+}
+
+/* Mic array through the high-level wrapper: channels mics and speakers, the
+   frames split across cores */
+void bench_echo_mc(int frameSize, int filterLength, int rate, int channels, int cores) {
+    char name[64];
+    snprintf(name, sizeof(name), "echo_mc %d/%d@%d %dch cores=%d", frameSize, filterLength, rate, channels, cores);
+    if (!selected(name)) return;
+
+    const int blocks = 64;
+    const int len = frameSize * blocks;
+    std::vector<int16_t> far, mic, farN(len * channels), micN(len * channels), out(frameSize * channels);
+    make_echo_signals(len, frameSize / 2, far, mic);
+    for (int i = 0; i < len; i++) {
+        for (int c = 0; c < channels; c++) {
+            farN[i * channels + c] = far[(i + c * 97) % len];
+            micN[i * channels + c] = mic[(i + c * 97) % len];
+        }
+    }
+
+    ESP32SpeexDSP dsp;
+    if (!dsp.beginAEC(frameSize, filterLength, rate, channels, cores)) return;
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        int off = (i % blocks) * frameSize * channels;
+        dsp.processAEC(&micN[off], &farN[off], &out[0]);
+    }
+    report(name, g_frames, Clock::now() - start);
+    SpeexProfile profile;
+    if (dsp.getAECProfile(profile)) report_profile(profile);
+}
+
+/* Echo reduction against CPU for a constraint schedule: 6 s of noise through a
+   decaying echo path that changes at 3 s. ERLE is measured over the first
+   second (convergence), the second after the change (tracking) and the last
+   second (steady state) */
+void bench_echo_constraint(int frameSize, int filterLength, int rate, int partitions, int boost) {
+    char name[64];
+    snprintf(name, sizeof(name), "echo_constraint %d/%d n=%d boost=%d", frameSize, filterLength, partitions, boost);
+    if (!selected(name)) return;
+
+    const int frames = 6 * rate / frameSize;
+    const int len = frames * frameSize;
+    const int taps = filterLength * 3 / 4;
+    std::vector<int16_t> far(len), mic(len), out(frameSize);
+    std::vector<float> path(2 * taps);
+    Lcg rng(99);
+    for (int i = 0; i < len; i++) far[i] = rng.next(16000) - 8000;
+    for (int k = 0; k < 2 * taps; k++) path[k] = (rng.next(2000) - 1000) / 1000.f * expf(-6.f * (k % taps) / taps) * .05f;
+    for (int i = 0; i < len; i++) {
+        const float *h = &path[i < len / 2 ? 0 : taps];
+        float echo = 0;
+        for (int k = 0; k < taps && k <= i; k++) echo += h[k] * far[i - k];
+        mic[i] = (int16_t)(echo + rng.next(60) - 30);
+    }
+
+    SpeexEchoState *st = speex_echo_state_init(frameSize, filterLength);
+    speex_echo_ctl(st, SPEEX_ECHO_SET_SAMPLING_RATE, &rate);
+    speex_echo_ctl(st, SPEEX_ECHO_SET_CONSTRAINT_PARTITIONS, &partitions);
+    speex_echo_ctl(st, SPEEX_ECHO_SET_CONSTRAINT_BOOST, &boost);
+    double in_energy[3] = {0, 0, 0}, out_energy[3] = {0, 0, 0};
+    Clock::duration elapsed = Clock::duration::zero();
+    for (int f = 0; f < frames; f++) {
+        int off = f * frameSize;
+        Clock::time_point start = Clock::now();
+        speex_echo_cancellation(st, &mic[off], &far[off], &out[0]);
+        elapsed += Clock::now() - start;
+        int second = off / rate;
+        int w = second == 0 ? 0 : second == 3 ? 1 : second == 5 ? 2 : -1;
+        if (w < 0) continue;
+        for (int i = 0; i < frameSize; i++) {
+            in_energy[w] += (double)mic[off + i] * mic[off + i];
+            out_energy[w] += (double)out[i] * out[i];
+        }
+    }
+    double erle[3];
+    for (int w = 0; w < 3; w++) erle[w] = 10 * log10((in_energy[w] + 1) / (out_energy[w] + 1));
+    double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    printf("%-40s %8.0f ns/frame ERLE %5.1f dB converging %5.1f dB tracking %5.1f dB steady\n", name,
+           ns / frames, erle[0], erle[1], erle[2]);
+    speex_echo_state_destroy(st);
+}
+
+void bench_preprocess(int frameSize, int rate, bool agc) {
+    char name[64];
+    snprintf(name, sizeof(name), "preprocess_run %d@%d%s", frameSize, rate, agc ? " +agc" : "");
+    if (!selected(name)) return;
+
+    const int blocks = 64;
+    std::vector<int16_t> far, mic, frame(frameSize);
+    make_echo_signals(frameSize * blocks, 0, far, mic);
+
+    SpeexPreprocessState *st = speex_preprocess_state_init(frameSize, rate);
+    int on = 1;
+    if (agc) speex_preprocess_ctl(st, SPEEX_PREPROCESS_SET_AGC, &on);
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        memcpy(&frame[0], &far[(i % blocks) * frameSize], frameSize * sizeof(int16_t));
+        speex_preprocess_run(st, &frame[0]);
+    }
+    report(name, g_frames, Clock::now() - start);
+    SpeexProfile profile;
+    if (speex_preprocess_ctl(st, SPEEX_PREPROCESS_GET_PROFILE, &profile) == 0) report_profile(profile);
+    speex_preprocess_state_destroy(st);
+}
+
+/* Runs the AEC until it has an echo estimate: the echo gets louder halfway, and
+   that change is what ends its initial adaptation phase. Until then the residual
+   echo is zero and costs nothing in fused mode, which would flatter it */
+bool adapt_echo(SpeexEchoState *st, int frameSize, const std::vector<int16_t> &far, const std::vector<int16_t> &mic) {
+    const int blocks = (int)far.size() / frameSize;
+    std::vector<int16_t> quiet(frameSize), out(frameSize);
+    for (int i = 0; i < 400; i++) {
+        int off = (i % blocks) * frameSize;
+        const int16_t *in = &mic[off];
+        if (i < 200) {
+            for (int j = 0; j < frameSize; j++) quiet[j] = mic[off + j] / 2;
+            in = &quiet[0];
+        }
+        speex_echo_cancellation(st, in, &far[off], &out[0]);
+    }
+    SpeexEchoTelemetry telemetry;
+    return speex_echo_ctl(st, SPEEX_ECHO_GET_TELEMETRY, &telemetry) == 0 && telemetry.adapted;
+}
+
+/* AEC followed by the mic preprocessor with residual echo suppression, either
+   re-analysing the echo estimate (classic) or reusing the AEC spectrum (fused) */
+void bench_aec_preprocess(int frameSize, int filterLength, int rate, bool fused) {
+    char name[64];
+    snprintf(name, sizeof(name), "aec+preprocess %d/%d@%d %s", frameSize, filterLength, rate,
+             fused ? "fused" : "classic");
+    if (!selected(name)) return;
+
+    const int blocks = 64;
+    std::vector<int16_t> far, mic, out(frameSize);
+    make_echo_signals(frameSize * blocks, frameSize / 2, far, mic);
+
+    SpeexEchoState *st = speex_echo_state_init(frameSize, filterLength);
+    speex_echo_ctl(st, SPEEX_ECHO_SET_SAMPLING_RATE, &rate);
+    if (!adapt_echo(st, frameSize, far, mic)) printf("%s: AEC not adapted\n", name);
+    SpeexPreprocessState *pp = speex_preprocess_state_init(frameSize, rate);
+    int on = fused ? 1 : 0;
+    speex_preprocess_ctl(pp, SPEEX_PREPROCESS_SET_ECHO_STATE, st);
+    speex_preprocess_ctl(pp, SPEEX_PREPROCESS_SET_ECHO_FUSED, &on);
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        int off = (i % blocks) * frameSize;
+        speex_echo_cancellation(st, &mic[off], &far[off], &out[0]);
+        speex_preprocess_run(pp, &out[0]);
+    }
+    report(name, g_frames, Clock::now() - start);
+    speex_preprocess_state_destroy(pp);
+    speex_echo_state_destroy(st);
+}
+
+/* The residual echo estimate alone, on an adapted AEC: what fused mode saves */
+void bench_echo_residual(int frameSize, int filterLength, int rate, bool fused) {
+    char name[64];
+    snprintf(name, sizeof(name), "echo residual %d/%d@%d %s", frameSize, filterLength, rate,
+             fused ? "fused" : "classic");
+    if (!selected(name)) return;
+
+    const int blocks = 64;
+    std::vector<int16_t> far, mic;
+    make_echo_signals(frameSize * blocks, frameSize / 2, far, mic);
+    std::vector<float> residual(frameSize + 1);
+
+    SpeexEchoState *st = speex_echo_state_init(frameSize, filterLength);
+    speex_echo_ctl(st, SPEEX_ECHO_SET_SAMPLING_RATE, &rate);
+    if (!adapt_echo(st, frameSize, far, mic)) printf("%s: AEC not adapted\n", name);
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        if (fused)
+            speex_echo_get_residual_fused(st, &residual[0], frameSize + 1);
+        else
+            speex_echo_get_residual(st, &residual[0], frameSize + 1);
+    }
+    report(name, g_frames, Clock::now() - start);
+    speex_echo_state_destroy(st);
+}
+
+/* Mic chain through the wrapper: fused AEC + preprocessor, then 16 -> 48 kHz.
+   The float run takes 32-bit I2S words in and out and stays in float between
+   the stages */
+void bench_pipeline(int frameSize, int filterLength, bool useFloat) {
+    char name[64];
+    snprintf(name, sizeof(name), "pipeline %d/%d@16000->48000 %s", frameSize, filterLength,
+             useFloat ? "float/i2s32" : "int16");
+    if (!selected(name)) return;
+
+    const int blocks = 64;
+    const int outMax = frameSize * 3 + 16;
+    std::vector<int16_t> far, mic, out(frameSize), up(outMax);
+    make_echo_signals(frameSize * blocks, frameSize / 2, far, mic);
+    std::vector<int32_t> mic32(mic.size()), far32(far.size()), up32(outMax);
+    std::vector<float> micf(frameSize), farf(frameSize), outf(frameSize), upf(outMax);
+    for (size_t i = 0; i < mic.size(); i++) {
+        mic32[i] = mic[i] * 65536;
+        far32[i] = far[i] * 65536;
+    }
+
+    ESP32SpeexDSP dsp;
+    dsp.beginAEC(frameSize, filterLength, 16000);
+    dsp.beginMicPreprocess(frameSize, 16000);
+    dsp.enableFusedAEC(true);
+    dsp.beginResampler(16000, 48000, 5);
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        int off = (i % blocks) * frameSize;
+        if (useFloat) {
+            ESP32SpeexDSP::i2sToFloat(&mic32[off], &micf[0], frameSize);
+            ESP32SpeexDSP::i2sToFloat(&far32[off], &farf[0], frameSize);
+            dsp.processAECFused(&micf[0], &farf[0], &outf[0]);
+            int n = dsp.resample(&outf[0], frameSize, &upf[0], outMax);
+            ESP32SpeexDSP::floatToI2S(&upf[0], &up32[0], n);
+        } else {
+            dsp.processAECFused(&mic[off], &far[off], &out[0]);
+            dsp.resample(&out[0], frameSize, &up[0], outMax);
+        }
+    }
+    report(name, g_frames, Clock::now() - start);
+}
+
+/* Re-creating a preprocessor while an echo canceller of the same frame size is alive
+   (as setFrameSize()/setSampleRate() do); the FFT tables come from the shared cache */
+void bench_state_init(int frameSize, int rate) {
+    char name[64];
+    snprintf(name, sizeof(name), "preprocess_state_init %d@%d", frameSize, rate);
+    if (!selected(name)) return;
+
+    SpeexEchoState *st = speex_echo_state_init(frameSize, frameSize * 10);
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        SpeexPreprocessState *pp = speex_preprocess_state_init(frameSize, rate);
+        speex_preprocess_state_destroy(pp);
+    }
+    report(name, g_frames, Clock::now() - start);
+    speex_echo_state_destroy(st);
+}
+
+/* Echo canceller create/destroy; the state arrays come from a single block */
+void bench_echo_init(int frameSize, int filterLength) {
+    char name[64];
+    snprintf(name, sizeof(name), "echo_state_init %d/%d", frameSize, filterLength);
+    if (!selected(name)) return;
+
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        SpeexEchoState *st = speex_echo_state_init(frameSize, filterLength);
+        speex_echo_state_destroy(st);
+    }
+    report(name, g_frames, Clock::now() - start);
+}
+
+/* Where an AEC + preprocessor pair lands with a given amount of internal RAM
+   (0 = unlimited), using the host model of the two memory tiers */
+void bench_mem_tiers(int frameSize, int filterLength, int rate, size_t internal) {
+    char name[64];
+    snprintf(name, sizeof(name), "mem_tiers %d/%d@%d internal=%zu", frameSize, filterLength, rate, internal);
+    if (!selected(name)) return;
+
+    SpeexMemTierStats stats;
+    speex_mem_tiers_set_capacity(internal);
+    speex_mem_tiers_reset_peaks();
+    SpeexEchoState *st = speex_echo_state_init(frameSize, filterLength);
+    SpeexPreprocessState *pp = speex_preprocess_state_init(frameSize, rate);
+    speex_mem_tiers_get_stats(&stats);
+    printf("%-40s %10zu B internal %10zu B psram %4d hot fallbacks\n", name,
+           stats.internal_used, stats.psram_used, stats.hot_fallbacks);
+    speex_preprocess_state_destroy(pp);
+    speex_echo_state_destroy(st);
+    speex_mem_tiers_set_capacity(0);
+}
+
+void bench_resampler(int inRate, int outRate, int quality) {
+    char name[64];
+    snprintf(name, sizeof(name), "resampler_process_int %d->%d q%d", inRate, outRate, quality);
+    if (!selected(name)) return;
+
+    /* 20 ms frames */
+    const int inLen = inRate / 50;
+    const int outMax = outRate / 50 + 16;
+    std::vector<int16_t> in(inLen), out(outMax);
+    Lcg rng(42);
+    for (int i = 0; i < inLen; i++) in[i] = rng.next(16000);
+
+    int err = 0;
+    SpeexResamplerState *st = speex_resampler_init(1, inRate, outRate, quality, &err);
+    if (!st) {
+        printf("%-40s init failed (%s)\n", name, speex_resampler_strerror(err));
+        return;
+    }
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        spx_uint32_t ilen = inLen, olen = outMax;
+        speex_resampler_process_int(st, 0, &in[0], &ilen, &out[0], &olen);
+    }
+    report(name, g_frames, Clock::now() - start);
+    speex_resampler_destroy(st);
+}
+
+/* Interleaved multichannel frames, all channels filtered in one pass */
+void bench_resampler_interleaved(int inRate, int outRate, int quality, int channels) {
+    char name[64];
+    snprintf(name, sizeof(name), "resampler_interleaved %d->%d q%d x%d", inRate, outRate, quality, channels);
+    if (!selected(name)) return;
+
+    const int inLen = inRate / 50;
+    const int outMax = outRate / 50 + 16;
+    std::vector<int16_t> in(inLen * channels), out(outMax * channels);
+    Lcg rng(42);
+    for (int i = 0; i < inLen * channels; i++) in[i] = rng.next(16000);
+
+    SpeexResamplerState *st = speex_resampler_init(channels, inRate, outRate, quality, NULL);
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        spx_uint32_t ilen = inLen, olen = outMax;
+        speex_resampler_process_interleaved_int(st, &in[0], &ilen, &out[0], &olen);
+    }
+    report(name, g_frames, Clock::now() - start);
+    speex_resampler_destroy(st);
+}
+
+/* Drift-tracking mode: interpolated filter, ratio steered every frame */
+void bench_resampler_drift(int inRate, int outRate, int quality) {
+    char name[64];
+    snprintf(name, sizeof(name), "resampler_drift %d->%d q%d", inRate, outRate, quality);
+    if (!selected(name)) return;
+
+    const int inLen = inRate / 50;
+    const int outMax = outRate / 50 + 16;
+    std::vector<int16_t> in(inLen), out(outMax);
+    Lcg rng(42);
+    for (int i = 0; i < inLen; i++) in[i] = rng.next(16000);
+
+    SpeexResamplerState *st = speex_resampler_init(1, inRate, outRate, quality, NULL);
+    speex_resampler_set_drift(st, 0);
+    /* Pretend the downstream buffer sits a little above its target */
+    int fill = outRate / 10;
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        spx_uint32_t ilen = inLen, olen = outMax;
+        speex_resampler_process_int(st, 0, &in[0], &ilen, &out[0], &olen);
+        speex_resampler_track_fill(st, fill + (i & 7), fill);
+    }
+    report(name, g_frames, Clock::now() - start);
+    speex_resampler_destroy(st);
+}
+
+/* Resampler create/destroy; cold drops the cached sinc table every time, so
+   only the rates and qualities in resample_tables.h skip computing it */
+void bench_resampler_init(int inRate, int outRate, int quality, bool cold) {
+    char name[64];
+    snprintf(name, sizeof(name), "resampler_init %d->%d q%d %s", inRate, outRate, quality, cold ? "cold" : "cached");
+    if (!selected(name)) return;
+
+    speex_resampler_cache_trim();
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        SpeexResamplerState *st = speex_resampler_init(1, inRate, outRate, quality, NULL);
+        speex_resampler_destroy(st);
+        if (cold) speex_resampler_cache_trim();
+    }
+    report(name, g_frames, Clock::now() - start);
+    speex_resampler_cache_trim();
+}
+
+void bench_jitter(int stepSize, bool pool) {
+    char name[64];
+    snprintf(name, sizeof(name), "jitter_buffer put/get step=%d%s", stepSize, pool ? " pool" : "");
+    if (!selected(name)) return;
+
+    std::vector<int16_t> payload(stepSize), out(stepSize);
+    JitterBuffer *jb = jitter_buffer_init(stepSize);
+    if (pool) {
+        spx_int32_t maxBytes = stepSize * sizeof(int16_t);
+        jitter_buffer_ctl(jb, JITTER_BUFFER_SET_MAX_PACKET_SIZE, &maxBytes);
+    }
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        /* Mildly reordered arrivals: swap every few packets */
+        int seq = (i % 5 == 3) ? i + 1 : (i % 5 == 4) ? i - 1 : i;
+        JitterBufferPacket p;
+        p.data = (char *)&payload[0];
+        p.len = stepSize * sizeof(int16_t);
+        p.timestamp = seq * stepSize;
+        p.span = stepSize;
+        p.sequence = (spx_uint16_t)seq;
+        p.user_data = 0;
+        jitter_buffer_put(jb, &p);
+
+        JitterBufferPacket q;
+        q.data = (char *)&out[0];
+        q.len = stepSize * sizeof(int16_t);
+        spx_int32_t offset;
+        jitter_buffer_get(jb, &q, stepSize, &offset);
+        jitter_buffer_tick(jb);
+    }
+    report(name, g_frames, Clock::now() - start);
+    jitter_buffer_destroy(jb);
+}
+
+/* Many streams ticked round robin, as on a gateway: every stream gets one 20 ms
+   packet per tick with network jitter (mostly on time, some up to 3 ticks late,
+   1% lost). Reported per stream tick. A group holds 16 packets per stream and
+   shares 8 payload slots per stream */
+void bench_jitter_streams(int streams, bool group) {
+    char name[64];
+    snprintf(name, sizeof(name), "jitter_buffer streams=%d%s", streams, group ? " group" : "");
+    if (!selected(name)) return;
+
+    const int stepSize = 160;
+    const int rounds = g_frames / 10 + 1;
+    struct Arrival { int tick; int seq; };
+    std::vector<Arrival> schedule;
+    Lcg rng(7);
+    for (int seq = 0; seq < rounds; seq++) {
+        int r = rng.next(100);
+        if (r < 0) r = -r;
+        if (r == 0) continue;
+        Arrival a = { seq + (r < 70 ? 0 : r < 90 ? 1 : r < 97 ? 2 : 3), seq };
+        schedule.push_back(a);
+    }
+    for (size_t i = 1; i < schedule.size(); i++) {
+        Arrival a = schedule[i];
+        size_t j = i;
+        for (; j > 0 && schedule[j - 1].tick > a.tick; j--) schedule[j] = schedule[j - 1];
+        schedule[j] = a;
+    }
+
+    std::vector<JitterBuffer *> jbs(streams);
+    JitterBufferGroup *jbg = NULL;
+    if (group) {
+        jbg = jitter_buffer_group_init(streams, stepSize, 16, streams * 8, stepSize * sizeof(int16_t));
+        for (int s = 0; s < streams; s++) jbs[s] = jitter_buffer_group_stream(jbg, s);
+    } else {
+        for (int s = 0; s < streams; s++) jbs[s] = jitter_buffer_init(stepSize);
+    }
+    std::vector<int16_t> payload(stepSize), out(stepSize);
+    size_t pos = 0;
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < rounds; r++) {
+        size_t end = pos;
+        while (end < schedule.size() && schedule[end].tick <= r) end++;
+        for (int s = 0; s < streams; s++) {
+            for (size_t k = pos; k < end; k++) {
+                JitterBufferPacket p;
+                p.data = (char *)&payload[0];
+                p.len = stepSize * sizeof(int16_t);
+                p.timestamp = schedule[k].seq * stepSize;
+                p.span = stepSize;
+                p.sequence = (spx_uint16_t)schedule[k].seq;
+                p.user_data = 0;
+                jitter_buffer_put(jbs[s], &p);
+            }
+            JitterBufferPacket q;
+            q.data = (char *)&out[0];
+            q.len = stepSize * sizeof(int16_t);
+            spx_int32_t offset;
+            jitter_buffer_get(jbs[s], &q, stepSize, &offset);
+            if (!group) jitter_buffer_tick(jbs[s]);
+        }
+        if (group) jitter_buffer_group_tick(jbg);
+        pos = end;
+    }
+    report(name, (long)rounds * streams, Clock::now() - start);
+    if (group) {
+        jitter_buffer_group_destroy(jbg);
+    } else {
+        for (int s = 0; s < streams; s++) jitter_buffer_destroy(jbs[s]);
+    }
+}
+
+void bench_buffer(int frameSize, bool spsc) {
+    char name[64];
+    snprintf(name, sizeof(name), "speex_buffer write/read %d%s", frameSize, spsc ? " spsc" : "");
+    if (!selected(name)) return;
+
+    std::vector<int16_t> in(frameSize), out(frameSize);
+    int bytes = frameSize * (int)sizeof(int16_t);
+    /* Odd capacity so that the copies regularly wrap around (SPSC rounds up to a power of two) */
+    SpeexBuffer *rb = spsc ? speex_buffer_init_spsc(bytes * 3 + 6) : speex_buffer_init(bytes * 3 + 6);
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        speex_buffer_write(rb, &in[0], bytes);
+        speex_buffer_read(rb, &out[0], bytes);
+    }
+    report(name, g_frames, Clock::now() - start);
+    speex_buffer_destroy(rb);
+}
+
+/* Same traffic as bench_buffer(), but the producer fills the free space in
+   place and the consumer processes the data where it lies (no copies) */
+void bench_buffer_spans(int frameSize, bool spsc) {
+    char name[64];
+    snprintf(name, sizeof(name), "speex_buffer spans %d%s", frameSize, spsc ? " spsc" : "");
+    if (!selected(name)) return;
+
+    int bytes = frameSize * (int)sizeof(int16_t);
+    SpeexBuffer *rb = spsc ? speex_buffer_init_spsc(bytes * 3 + 6) : speex_buffer_init(bytes * 3 + 6);
+    SpeexBufferSpan spans[2];
+    int32_t sum = 0;
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < g_frames; i++) {
+        int n = speex_buffer_acquire_write(rb, bytes, spans);
+        for (int s = 0; s < 2; s++)
+            memset(spans[s].data, i, spans[s].len);
+        speex_buffer_commit_write(rb, n);
+        n = speex_buffer_peek_read(rb, bytes, spans);
+        for (int s = 0; s < 2; s++)
+            for (int j = 0; j < spans[s].len; j++)
+                sum += spans[s].data[j];
+        speex_buffer_consume(rb, n);
+    }
+    report(name, g_frames, Clock::now() - start);
+    g_sink = sum;
+    speex_buffer_destroy(rb);
+}
+
+/* A capture thread feeding a processing thread, through a mutex-guarded
+   buffer or a lock-free SPSC one. Counts frames handed over. */
+void bench_buffer_threads(int frameSize, bool spsc) {
+    char name[64];
+    snprintf(name, sizeof(name), "speex_buffer 2 threads %d %s", frameSize, spsc ? "spsc" : "mutex");
+    if (!selected(name)) return;
+
+    int bytes = frameSize * (int)sizeof(int16_t);
+    SpeexBuffer *rb = spsc ? speex_buffer_init_spsc(bytes * 4) : speex_buffer_init(bytes * 4);
+    std::mutex lock;
+    const long total = (long)g_frames * 20;
+
+    Clock::time_point start = Clock::now();
+    std::thread producer([&]() {
+        std::vector<int16_t> in(frameSize);
+        for (long i = 0; i < total; i++) {
+            for (;;) {
+                if (spsc) {
+                    if (speex_buffer_get_available(rb) <= bytes * 3) {
+                        speex_buffer_write(rb, &in[0], bytes);
+                        break;
+                    }
+                } else {
+                    std::lock_guard<std::mutex> guard(lock);
+                    if (speex_buffer_get_available(rb) <= bytes * 3) {
+                        speex_buffer_write(rb, &in[0], bytes);
+                        break;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        }
+    });
+    std::vector<int16_t> out(frameSize);
+    for (long i = 0; i < total; i++) {
+        for (;;) {
+            if (spsc) {
+                if (speex_buffer_get_available(rb) >= bytes) {
+                    speex_buffer_read(rb, &out[0], bytes);
+                    break;
+                }
+            } else {
+                std::lock_guard<std::mutex> guard(lock);
+                if (speex_buffer_get_available(rb) >= bytes) {
+                    speex_buffer_read(rb, &out[0], bytes);
+                    break;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    report(name, total, Clock::now() - start);
+    speex_buffer_destroy(rb);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)
+            g_frames = atoi(argv[++i]);
+        else
+            g_filter = argv[i];
+    }
+    if (g_frames <= 0) g_frames = 1;
+
+    bench_echo(128, 1024, 8000);
+    bench_echo(160, 1600, 16000);
+    bench_echo(256, 3200, 16000);
+    bench_echo(480, 4800, 48000);
+    bench_echo_mc(256, 2048, 16000, 1, 1);
+    bench_echo_mc(256, 2048, 16000, 1, 2);
+    bench_echo_mc(256, 2048, 16000, 2, 1);
+    bench_echo_mc(256, 2048, 16000, 2, 2);
+    bench_echo_constraint(256, 3200, 16000, 1, 0);
+    bench_echo_constraint(256, 3200, 16000, 2, 0);
+    bench_echo_constraint(256, 3200, 16000, 4, 0);
+    bench_echo_constraint(256, 3200, 16000, 13, 0);
+    bench_echo_constraint(256, 3200, 16000, 2, 13);
+
+    bench_preprocess(160, 16000, false);
+    bench_preprocess(256, 16000, false);
+    bench_preprocess(256, 16000, true);
+    bench_preprocess(480, 48000, false);
+
+    bench_aec_preprocess(160, 1600, 16000, false);
+    bench_aec_preprocess(160, 1600, 16000, true);
+    bench_aec_preprocess(256, 3200, 16000, false);
+    bench_aec_preprocess(256, 3200, 16000, true);
+    bench_echo_residual(160, 1600, 16000, false);
+    bench_echo_residual(160, 1600, 16000, true);
+    bench_echo_residual(256, 3200, 16000, false);
+    bench_echo_residual(256, 3200, 16000, true);
+    bench_pipeline(160, 1600, false);
+    bench_pipeline(160, 1600, true);
+
+    bench_state_init(160, 16000);
+    bench_state_init(256, 16000);
+    bench_echo_init(160, 1600);
+    bench_echo_init(256, 3200);
+
+    bench_mem_tiers(160, 1600, 16000, 0);
+    bench_mem_tiers(256, 3200, 16000, 0);
+    bench_mem_tiers(256, 8192, 16000, 0);
+    bench_mem_tiers(256, 8192, 16000, 32768);
+
+    bench_resampler(48000, 16000, 5);
+    bench_resampler(48000, 16000, 10);
+    bench_resampler(16000, 48000, 5);
+    bench_resampler(16000, 8000, 5);
+    bench_resampler(44100, 16000, 5);
+    bench_resampler(44100, 16000, 10);
+    bench_resampler(16000, 48000, 10);
+    bench_resampler_interleaved(48000, 16000, 5, 2);
+    bench_resampler_interleaved(48000, 32000, 5, 2);
+    bench_resampler_interleaved(48000, 32000, 5, 4);
+    bench_resampler_interleaved(44100, 16000, 5, 2);
+    bench_resampler_drift(48000, 16000, 5);
+    bench_resampler_drift(16000, 48000, 5);
+    bench_resampler_init(48000, 16000, 5, true);
+    bench_resampler_init(44100, 16000, 5, true);
+    bench_resampler_init(48000, 16000, 10, true);
+    bench_resampler_init(48000, 16000, 10, false);
+    bench_resampler_init(44100, 16000, 10, true);
+    bench_resampler_init(44100, 16000, 10, false);
+
+    bench_jitter(160, false);
+    bench_jitter(160, true);
+    bench_jitter(320, false);
+    bench_jitter(320, true);
+    bench_jitter_streams(100, false);
+    bench_jitter_streams(2000, false);
+    bench_jitter_streams(2000, true);
+
+    bench_buffer(160, false);
+    bench_buffer(160, true);
+    bench_buffer(512, false);
+    bench_buffer(512, true);
+    bench_buffer_spans(160, false);
+    bench_buffer_spans(160, true);
+    bench_buffer_threads(160, false);
+    bench_buffer_threads(160, true);
+    return 0;
+}
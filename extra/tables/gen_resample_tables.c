@@ -0,0 +1,176 @@
+/* Generator for src/resample_tables.h
+
+   Builds the resampler filter tables for every pair of the given sample rates
+   at the given qualities, using the same code as the library, and prints them
+   as const arrays that update_filter() picks up instead of computing them.
+
+   Built by the top-level CMakeLists.txt on the host:
+      ./build/gen_resample_tables > src/resample_tables.h
+      ./build/gen_resample_tables -q 3,5,8 -r 16000,48000 > src/resample_tables.h
+
+   The tables are only used by the floating-point build. Identical tables (all
+   up-sampling ratios of the same quality with an interpolated filter, for
+   instance) are only emitted once.
+*/
+
+#define RESAMPLE_NO_BUILTIN_TABLES
+#include "../../src/resample.c"
+
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_LIST 16
+#define MAX_TABLES 512
+
+static const int default_rates[] = {8000, 16000, 24000, 32000, 44100, 48000};
+static const int default_qualities[] = {3, 4, 5};
+
+struct gen_table {
+   int quality;
+   spx_uint32_t num_rate;
+   spx_uint32_t den_rate;
+   int direct;
+   spx_uint32_t length;
+   const spx_word16_t *table;
+   int data;   /* index of the table whose array holds the data */
+};
+
+static int parse_list(const char *arg, int *list)
+{
+   int n = 0;
+   while (*arg && n < MAX_LIST)
+   {
+      char *end;
+      list[n++] = (int)strtol(arg, &end, 10);
+      arg = *end == ',' ? end+1 : end;
+      if (end == arg && *arg)
+         return -1;
+   }
+   return n;
+}
+
+int main(int argc, char **argv)
+{
+   int rates[MAX_LIST], qualities[MAX_LIST];
+   int nb_rates, nb_qualities;
+   static struct gen_table tables[MAX_TABLES];
+   SpeexResamplerState *states[MAX_TABLES];
+   int nb_tables = 0, nb_states = 0;
+   size_t bytes = 0;
+   int i, j, k;
+
+   nb_rates = sizeof(default_rates)/sizeof(default_rates[0]);
+   memcpy(rates, default_rates, sizeof(default_rates));
+   nb_qualities = sizeof(default_qualities)/sizeof(default_qualities[0]);
+   memcpy(qualities, default_qualities, sizeof(default_qualities));
+   for (i=1;i<argc;i++)
+   {
+      if (!strcmp(argv[i], "-r") && i+1 < argc)
+         nb_rates = parse_list(argv[++i], rates);
+      else if (!strcmp(argv[i], "-q") && i+1 < argc)
+         nb_qualities = parse_list(argv[++i], qualities);
+      else
+         nb_rates = -1;
+      if (nb_rates <= 0 || nb_qualities <= 0)
+      {
+         fprintf(stderr, "usage: %s [-q q1,q2,...] [-r rate1,rate2,...]\n", argv[0]);
+         return 1;
+      }
+   }
+
+   for (k=0;k<nb_qualities;k++)
+   {
+      for (i=0;i<nb_rates;i++)
+      {
+         for (j=0;j<nb_rates;j++)
+         {
+            SpeexResamplerState *st;
+            struct gen_table *t;
+            int m, err;
+            if (rates[i] == rates[j])
+               continue;
+            st = speex_resampler_init(1, rates[i], rates[j], qualities[k], &err);
+            if (!st)
+            {
+               fprintf(stderr, "%d->%d q%d: %s\n", rates[i], rates[j], qualities[k], speex_resampler_strerror(err));
+               return 1;
+            }
+            for (m=0;m<nb_tables;m++)
+               if (tables[m].quality == st->quality && tables[m].num_rate == st->num_rate
+                   && tables[m].den_rate == st->den_rate)
+                  break;
+            if (m < nb_tables)
+            {
+               speex_resampler_destroy(st);
+               continue;
+            }
+            if (nb_tables == MAX_TABLES)
+            {
+               fprintf(stderr, "too many tables\n");
+               return 1;
+            }
+            /* Keep the state alive so the cache keeps its table */
+            states[nb_states++] = st;
+            t = &tables[nb_tables];
+            t->quality = st->quality;
+            t->num_rate = st->num_rate;
+            t->den_rate = st->den_rate;
+            t->direct = st->sinc_entry->direct;
+            t->length = st->sinc_table_length;
+            t->table = st->sinc_table;
+            t->data = nb_tables;
+            for (m=0;m<nb_tables;m++)
+            {
+               if (tables[m].data == m && tables[m].length == t->length
+                   && !memcmp(tables[m].table, t->table, t->length*sizeof(spx_word16_t)))
+               {
+                  t->data = m;
+                  break;
+               }
+            }
+            if (t->data == nb_tables)
+               bytes += t->length*sizeof(spx_word16_t);
+            nb_tables++;
+         }
+      }
+   }
+
+   printf("/* File: resample_tables.h\n");
+   printf("   Precomputed resampler filter tables (%lu bytes)\n\n", (unsigned long)bytes);
+   printf("   Generated by extra/tables/gen_resample_tables.c, do not edit.\n");
+   printf("   Rates:");
+   for (i=0;i<nb_rates;i++)
+      printf(" %d", rates[i]);
+   printf("\n   Qualities:");
+   for (k=0;k<nb_qualities;k++)
+      printf(" %d", qualities[k]);
+   printf("\n*/\n\n");
+   printf("#ifndef RESAMPLE_TABLES_H\n#define RESAMPLE_TABLES_H\n\n");
+
+   for (i=0;i<nb_tables;i++)
+   {
+      spx_uint32_t n;
+      if (tables[i].data != i)
+         continue;
+      printf("static const spx_word16_t resample_table_%d[%lu] = {", i, (unsigned long)tables[i].length);
+      for (n=0;n<tables[i].length;n++)
+      {
+         if (n%6 == 0)
+            printf("\n  ");
+         /* 9 significant digits round-trip a float exactly */
+         printf(" %#.9gf,", tables[i].table[n]);
+      }
+      printf("\n};\n\n");
+   }
+
+   printf("static const struct builtin_sinc_table builtin_sinc_tables[] = {\n");
+   for (i=0;i<nb_tables;i++)
+      printf("   {%d, %lu, %lu, %d, %lu, resample_table_%d},\n", tables[i].quality,
+             (unsigned long)tables[i].num_rate, (unsigned long)tables[i].den_rate,
+             tables[i].direct, (unsigned long)tables[i].length, tables[i].data);
+   printf("};\n\n#endif\n");
+
+   for (i=0;i<nb_states;i++)
+      speex_resampler_destroy(states[i]);
+   return 0;
+}
@@ -0,0 +1,140 @@
+/* Host test: residual echo estimate of the fused post-filter (mdf.c)
+
+   An echo canceller runs on a synthetic echo: noise on the far end, played
+   through a decaying echo path, plus a little near-end noise on the
+   microphone. The echo path gets louder once, which is what takes the filter
+   out of its initial adaptation phase (before that, there is no estimate).
+   Once it has converged again, every frame is checked:
+     - With one microphone, the fused estimate (reusing the AEC spectrum) has
+       to match the classic one (windowing and transforming the echo again)
+       within 1 dB in total energy.
+     - With two microphones receiving the same signal, the fused estimate
+       has to match the one-microphone run within 1 dB. It describes one
+       microphone like the classic estimate, not the sum of all of them.
+*/
+
+#include "config.h"
+#include "arch.h"
+#include "speex/speex_echo.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* mdf.c, used by the preprocessor */
+void speex_echo_get_residual(SpeexEchoState *st, spx_word32_t *Yout, int len);
+void speex_echo_get_residual_fused(SpeexEchoState *st, spx_word32_t *Yout, int len);
+
+#define FRAME 160
+#define TAIL 1024
+#define RATE 16000
+#define PATH 256
+#define FRAMES 600
+#define CHANGE 150    /* Frame where the echo path changes */
+#define SKIP 400      /* Frames left to converge */
+#define TOLERANCE 1.f /* dB */
+
+static unsigned int seed;
+
+/* Roughly uniform in [-1, 1) */
+static float rnd(void)
+{
+   seed = seed*1103515245u + 12345u;
+   return (float)(int)(seed >> 8) / (float)(1 << 23) - 1.f;
+}
+
+static spx_int16_t clip16(float x)
+{
+   return (spx_int16_t)(x > 32767.f ? 32767 : x < -32768.f ? -32768 : floorf(x + .5f));
+}
+
+/* Total energy of the estimates over the checked frames, in dB: fused, and
+   classic (only with one microphone) */
+static int run(int channels, double *fused_db, double *classic_db)
+{
+   static float far_hist[PATH + FRAME];
+   static float path[PATH];
+   spx_int16_t far[FRAME], mic[FRAME*2], out[FRAME*2];
+   spx_word32_t fused[FRAME+1], classic[FRAME+1];
+   double fused_sum = 0, classic_sum = 0;
+   SpeexEchoState *st;
+   int rate = RATE;
+   int f, i, j, c;
+
+   seed = 1;
+   for (i=0;i<PATH;i++)
+      path[i] = .5f*rnd()*expf(-i/40.f);
+   for (i=0;i<PATH+FRAME;i++)
+      far_hist[i] = 0;
+
+   st = speex_echo_state_init_mc(FRAME, TAIL, channels, 1);
+   if (!st)
+      return 1;
+   speex_echo_ctl(st, SPEEX_ECHO_SET_SAMPLING_RATE, &rate);
+
+   for (f=0;f<FRAMES;f++)
+   {
+      for (i=0;i<PATH;i++)
+         far_hist[i] = far_hist[i+FRAME];
+      for (i=0;i<FRAME;i++)
+      {
+         far_hist[PATH+i] = 4000.f*rnd();
+         far[i] = clip16(far_hist[PATH+i]);
+      }
+      for (i=0;i<FRAME;i++)
+      {
+         float echo = 0;
+         for (j=0;j<PATH;j++)
+            echo += path[j]*far_hist[PATH+i-j];
+         if (f >= CHANGE)
+            echo *= 2.f;
+         echo += 30.f*rnd();
+         for (c=0;c<channels;c++)
+            mic[i*channels+c] = clip16(echo);
+      }
+      speex_echo_cancellation(st, mic, far, out);
+      if (f < SKIP)
+         continue;
+      /* The classic estimate overwrites the spectrum the fused one reads */
+      speex_echo_get_residual_fused(st, fused, FRAME+1);
+      if (channels == 1)
+         speex_echo_get_residual(st, classic, FRAME+1);
+      for (i=0;i<=FRAME;i++)
+      {
+         fused_sum += fused[i];
+         if (channels == 1)
+            classic_sum += classic[i];
+      }
+   }
+   speex_echo_state_destroy(st);
+   *fused_db = 10*log10(1 + fused_sum);
+   *classic_db = 10*log10(1 + classic_sum);
+   return 0;
+}
+
+int main(void)
+{
+   double fused1, classic1, fused2, unused;
+   int failures = 0;
+   if (run(1, &fused1, &classic1) || run(2, &fused2, &unused))
+   {
+      printf("echo_residual_test: out of memory\n");
+      return 1;
+   }
+   printf("echo_residual_test: 1 mic fused %.2f dB, classic %.2f dB; 2 mics fused %.2f dB\n",
+          fused1, classic1, fused2);
+   if (fabs(fused1 - classic1) > TOLERANCE)
+   {
+      printf("echo_residual_test: fused estimate off the classic one by %.2f dB\n", fused1 - classic1);
+      failures++;
+   }
+   if (fabs(fused2 - fused1) > TOLERANCE)
+   {
+      printf("echo_residual_test: 2-mic fused estimate off the 1-mic one by %.2f dB\n", fused2 - fused1);
+      failures++;
+   }
+   if (failures)
+      return 1;
+   printf("echo_residual_test: OK\n");
+   return 0;
+}
@@ -0,0 +1,500 @@
+/* Host test: jitter buffer against the reference implementation (jitter_ref.c)
+
+   The reference is jitter.c as originally imported, before the payload pool,
+   the timing bisection and the packet index. Randomized schedules are
+   replayed in lockstep on four buffers:
+     - the reference,
+     - a standalone buffer,
+     - two streams of a group holding 200 packets each, which must behave
+       exactly like standalone buffers.
+   The network side reorders, loses, duplicates (equal timestamps, so ties
+   between entries) and re-sends stale packets, starting close to the 32-bit
+   timestamp wrap-around. The consumer stalls now and then so that the buffers
+   fill up and evict their earliest packet, ties included. Every return value,
+   packet field, payload, start offset, pointer timestamp, available count and
+   destroy callback (in order) must match the reference. Copied payloads are
+   tested with and without payload pools, including undersized ones.
+
+   Warnings printed by the buffers themselves are expected.
+*/
+
+#include "config.h"
+#include "speex/speex_jitter.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* jitter_ref.c */
+JitterBuffer *ref_jitter_buffer_init(int step_size);
+void ref_jitter_buffer_reset(JitterBuffer *jitter);
+void ref_jitter_buffer_destroy(JitterBuffer *jitter);
+void ref_jitter_buffer_put(JitterBuffer *jitter, const JitterBufferPacket *packet);
+int ref_jitter_buffer_get(JitterBuffer *jitter, JitterBufferPacket *packet, spx_int32_t desired_span, spx_int32_t *start_offset);
+int ref_jitter_buffer_get_another(JitterBuffer *jitter, JitterBufferPacket *packet);
+int ref_jitter_buffer_update_delay(JitterBuffer *jitter, JitterBufferPacket *packet, spx_int32_t *start_offset);
+int ref_jitter_buffer_get_pointer_timestamp(JitterBuffer *jitter);
+void ref_jitter_buffer_tick(JitterBuffer *jitter);
+void ref_jitter_buffer_remaining_span(JitterBuffer *jitter, spx_uint32_t rem);
+int ref_jitter_buffer_ctl(JitterBuffer *jitter, int request, void *ptr);
+
+#define LANES 4          /* Reference, standalone, two group streams */
+#define MAX_LEN 64       /* Largest payload in bytes */
+#define MAX_PENDING 1024 /* Packets in flight on the network */
+#define MAX_LOG 256      /* Destroy callbacks between two checks */
+
+#define SCHEDULES 300
+#define TICKS 3000
+
+enum { MODE_COPY, MODE_POOL, MODE_DESTROY, MODES };
+
+typedef struct {
+   void (*reset)(JitterBuffer *);
+   void (*put)(JitterBuffer *, const JitterBufferPacket *);
+   int (*get)(JitterBuffer *, JitterBufferPacket *, spx_int32_t, spx_int32_t *);
+   int (*get_another)(JitterBuffer *, JitterBufferPacket *);
+   int (*update_delay)(JitterBuffer *, JitterBufferPacket *, spx_int32_t *);
+   int (*get_pointer_timestamp)(JitterBuffer *);
+   void (*remaining_span)(JitterBuffer *, spx_uint32_t);
+   int (*ctl)(JitterBuffer *, int, void *);
+} JitterApi;
+
+static const JitterApi ref_api = {
+   ref_jitter_buffer_reset, ref_jitter_buffer_put, ref_jitter_buffer_get,
+   ref_jitter_buffer_get_another, ref_jitter_buffer_update_delay,
+   ref_jitter_buffer_get_pointer_timestamp, ref_jitter_buffer_remaining_span,
+   ref_jitter_buffer_ctl
+};
+
+static const JitterApi new_api = {
+   jitter_buffer_reset, jitter_buffer_put, jitter_buffer_get,
+   jitter_buffer_get_another, jitter_buffer_update_delay,
+   jitter_buffer_get_pointer_timestamp, jitter_buffer_remaining_span,
+   jitter_buffer_ctl
+};
+
+static const char *lane_names[LANES] = {"reference", "standalone", "group stream 0", "group stream 1"};
+
+/* Payload: lane, 32-bit packet id, then bytes derived from the id */
+typedef struct {
+   spx_uint32_t id;
+   spx_uint32_t timestamp;
+   spx_uint32_t span;
+   int len;
+   int deliver;
+} Pending;
+
+typedef struct {
+   const JitterApi *api[LANES];
+   JitterBuffer *jb[LANES];
+   JitterBufferGroup *group;
+   int mode;
+   spx_uint32_t destroyed[LANES][MAX_LOG];
+   int nb_destroyed[LANES];
+   /* Payloads handed over with a destroy callback. A buffer doesn't take the
+      ones it rejects, so they are all freed at the end of the schedule */
+   char **payloads;
+   int nb_payloads;
+} Lanes;
+
+static Lanes *current;
+static unsigned int seed;
+static int failures;
+static int where_schedule, where_tick;
+
+static unsigned int rnd(void)
+{
+   seed = seed*1103515245u + 12345u;
+   return seed >> 8;
+}
+
+/* Uniform in [0, n) */
+static int rnd_below(int n)
+{
+   return (int)(rnd() % (unsigned int)n);
+}
+
+static spx_uint32_t payload_id(const char *data)
+{
+   spx_uint32_t id;
+   memcpy(&id, data+1, sizeof(id));
+   return id;
+}
+
+static void payload_fill(char *data, int lane, spx_uint32_t id, int len)
+{
+   int i;
+   data[0] = (char)lane;
+   memcpy(data+1, &id, sizeof(id));
+   for (i=5;i<len;i++)
+      data[i] = (char)(id*31u + i);
+}
+
+static void payload_destroy(void *data)
+{
+   int lane = ((char*)data)[0];
+   if (current->nb_destroyed[lane] < MAX_LOG)
+      current->destroyed[lane][current->nb_destroyed[lane]] = payload_id((char*)data);
+   current->nb_destroyed[lane]++;
+}
+
+static int fail(const char *what, int lane, long got, long expected)
+{
+   if (failures < 20)
+      printf("jitter_diff_test: schedule %d tick %d: %s of %s is %ld, reference %ld\n",
+             where_schedule, where_tick, what, lane_names[lane], got, expected);
+   failures++;
+   return 1;
+}
+
+/* Destroy callbacks since the last check, in the same order */
+static int check_destroyed(Lanes *l)
+{
+   int lane, i, bad = 0;
+   for (lane=1;lane<LANES && !bad;lane++)
+   {
+      if (l->nb_destroyed[lane] != l->nb_destroyed[0])
+         bad = fail("destroyed packet count", lane, l->nb_destroyed[lane], l->nb_destroyed[0]);
+      for (i=0;i<l->nb_destroyed[0] && i<MAX_LOG && !bad;i++)
+         if (l->destroyed[lane][i] != l->destroyed[0][i])
+            bad = fail("destroyed packet id", lane, l->destroyed[lane][i], l->destroyed[0][i]);
+   }
+   for (lane=0;lane<LANES;lane++)
+      l->nb_destroyed[lane] = 0;
+   return bad;
+}
+
+/* Results of a get()/get_another() on every lane against the reference */
+static int check_packets(const int *ret, JitterBufferPacket *pkt, const spx_int32_t *offset)
+{
+   int lane;
+   for (lane=1;lane<LANES;lane++)
+   {
+      if (ret[lane] != ret[0])
+         return fail("return value", lane, ret[lane], ret[0]);
+      if (pkt[lane].timestamp != pkt[0].timestamp)
+         return fail("timestamp", lane, (long)pkt[lane].timestamp, (long)pkt[0].timestamp);
+      if (pkt[lane].span != pkt[0].span)
+         return fail("span", lane, (long)pkt[lane].span, (long)pkt[0].span);
+      if (pkt[lane].len != pkt[0].len)
+         return fail("length", lane, (long)pkt[lane].len, (long)pkt[0].len);
+      if (pkt[lane].sequence != pkt[0].sequence)
+         return fail("sequence", lane, pkt[lane].sequence, pkt[0].sequence);
+      if (pkt[lane].user_data != pkt[0].user_data)
+         return fail("user data", lane, (long)pkt[lane].user_data, (long)pkt[0].user_data);
+      if (offset && offset[lane] != offset[0])
+         return fail("start offset", lane, offset[lane], offset[0]);
+      if ((pkt[lane].data == NULL) != (pkt[0].data == NULL))
+         return fail("data pointer set", lane, pkt[lane].data != NULL, pkt[0].data != NULL);
+      if (ret[0] == JITTER_BUFFER_OK && pkt[0].len > 1 &&
+          memcmp(pkt[lane].data+1, pkt[0].data+1, pkt[0].len-1) != 0)
+         return fail("payload of packet", lane, (long)pkt[lane].user_data, (long)pkt[0].user_data);
+   }
+   return 0;
+}
+
+/* Pointer timestamp, available count and the counters of the new buffers */
+static int check_state(Lanes *l)
+{
+   int lane;
+   spx_int32_t avail0, avail;
+   JitterBufferStats s1, s;
+   l->api[0]->ctl(l->jb[0], JITTER_BUFFER_GET_AVAILABLE_COUNT, &avail0);
+   for (lane=1;lane<LANES;lane++)
+   {
+      int ts = l->api[lane]->get_pointer_timestamp(l->jb[lane]);
+      int ts0 = l->api[0]->get_pointer_timestamp(l->jb[0]);
+      if (ts != ts0)
+         return fail("pointer timestamp", lane, ts, ts0);
+      l->api[lane]->ctl(l->jb[lane], JITTER_BUFFER_GET_AVAILABLE_COUNT, &avail);
+      if (avail != avail0)
+         return fail("available count", lane, avail, avail0);
+   }
+   /* Heap payloads depend on the pools, everything else is the same */
+   jitter_buffer_ctl(l->jb[1], JITTER_BUFFER_GET_STATS, &s1);
+   for (lane=2;lane<LANES;lane++)
+   {
+      jitter_buffer_ctl(l->jb[lane], JITTER_BUFFER_GET_STATS, &s);
+      if (s.received != s1.received || s.late != s1.late || s.dropped != s1.dropped ||
+          s.returned != s1.returned || s.missing != s1.missing || s.inserted != s1.inserted ||
+          s.buffered != s1.buffered)
+         return fail("counters (buffered packets)", lane, s.buffered, s1.buffered);
+   }
+   return 0;
+}
+
+static void put_all(Lanes *l, const Pending *p)
+{
+   static char copy[MAX_LEN];
+   int lane;
+   for (lane=0;lane<LANES;lane++)
+   {
+      JitterBufferPacket pkt;
+      if (l->mode == MODE_DESTROY)
+      {
+         pkt.data = (char*)malloc(p->len);
+         l->payloads = (char**)realloc(l->payloads, (l->nb_payloads+1)*sizeof(char*));
+         if (!pkt.data || !l->payloads)
+         {
+            printf("jitter_diff_test: out of memory\n");
+            exit(1);
+         }
+         l->payloads[l->nb_payloads++] = pkt.data;
+         payload_fill(pkt.data, lane, p->id, p->len);
+      } else {
+         /* Copied by the buffer, so the lane byte stays 0 */
+         pkt.data = copy;
+         payload_fill(pkt.data, 0, p->id, p->len);
+      }
+      pkt.len = p->len;
+      pkt.timestamp = p->timestamp;
+      pkt.span = p->span;
+      pkt.sequence = (spx_uint16_t)p->id;
+      pkt.user_data = p->id;
+      l->api[lane]->put(l->jb[lane], &pkt);
+   }
+}
+
+/* Returns the result of the reference */
+static int get_all(Lanes *l, int another, spx_int32_t desired_span, int with_offset, int cap)
+{
+   static char bufs[LANES][MAX_LEN];
+   JitterBufferPacket pkt[LANES];
+   spx_int32_t offset[LANES];
+   int ret[LANES];
+   int lane, bad;
+   for (lane=0;lane<LANES;lane++)
+   {
+      memset(&pkt[lane], 0, sizeof(pkt[lane]));
+      pkt[lane].data = bufs[lane];
+      pkt[lane].len = cap;
+      pkt[lane].timestamp = 0xdeadbeef;
+      pkt[lane].span = 0xdeadbeef;
+      offset[lane] = -12345;
+      if (another)
+         ret[lane] = l->api[lane]->get_another(l->jb[lane], &pkt[lane]);
+      else
+         ret[lane] = l->api[lane]->get(l->jb[lane], &pkt[lane], desired_span, with_offset ? &offset[lane] : NULL);
+   }
+   bad = check_packets(ret, pkt, offset);
+   return bad ? -1 : ret[0];
+}
+
+static void ctl_all(Lanes *l, int request, spx_int32_t value)
+{
+   int lane;
+   for (lane=0;lane<LANES;lane++)
+   {
+      spx_int32_t v = value;
+      l->api[lane]->ctl(l->jb[lane], request, &v);
+   }
+}
+
+static int run_schedule(int schedule)
+{
+   static Pending pending[MAX_PENDING];
+   static const int steps[] = {1, 20, 160, 320};
+   Lanes l;
+   int nb_pending = 0;
+   int lane, tick, i, bad = 0;
+   int step = steps[rnd_below(4)];
+   int max_delay = 1 + rnd_below(12);
+   int loss = rnd_below(15);         /* Percent */
+   int duplicates = rnd_below(15);   /* Percent */
+   int stale = rnd_below(5);         /* Percent */
+   int stall = 0, outage = 0;
+   spx_uint32_t id = 1;
+   /* Close to the wrap-around, or anywhere */
+   spx_uint32_t send_ts = rnd_below(2) ? 0u - (spx_uint32_t)step*(spx_uint32_t)rnd_below(400) : (spx_uint32_t)rnd()*256u;
+
+   memset(&l, 0, sizeof(l));
+   l.mode = schedule % MODES;
+   l.api[0] = &ref_api;
+   l.jb[0] = ref_jitter_buffer_init(step);
+   l.api[1] = &new_api;
+   l.jb[1] = jitter_buffer_init(step);
+   /* Undersized pools too: the overflow comes from the heap */
+   l.group = jitter_buffer_group_init(2, step, 200, l.mode == MODE_POOL ? 1 + rnd_below(400) : 0,
+                                      l.mode == MODE_POOL ? 8 + rnd_below(MAX_LEN) : 0);
+   l.api[2] = l.api[3] = &new_api;
+   l.jb[2] = jitter_buffer_group_stream(l.group, 0);
+   l.jb[3] = jitter_buffer_group_stream(l.group, 1);
+   if (!l.jb[0] || !l.jb[1] || !l.group)
+   {
+      printf("jitter_diff_test: out of memory\n");
+      exit(1);
+   }
+   if (l.mode == MODE_POOL)
+   {
+      spx_int32_t size = 8 + rnd_below(MAX_LEN);
+      jitter_buffer_ctl(l.jb[1], JITTER_BUFFER_SET_MAX_PACKET_SIZE, &size);
+   }
+   if (l.mode == MODE_DESTROY)
+      for (lane=0;lane<LANES;lane++)
+         l.api[lane]->ctl(l.jb[lane], JITTER_BUFFER_SET_DESTROY_CALLBACK, (void*)payload_destroy);
+   current = &l;
+   where_schedule = schedule;
+
+   for (tick=0;tick<TICKS && !bad;tick++)
+   {
+      where_tick = tick;
+
+      /* Sender: one packet per tick (more while the consumer stalls), none during an outage */
+      if (outage > 0)
+         outage--;
+      else if (rnd_below(500) == 0)
+         outage = 5 + rnd_below(40);
+      if (!outage)
+      {
+         int burst = stall ? 1 + rnd_below(3) : 1;
+         for (i=0;i<burst && nb_pending <= MAX_PENDING-3;i++)
+         {
+            int r = rnd_below(10);
+            Pending p;
+            p.id = id++;
+            p.timestamp = send_ts;
+            p.span = r == 0 ? 2*step : r == 1 && step > 1 ? step/2 : r == 2 ? 1 + rnd_below(2*step) : step;
+            p.len = 5 + rnd_below(MAX_LEN-4);
+            p.deliver = tick + rnd_below(max_delay);
+            send_ts += p.span;
+            if (rnd_below(100) >= loss)
+               pending[nb_pending++] = p;
+            /* Same timestamp again, maybe with another span */
+            if (rnd_below(100) < duplicates)
+            {
+               p.id = id++;
+               if (rnd_below(2))
+                  p.span = step + rnd_below(step);
+               p.deliver = tick + rnd_below(max_delay);
+               pending[nb_pending++] = p;
+            }
+            /* Long gone */
+            if (rnd_below(100) < stale)
+            {
+               p.id = id++;
+               p.timestamp = send_ts - (spx_uint32_t)step*(spx_uint32_t)(2 + rnd_below(300));
+               p.span = step;
+               p.deliver = tick;
+               pending[nb_pending++] = p;
+            }
+         }
+      }
+
+      /* Network: deliver what is due, in random order */
+      for (i=0;i<nb_pending;)
+      {
+         int j = i + rnd_below(nb_pending - i);
+         Pending p = pending[j];
+         pending[j] = pending[i];
+         pending[i] = p;
+         if (p.deliver <= tick)
+         {
+            put_all(&l, &p);
+            pending[i] = pending[--nb_pending];
+         } else {
+            i++;
+         }
+      }
+      bad = check_destroyed(&l);
+      if (bad)
+         break;
+
+      /* Receiver, which sometimes stops reading and lets the buffers fill up */
+      if (stall > 0)
+      {
+         stall--;
+         continue;
+      }
+      if (rnd_below(400) == 0)
+      {
+         stall = 50 + rnd_below(400);
+         continue;
+      }
+      {
+         int r = rnd_below(10);
+         spx_int32_t desired = r == 0 ? 2*step : r == 1 ? 1 + rnd_below(2*step) : step;
+         int cap = rnd_below(20) == 0 ? 5 + rnd_below(MAX_LEN-4) : MAX_LEN;
+         int ret = get_all(&l, 0, desired, rnd_below(20) != 0, cap);
+         if (ret < 0)
+            break;
+         /* Other packets starting at the same timestamp */
+         if (ret == JITTER_BUFFER_OK && rnd_below(3) == 0)
+            for (i=0;i<4 && ret == JITTER_BUFFER_OK;i++)
+               if ((ret = get_all(&l, 1, 0, 0, MAX_LEN)) < 0)
+                  break;
+         if (ret < 0)
+            break;
+      }
+      if (rnd_below(50) == 0)
+      {
+         spx_int32_t offset[LANES];
+         int ret[LANES];
+         for (lane=0;lane<LANES;lane++)
+            ret[lane] = l.api[lane]->update_delay(l.jb[lane], NULL, &offset[lane]);
+         for (lane=1;lane<LANES && !bad;lane++)
+            if (ret[lane] != ret[0])
+               bad = fail("update_delay()", lane, ret[lane], ret[0]);
+      }
+      if (rnd_below(10) == 0)
+      {
+         spx_uint32_t rem = rnd_below(step+1);
+         for (lane=0;lane<LANES;lane++)
+            l.api[lane]->remaining_span(l.jb[lane], rem);
+      } else {
+         ref_jitter_buffer_tick(l.jb[0]);
+         jitter_buffer_tick(l.jb[1]);
+         jitter_buffer_group_tick(l.group);
+      }
+
+      /* Settings and resets, rarely */
+      switch (rnd_below(1000))
+      {
+         case 0:
+            ctl_all(&l, JITTER_BUFFER_SET_MARGIN, rnd_below(2*step+1));
+            break;
+         case 1:
+            ctl_all(&l, JITTER_BUFFER_SET_LATE_COST, rnd_below(100));
+            break;
+         case 2:
+            ctl_all(&l, JITTER_BUFFER_SET_CONCEALMENT_SIZE, 1 + rnd_below(2*step));
+            break;
+         case 3:
+            ctl_all(&l, JITTER_BUFFER_SET_MAX_LATE_RATE, 1 + rnd_below(10));
+            break;
+         case 4:
+            ctl_all(&l, JITTER_BUFFER_SET_DELAY_STEP, 1 + rnd_below(2*step));
+            break;
+         case 5:
+            for (lane=0;lane<LANES;lane++)
+               l.api[lane]->reset(l.jb[lane]);
+            break;
+      }
+      bad = check_destroyed(&l) || check_state(&l);
+   }
+
+   ref_jitter_buffer_destroy(l.jb[0]);
+   jitter_buffer_destroy(l.jb[1]);
+   jitter_buffer_group_destroy(l.group);
+   if (!bad)
+      bad = check_destroyed(&l);
+   for (i=0;i<l.nb_payloads;i++)
+      free(l.payloads[i]);
+   free(l.payloads);
+   current = NULL;
+   return bad;
+}
+
+int main(void)
+{
+   int schedule;
+   seed = 12345;
+   for (schedule=0;schedule<SCHEDULES;schedule++)
+      run_schedule(schedule);
+   if (failures)
+   {
+      printf("jitter_diff_test: %d mismatches\n", failures);
+      return 1;
+   }
+   printf("jitter_diff_test: OK (%d schedules of %d ticks)\n", SCHEDULES, TICKS);
+   return 0;
+}
@@ -1,16 +1,20 @@
 #include "ESP32-SpeexDSP.h"
+#include "worker_pool.h"
 #include <cstring>
 #include <cmath>
+#ifdef ARDUINO
 #include <Arduino.h>
+#endif
 
 ESP32SpeexDSP::ESP32SpeexDSP() 
-    : echoState(nullptr), micPreprocessState(nullptr), speakerPreprocessState(nullptr), 
+    : echoState(nullptr), aecWorkers(nullptr), micPreprocessState(nullptr), speakerPreprocessState(nullptr), 
       jitterBuffer(nullptr), resampler(nullptr), ringBuffer(nullptr), frameSize(0), 
-      sampleRate(0), jitterStepSize(0), aecEnabled(false), resamplerInputRate(0), 
-      resamplerOutputRate(0), resamplerQuality(5) {}
+      sampleRate(0), aecChannels(1), aecCores(1), jitterStepSize(0), jitterMaxPacketSamples(0), aecEnabled(false), fusedAEC(false), resamplerInputRate(0), 
+      resamplerOutputRate(0), resamplerQuality(5), resamplerChannels(1) {}
 
 ESP32SpeexDSP::~ESP32SpeexDSP() {
     if (echoState) speex_echo_state_destroy(echoState);
+    delete aecWorkers;
     if (micPreprocessState) speex_preprocess_state_destroy(micPreprocessState);
     if (speakerPreprocessState) speex_preprocess_state_destroy(speakerPreprocessState);
     if (jitterBuffer) jitter_buffer_destroy(jitterBuffer);
@@ -18,21 +22,47 @@ ESP32SpeexDSP::~ESP32SpeexDSP() {
     if (ringBuffer) speex_buffer_destroy(ringBuffer);
 }
 
-// AEC (unchanged)
-bool ESP32SpeexDSP::beginAEC(int frameSize, int filterLength, int sampleRate, int channels) {
+// AEC
+bool ESP32SpeexDSP::beginAEC(int frameSize, int filterLength, int sampleRate, int channels, int cores) {
     if (echoState) {
         speex_echo_state_destroy(echoState);
         echoState = nullptr;
     }
     this->frameSize = frameSize;
     this->sampleRate = sampleRate;
+    aecChannels = channels;
+    aecCores = cores;
     echoState = speex_echo_state_init_mc(frameSize, filterLength, channels, channels);
+    linkFusedAEC();
     if (!echoState) return false;
     speex_echo_ctl(echoState, SPEEX_ECHO_SET_SAMPLING_RATE, &sampleRate);
+    if (!setupAECWorkers()) return false;
     aecEnabled = true;
     return true;
 }
 
+// Hands the worker pool to the echo canceller, starting it on first use. The
+// pool outlives AEC rebuilds; the output does not depend on the core count.
+// With one mic only the weight update can be split, and the hand-offs cost
+// more than that saves, so a single mic always runs on the calling core.
+bool ESP32SpeexDSP::setupAECWorkers() {
+    if (aecCores <= 1 || aecChannels <= 1) {
+        delete aecWorkers;
+        aecWorkers = nullptr;
+        return true;
+    }
+    if (!aecWorkers || aecWorkers->size() != aecCores) {
+        delete aecWorkers;
+        aecWorkers = SpeexWorkerPool::create(aecCores);
+        if (!aecWorkers) return false;
+    }
+    SpeexEchoParallel parallel;
+    parallel.workers = aecWorkers->size();
+    parallel.run = SpeexWorkerPool::run;
+    parallel.ctx = aecWorkers;
+    return speex_echo_ctl(echoState, SPEEX_ECHO_SET_PARALLEL, &parallel) == 0;
+}
+
 void ESP32SpeexDSP::enableAEC(bool enable) {
     aecEnabled = enable;
 }
@@ -41,7 +71,15 @@ void ESP32SpeexDSP::processAEC(int16_t *mic, int16_t *speaker, int16_t *out) {
     if (echoState && aecEnabled) {
         speex_echo_cancellation(echoState, mic, speaker, out);
     } else {
-        memcpy(out, mic, frameSize * sizeof(int16_t));
+        memcpy(out, mic, frameSize * aecChannels * sizeof(int16_t)); // Interleaved, all channels
+    }
+}
+
+void ESP32SpeexDSP::processAEC(float *mic, float *speaker, float *out) {
+    if (echoState && aecEnabled) {
+        speex_echo_cancellation_float(echoState, mic, speaker, out);
+    } else {
+        memcpy(out, mic, frameSize * aecChannels * sizeof(float));
     }
 }
 
@@ -49,6 +87,47 @@ SpeexEchoState* ESP32SpeexDSP::getEchoState() {
     return echoState;
 }
 
+bool ESP32SpeexDSP::getAECTelemetry(SpeexEchoTelemetry &telemetry) {
+    return echoState && speex_echo_ctl(echoState, SPEEX_ECHO_GET_TELEMETRY, &telemetry) == 0;
+}
+
+void ESP32SpeexDSP::resetAECTelemetry() {
+    if (echoState) speex_echo_ctl(echoState, SPEEX_ECHO_RESET_TELEMETRY, nullptr);
+}
+
+// Fused AEC + Mic preprocessing
+bool ESP32SpeexDSP::enableFusedAEC(bool enable) {
+    if (enable && (!echoState || !micPreprocessState)) return false;
+    if (!enable && fusedAEC && micPreprocessState) {
+        int off = 0;
+        speex_preprocess_ctl(micPreprocessState, SPEEX_PREPROCESS_SET_ECHO_STATE, nullptr);
+        speex_preprocess_ctl(micPreprocessState, SPEEX_PREPROCESS_SET_ECHO_FUSED, &off);
+    }
+    fusedAEC = enable;
+    linkFusedAEC();
+    return true;
+}
+
+void ESP32SpeexDSP::processAECFused(int16_t *mic, int16_t *speaker, int16_t *out) {
+    // The preprocessor reads the residual echo of this exact frame from the AEC,
+    // so both stages run back to back on the same buffer
+    processAEC(mic, speaker, out);
+    preprocessMicAudio(out);
+}
+
+void ESP32SpeexDSP::processAECFused(float *mic, float *speaker, float *out) {
+    processAEC(mic, speaker, out);
+    preprocessMicAudio(out);
+}
+
+// Keeps the mic preprocessor pointing at the current echo state whenever either is re-created
+void ESP32SpeexDSP::linkFusedAEC() {
+    if (!fusedAEC || !micPreprocessState) return;
+    int fused = echoState ? 1 : 0;
+    speex_preprocess_ctl(micPreprocessState, SPEEX_PREPROCESS_SET_ECHO_STATE, echoState);
+    speex_preprocess_ctl(micPreprocessState, SPEEX_PREPROCESS_SET_ECHO_FUSED, &fused);
+}
+
 // Preprocessing - Mic (unchanged)
 bool ESP32SpeexDSP::beginMicPreprocess(int frameSize, int sampleRate) {
     if (micPreprocessState) {
@@ -58,6 +137,7 @@ bool ESP32SpeexDSP::beginMicPreprocess(int frameSize, int sampleRate) {
     this->frameSize = frameSize;
     this->sampleRate = sampleRate;
     micPreprocessState = speex_preprocess_state_init(frameSize, sampleRate);
+    linkFusedAEC();
     return micPreprocessState != nullptr;
 }
 
@@ -67,6 +147,12 @@ void ESP32SpeexDSP::preprocessMicAudio(int16_t *inOut) {
     }
 }
 
+void ESP32SpeexDSP::preprocessMicAudio(float *inOut) {
+    if (micPreprocessState) {
+        speex_preprocess_run_float(micPreprocessState, inOut);
+    }
+}
+
 void ESP32SpeexDSP::enableMicNoiseSuppression(bool enable) {
     if (micPreprocessState) {
         int i = enable ? 1 : 0;
@@ -131,6 +217,12 @@ void ESP32SpeexDSP::preprocessSpeakerAudio(int16_t *inOut) {
     }
 }
 
+void ESP32SpeexDSP::preprocessSpeakerAudio(float *inOut) {
+    if (speakerPreprocessState) {
+        speex_preprocess_run_float(speakerPreprocessState, inOut);
+    }
+}
+
 void ESP32SpeexDSP::enableSpeakerNoiseSuppression(bool enable) {
     if (speakerPreprocessState) {
         int i = enable ? 1 : 0;
@@ -156,9 +248,28 @@ void ESP32SpeexDSP::enableSpeakerAGC(bool enable, float targetLevel) {
 }
 
 // Jitter Buffer (unchanged)
-bool ESP32SpeexDSP::beginJitterBuffer(int stepSizeMs) {
+bool ESP32SpeexDSP::beginJitterBuffer(int stepSizeMs, int maxPacketSamples) {
+    if (jitterBuffer) {
+        jitter_buffer_destroy(jitterBuffer);
+        jitterBuffer = nullptr;
+    }
     jitterStepSize = (sampleRate * stepSizeMs) / 1000;
+    jitterMaxPacketSamples = maxPacketSamples > 0 ? maxPacketSamples : 0;
+    return setupJitterBuffer();
+}
+
+// (Re)creates the jitter buffer for jitterStepSize, with the payload pool if one was asked for
+bool ESP32SpeexDSP::setupJitterBuffer() {
+    if (jitterBuffer) jitter_buffer_destroy(jitterBuffer);
     jitterBuffer = jitter_buffer_init(jitterStepSize);
+    if (jitterBuffer && jitterMaxPacketSamples > 0) {
+        // Preallocated payload slots: no malloc/free per packet
+        spx_int32_t maxBytes = jitterMaxPacketSamples * sizeof(int16_t);
+        if (jitter_buffer_ctl(jitterBuffer, JITTER_BUFFER_SET_MAX_PACKET_SIZE, &maxBytes) != 0) {
+            jitter_buffer_destroy(jitterBuffer);
+            jitterBuffer = nullptr;
+        }
+    }
     return jitterBuffer != nullptr;
 }
 
@@ -188,24 +299,23 @@ int ESP32SpeexDSP::getJitterPacket(int16_t *out, int len) {
 }
 
 // Resampler
-bool ESP32SpeexDSP::beginResampler(int inputRate, int outputRate, int quality) {
+bool ESP32SpeexDSP::beginResampler(int inputRate, int outputRate, int quality, int channels) {
     if (resampler) {
         speex_resampler_destroy(resampler);
         resampler = nullptr;
     }
     int err = 0;
-    resampler = speex_resampler_init(1, inputRate, outputRate, quality, &err);
+    resampler = speex_resampler_init(channels, inputRate, outputRate, quality, &err);
     resamplerInputRate = inputRate;
     resamplerOutputRate = outputRate;
     resamplerQuality = quality;
+    resamplerChannels = channels;
     return resampler != nullptr && err == 0;
 }
 
 void ESP32SpeexDSP::setResamplerQuality(int quality) {
-    if (resampler && quality >= 0 && quality <= 10) {
-        speex_resampler_destroy(resampler);
-        int err = 0;
-        resampler = speex_resampler_init(1, resamplerInputRate, resamplerOutputRate, quality, &err);
+    // Rebuilds the filter in place, keeping the drift-adjusted ratio
+    if (resampler && speex_resampler_set_quality(resampler, quality) == RESAMPLER_ERR_SUCCESS) {
         resamplerQuality = quality;
     }
 }
@@ -214,35 +324,81 @@ int ESP32SpeexDSP::resample(int16_t *in, int inLen, int16_t *out, int outLenMax)
     if (resampler) {
         uint32_t in_len = inLen;
         uint32_t out_len = outLenMax;
-        int err = speex_resampler_process_int(resampler, 0, in, &in_len, out, &out_len);
+        int err;
+        if (resamplerChannels > 1)
+            err = speex_resampler_process_interleaved_int(resampler, in, &in_len, out, &out_len);
+        else
+            err = speex_resampler_process_int(resampler, 0, in, &in_len, out, &out_len);
         if (err == 0) return out_len;
     }
     return 0;
 }
 
+int ESP32SpeexDSP::resample(float *in, int inLen, float *out, int outLenMax) {
+    if (resampler) {
+        uint32_t in_len = inLen;
+        uint32_t out_len = outLenMax;
+        int err;
+        if (resamplerChannels > 1)
+            err = speex_resampler_process_interleaved_float(resampler, in, &in_len, out, &out_len);
+        else
+            err = speex_resampler_process_float(resampler, 0, in, &in_len, out, &out_len);
+        if (err == 0) return out_len;
+    }
+    return 0;
+}
+
+bool ESP32SpeexDSP::setResamplerDrift(float ppm) {
+    if (!resampler) return false;
+    return speex_resampler_set_drift(resampler, (spx_int32_t)lrintf(ppm * 1000.0f)) == RESAMPLER_ERR_SUCCESS;
+}
+
+float ESP32SpeexDSP::trackResamplerDrift(int fillSamples, int targetSamples) {
+    if (!resampler) return 0.0f;
+    spx_int32_t ppb = 0;
+    speex_resampler_track_fill(resampler, fillSamples, targetSamples);
+    speex_resampler_get_drift(resampler, &ppb);
+    return ppb / 1000.0f;
+}
+
+float ESP32SpeexDSP::trackResamplerDrift(int targetSamples) {
+    return trackResamplerDrift(getBufferAvailable(), targetSamples);
+}
+
 // Ring Buffer (unchanged)
-bool ESP32SpeexDSP::beginBuffer(int bufferSize) {
+bool ESP32SpeexDSP::beginBuffer(int bufferSize, bool lockFree) {
     if (ringBuffer) {
         speex_buffer_destroy(ringBuffer);
         ringBuffer = nullptr;
     }
-    ringBuffer = speex_buffer_init(bufferSize * sizeof(int16_t));
+    if (lockFree) {
+        ringBuffer = speex_buffer_init_spsc(bufferSize * sizeof(int16_t));
+    } else {
+        ringBuffer = speex_buffer_init(bufferSize * sizeof(int16_t));
+    }
     return ringBuffer != nullptr;
 }
 
 bool ESP32SpeexDSP::resizeBuffer(int newBufferSize) {
     if (ringBuffer) {
-        speex_buffer_destroy(ringBuffer);
-        ringBuffer = speex_buffer_init(newBufferSize * sizeof(int16_t));
-        return ringBuffer != nullptr;
+        return speex_buffer_resize(ringBuffer, newBufferSize * sizeof(int16_t)) >= 0;
     }
     return false;
 }
 
-void ESP32SpeexDSP::writeBuffer(int16_t *data, int len) {
+bool ESP32SpeexDSP::setBufferMaxSize(int maxBufferSize) {
     if (ringBuffer) {
-        speex_buffer_write(ringBuffer, (char*)data, len * sizeof(int16_t));
+        return speex_buffer_set_max_size(ringBuffer, maxBufferSize * sizeof(int16_t)) == 0;
     }
+    return false;
+}
+
+int ESP32SpeexDSP::writeBuffer(int16_t *data, int len) {
+    if (ringBuffer) {
+        int bytesWritten = speex_buffer_write(ringBuffer, (char*)data, len * sizeof(int16_t));
+        return bytesWritten / sizeof(int16_t);
+    }
+    return 0;
 }
 
 int ESP32SpeexDSP::readBuffer(int16_t *out, int len) {
@@ -253,6 +409,87 @@ int ESP32SpeexDSP::readBuffer(int16_t *out, int len) {
     return 0;
 }
 
+int ESP32SpeexDSP::getBufferAvailable() {
+    if (ringBuffer) {
+        return speex_buffer_get_available(ringBuffer) / sizeof(int16_t);
+    }
+    return 0;
+}
+
+static int toBufferSpans(const SpeexBufferSpan *raw, ESP32SpeexDSP::BufferSpans &spans) {
+    spans.first = (int16_t*)raw[0].data;
+    spans.firstLen = raw[0].len / sizeof(int16_t);
+    spans.second = (int16_t*)raw[1].data;
+    spans.secondLen = raw[1].len / sizeof(int16_t);
+    return spans.firstLen + spans.secondLen;
+}
+
+int ESP32SpeexDSP::acquireBufferWrite(int len, BufferSpans &spans) {
+    SpeexBufferSpan raw[2] = {};
+    if (ringBuffer) {
+        speex_buffer_acquire_write(ringBuffer, len * sizeof(int16_t), raw);
+    }
+    return toBufferSpans(raw, spans);
+}
+
+int ESP32SpeexDSP::commitBufferWrite(int len) {
+    if (ringBuffer) {
+        return speex_buffer_commit_write(ringBuffer, len * sizeof(int16_t)) / sizeof(int16_t);
+    }
+    return 0;
+}
+
+int ESP32SpeexDSP::peekBufferRead(int len, BufferSpans &spans) {
+    SpeexBufferSpan raw[2] = {};
+    if (ringBuffer) {
+        speex_buffer_peek_read(ringBuffer, len * sizeof(int16_t), raw);
+    }
+    return toBufferSpans(raw, spans);
+}
+
+int ESP32SpeexDSP::consumeBuffer(int len) {
+    if (ringBuffer) {
+        return speex_buffer_consume(ringBuffer, len * sizeof(int16_t)) / sizeof(int16_t);
+    }
+    return 0;
+}
+
+// Stage timings
+bool ESP32SpeexDSP::getAECProfile(SpeexProfile &profile) {
+    return echoState && speex_echo_ctl(echoState, SPEEX_ECHO_GET_PROFILE, &profile) == 0;
+}
+
+bool ESP32SpeexDSP::getMicPreprocessProfile(SpeexProfile &profile) {
+    return micPreprocessState && speex_preprocess_ctl(micPreprocessState, SPEEX_PREPROCESS_GET_PROFILE, &profile) == 0;
+}
+
+bool ESP32SpeexDSP::getSpeakerPreprocessProfile(SpeexProfile &profile) {
+    return speakerPreprocessState && speex_preprocess_ctl(speakerPreprocessState, SPEEX_PREPROCESS_GET_PROFILE, &profile) == 0;
+}
+
+void ESP32SpeexDSP::resetProfiles() {
+    if (echoState) speex_echo_ctl(echoState, SPEEX_ECHO_RESET_PROFILE, nullptr);
+    if (micPreprocessState) speex_preprocess_ctl(micPreprocessState, SPEEX_PREPROCESS_RESET_PROFILE, nullptr);
+    if (speakerPreprocessState) speex_preprocess_ctl(speakerPreprocessState, SPEEX_PREPROCESS_RESET_PROFILE, nullptr);
+}
+
+// 32-bit I2S words carry the sample in the top bits; dividing by 65536 puts
+// the top 16 bits on the int16 scale and keeps the lower ones as a fraction
+void ESP32SpeexDSP::i2sToFloat(const int32_t *in, float *out, int len) {
+    for (int i = 0; i < len; i++) {
+        out[i] = in[i] * (1.0f / 65536.0f);
+    }
+}
+
+void ESP32SpeexDSP::floatToI2S(const float *in, int32_t *out, int len) {
+    for (int i = 0; i < len; i++) {
+        float v = in[i] * 65536.0f;
+        if (v >= 2147483647.0f) out[i] = INT32_MAX;
+        else if (v <= -2147483648.0f) out[i] = INT32_MIN;
+        else out[i] = (int32_t)lrintf(v);
+    }
+}
+
 bool ESP32SpeexDSP::setSampleRate(int newSampleRate, int aecFrameSize, int aecFilterLength) {
     bool success = true;
     int oldFrameSize = frameSize;
@@ -261,14 +498,14 @@ bool ESP32SpeexDSP::setSampleRate(int newSampleRate, int aecFrameSize, int aecFi
     sampleRate = newSampleRate;
 
     if (echoState) {
-        int channels = 1; // Default, could store as member
         speex_echo_state_destroy(echoState);
         echoState = nullptr;
         echoState = speex_echo_state_init_mc(aecFrameSize ? aecFrameSize : oldFrameSize,
                                              aecFilterLength ? aecFilterLength : oldFrameSize * 2,
-                                             channels, channels);
+                                             aecChannels, aecChannels);
         if (echoState) {
             speex_echo_ctl(echoState, SPEEX_ECHO_SET_SAMPLING_RATE, &sampleRate);
+            if (!setupAECWorkers()) success = false;
         } else {
             success = false;
         }
@@ -289,24 +526,25 @@ bool ESP32SpeexDSP::setSampleRate(int newSampleRate, int aecFrameSize, int aecFi
     }
 
     if (jitterBuffer) {
+        // Same durations at the new rate, keeping the payload pool
         jitterStepSize = (sampleRate * jitterStepSize) / oldSampleRate;
-        jitter_buffer_destroy(jitterBuffer);
-        jitterBuffer = jitter_buffer_init(jitterStepSize);
-        if (!jitterBuffer) success = false;
+        jitterMaxPacketSamples = (int)(((int64_t)sampleRate * jitterMaxPacketSamples + oldSampleRate - 1) / oldSampleRate);
+        if (!setupJitterBuffer()) success = false;
     }
 
+    linkFusedAEC();
     return success;
 }
 
 bool ESP32SpeexDSP::setFrameSize(int newFrameSize) {
     bool success = true;
     if (echoState) {
-        int channels = 1;
         int filterLength = newFrameSize * 2; // Example scaling
         speex_echo_state_destroy(echoState);
-        echoState = speex_echo_state_init_mc(newFrameSize, filterLength, channels, channels);
+        echoState = speex_echo_state_init_mc(newFrameSize, filterLength, aecChannels, aecChannels);
         if (echoState) {
             speex_echo_ctl(echoState, SPEEX_ECHO_SET_SAMPLING_RATE, &sampleRate);
+            if (!setupAECWorkers()) success = false;
         } else {
             success = false;
         }
@@ -323,5 +561,6 @@ bool ESP32SpeexDSP::setFrameSize(int newFrameSize) {
         if (!speakerPreprocessState) success = false;
     }
     frameSize = newFrameSize;
+    linkFusedAEC();
     return success;
 }
\ No newline at end of file
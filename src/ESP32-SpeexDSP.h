@@ -10,16 +10,24 @@
 #include "speex/speex_buffer.h"
 #include <stdint.h>
 
+class SpeexWorkerPool;
+
 class ESP32SpeexDSP {
 public:
     ESP32SpeexDSP();
     ~ESP32SpeexDSP();
 
-    // AEC
-    bool beginAEC(int frameSize, int filterLength, int sampleRate, int channels = 1);
+    // AEC (cores > 1 splits every frame across that many cores, e.g. 2 for a 2-mic array; ignored with 1 mic)
+    bool beginAEC(int frameSize, int filterLength, int sampleRate, int channels = 1, int cores = 1);
     void enableAEC(bool enable);
     void processAEC(int16_t *mic, int16_t *speaker, int16_t *out);
     SpeexEchoState* getEchoState();
+    bool getAECTelemetry(SpeexEchoTelemetry &telemetry); // ERLE, filter switches, resets, clipping
+    void resetAECTelemetry();
+
+    // Fused AEC + Mic preprocessing (residual echo taken from the AEC, no extra FFT)
+    bool enableFusedAEC(bool enable);
+    void processAECFused(int16_t *mic, int16_t *speaker, int16_t *out);
 
     // Preprocessing - Mic
     bool beginMicPreprocess(int frameSize, int sampleRate);
@@ -39,20 +47,58 @@ public:
     void enableSpeakerAGC(bool enable, float targetLevel = 0.9f);
 
     // Jitter Buffer
-    bool beginJitterBuffer(int stepSizeMs);
+    bool beginJitterBuffer(int stepSizeMs, int maxPacketSamples = 0); // > 0: pooled packets, no per-packet malloc
     void putJitterPacket(int16_t *data, int len, int timestamp);
     int getJitterPacket(int16_t *out, int len);
 
     // Resampler
-    bool beginResampler(int inputRate, int outputRate, int quality = 5);
+    bool beginResampler(int inputRate, int outputRate, int quality = 5, int channels = 1);
     void setResamplerQuality(int quality);
+    // Interleaved when channels > 1; lengths are in frames (samples per channel)
     int resample(int16_t *in, int inLen, int16_t *out, int outLenMax);
+    // Clock drift compensation: nudge the ratio by a few ppm without rebuilding the filter
+    bool setResamplerDrift(float ppm);                        // > 0 consumes input faster
+    float trackResamplerDrift(int fillSamples, int targetSamples); // Steer a buffer level to the target, returns ppm
+    float trackResamplerDrift(int targetSamples);             // Same, using the ring buffer level
 
-    // Ring Buffer
-    bool beginBuffer(int bufferSize);
-    bool resizeBuffer(int newBufferSize);
-    void writeBuffer(int16_t *data, int len);
+    // Ring Buffer (lockFree: one writer task and one reader task, no mutex needed;
+    // a full buffer then rejects new samples instead of dropping the oldest)
+    bool beginBuffer(int bufferSize, bool lockFree = false);
+    bool resizeBuffer(int newBufferSize);      // Keeps buffered samples (lock-free: call while idle)
+    bool setBufferMaxSize(int maxBufferSize);  // Grow on overflow up to this size, 0 = drop oldest
+    int writeBuffer(int16_t *data, int len);
     int readBuffer(int16_t *out, int len);
+    int getBufferAvailable();
+
+    // Zero-copy ring buffer access: up to two contiguous regions inside the
+    // buffer (the second one is only used when the region wraps around)
+    struct BufferSpans {
+        int16_t *first;
+        int firstLen;
+        int16_t *second;
+        int secondLen;
+    };
+    int acquireBufferWrite(int len, BufferSpans &spans); // Free space to fill in place
+    int commitBufferWrite(int len);                      // Publish samples written there
+    int peekBufferRead(int len, BufferSpans &spans);     // Buffered samples, left in place
+    int consumeBuffer(int len);                          // Drop samples after processing
+
+    // Float frames: same calls without the int16 round trip between stages. Samples
+    // use the 16-bit scale (full scale +/-32768) but are neither rounded nor clipped
+    void processAEC(float *mic, float *speaker, float *out);
+    void processAECFused(float *mic, float *speaker, float *out);
+    void preprocessMicAudio(float *inOut);
+    void preprocessSpeakerAudio(float *inOut);
+    int resample(float *in, int inLen, float *out, int outLenMax);
+    // 32-bit I2S samples (24-bit data left-justified) to and from that scale
+    static void i2sToFloat(const int32_t *in, float *out, int len);
+    static void floatToI2S(const float *in, int32_t *out, int len); // Saturates
+
+    // Stage timings (library built with SPEEXDSP_PROFILE, false otherwise)
+    bool getAECProfile(SpeexProfile &profile);
+    bool getMicPreprocessProfile(SpeexProfile &profile);
+    bool getSpeakerPreprocessProfile(SpeexProfile &profile);
+    void resetProfiles();
 
     // Utility
     bool setSampleRate(int newSampleRate, int aecFrameSize = 0, int aecFilterLength = 0);
@@ -60,6 +106,7 @@ public:
 
 private:
     SpeexEchoState *echoState;
+    SpeexWorkerPool *aecWorkers;
     SpeexPreprocessState *micPreprocessState; // Mic-specific
     SpeexPreprocessState *speakerPreprocessState; // Speaker-specific
     JitterBuffer *jitterBuffer;
@@ -67,11 +114,20 @@ private:
     SpeexBuffer *ringBuffer;
     int frameSize;
     int sampleRate;
+    int aecChannels;
+    int aecCores;
     int jitterStepSize;
+    int jitterMaxPacketSamples; // 0: no payload pool
     bool aecEnabled;
+    bool fusedAEC;
     int resamplerInputRate;
     int resamplerOutputRate;
     int resamplerQuality;
+    int resamplerChannels;
+
+    void linkFusedAEC();
+    bool setupAECWorkers();
+    bool setupJitterBuffer();
 };
 
 #endif
\ No newline at end of file
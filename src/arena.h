@@ -0,0 +1,67 @@
+/* File: arena.h
+   Single-block allocation for DSP states
+
+   A state lays out all of its arrays twice through the same code: first on a
+   measuring arena, which only adds up the (aligned) sizes, then on a real
+   arena that carves them out of one block. The block is either taken with
+   speex_alloc_tier() or supplied by the caller, in which case the state needs
+   no heap memory of its own.
+
+   States that separate hot and cold arrays lay them out on two arenas, one
+   block per memory tier. A caller-provided block holds both (the same arena
+   is passed twice).
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted under the same terms as the rest of SpeexDSP.
+*/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+#include <string.h>
+
+/** Alignment of every array carved from an arena (enough for 128-bit vectors) */
+#define SPEEX_ARENA_ALIGN 16
+
+typedef struct {
+   char *base;    /**< Start of the block, NULL while measuring */
+   size_t size;   /**< Usable bytes from base */
+   size_t used;   /**< Bytes handed out so far (including padding) */
+} SpeexArena;
+
+/** Start a measuring pass: allocations return NULL and only the footprint grows */
+static inline void speex_arena_measure(SpeexArena *a)
+{
+   a->base = NULL;
+   a->size = 0;
+   a->used = 0;
+}
+
+/** Start carving from a block of len bytes (which must come from speex_arena_footprint()) */
+static inline void speex_arena_init(SpeexArena *a, void *mem, size_t len)
+{
+   size_t pad = (SPEEX_ARENA_ALIGN - ((size_t)mem & (SPEEX_ARENA_ALIGN-1))) & (SPEEX_ARENA_ALIGN-1);
+   a->base = (char*)mem + pad;
+   a->size = len - pad;
+   a->used = 0;
+}
+
+/** Carve size bytes (zeroed if the block was). Returns NULL when measuring or out of space */
+static inline void *speex_arena_alloc(SpeexArena *a, size_t size)
+{
+   void *ptr = NULL;
+   a->used = (a->used + SPEEX_ARENA_ALIGN-1) & ~(size_t)(SPEEX_ARENA_ALIGN-1);
+   if (a->base && a->used + size <= a->size)
+      ptr = a->base + a->used;
+   a->used += size;
+   return ptr;
+}
+
+/** Block size needed for everything measured so far, with room to align an arbitrary block (0 if nothing was) */
+static inline size_t speex_arena_footprint(const SpeexArena *a)
+{
+   return a->used ? a->used + SPEEX_ARENA_ALIGN-1 : 0;
+}
+
+#endif
@@ -2,7 +2,9 @@
 
    File: buffer.c
    This is a very simple ring buffer implementation. It is not thread-safe
-   so you need to do your own locking.
+   so you need to do your own locking, except for buffers created with
+   speex_buffer_init_spsc(), which one producer and one consumer can use
+   concurrently without locks.
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -44,8 +46,29 @@ struct SpeexBuffer_ {
    int   read_ptr;
    int   write_ptr;
    int   available;
+   int   max_size;   /* Writes that do not fit grow the buffer up to this size (0 = never grow) */
+
+   /* Lock-free single-producer/single-consumer mode. The indices run freely
+      and are masked into the (power of two) buffer; head is only written by
+      the producer and tail only by the consumer, so available() is head-tail
+      and nothing is shared read-modify-write. */
+   int   spsc;
+   spx_uint32_t mask;
+   spx_uint32_t head;
+   spx_uint32_t tail;
 };
 
+/* The producer publishes head with a release store after filling the data and
+   the consumer loads it with acquire before reading it (and the other way
+   around for tail), which is all the ordering an SPSC ring needs */
+#if defined(__GNUC__) || defined(__clang__)
+#define spsc_load(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define spsc_store(p,v)  __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+#define spsc_load(p)     (*(volatile spx_uint32_t*)(p))
+#define spsc_store(p,v)  (*(volatile spx_uint32_t*)(p) = (v))
+#endif
+
 EXPORT SpeexBuffer *speex_buffer_init(int size)
 {
    SpeexBuffer *st = speex_alloc(sizeof(SpeexBuffer));
@@ -54,9 +77,87 @@ EXPORT SpeexBuffer *speex_buffer_init(int size)
    st->read_ptr = 0;
    st->write_ptr = 0;
    st->available = 0;
+   st->max_size = 0;
+   st->spsc = 0;
+   return st;
+}
+
+EXPORT SpeexBuffer *speex_buffer_init_spsc(int size)
+{
+   SpeexBuffer *st;
+   int capacity = 1;
+   if (size <= 0 || size > (1<<30))
+      return NULL;
+   while (capacity < size)
+      capacity <<= 1;
+   st = speex_buffer_init(capacity);
+   if (!st)
+      return NULL;
+   st->spsc = 1;
+   st->mask = capacity-1;
+   st->head = 0;
+   st->tail = 0;
    return st;
 }
 
+/* Grows a classic buffer (doubling, up to max_size) so that len more bytes fit.
+   If that is not possible the caller falls back to overwriting old data. */
+static void buffer_grow(SpeexBuffer *st, int len)
+{
+   int need = st->available + len;
+   int size = st->size;
+   if (need <= size || size >= st->max_size)
+      return;
+   while (size < need && size < st->max_size)
+      size = size > st->max_size/2 ? st->max_size : 2*size;
+   speex_buffer_resize(st, size);
+}
+
+/* SPSC producer side: copies (or zeroes if data is NULL) as much as fits */
+static int spsc_write(SpeexBuffer *st, const char *data, int len)
+{
+   spx_uint32_t head = st->head;
+   int room = st->size - (int)(head - spsc_load(&st->tail));
+   int pos, first;
+   if (len > room)
+      len = room;
+   pos = head & st->mask;
+   first = st->size - pos;
+   if (first > len)
+      first = len;
+   if (data)
+   {
+      SPEEX_COPY(st->data + pos, data, first);
+      SPEEX_COPY(st->data, data + first, len - first);
+   } else {
+      SPEEX_MEMSET(st->data + pos, 0, first);
+      SPEEX_MEMSET(st->data, 0, len - first);
+   }
+   spsc_store(&st->head, head + len);
+   return len;
+}
+
+/* SPSC consumer side: same contract as speex_buffer_read() */
+static int spsc_read(SpeexBuffer *st, char *data, int len)
+{
+   spx_uint32_t tail = st->tail;
+   int avail = (int)(spsc_load(&st->head) - tail);
+   int pos, first;
+   if (len > avail)
+   {
+      SPEEX_MEMSET(data+avail, 0, len - avail);
+      len = avail;
+   }
+   pos = tail & st->mask;
+   first = st->size - pos;
+   if (first > len)
+      first = len;
+   SPEEX_COPY(data, st->data + pos, first);
+   SPEEX_COPY(data + first, st->data, len - first);
+   spsc_store(&st->tail, tail + len);
+   return len;
+}
+
 EXPORT void speex_buffer_destroy(SpeexBuffer *st)
 {
    speex_free(st->data);
@@ -68,6 +169,10 @@ EXPORT int speex_buffer_write(SpeexBuffer *st, void *_data, int len)
    int end;
    int end1;
    char *data = _data;
+   if (st->spsc)
+      return spsc_write(st, data, len);
+   if (st->max_size)
+      buffer_grow(st, len);
    if (len > st->size)
    {
       data += len-st->size;
@@ -83,15 +188,16 @@ EXPORT int speex_buffer_write(SpeexBuffer *st, void *_data, int len)
       end -= st->size;
       SPEEX_COPY(st->data, data+end1 - st->write_ptr, end);
    }
+   st->write_ptr += len;
+   if (st->write_ptr > st->size)
+      st->write_ptr -= st->size;
    st->available += len;
    if (st->available > st->size)
    {
+      /* Overwrote the oldest data: it now starts right after what was just written */
       st->available = st->size;
       st->read_ptr = st->write_ptr;
    }
-   st->write_ptr += len;
-   if (st->write_ptr > st->size)
-      st->write_ptr -= st->size;
    return len;
 }
 
@@ -101,6 +207,10 @@ EXPORT int speex_buffer_writezeros(SpeexBuffer *st, int len)
    SPEEX_MEMSET() instead of SPEEX_COPY(). Update accordingly. */
    int end;
    int end1;
+   if (st->spsc)
+      return spsc_write(st, NULL, len);
+   if (st->max_size)
+      buffer_grow(st, len);
    if (len > st->size)
    {
       len = st->size;
@@ -115,15 +225,16 @@ EXPORT int speex_buffer_writezeros(SpeexBuffer *st, int len)
       end -= st->size;
       SPEEX_MEMSET(st->data, 0, end);
    }
+   st->write_ptr += len;
+   if (st->write_ptr > st->size)
+      st->write_ptr -= st->size;
    st->available += len;
    if (st->available > st->size)
    {
+      /* Overwrote the oldest data: it now starts right after what was just written */
       st->available = st->size;
       st->read_ptr = st->write_ptr;
    }
-   st->write_ptr += len;
-   if (st->write_ptr > st->size)
-      st->write_ptr -= st->size;
    return len;
 }
 
@@ -131,6 +242,8 @@ EXPORT int speex_buffer_read(SpeexBuffer *st, void *_data, int len)
 {
    int end, end1;
    char *data = _data;
+   if (st->spsc)
+      return spsc_read(st, data, len);
    if (len > st->available)
    {
       SPEEX_MEMSET(data+st->available, 0, len - st->available);
@@ -156,19 +269,159 @@ EXPORT int speex_buffer_read(SpeexBuffer *st, void *_data, int len)
 
 EXPORT int speex_buffer_get_available(SpeexBuffer *st)
 {
+   if (st->spsc)
+   {
+      /* Load tail first: head can only move forward meanwhile, never past tail+size */
+      spx_uint32_t tail = spsc_load(&st->tail);
+      return (int)(spsc_load(&st->head) - tail);
+   }
    return st->available;
 }
 
-EXPORT int speex_buffer_resize(SpeexBuffer *st, int len)
+/* Describes len bytes starting at offset pos as (at most) two contiguous spans */
+static int buffer_spans(SpeexBuffer *st, int pos, int len, SpeexBufferSpan *spans)
 {
-   int old_len = st->size;
-   if (len > old_len)
+   int first = st->size - pos;
+   if (first > len)
+      first = len;
+   spans[0].data = st->data + pos;
+   spans[0].len = first;
+   spans[1].data = st->data;
+   spans[1].len = len - first;
+   return len;
+}
+
+EXPORT int speex_buffer_acquire_write(SpeexBuffer *st, int len, SpeexBufferSpan *spans)
+{
+   int room, pos;
+   if (st->spsc)
    {
-      st->data = speex_realloc(st->data, len);
-      /* FIXME: move data/pointers properly for growing the buffer */
+      room = st->size - (int)(st->head - spsc_load(&st->tail));
+      pos = st->head & st->mask;
    } else {
-      /* FIXME: move data/pointers properly for shrinking the buffer */
-      st->data = speex_realloc(st->data, len);
+      if (st->max_size)
+         buffer_grow(st, len);
+      room = st->size - st->available;
+      pos = st->write_ptr;
    }
+   if (pos >= st->size)
+      pos -= st->size;
+   if (len > room)
+      len = room;
+   if (len < 0)
+      len = 0;
+   return buffer_spans(st, pos, len, spans);
+}
+
+EXPORT int speex_buffer_commit_write(SpeexBuffer *st, int len)
+{
+   if (st->spsc)
+   {
+      int room = st->size - (int)(st->head - spsc_load(&st->tail));
+      if (len > room)
+         len = room;
+      spsc_store(&st->head, st->head + len);
+      return len;
+   }
+   if (len > st->size - st->available)
+      len = st->size - st->available;
+   st->available += len;
+   st->write_ptr += len;
+   if (st->write_ptr > st->size)
+      st->write_ptr -= st->size;
    return len;
 }
+
+EXPORT int speex_buffer_peek_read(SpeexBuffer *st, int len, SpeexBufferSpan *spans)
+{
+   int avail, pos;
+   if (st->spsc)
+   {
+      avail = (int)(spsc_load(&st->head) - st->tail);
+      pos = st->tail & st->mask;
+   } else {
+      avail = st->available;
+      pos = st->read_ptr;
+   }
+   if (pos >= st->size)
+      pos -= st->size;
+   if (len > avail)
+      len = avail;
+   if (len < 0)
+      len = 0;
+   return buffer_spans(st, pos, len, spans);
+}
+
+EXPORT int speex_buffer_consume(SpeexBuffer *st, int len)
+{
+   if (st->spsc)
+   {
+      int avail = (int)(spsc_load(&st->head) - st->tail);
+      if (len > avail)
+         len = avail;
+      spsc_store(&st->tail, st->tail + len);
+      return len;
+   }
+   if (len > st->available)
+      len = st->available;
+   st->available -= len;
+   st->read_ptr += len;
+   if (st->read_ptr > st->size)
+      st->read_ptr -= st->size;
+   return len;
+}
+
+EXPORT int speex_buffer_resize(SpeexBuffer *st, int len)
+{
+   SpeexBufferSpan spans[2];
+   char *data;
+   int avail, keep;
+   if (len <= 0 || len > (1<<30))
+      return -1;
+   if (st->spsc)
+   {
+      int capacity = 1;
+      while (capacity < len)
+         capacity <<= 1;
+      len = capacity;
+   }
+   data = speex_alloc(len);
+   if (!data)
+      return -1;
+
+   /* Shrinking below the buffered amount drops the oldest data, like an overflowing write */
+   avail = speex_buffer_get_available(st);
+   keep = avail < len ? avail : len;
+   speex_buffer_consume(st, avail - keep);
+   /* Unwrap what is left to the start of the new storage */
+   speex_buffer_peek_read(st, keep, spans);
+   SPEEX_COPY(data, spans[0].data, spans[0].len);
+   SPEEX_COPY(data + spans[0].len, spans[1].data, spans[1].len);
+   speex_free(st->data);
+
+   st->data = data;
+   st->size = len;
+   st->read_ptr = 0;
+   st->write_ptr = keep;
+   st->available = keep;
+   if (st->spsc)
+   {
+      st->mask = len-1;
+      st->tail = 0;
+      st->head = keep;
+   }
+   if (st->max_size && st->max_size < len)
+      st->max_size = len;
+   return len;
+}
+
+EXPORT int speex_buffer_set_max_size(SpeexBuffer *st, int max_size)
+{
+   if (st->spsc && max_size)
+   {
+      speex_warning("SPSC buffers cannot grow while in use");
+      return -1;
+   }
+   st->max_size = max_size > st->size ? max_size : 0;
+   return 0;
+}
@@ -6,10 +6,33 @@
 #define FLOATING_POINT 1       // Use floating-point arithmetic
 #define USE_KISS_FFT 1         // Enable Kiss FFT
 #define EXPORT                 // Empty EXPORT for no DLL exports
+#define RESAMPLE_BUILTIN_TABLES 1 // Resampler filters for common rates from flash (resample_tables.h)
+
+// Vectorised resampler kernels, picked from the compiler's target flags.
+// Define DISABLE_SIMD to build the plain C loops instead.
+#ifndef DISABLE_SIMD
+#if defined(__SSE__)
+#define USE_SSE 1              // resample_sse.h
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define USE_NEON 1             // resample_neon.h
+#elif defined(__XTENSA__)
+#define USE_XTENSA_FPU 1       // resample_xtensa.h
+#endif
+#endif
+
+// Per-stage timing counters in the echo canceller and preprocessor, read with
+// SPEEX_ECHO_GET_PROFILE / SPEEX_PREPROCESS_GET_PROFILE. Off: no cost at all.
+//#define SPEEXDSP_PROFILE 1
 
 // Optional ESP32-specific options
+// SPEEXDSP_HOST_BUILD is set by the CMake host build (see CMakeLists.txt) so the
+// library can be compiled and benchmarked on a PC with the plain libc allocator.
+#ifndef SPEEXDSP_HOST_BUILD
 #define USE_PSRAM 1            // Use PSRAM for allocations if available
 //#define USE_FREERTOS_HEAP 1    // Use FreeRTOS heap (pvPortMalloc/vPortFree)
+#ifndef ESP_PLATFORM
 #define ESP_PLATFORM 1
+#endif
+#endif
 
-#endif /* CONFIG_H */
\ No newline at end of file
+#endif /* CONFIG_H */
@@ -36,6 +36,7 @@
 
 #include "arch.h"
 #include "os_support.h"
+#include "fftwrap.h"
 
 #define MAX_FFT_SIZE 2048
 
@@ -293,28 +294,154 @@ void spx_ifft(void *table, spx_word16_t *in, spx_word16_t *out)
 #include "kiss_fftr.h"
 #include "kiss_fft.h"
 
+/* Twiddles and factors for one FFT size, shared by every state using that size */
+struct kiss_plan {
+   kiss_fftr_cfg forward;
+   kiss_fftr_cfg backward;
+   int N;
+   int refcount;
+   struct kiss_plan *next;
+};
+
 struct kiss_config {
    kiss_fftr_cfg forward;
    kiss_fftr_cfg backward;
    int N;
+   struct kiss_plan *plan;
+   int in_arena;
 };
 
+static struct kiss_plan *kiss_plans = NULL;
+static speex_lock_t kiss_plans_lock = SPEEX_LOCK_INITIALIZER;
+
+/* Must be called with kiss_plans_lock held */
+static struct kiss_plan *kiss_plan_acquire(int size)
+{
+   struct kiss_plan *plan;
+   for (plan=kiss_plans;plan;plan=plan->next)
+   {
+      if (plan->N == size)
+      {
+         plan->refcount++;
+         return plan;
+      }
+   }
+   return NULL;
+}
+
+static void kiss_plan_free(struct kiss_plan *plan)
+{
+   speex_free_tier(plan->forward);
+   speex_free_tier(plan->backward);
+   speex_free(plan);
+}
+
+/* The twiddles are read on every transform, so they go to the fast tier */
+static kiss_fftr_cfg kiss_plan_alloc(int size, int inverse)
+{
+   size_t len = 0;
+   void *mem;
+   kiss_fftr_alloc(size,inverse,NULL,&len);
+   mem = speex_alloc_tier(len, SPEEX_MEM_HOT);
+   if (!mem)
+      return NULL;
+   return kiss_fftr_alloc(size,inverse,mem,&len);
+}
+
+/* Returns the shared plan for this size, creating it if needed */
+static struct kiss_plan *kiss_plan_get(int size)
+{
+   struct kiss_plan *plan, *fresh=NULL;
+
+   speex_lock(&kiss_plans_lock);
+   plan = kiss_plan_acquire(size);
+   speex_unlock(&kiss_plans_lock);
+   if (!plan)
+   {
+      /* Build the tables outside the lock, then check nobody beat us to it */
+      fresh = (struct kiss_plan*)speex_alloc(sizeof(struct kiss_plan));
+      fresh->forward = kiss_plan_alloc(size,0);
+      fresh->backward = kiss_plan_alloc(size,1);
+      fresh->N = size;
+      fresh->refcount = 1;
+      speex_lock(&kiss_plans_lock);
+      plan = kiss_plan_acquire(size);
+      if (!plan)
+      {
+         fresh->next = kiss_plans;
+         kiss_plans = fresh;
+         plan = fresh;
+         fresh = NULL;
+      }
+      speex_unlock(&kiss_plans_lock);
+      if (fresh)
+         kiss_plan_free(fresh);
+   }
+   return plan;
+}
+
+static void kiss_plan_release(struct kiss_plan *plan)
+{
+   struct kiss_plan **p;
+   speex_lock(&kiss_plans_lock);
+   if (--plan->refcount == 0)
+   {
+      for (p=&kiss_plans;*p!=plan;p=&(*p)->next);
+      *p = plan->next;
+   } else {
+      plan = NULL;
+   }
+   speex_unlock(&kiss_plans_lock);
+   if (plan)
+      kiss_plan_free(plan);
+}
+
 void *spx_fft_init(int size)
 {
    struct kiss_config *table;
+   struct kiss_plan *plan = kiss_plan_get(size);
+
+   /* Each user gets its own scratch space so that states can run concurrently */
    table = (struct kiss_config*)speex_alloc(sizeof(struct kiss_config));
-   table->forward = kiss_fftr_alloc(size,0,NULL,NULL);
-   table->backward = kiss_fftr_alloc(size,1,NULL,NULL);
+   table->forward = kiss_fftr_alloc_shared(plan->forward,NULL,NULL);
+   table->backward = kiss_fftr_alloc_shared(plan->backward,NULL,NULL);
    table->N = size;
+   table->plan = plan;
+   table->in_arena = 0;
+   return table;
+}
+
+void *spx_fft_init_arena(int size, SpeexArena *a)
+{
+   struct kiss_config *table;
+   void *forward, *backward;
+   size_t len = kiss_fftr_shared_size(size);
+
+   table = (struct kiss_config*)speex_arena_alloc(a, sizeof(struct kiss_config));
+   forward = speex_arena_alloc(a, len);
+   backward = speex_arena_alloc(a, len);
+   if (!table || !forward || !backward)
+      return NULL;
+
+   table->plan = kiss_plan_get(size);
+   table->forward = kiss_fftr_alloc_shared(table->plan->forward,forward,&len);
+   table->backward = kiss_fftr_alloc_shared(table->plan->backward,backward,&len);
+   table->N = size;
+   table->in_arena = 1;
    return table;
 }
 
 void spx_fft_destroy(void *table)
 {
    struct kiss_config *t = (struct kiss_config *)table;
-   kiss_fftr_free(t->forward);
-   kiss_fftr_free(t->backward);
-   speex_free(table);
+   struct kiss_plan *plan = t->plan;
+   if (!t->in_arena)
+   {
+      kiss_fftr_free(t->forward);
+      kiss_fftr_free(t->backward);
+      speex_free(table);
+   }
+   kiss_plan_release(plan);
 }
 
 #ifdef FIXED_POINT
@@ -356,6 +483,14 @@ void spx_ifft(void *table, spx_word16_t *in, spx_word16_t *out)
 
 #endif
 
+#ifndef USE_KISS_FFT
+void *spx_fft_init_arena(int size, SpeexArena *a)
+{
+   /* Only the kiss backend can be placed in an arena, the others keep their own tables */
+   return a->base ? spx_fft_init(size) : NULL;
+}
+#endif
+
 
 #ifdef FIXED_POINT
 /*#include "smallft.h"*/
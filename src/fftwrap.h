@@ -36,11 +36,15 @@
 #define FFTWRAP_H
 
 #include "arch.h"
+#include "arena.h"
 
-/** Compute tables for an FFT */
+/** Compute tables for an FFT (with the kiss backend, tables are shared between all users of the same size) */
 void *spx_fft_init(int size);
 
-/** Destroy tables for an FFT */
+/** Same as spx_fft_init(), with the per-user part carved from an arena (NULL while measuring) */
+void *spx_fft_init_arena(int size, SpeexArena *a);
+
+/** Destroy tables for an FFT (shared tables are released with their last user) */
 void spx_fft_destroy(void *table);
 
 /** Forward (real to half-complex) transform */
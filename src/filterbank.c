@@ -49,7 +49,46 @@
 
 #define toMEL(n)    (2595.f*log10(1.f+(n)/700.f))
 
+/* Carves the bank and its arrays from the arena, returns NULL while measuring */
+static FilterBank *filterbank_layout(SpeexArena *a, int banks, int len)
+{
+   FilterBank *bank, *ret;
+   FilterBank dummy;
+
+   /* While measuring, the array pointers go to a throwaway struct */
+   ret = (FilterBank*)speex_arena_alloc(a, sizeof(FilterBank));
+   bank = ret ? ret : &dummy;
+   bank->bank_left = (int*)speex_arena_alloc(a, len*sizeof(int));
+   bank->bank_right = (int*)speex_arena_alloc(a, len*sizeof(int));
+   bank->filter_left = (spx_word16_t*)speex_arena_alloc(a, len*sizeof(spx_word16_t));
+   bank->filter_right = (spx_word16_t*)speex_arena_alloc(a, len*sizeof(spx_word16_t));
+   /* Think I can safely disable normalisation that for fixed-point (and probably float as well) */
+#ifndef FIXED_POINT
+   bank->scaling = (float*)speex_arena_alloc(a, banks*sizeof(float));
+#endif
+   return ret;
+}
+
 FilterBank *filterbank_new(int banks, spx_word32_t sampling, int len, int type)
+{
+   SpeexArena a;
+   FilterBank *bank;
+   void *mem;
+   size_t size;
+
+   speex_arena_measure(&a);
+   filterbank_layout(&a, banks, len);
+   size = speex_arena_footprint(&a);
+   mem = speex_alloc_tier(size, SPEEX_MEM_HOT);
+   if (!mem)
+      return NULL;
+   speex_arena_init(&a, mem, size);
+   bank = filterbank_new_arena(&a, banks, sampling, len, type);
+   bank->mem = mem;
+   return bank;
+}
+
+FilterBank *filterbank_new_arena(SpeexArena *a, int banks, spx_word32_t sampling, int len, int type)
 {
    FilterBank *bank;
    spx_word32_t df;
@@ -57,21 +96,17 @@ FilterBank *filterbank_new(int banks, spx_word32_t sampling, int len, int type)
    int i;
    int id1;
    int id2;
+
+   bank = filterbank_layout(a, banks, len);
+   if (!bank)
+      return NULL;
    df = DIV32(SHL32(sampling,15),MULT16_16(2,len));
    max_mel = toBARK(EXTRACT16(sampling/2));
    mel_interval = PDIV32(max_mel,banks-1);
 
-   bank = (FilterBank*)speex_alloc(sizeof(FilterBank));
    bank->nb_banks = banks;
    bank->len = len;
-   bank->bank_left = (int*)speex_alloc(len*sizeof(int));
-   bank->bank_right = (int*)speex_alloc(len*sizeof(int));
-   bank->filter_left = (spx_word16_t*)speex_alloc(len*sizeof(spx_word16_t));
-   bank->filter_right = (spx_word16_t*)speex_alloc(len*sizeof(spx_word16_t));
-   /* Think I can safely disable normalisation that for fixed-point (and probably float as well) */
-#ifndef FIXED_POINT
-   bank->scaling = (float*)speex_alloc(banks*sizeof(float));
-#endif
+   bank->mem = NULL;
    for (i=0;i<len;i++)
    {
       spx_word16_t curr_freq;
@@ -119,14 +154,8 @@ FilterBank *filterbank_new(int banks, spx_word32_t sampling, int len, int type)
 
 void filterbank_destroy(FilterBank *bank)
 {
-   speex_free(bank->bank_left);
-   speex_free(bank->bank_right);
-   speex_free(bank->filter_left);
-   speex_free(bank->filter_right);
-#ifndef FIXED_POINT
-   speex_free(bank->scaling);
-#endif
-   speex_free(bank);
+   /* Banks from filterbank_new_arena() go away with their arena */
+   speex_free_tier(bank->mem);
 }
 
 void filterbank_compute_bank32(FilterBank *bank, spx_word32_t *ps, spx_word32_t *mel)
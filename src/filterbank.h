@@ -35,6 +35,7 @@
 #define FILTERBANK_H
 
 #include "arch.h"
+#include "arena.h"
 
 typedef struct {
    int *bank_left;
@@ -46,11 +47,15 @@ typedef struct {
 #endif
    int nb_banks;
    int len;
+   void *mem;   /* Block owning the arrays, NULL when they live in the caller's arena */
 } FilterBank;
 
 
 FilterBank *filterbank_new(int banks, spx_word32_t sampling, int len, int type);
 
+/** Same as filterbank_new(), but carved from an arena (NULL while measuring). Freed with the arena */
+FilterBank *filterbank_new_arena(SpeexArena *a, int banks, spx_word32_t sampling, int len, int type);
+
 void filterbank_destroy(FilterBank *bank);
 
 void filterbank_compute_bank32(FilterBank *bank, spx_word32_t *ps, spx_word32_t *mel);
@@ -62,6 +62,7 @@ TODO:
 #endif
 
 #define SPEEX_JITTER_MAX_BUFFER_SIZE 200   /**< Maximum number of packets in jitter buffer */
+#define USED_WORDS(n) (((n)+31)/32)
 
 #define TSUB(a,b) ((spx_int32_t)((a)-(b)))
 
@@ -90,24 +91,36 @@ static void tb_init(struct TimingBuffer *tb)
    tb->curr_count = 0;
 }
 
-/* Add the timing of a new packet to the TimingBuffer */
-static void tb_add(struct TimingBuffer *tb, spx_int16_t timing)
+/* Position where timing goes in the sorted list of len entries: after any
+   equal ones */
+static int timing_upper_bound(const spx_int32_t *list, int len, spx_int32_t timing)
+{
+   int lo = 0, hi = len;
+   while (lo < hi)
+   {
+      int mid = (lo+hi)>>1;
+      if (timing >= list[mid])
+         lo = mid+1;
+      else
+         hi = mid;
+   }
+   return lo;
+}
+
+/* Add the timing of a new packet to the TimingBuffer, returns 0 if it was
+   too early to be kept */
+static int tb_add(struct TimingBuffer *tb, spx_int16_t timing)
 {
    int pos;
    /* Discard packet that won't make it into the list because they're too early */
    if (tb->filled >= MAX_TIMINGS && timing >= tb->timing[tb->filled-1])
    {
       tb->curr_count++;
-      return;
+      return 0;
    }
 
    /* Find where the timing info goes in the sorted list */
-   pos = 0;
-   /* FIXME: Do bisection instead of linear search */
-   while (pos<tb->filled && timing >= tb->timing[pos])
-   {
-      pos++;
-   }
+   pos = timing_upper_bound(tb->timing, tb->filled, timing);
 
    speex_assert(pos <= tb->filled && pos < MAX_TIMINGS);
 
@@ -127,6 +140,7 @@ static void tb_add(struct TimingBuffer *tb, spx_int16_t timing)
    tb->curr_count++;
    if (tb->filled<MAX_TIMINGS)
       tb->filled++;
+   return 1;
 }
 
 
@@ -139,11 +153,20 @@ struct JitterBuffer_ {
 
    spx_int32_t buffered;                                       /**< Amount of data we think is still buffered by the application (timestamp units)*/
 
-   JitterBufferPacket packets[SPEEX_JITTER_MAX_BUFFER_SIZE];   /**< Packets stored in the buffer */
-   spx_uint32_t arrival[SPEEX_JITTER_MAX_BUFFER_SIZE];         /**< Packet arrival time (0 means it was late, even though it's a valid timestamp) */
+   int max_packets;                                            /**< Number of packet entries (they follow the structure) */
+   JitterBufferPacket *packets;                                /**< Packets stored in the buffer */
+   spx_uint32_t *arrival;                                      /**< Packet arrival time (0 means it was late, even though it's a valid timestamp) */
+   spx_int16_t *order;                                         /**< Entries holding a packet, sorted by timestamp (then by entry) */
+   int nb_packets;                                             /**< Number of entries in "order" */
+   spx_uint32_t *used;                                         /**< One bit per entry holding a packet */
 
    void (*destroy) (void *);                                   /**< Callback for destroying a packet */
 
+   char *pool;                                                 /**< One payload slot per packet entry (NULL: payloads come from the heap) */
+   int slot_size;                                              /**< Size of a pool slot (largest pooled packet) */
+   JitterBufferGroup *group;                                   /**< Group whose slots hold the payloads (NULL if standalone) */
+   JitterBufferStats stats;                                    /**< Counters for JITTER_BUFFER_GET_STATS */
+
    spx_int32_t delay_step;                                     /**< Size of the steps when adjusting buffering (timestamp units) */
    spx_int32_t concealment_size;                               /**< Size of the packet loss concealment "units" */
    int reset_state;                                            /**< True if state was just reset        */
@@ -154,6 +177,8 @@ struct JitterBuffer_ {
 
    struct TimingBuffer _tb[MAX_BUFFERS];                       /**< Don't use those directly */
    struct TimingBuffer *timeBuffers[MAX_BUFFERS];              /**< Storing arrival time of latest frames so we can compute some stats */
+   spx_int32_t top[TOP_DELAY];                                 /**< The TOP_DELAY latest timings of all sub-windows merged, sorted like "timing" */
+   int top_filled;                                             /**< Number of entries in "top" */
    int window_size;                                            /**< Total window over which the late frames are counted */
    int subwindow_size;                                         /**< Sub-window size for faster computation  */
    int max_late_rate;                                          /**< Absolute maximum amount of late packets tolerable (in percent) */
@@ -163,6 +188,17 @@ struct JitterBuffer_ {
    int lost_count;                                             /**< Number of consecutive lost packets  */
 };
 
+/** Streams sharing one payload pool */
+struct JitterBufferGroup_ {
+   int nb_streams;
+   JitterBuffer **streams;                                     /**< Stream states (all in the group's block) */
+   char *slots;                                                /**< Payload slots shared by all streams */
+   int slot_size;                                              /**< Size of a slot (largest pooled packet) */
+   int nb_slots;                                               /**< Number of slots */
+   int *free_slots;                                            /**< Stack of unused slots */
+   int nb_free;                                                /**< Number of entries in "free_slots" */
+};
+
 /** Based on available data, this computes the optimal delay for the jitter buffer.
    The optimised function is in timestamp units and is:
    cost = delay + late_factor*[number of frames that would be late if we used that delay]
@@ -175,7 +211,6 @@ static spx_int16_t compute_opt_delay(JitterBuffer *jitter)
    spx_int16_t opt=0;
    spx_int32_t best_cost=0x7fffffff;
    int late = 0;
-   int pos[MAX_BUFFERS];
    int tot_count;
    float late_factor;
    int penalty_taken = 0;
@@ -200,45 +235,29 @@ static spx_int16_t compute_opt_delay(JitterBuffer *jitter)
       late_factor = jitter->auto_tradeoff * jitter->window_size/tot_count;
 
    /*fprintf(stderr, "late_factor = %f\n", late_factor);*/
-   for (i=0;i<MAX_BUFFERS;i++)
-      pos[i] = 0;
-
-   /* Pick the TOP_DELAY "latest" packets (doesn't need to actually be late
-      for the current settings) */
-   for (i=0;i<TOP_DELAY;i++)
+   /* Go through the TOP_DELAY "latest" packets (doesn't need to actually be late
+      for the current settings), kept merged by update_timings() */
+   for (i=0;i<jitter->top_filled;i++)
    {
-      int j;
-      int next=-1;
-      int latest = 32767;
-      /* Pick latest among all sub-windows */
-      for (j=0;j<MAX_BUFFERS;j++)
-      {
-         if (pos[j] < tb[j].filled && tb[j].timing[pos[j]] < latest)
-         {
-            next = j;
-            latest = tb[j].timing[pos[j]];
-         }
-      }
-      if (next != -1)
-      {
-         spx_int32_t cost;
-
-         if (i==0)
-            worst = latest;
-         best = latest;
-         latest = ROUND_DOWN(latest, jitter->delay_step);
-         pos[next]++;
-
-         /* Actual cost function that tells us how bad using this delay would be */
-         cost = -latest + late_factor*late;
-         /*fprintf(stderr, "cost %d = %d + %f * %d\n", cost, -latest, late_factor, late);*/
-         if (cost < best_cost)
-         {
-            best_cost = cost;
-            opt = latest;
-         }
-      } else {
+      spx_int32_t cost;
+      int latest = jitter->top[i];
+
+      /* Timings shifted up to the clamp value or beyond never count */
+      if (latest >= 32767)
          break;
+
+      if (i==0)
+         worst = latest;
+      best = latest;
+      latest = ROUND_DOWN(latest, jitter->delay_step);
+
+      /* Actual cost function that tells us how bad using this delay would be */
+      cost = -latest + late_factor*late;
+      /*fprintf(stderr, "cost %d = %d + %f * %d\n", cost, -latest, late_factor, late);*/
+      if (cost < best_cost)
+      {
+         best_cost = cost;
+         opt = latest;
       }
 
       /* For the next timing we will consider, there will be one more late packet to count */
@@ -265,28 +284,156 @@ static spx_int16_t compute_opt_delay(JitterBuffer *jitter)
 }
 
 
+/* The entries holding a packet are indexed in timestamp order so that get()
+   can bisect instead of scanning all entries. Packets with the same timestamp
+   stay in entry order, which resolves ties the same way a scan would */
+
+/* First position in the index whose packet doesn't start before timestamp */
+static int index_lower_bound(JitterBuffer *jitter, spx_uint32_t timestamp)
+{
+   int lo = 0, hi = jitter->nb_packets;
+   while (lo < hi)
+   {
+      int mid = (lo+hi)>>1;
+      if (LT32(jitter->packets[jitter->order[mid]].timestamp, timestamp))
+         lo = mid+1;
+      else
+         hi = mid;
+   }
+   return lo;
+}
+
+/* Position of entry i in the index (or where it goes) */
+static int index_position(JitterBuffer *jitter, int i)
+{
+   spx_uint32_t timestamp = jitter->packets[i].timestamp;
+   int pos = index_lower_bound(jitter, timestamp);
+   while (pos < jitter->nb_packets && jitter->packets[jitter->order[pos]].timestamp == timestamp && jitter->order[pos] < i)
+      pos++;
+   return pos;
+}
+
+static void index_insert(JitterBuffer *jitter, int i)
+{
+   int pos = index_position(jitter, i);
+   SPEEX_MOVE(&jitter->order[pos+1], &jitter->order[pos], jitter->nb_packets-pos);
+   jitter->order[pos] = i;
+   jitter->nb_packets++;
+   jitter->used[i>>5] |= (spx_uint32_t)1<<(i&31);
+}
+
+static void index_remove(JitterBuffer *jitter, int i)
+{
+   int pos;
+   if (!(jitter->used[i>>5] & ((spx_uint32_t)1<<(i&31))))
+      return;
+   pos = index_position(jitter, i);
+   jitter->nb_packets--;
+   SPEEX_MOVE(&jitter->order[pos], &jitter->order[pos+1], jitter->nb_packets-pos);
+   jitter->used[i>>5] &= ~((spx_uint32_t)1<<(i&31));
+}
+
+/* First entry not holding a packet (max_packets if full) */
+static int index_free_entry(JitterBuffer *jitter)
+{
+   int w;
+   if (jitter->nb_packets >= jitter->max_packets)
+      return jitter->max_packets;
+   for (w=0;jitter->used[w]==0xffffffff;w++);
+   w <<= 5;
+   while (jitter->used[w>>5] & ((spx_uint32_t)1<<(w&31)))
+      w++;
+   return w;
+}
+
+/* Gets storage for a copied payload of len bytes in entry i: the entry's pool
+   slot (or a free slot of the group) when it fits, so no heap operation, the
+   heap otherwise */
+static char *packet_data_alloc(JitterBuffer *jitter, int i, int len)
+{
+   JitterBufferGroup *group = jitter->group;
+   if (jitter->pool && len <= jitter->slot_size)
+      return jitter->pool + i*jitter->slot_size;
+   if (group && len <= group->slot_size && group->nb_free > 0)
+      return group->slots + group->free_slots[--group->nb_free]*group->slot_size;
+   if (jitter->pool || (group && group->slots))
+      jitter->stats.heap_packets++;
+   return (char*)speex_alloc(len);
+}
+
+/* Releases the payload of entry i once its data has been copied out (or not needed) */
+static void packet_data_free(JitterBuffer *jitter, int i)
+{
+   char *data = jitter->packets[i].data;
+   JitterBufferGroup *group = jitter->group;
+   if (group && group->slots && data >= group->slots && data < group->slots + group->nb_slots*group->slot_size)
+      group->free_slots[group->nb_free++] = (data - group->slots)/group->slot_size;
+   else if (!jitter->pool || data < jitter->pool || data >= jitter->pool + jitter->max_packets*jitter->slot_size)
+      speex_free(data);
+   jitter->packets[i].data = NULL;
+}
+
+/* Drops the packet in entry i */
+static void packet_drop(JitterBuffer *jitter, int i)
+{
+   index_remove(jitter, i);
+   if (jitter->destroy)
+   {
+      jitter->destroy(jitter->packets[i].data);
+      jitter->packets[i].data = NULL;
+   } else {
+      packet_data_free(jitter, i);
+   }
+}
+
+/* Size of a jitter buffer state followed by its packet entries, rounded up so
+   that states can be laid out back to back */
+static int jitter_buffer_size(int max_packets)
+{
+   int size = sizeof(JitterBuffer);
+   size += max_packets*(sizeof(JitterBufferPacket)+sizeof(spx_uint32_t)+sizeof(spx_int16_t));
+   size += USED_WORDS(max_packets)*sizeof(spx_uint32_t);
+   return (size+7) & ~7;
+}
+
+/* Sets up a cleared state of jitter_buffer_size(max_packets) bytes */
+static void jitter_buffer_setup(JitterBuffer *jitter, int max_packets, int step_size)
+{
+   int i;
+   spx_int32_t tmp;
+   char *entries = (char*)(jitter+1);
+   jitter->max_packets = max_packets;
+   jitter->packets = (JitterBufferPacket*)entries;
+   entries += max_packets*sizeof(JitterBufferPacket);
+   jitter->arrival = (spx_uint32_t*)entries;
+   entries += max_packets*sizeof(spx_uint32_t);
+   jitter->used = (spx_uint32_t*)entries;
+   entries += USED_WORDS(max_packets)*sizeof(spx_uint32_t);
+   jitter->order = (spx_int16_t*)entries;
+   for (i=0;i<max_packets;i++)
+      jitter->packets[i].data=NULL;
+   jitter->pool = NULL;
+   jitter->slot_size = 0;
+   jitter->group = NULL;
+   jitter->delay_step = step_size;
+   jitter->concealment_size = step_size;
+   /*FIXME: Should this be 0 or 1?*/
+   jitter->buffer_margin = 0;
+   jitter->late_cutoff = 50;
+   jitter->destroy = NULL;
+   jitter->latency_tradeoff = 0;
+   jitter->auto_adjust = 1;
+   tmp = 4;
+   jitter_buffer_ctl(jitter, JITTER_BUFFER_SET_MAX_LATE_RATE, &tmp);
+   jitter_buffer_reset(jitter);
+}
+
 /** Initialise jitter buffer */
 EXPORT JitterBuffer *jitter_buffer_init(int step_size)
 {
-   JitterBuffer *jitter = (JitterBuffer*)speex_alloc(sizeof(JitterBuffer));
+   JitterBuffer *jitter = (JitterBuffer*)speex_alloc(jitter_buffer_size(SPEEX_JITTER_MAX_BUFFER_SIZE));
    if (jitter)
-   {
-      int i;
-      spx_int32_t tmp;
-      for (i=0;i<SPEEX_JITTER_MAX_BUFFER_SIZE;i++)
-         jitter->packets[i].data=NULL;
-      jitter->delay_step = step_size;
-      jitter->concealment_size = step_size;
-      /*FIXME: Should this be 0 or 1?*/
-      jitter->buffer_margin = 0;
-      jitter->late_cutoff = 50;
-      jitter->destroy = NULL;
-      jitter->latency_tradeoff = 0;
-      jitter->auto_adjust = 1;
-      tmp = 4;
-      jitter_buffer_ctl(jitter, JITTER_BUFFER_SET_MAX_LATE_RATE, &tmp);
-      jitter_buffer_reset(jitter);
-   }
+      jitter_buffer_setup(jitter, SPEEX_JITTER_MAX_BUFFER_SIZE, step_size);
    return jitter;
 }
 
@@ -294,16 +441,10 @@ EXPORT JitterBuffer *jitter_buffer_init(int step_size)
 EXPORT void jitter_buffer_reset(JitterBuffer *jitter)
 {
    int i;
-   for (i=0;i<SPEEX_JITTER_MAX_BUFFER_SIZE;i++)
+   for (i=0;i<jitter->max_packets;i++)
    {
       if (jitter->packets[i].data)
-      {
-         if (jitter->destroy)
-            jitter->destroy(jitter->packets[i].data);
-         else
-            speex_free(jitter->packets[i].data);
-         jitter->packets[i].data = NULL;
-      }
+         packet_drop(jitter, i);
    }
    /* Timestamp is actually undefined at this point */
    jitter->pointer_timestamp = 0;
@@ -318,17 +459,70 @@ EXPORT void jitter_buffer_reset(JitterBuffer *jitter)
       tb_init(&jitter->_tb[i]);
       jitter->timeBuffers[i] = &jitter->_tb[i];
    }
+   jitter->top_filled = 0;
    /*fprintf (stderr, "reset\n");*/
 }
 
 /** Destroy jitter buffer */
 EXPORT void jitter_buffer_destroy(JitterBuffer *jitter)
 {
+   if (jitter->group)
+   {
+      speex_warning("jitter_buffer_destroy(): streams of a group go away with jitter_buffer_group_destroy()");
+      return;
+   }
    jitter_buffer_reset(jitter);
+   speex_free(jitter->pool);
    speex_free(jitter);
 }
 
 /** Take the following timing into consideration for future calculations */
+/* Merge the TOP_DELAY latest timings of all sub-windows (only needed when
+   one of them gets discarded) */
+static void top_rebuild(JitterBuffer *jitter)
+{
+   int i;
+   int pos[MAX_BUFFERS];
+   struct TimingBuffer *tb = jitter->_tb;
+   for (i=0;i<MAX_BUFFERS;i++)
+      pos[i] = 0;
+   for (i=0;i<TOP_DELAY;i++)
+   {
+      int j;
+      int next=-1;
+      spx_int32_t latest = 0;
+      /* Pick latest among all sub-windows */
+      for (j=0;j<MAX_BUFFERS;j++)
+      {
+         if (pos[j] < tb[j].filled && (next == -1 || tb[j].timing[pos[j]] < latest))
+         {
+            next = j;
+            latest = tb[j].timing[pos[j]];
+         }
+      }
+      if (next == -1)
+         break;
+      jitter->top[i] = latest;
+      pos[next]++;
+   }
+   jitter->top_filled = i;
+}
+
+/* Keep the merged list up to date with a timing the current sub-window kept.
+   Whatever that sub-window dropped to make room was later than this one, so
+   it can't be among the TOP_DELAY latest anymore either */
+static void top_add(JitterBuffer *jitter, spx_int32_t timing)
+{
+   int pos;
+   if (jitter->top_filled >= TOP_DELAY && timing >= jitter->top[TOP_DELAY-1])
+      return;
+   pos = timing_upper_bound(jitter->top, jitter->top_filled, timing);
+   if (jitter->top_filled < TOP_DELAY)
+      jitter->top_filled++;
+   SPEEX_MOVE(&jitter->top[pos+1], &jitter->top[pos], jitter->top_filled-pos-1);
+   jitter->top[pos] = timing;
+}
+
 static void update_timings(JitterBuffer *jitter, spx_int32_t timing)
 {
    if (timing < -32767)
@@ -345,8 +539,10 @@ static void update_timings(JitterBuffer *jitter, spx_int32_t timing)
          jitter->timeBuffers[i] = jitter->timeBuffers[i-1];
       jitter->timeBuffers[0] = tmp;
       tb_init(jitter->timeBuffers[0]);
+      top_rebuild(jitter);
    }
-   tb_add(jitter->timeBuffers[0], timing);
+   if (tb_add(jitter->timeBuffers[0], timing))
+      top_add(jitter, timing);
 }
 
 /** Compensate all timings when we do an adjustment of the buffering */
@@ -358,6 +554,8 @@ static void shift_timings(JitterBuffer *jitter, spx_int16_t amount)
       for (j=0;j<jitter->timeBuffers[i]->filled;j++)
          jitter->timeBuffers[i]->timing[j] += amount;
    }
+   for (j=0;j<jitter->top_filled;j++)
+      jitter->top[j] += amount;
 }
 
 
@@ -367,21 +565,23 @@ EXPORT void jitter_buffer_put(JitterBuffer *jitter, const JitterBufferPacket *pa
    int i,j;
    int late;
    /*fprintf (stderr, "put packet %d %d\n", timestamp, span);*/
+   jitter->stats.received++;
 
    /* Cleanup buffer (remove old packets that weren't played) */
    if (!jitter->reset_state)
    {
-      for (i=0;i<SPEEX_JITTER_MAX_BUFFER_SIZE;i++)
+      for (j=0;j<USED_WORDS(jitter->max_packets);j++)
       {
-         /* Make sure we don't discard a "just-late" packet in case we want to play it next (if we interpolate). */
-         if (jitter->packets[i].data && LE32(jitter->packets[i].timestamp + jitter->packets[i].span, jitter->pointer_timestamp))
+         spx_uint32_t used = jitter->used[j];
+         for (i=j<<5;used;i++,used>>=1)
          {
-            /*fprintf (stderr, "cleaned (not played)\n");*/
-            if (jitter->destroy)
-               jitter->destroy(jitter->packets[i].data);
-            else
-               speex_free(jitter->packets[i].data);
-            jitter->packets[i].data = NULL;
+            /* Make sure we don't discard a "just-late" packet in case we want to play it next (if we interpolate). */
+            if ((used&1) && LE32(jitter->packets[i].timestamp + jitter->packets[i].span, jitter->pointer_timestamp))
+            {
+               /*fprintf (stderr, "cleaned (not played)\n");*/
+               packet_drop(jitter, i);
+               jitter->stats.dropped++;
+            }
          }
       }
    }
@@ -392,6 +592,7 @@ EXPORT void jitter_buffer_put(JitterBuffer *jitter, const JitterBufferPacket *pa
    {
       update_timings(jitter, ((spx_int32_t)packet->timestamp) - ((spx_int32_t)jitter->next_stop) - jitter->buffer_margin);
       late = 1;
+      jitter->stats.late++;
    } else {
       late = 0;
    }
@@ -408,30 +609,14 @@ EXPORT void jitter_buffer_put(JitterBuffer *jitter, const JitterBufferPacket *pa
    {
 
       /*Find an empty slot in the buffer*/
-      for (i=0;i<SPEEX_JITTER_MAX_BUFFER_SIZE;i++)
-      {
-         if (jitter->packets[i].data==NULL)
-            break;
-      }
+      i = index_free_entry(jitter);
 
       /*No place left in the buffer, need to make room for it by discarding the oldest packet */
-      if (i==SPEEX_JITTER_MAX_BUFFER_SIZE)
+      if (i==jitter->max_packets)
       {
-         int earliest=jitter->packets[0].timestamp;
-         i=0;
-         for (j=1;j<SPEEX_JITTER_MAX_BUFFER_SIZE;j++)
-         {
-            if (!jitter->packets[i].data || LT32(jitter->packets[j].timestamp,earliest))
-            {
-               earliest = jitter->packets[j].timestamp;
-               i=j;
-            }
-         }
-         if (jitter->destroy)
-            jitter->destroy(jitter->packets[i].data);
-         else
-            speex_free(jitter->packets[i].data);
-         jitter->packets[i].data=NULL;
+         i = jitter->order[0];
+         packet_drop(jitter, i);
+         jitter->stats.dropped++;
          /*fprintf (stderr, "Buffer is full, discarding earliest frame %d (currently at %d)\n", timestamp, jitter->pointer_timestamp);*/
       }
 
@@ -440,19 +625,22 @@ EXPORT void jitter_buffer_put(JitterBuffer *jitter, const JitterBufferPacket *pa
       {
          jitter->packets[i].data = packet->data;
       } else {
-         jitter->packets[i].data=(char*)speex_alloc(packet->len);
-         for (j=0;j<packet->len;j++)
-            jitter->packets[i].data[j]=packet->data[j];
+         jitter->packets[i].data=packet_data_alloc(jitter, i, packet->len);
+         SPEEX_COPY(jitter->packets[i].data, packet->data, packet->len);
       }
       jitter->packets[i].timestamp=packet->timestamp;
       jitter->packets[i].span=packet->span;
       jitter->packets[i].len=packet->len;
       jitter->packets[i].sequence=packet->sequence;
       jitter->packets[i].user_data=packet->user_data;
+      if (jitter->packets[i].data)
+         index_insert(jitter, i);
       if (jitter->reset_state || late)
          jitter->arrival[i] = 0;
       else
          jitter->arrival[i] = jitter->next_stop;
+   } else {
+      jitter->stats.dropped++;
    }
 
 
@@ -461,8 +649,7 @@ EXPORT void jitter_buffer_put(JitterBuffer *jitter, const JitterBufferPacket *pa
 /** Get one packet from the jitter buffer */
 EXPORT int jitter_buffer_get(JitterBuffer *jitter, JitterBufferPacket *packet, spx_int32_t desired_span, spx_int32_t *start_offset)
 {
-   int i;
-   unsigned int j;
+   int i, pos, start;
    spx_int16_t opt;
 
    if (start_offset != NULL)
@@ -471,25 +658,17 @@ EXPORT int jitter_buffer_get(JitterBuffer *jitter, JitterBufferPacket *packet, s
    /* Syncing on the first call */
    if (jitter->reset_state)
    {
-      int found = 0;
       /* Find the oldest packet */
-      spx_uint32_t oldest=0;
-      for (i=0;i<SPEEX_JITTER_MAX_BUFFER_SIZE;i++)
-      {
-         if (jitter->packets[i].data && (!found || LT32(jitter->packets[i].timestamp,oldest)))
-         {
-            oldest = jitter->packets[i].timestamp;
-            found = 1;
-         }
-      }
-      if (found)
+      if (jitter->nb_packets > 0)
       {
+         spx_uint32_t oldest = jitter->packets[jitter->order[0]].timestamp;
          jitter->reset_state=0;
          jitter->pointer_timestamp = oldest;
          jitter->next_stop = oldest;
       } else {
          packet->timestamp = 0;
          packet->span = jitter->interp_requested;
+         jitter->stats.missing++;
          return JITTER_BUFFER_MISSING;
       }
    }
@@ -511,68 +690,71 @@ EXPORT int jitter_buffer_get(JitterBuffer *jitter, JitterBufferPacket *packet, s
 
       jitter->buffered = packet->span - desired_span;
 
+      jitter->stats.inserted++;
       return JITTER_BUFFER_INSERTION;
    }
 
    /* Searching for the packet that fits best */
 
+   /* The index is sorted by timestamp, then by entry: wherever several packets
+      qualify, the first entry wins */
+   start = index_lower_bound(jitter, jitter->pointer_timestamp);
+   i = jitter->max_packets;
+
    /* Search the buffer for a packet with the right timestamp and spanning the whole current chunk */
-   for (i=0;i<SPEEX_JITTER_MAX_BUFFER_SIZE;i++)
+   for (pos=start;pos<jitter->nb_packets && jitter->packets[jitter->order[pos]].timestamp==jitter->pointer_timestamp;pos++)
    {
-      if (jitter->packets[i].data && jitter->packets[i].timestamp==jitter->pointer_timestamp && GE32(jitter->packets[i].timestamp+jitter->packets[i].span,jitter->pointer_timestamp+desired_span))
+      int k = jitter->order[pos];
+      if (GE32(jitter->packets[k].timestamp+jitter->packets[k].span,jitter->pointer_timestamp+desired_span))
+      {
+         i = k;
          break;
+      }
    }
 
    /* If no match, try for an "older" packet that still spans (fully) the current chunk */
-   if (i==SPEEX_JITTER_MAX_BUFFER_SIZE)
+   if (i==jitter->max_packets)
    {
-      for (i=0;i<SPEEX_JITTER_MAX_BUFFER_SIZE;i++)
+      for (pos=0;pos<jitter->nb_packets && LE32(jitter->packets[jitter->order[pos]].timestamp, jitter->pointer_timestamp);pos++)
       {
-         if (jitter->packets[i].data && LE32(jitter->packets[i].timestamp, jitter->pointer_timestamp) && GE32(jitter->packets[i].timestamp+jitter->packets[i].span,jitter->pointer_timestamp+desired_span))
-            break;
+         int k = jitter->order[pos];
+         if (k < i && GE32(jitter->packets[k].timestamp+jitter->packets[k].span,jitter->pointer_timestamp+desired_span))
+            i = k;
       }
    }
 
    /* If still no match, try for an "older" packet that spans part of the current chunk */
-   if (i==SPEEX_JITTER_MAX_BUFFER_SIZE)
+   if (i==jitter->max_packets)
    {
-      for (i=0;i<SPEEX_JITTER_MAX_BUFFER_SIZE;i++)
+      for (pos=0;pos<jitter->nb_packets && LE32(jitter->packets[jitter->order[pos]].timestamp, jitter->pointer_timestamp);pos++)
       {
-         if (jitter->packets[i].data && LE32(jitter->packets[i].timestamp, jitter->pointer_timestamp) && GT32(jitter->packets[i].timestamp+jitter->packets[i].span,jitter->pointer_timestamp))
-            break;
+         int k = jitter->order[pos];
+         if (k < i && GT32(jitter->packets[k].timestamp+jitter->packets[k].span,jitter->pointer_timestamp))
+            i = k;
       }
    }
 
-   /* If still no match, try for earliest packet possible */
-   if (i==SPEEX_JITTER_MAX_BUFFER_SIZE)
+   /* If still no match, try for earliest packet possible (the longest one if several start there) */
+   if (i==jitter->max_packets && start<jitter->nb_packets)
    {
-      int found = 0;
-      spx_uint32_t best_time=0;
-      int best_span=0;
-      int besti=0;
-      for (i=0;i<SPEEX_JITTER_MAX_BUFFER_SIZE;i++)
+      int k = jitter->order[start];
+      spx_uint32_t best_time = jitter->packets[k].timestamp;
+      /* check if packet starts within current chunk */
+      if (LT32(best_time,jitter->pointer_timestamp+desired_span))
       {
-         /* check if packet starts within current chunk */
-         if (jitter->packets[i].data && LT32(jitter->packets[i].timestamp,jitter->pointer_timestamp+desired_span) && GE32(jitter->packets[i].timestamp,jitter->pointer_timestamp))
+         i = k;
+         for (pos=start+1;pos<jitter->nb_packets && jitter->packets[jitter->order[pos]].timestamp==best_time;pos++)
          {
-            if (!found || LT32(jitter->packets[i].timestamp,best_time) || (jitter->packets[i].timestamp==best_time && GT32(jitter->packets[i].span,best_span)))
-            {
-               best_time = jitter->packets[i].timestamp;
-               best_span = jitter->packets[i].span;
-               besti = i;
-               found = 1;
-            }
+            k = jitter->order[pos];
+            if (GT32(jitter->packets[k].span,jitter->packets[i].span))
+               i = k;
          }
-      }
-      if (found)
-      {
-         i=besti;
          /*fprintf (stderr, "incomplete: %d %d %d %d\n", jitter->packets[i].timestamp, jitter->pointer_timestamp, chunk_size, jitter->packets[i].span);*/
       }
    }
 
    /* If we find something */
-   if (i!=SPEEX_JITTER_MAX_BUFFER_SIZE)
+   if (i!=jitter->max_packets)
    {
       spx_int32_t offset;
 
@@ -598,11 +780,11 @@ EXPORT int jitter_buffer_get(JitterBuffer *jitter, JitterBufferPacket *packet, s
          } else {
             packet->len = jitter->packets[i].len;
          }
-         for (j=0;j<packet->len;j++)
-            packet->data[j] = jitter->packets[i].data[j];
+         SPEEX_COPY(packet->data, jitter->packets[i].data, packet->len);
          /* Remove packet */
-         speex_free(jitter->packets[i].data);
+         packet_data_free(jitter, i);
       }
+      index_remove(jitter, i);
       jitter->packets[i].data = NULL;
       /* Set timestamp and span (if requested) */
       offset = (spx_int32_t)jitter->packets[i].timestamp-(spx_int32_t)jitter->pointer_timestamp;
@@ -625,6 +807,7 @@ EXPORT int jitter_buffer_get(JitterBuffer *jitter, JitterBufferPacket *packet, s
       if (start_offset != NULL)
          jitter->buffered += *start_offset;
 
+      jitter->stats.returned++;
       return JITTER_BUFFER_OK;
    }
 
@@ -652,6 +835,7 @@ EXPORT int jitter_buffer_get(JitterBuffer *jitter, JitterBufferPacket *packet, s
       packet->len = 0;
 
       jitter->buffered = packet->span - desired_span;
+      jitter->stats.inserted++;
       return JITTER_BUFFER_INSERTION;
       /*jitter->pointer_timestamp -= jitter->delay_step;*/
       /*fprintf (stderr, "Forced to interpolate\n");*/
@@ -665,6 +849,7 @@ EXPORT int jitter_buffer_get(JitterBuffer *jitter, JitterBufferPacket *packet, s
       packet->len = 0;
 
       jitter->buffered = packet->span - desired_span;
+      jitter->stats.missing++;
       return JITTER_BUFFER_MISSING;
       /*fprintf (stderr, "Normal loss\n");*/
    }
@@ -674,13 +859,11 @@ EXPORT int jitter_buffer_get(JitterBuffer *jitter, JitterBufferPacket *packet, s
 
 EXPORT int jitter_buffer_get_another(JitterBuffer *jitter, JitterBufferPacket *packet)
 {
-   int i, j;
-   for (i=0;i<SPEEX_JITTER_MAX_BUFFER_SIZE;i++)
-   {
-      if (jitter->packets[i].data && jitter->packets[i].timestamp==jitter->last_returned_timestamp)
-         break;
-   }
-   if (i!=SPEEX_JITTER_MAX_BUFFER_SIZE)
+   int i = jitter->max_packets;
+   int pos = index_lower_bound(jitter, jitter->last_returned_timestamp);
+   if (pos<jitter->nb_packets && jitter->packets[jitter->order[pos]].timestamp==jitter->last_returned_timestamp)
+      i = jitter->order[pos];
+   if (i!=jitter->max_packets)
    {
       /* Copy packet */
       packet->len = jitter->packets[i].len;
@@ -688,16 +871,17 @@ EXPORT int jitter_buffer_get_another(JitterBuffer *jitter, JitterBufferPacket *p
       {
          packet->data = jitter->packets[i].data;
       } else {
-         for (j=0;j<packet->len;j++)
-            packet->data[j] = jitter->packets[i].data[j];
+         SPEEX_COPY(packet->data, jitter->packets[i].data, packet->len);
          /* Remove packet */
-         speex_free(jitter->packets[i].data);
+         packet_data_free(jitter, i);
       }
+      index_remove(jitter, i);
       jitter->packets[i].data = NULL;
       packet->timestamp = jitter->packets[i].timestamp;
       packet->span = jitter->packets[i].span;
       packet->sequence = jitter->packets[i].sequence;
       packet->user_data = jitter->packets[i].user_data;
+      jitter->stats.returned++;
       return JITTER_BUFFER_OK;
    } else {
       packet->data = NULL;
@@ -777,7 +961,7 @@ EXPORT void jitter_buffer_remaining_span(JitterBuffer *jitter, spx_uint32_t rem)
 /* Used like the ioctl function to control the jitter buffer parameters */
 EXPORT int jitter_buffer_ctl(JitterBuffer *jitter, int request, void *ptr)
 {
-   int count, i;
+   int count;
    switch(request)
    {
       case JITTER_BUFFER_SET_MARGIN:
@@ -787,14 +971,7 @@ EXPORT int jitter_buffer_ctl(JitterBuffer *jitter, int request, void *ptr)
          *(spx_int32_t*)ptr = jitter->buffer_margin;
          break;
       case JITTER_BUFFER_GET_AVALIABLE_COUNT:
-         count = 0;
-         for (i=0;i<SPEEX_JITTER_MAX_BUFFER_SIZE;i++)
-         {
-            if (jitter->packets[i].data && LE32(jitter->pointer_timestamp, jitter->packets[i].timestamp))
-            {
-               count++;
-            }
-         }
+         count = jitter->nb_packets - index_lower_bound(jitter, jitter->pointer_timestamp);
          *(spx_int32_t*)ptr = count;
          break;
       case JITTER_BUFFER_SET_DESTROY_CALLBACK:
@@ -829,6 +1006,32 @@ EXPORT int jitter_buffer_ctl(JitterBuffer *jitter, int request, void *ptr)
       case JITTER_BUFFER_GET_LATE_COST:
          *(spx_int32_t*)ptr = jitter->latency_tradeoff;
          break;
+      case JITTER_BUFFER_SET_MAX_PACKET_SIZE:
+         /* Streams of a group use the group's slots */
+         if (jitter->group)
+            return -1;
+         /* Buffered packets may live in the old pool */
+         jitter_buffer_reset(jitter);
+         speex_free(jitter->pool);
+         jitter->pool = NULL;
+         jitter->slot_size = 0;
+         if (*(spx_int32_t*)ptr > 0)
+         {
+            /* Round up so that every slot stays aligned */
+            int slot = (*(spx_int32_t*)ptr + 7) & ~7;
+            jitter->pool = (char*)speex_alloc(jitter->max_packets*slot);
+            if (!jitter->pool)
+               return -1;
+            jitter->slot_size = slot;
+         }
+         break;
+      case JITTER_BUFFER_GET_MAX_PACKET_SIZE:
+         *(spx_int32_t*)ptr = jitter->group ? jitter->group->slot_size : jitter->slot_size;
+         break;
+      case JITTER_BUFFER_GET_STATS:
+         *(JitterBufferStats*)ptr = jitter->stats;
+         ((JitterBufferStats*)ptr)->buffered = jitter->nb_packets;
+         break;
       default:
          speex_warning_int("Unknown jitter_buffer_ctl request: ", request);
          return -1;
@@ -836,3 +1039,74 @@ EXPORT int jitter_buffer_ctl(JitterBuffer *jitter, int request, void *ptr)
    return 0;
 }
 
+
+EXPORT JitterBufferGroup *jitter_buffer_group_init(int nb_streams, int step_size, int stream_packets, int pool_packets, int max_packet_size)
+{
+   int i;
+   int head, stream_size;
+   char *block;
+   JitterBufferGroup *group;
+   if (nb_streams <= 0 || stream_packets <= 0 || stream_packets > 32767 || pool_packets < 0 || max_packet_size < 0)
+      return NULL;
+   head = (sizeof(JitterBufferGroup) + nb_streams*sizeof(JitterBuffer*) + 7) & ~7;
+   stream_size = jitter_buffer_size(stream_packets);
+   block = (char*)speex_alloc(head + nb_streams*stream_size + pool_packets*sizeof(int));
+   if (!block)
+      return NULL;
+   group = (JitterBufferGroup*)block;
+   group->nb_streams = nb_streams;
+   group->streams = (JitterBuffer**)(group+1);
+   group->free_slots = (int*)(block + head + nb_streams*stream_size);
+   if (pool_packets > 0 && max_packet_size > 0)
+   {
+      /* Round up so that every slot stays aligned */
+      group->slot_size = (max_packet_size + 7) & ~7;
+      group->slots = (char*)speex_alloc(pool_packets*group->slot_size);
+      if (!group->slots)
+      {
+         speex_free(block);
+         return NULL;
+      }
+      group->nb_slots = pool_packets;
+      /* Hand out the lowest slots first */
+      for (i=0;i<pool_packets;i++)
+         group->free_slots[i] = pool_packets-1-i;
+      group->nb_free = pool_packets;
+   }
+   for (i=0;i<nb_streams;i++)
+   {
+      JitterBuffer *jitter = (JitterBuffer*)(block + head + i*stream_size);
+      jitter_buffer_setup(jitter, stream_packets, step_size);
+      jitter->group = group;
+      group->streams[i] = jitter;
+   }
+   return group;
+}
+
+EXPORT void jitter_buffer_group_destroy(JitterBufferGroup *group)
+{
+   int i;
+   for (i=0;i<group->nb_streams;i++)
+      jitter_buffer_reset(group->streams[i]);
+   speex_free(group->slots);
+   speex_free(group);
+}
+
+EXPORT JitterBuffer *jitter_buffer_group_stream(JitterBufferGroup *group, int stream)
+{
+   if (stream < 0 || stream >= group->nb_streams)
+      return NULL;
+   return group->streams[stream];
+}
+
+EXPORT void jitter_buffer_group_tick(JitterBufferGroup *group)
+{
+   int i;
+   for (i=0;i<group->nb_streams;i++)
+      jitter_buffer_tick(group->streams[i]);
+}
+
+EXPORT int jitter_buffer_group_get_free(JitterBufferGroup *group)
+{
+   return group->nb_free;
+}
@@ -78,6 +78,35 @@ kiss_fftr_cfg kiss_fftr_alloc(int nfft,int inverse_fft,void * mem,size_t * lenme
     return st;
 }
 
+size_t kiss_fftr_shared_size(int nfft)
+{
+    /* Only the scratch buffer is private, the twiddles and factors stay in the shared config */
+    return sizeof(struct kiss_fftr_state) + sizeof(kiss_fft_cpx) * (nfft >> 1);
+}
+
+kiss_fftr_cfg kiss_fftr_alloc_shared(kiss_fftr_cfg shared,void * mem,size_t * lenmem)
+{
+    kiss_fftr_cfg st = NULL;
+    size_t memneeded;
+
+    memneeded = kiss_fftr_shared_size(shared->substate->nfft << 1);
+
+    if (lenmem == NULL) {
+        st = (kiss_fftr_cfg) KISS_FFT_MALLOC (memneeded);
+    } else {
+        if (*lenmem >= memneeded)
+            st = (kiss_fftr_cfg) mem;
+        *lenmem = memneeded;
+    }
+    if (!st)
+        return NULL;
+
+    st->substate = shared->substate;
+    st->tmpbuf = (kiss_fft_cpx *) (st + 1);
+    st->super_twiddles = shared->super_twiddles;
+    return st;
+}
+
 void kiss_fftr(kiss_fftr_cfg st,const kiss_fft_scalar *timedata,kiss_fft_cpx *freqdata)
 {
     /* input buffer timedata is stored row-wise */
@@ -25,6 +25,18 @@ kiss_fftr_cfg kiss_fftr_alloc(int nfft,int inverse_fft,void * mem, size_t * lenm
  If you don't care to allocate space, use mem = lenmem = NULL
 */
 
+kiss_fftr_cfg kiss_fftr_alloc_shared(kiss_fftr_cfg shared,void * mem, size_t * lenmem);
+/*
+ Same transform as shared, but with its own scratch buffer so that several users
+ can run it concurrently. The twiddle tables are not copied: shared must stay
+ allocated until every config created from it has been freed.
+*/
+
+size_t kiss_fftr_shared_size(int nfft);
+/*
+ Bytes needed by kiss_fftr_alloc_shared() for an nfft-point config
+*/
+
 
 void kiss_fftr(kiss_fftr_cfg cfg,const kiss_fft_scalar *timedata,kiss_fft_cpx *freqdata);
 /*
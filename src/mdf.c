@@ -73,6 +73,8 @@
 #include "pseudofloat.h"
 #include "math_approx.h"
 #include "os_support.h"
+#include "profile.h"
+#include <math.h>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -118,14 +120,53 @@ static const spx_float_t VAR_BACKTRACK = 4.f;
 #define PLAYBACK_DELAY 2
 
 void speex_echo_get_residual(SpeexEchoState *st, spx_word32_t *Yout, int len);
+void speex_echo_get_residual_fused(SpeexEchoState *st, spx_word32_t *Yout, int len);
 
 
+/* Scratch of one job slot: jobs running at the same time each need their own */
+typedef struct {
+   void *fft_table;
+   spx_word32_t *PHI;
+   spx_word16_t *wtmp;
+#ifdef FIXED_POINT
+   spx_word16_t *wtmp2;
+#endif
+#ifdef SPEEXDSP_PROFILE
+   SpeexProfileCounters profile; /* Slot 0 also times the serial parts and counts frames */
+#endif
+} MdfScratch;
+
+/* Raw material of SpeexEchoTelemetry, converted when read */
+typedef struct {
+   spx_word32_t Sdd, Sff;                  /* Microphone and output energy of the last frame */
+   spx_word32_t Sdd_avg, Sff_avg, Syy_avg; /* Smoothed, echo estimate energy too */
+   spx_word16_t RER;
+   spx_word16_t rate;                      /* Energy-weighted mean of the step size mask */
+   spx_uint32_t frames;
+   spx_uint32_t foreground_updates;
+   spx_uint32_t background_resets;
+   spx_uint32_t resets;
+   spx_uint32_t saturations;
+} MdfTelemetry;
+
+/* Per-microphone sums of a frame, filled by the jobs and added up in order */
+#define MDF_SFF 0
+#define MDF_SEE 1
+#define MDF_DBF 2
+#define MDF_SEY 3
+#define MDF_SYY 4
+#define MDF_SDD 5
+#define MDF_SUMS 6
+
 /** Speex echo cancellation state. */
 struct SpeexEchoState_ {
    int frame_size;           /**< Number of samples processed each time */
    int window_size;
    int M;
    int cancel_count;
+   int constraint_count;     /**< Partitions whose weights get the gradient constraint each frame */
+   int constraint_boost;     /**< Same while the filter converges or recovers (0: no boost) */
+   int boost_frames;         /**< Frames of recovery left after the background filter was reset */
    int adapted;
    int saturated;
    int screwed_up;
@@ -140,7 +181,8 @@ struct SpeexEchoState_ {
 
    spx_word16_t *e;      /* scratch */
    spx_word16_t *x;      /* Far-end input buffer (2N) */
-   spx_word16_t *X;      /* Far-end buffer (M+1 frames) in frequency domain */
+   spx_word16_t *X;      /* Far-end buffer (M+1 frames) in frequency domain, a ring starting at X_head */
+   int X_head;           /* Block of X holding the latest frame */
    spx_word16_t *input;  /* scratch */
    spx_word16_t *y;      /* scratch */
    spx_word16_t *last_y;
@@ -163,6 +205,9 @@ struct SpeexEchoState_ {
 #endif
    spx_word32_t *Rf;     /* scratch */
    spx_word32_t *Yf;     /* scratch */
+#ifndef FIXED_POINT
+   spx_word32_t *Yf_weight; /* Maps the echo power spectrum to the residual echo (fused post-filter) */
+#endif
    spx_word32_t *Xf;     /* scratch */
    spx_word32_t *Eh;
    spx_word32_t *Yh;
@@ -175,6 +220,15 @@ struct SpeexEchoState_ {
    spx_word16_t preemph;
    spx_word16_t notch_radius;
    spx_mem_t *notch_mem;
+   void *mem;            /* Block holding the state and its per-bin arrays, NULL if caller-provided */
+   void *mem_filter;     /* Block holding W, foreground and X, NULL if caller-provided */
+
+   spx_word32_t *chan_sums;   /* MDF_SUMS per microphone */
+   SpeexEchoParallel parallel;
+   MdfScratch *scratch;       /* One per job slot */
+   MdfScratch serial_scratch; /* Slot 0: fft_table, PHI and wtmp above */
+   void *mem_parallel;        /* Slots of the other workers, NULL when serial */
+   MdfTelemetry telemetry;
 
    /* NOTE: If you only use speex_echo_cancel() and want to save some memory, remove this */
    spx_int16_t *play_buf;
@@ -182,7 +236,18 @@ struct SpeexEchoState_ {
    int play_buf_started;
 };
 
-static inline void filter_dc_notch16(const spx_int16_t *in, spx_word16_t radius, spx_word16_t *out, int len, spx_mem_t *mem, int stride)
+/* Sample i of the input, which is either 16-bit (in) or float (in_float, on
+   the same scale but neither rounded nor clipped) */
+static inline spx_word16_t mdf_sample(const spx_int16_t *in, const float *in_float, int i)
+{
+#ifdef FIXED_POINT
+   return in_float ? WORD2INT(in_float[i]) : in[i];
+#else
+   return in_float ? in_float[i] : in[i];
+#endif
+}
+
+static inline void filter_dc_notch16(const spx_int16_t *in, const float *in_float, int offset, spx_word16_t radius, spx_word16_t *out, int len, spx_mem_t *mem, int stride)
 {
    int i;
    spx_word16_t den2;
@@ -194,7 +259,7 @@ static inline void filter_dc_notch16(const spx_int16_t *in, spx_word16_t radius,
    /*printf ("%d %d %d %d %d %d\n", num[0], num[1], num[2], den[0], den[1], den[2]);*/
    for (i=0;i<len;i++)
    {
-      spx_word16_t vin = in[i*stride];
+      spx_word16_t vin = mdf_sample(in, in_float, offset+i*stride);
       spx_word32_t vout = mem[0] + SHL32(EXTEND32(vin),15);
 #ifdef FIXED_POINT
       mem[0] = mem[1] + SHL32(SHL32(-EXTEND32(vin),15) + MULT16_32_Q15(radius,vout),1);
@@ -246,15 +311,20 @@ static inline void power_spectrum_accum(const spx_word16_t *X, spx_word32_t *ps,
    ps[j]+=MULT16_16(X[i],X[i]);
 }
 
-/** Compute cross-power spectrum of a half-complex (packed) vectors and add to acc */
+/* Block j of a ring of M blocks of N words read from its newest block on: the
+   first wrap blocks follow X, the others start over at X_wrap */
+#define MDF_RING_BLOCK(X,X_wrap,wrap,j,N) ((j)<(wrap) ? (X)+(j)*(N) : (X_wrap)+((j)-(wrap))*(N))
+
+/** Compute cross-power spectrum of a half-complex (packed) vectors and add to acc.
+    X is read as a ring (see MDF_RING_BLOCK) */
 #ifdef FIXED_POINT
-static inline void spectral_mul_accum(const spx_word16_t *X, const spx_word32_t *Y, spx_word16_t *acc, int N, int M)
+static inline void spectral_mul_accum(const spx_word16_t *X, const spx_word16_t *X_wrap, int wrap, const spx_word32_t *Y, spx_word16_t *acc, int N, int M)
 {
    int i,j;
    spx_word32_t tmp1=0,tmp2=0;
    for (j=0;j<M;j++)
    {
-      tmp1 = MAC16_16(tmp1, X[j*N],TOP16(Y[j*N]));
+      tmp1 = MAC16_16(tmp1, MDF_RING_BLOCK(X,X_wrap,wrap,j,N)[0],TOP16(Y[j*N]));
    }
    acc[0] = PSHR32(tmp1,WEIGHT_SHIFT);
    for (i=1;i<N-1;i+=2)
@@ -262,8 +332,9 @@ static inline void spectral_mul_accum(const spx_word16_t *X, const spx_word32_t
       tmp1 = tmp2 = 0;
       for (j=0;j<M;j++)
       {
-         tmp1 = SUB32(MAC16_16(tmp1, X[j*N+i],TOP16(Y[j*N+i])), MULT16_16(X[j*N+i+1],TOP16(Y[j*N+i+1])));
-         tmp2 = MAC16_16(MAC16_16(tmp2, X[j*N+i+1],TOP16(Y[j*N+i])), X[j*N+i], TOP16(Y[j*N+i+1]));
+         const spx_word16_t *Xj = MDF_RING_BLOCK(X,X_wrap,wrap,j,N);
+         tmp1 = SUB32(MAC16_16(tmp1, Xj[i],TOP16(Y[j*N+i])), MULT16_16(Xj[i+1],TOP16(Y[j*N+i+1])));
+         tmp2 = MAC16_16(MAC16_16(tmp2, Xj[i+1],TOP16(Y[j*N+i])), Xj[i], TOP16(Y[j*N+i+1]));
       }
       acc[i] = PSHR32(tmp1,WEIGHT_SHIFT);
       acc[i+1] = PSHR32(tmp2,WEIGHT_SHIFT);
@@ -271,17 +342,17 @@ static inline void spectral_mul_accum(const spx_word16_t *X, const spx_word32_t
    tmp1 = tmp2 = 0;
    for (j=0;j<M;j++)
    {
-      tmp1 = MAC16_16(tmp1, X[(j+1)*N-1],TOP16(Y[(j+1)*N-1]));
+      tmp1 = MAC16_16(tmp1, MDF_RING_BLOCK(X,X_wrap,wrap,j,N)[N-1],TOP16(Y[(j+1)*N-1]));
    }
    acc[N-1] = PSHR32(tmp1,WEIGHT_SHIFT);
 }
-static inline void spectral_mul_accum16(const spx_word16_t *X, const spx_word16_t *Y, spx_word16_t *acc, int N, int M)
+static inline void spectral_mul_accum16(const spx_word16_t *X, const spx_word16_t *X_wrap, int wrap, const spx_word16_t *Y, spx_word16_t *acc, int N, int M)
 {
    int i,j;
    spx_word32_t tmp1=0,tmp2=0;
    for (j=0;j<M;j++)
    {
-      tmp1 = MAC16_16(tmp1, X[j*N],Y[j*N]);
+      tmp1 = MAC16_16(tmp1, MDF_RING_BLOCK(X,X_wrap,wrap,j,N)[0],Y[j*N]);
    }
    acc[0] = PSHR32(tmp1,WEIGHT_SHIFT);
    for (i=1;i<N-1;i+=2)
@@ -289,8 +360,9 @@ static inline void spectral_mul_accum16(const spx_word16_t *X, const spx_word16_
       tmp1 = tmp2 = 0;
       for (j=0;j<M;j++)
       {
-         tmp1 = SUB32(MAC16_16(tmp1, X[j*N+i],Y[j*N+i]), MULT16_16(X[j*N+i+1],Y[j*N+i+1]));
-         tmp2 = MAC16_16(MAC16_16(tmp2, X[j*N+i+1],Y[j*N+i]), X[j*N+i], Y[j*N+i+1]);
+         const spx_word16_t *Xj = MDF_RING_BLOCK(X,X_wrap,wrap,j,N);
+         tmp1 = SUB32(MAC16_16(tmp1, Xj[i],Y[j*N+i]), MULT16_16(Xj[i+1],Y[j*N+i+1]));
+         tmp2 = MAC16_16(MAC16_16(tmp2, Xj[i+1],Y[j*N+i]), Xj[i], Y[j*N+i+1]);
       }
       acc[i] = PSHR32(tmp1,WEIGHT_SHIFT);
       acc[i+1] = PSHR32(tmp2,WEIGHT_SHIFT);
@@ -298,19 +370,21 @@ static inline void spectral_mul_accum16(const spx_word16_t *X, const spx_word16_
    tmp1 = tmp2 = 0;
    for (j=0;j<M;j++)
    {
-      tmp1 = MAC16_16(tmp1, X[(j+1)*N-1],Y[(j+1)*N-1]);
+      tmp1 = MAC16_16(tmp1, MDF_RING_BLOCK(X,X_wrap,wrap,j,N)[N-1],Y[(j+1)*N-1]);
    }
    acc[N-1] = PSHR32(tmp1,WEIGHT_SHIFT);
 }
 
 #else
-static inline void spectral_mul_accum(const spx_word16_t *X, const spx_word32_t *Y, spx_word16_t *acc, int N, int M)
+static inline void spectral_mul_accum(const spx_word16_t *X, const spx_word16_t *X_wrap, int wrap, const spx_word32_t *Y, spx_word16_t *acc, int N, int M)
 {
    int i,j;
    for (i=0;i<N;i++)
       acc[i] = 0;
    for (j=0;j<M;j++)
    {
+      if (j==wrap)
+         X = X_wrap;
       acc[0] += X[0]*Y[0];
       for (i=1;i<N-1;i+=2)
       {
@@ -342,12 +416,12 @@ static inline void weighted_spectral_mul_conj(const spx_float_t *w, const spx_fl
    prod[i] = FLOAT_MUL32(W,MULT16_16(X[i],Y[i]));
 }
 
-static inline void mdf_adjust_prop(const spx_word32_t *W, int N, int M, int P, spx_word16_t *prop)
+/* Weight norm of partitions from to to-1, the first half of the proportional
+   adaptation rate (the partitions can be split between jobs) */
+static inline void mdf_prop_norms(const spx_word32_t *W, int N, int M, int P, spx_word16_t *prop, int from, int to)
 {
    int i, j, p;
-   spx_word16_t max_sum = 1;
-   spx_word32_t prop_sum = 1;
-   for (i=0;i<M;i++)
+   for (i=from;i<to;i++)
    {
       spx_word32_t tmp = 1;
       for (p=0;p<P;p++)
@@ -358,6 +432,17 @@ static inline void mdf_adjust_prop(const spx_word32_t *W, int N, int M, int P, s
       tmp = MIN32(ABS32(tmp), 536870912);
 #endif
       prop[i] = spx_sqrt(tmp);
+   }
+}
+
+/* Turns the weight norms into proportional adaptation rates */
+static inline void mdf_prop_normalize(int M, spx_word16_t *prop)
+{
+   int i;
+   spx_word16_t max_sum = 1;
+   spx_word32_t prop_sum = 1;
+   for (i=0;i<M;i++)
+   {
       if (prop[i] > max_sum)
          max_sum = prop[i];
    }
@@ -396,10 +481,132 @@ EXPORT SpeexEchoState *speex_echo_state_init(int frame_size, int filter_length)
    return speex_echo_state_init_mc(frame_size, filter_length, 1, 1);
 }
 
+/* Carves the state and all its arrays from the arenas, returns NULL while measuring.
+   The per-bin working arrays go to a, the M-block filters and far-end history to
+   filt. Both are hot (W is read by the filter, updated by the gradient and the
+   constraint and copied on filter switches, X is read by the filter, the update
+   and the proportional rate), but they are separate blocks so that a tail too
+   long for internal RAM only sends filt to PSRAM. */
+static SpeexEchoState *mdf_layout(SpeexArena *a, SpeexArena *filt, int frame_size, int M, int C, int K)
+{
+   SpeexEchoState *st, *ret;
+   SpeexEchoState dummy;
+   int N = 2*frame_size;
+
+   /* While measuring, the array pointers go to a throwaway struct */
+   ret = (SpeexEchoState*)speex_arena_alloc(a, sizeof(SpeexEchoState));
+   st = ret ? ret : &dummy;
+   st->fft_table = spx_fft_init_arena(N, a);
+
+   st->e = (spx_word16_t*)speex_arena_alloc(a, C*N*sizeof(spx_word16_t));
+   st->x = (spx_word16_t*)speex_arena_alloc(a, K*N*sizeof(spx_word16_t));
+   st->input = (spx_word16_t*)speex_arena_alloc(a, C*frame_size*sizeof(spx_word16_t));
+   st->y = (spx_word16_t*)speex_arena_alloc(a, C*N*sizeof(spx_word16_t));
+   st->last_y = (spx_word16_t*)speex_arena_alloc(a, C*N*sizeof(spx_word16_t));
+   st->Yf = (spx_word32_t*)speex_arena_alloc(a, (frame_size+1)*sizeof(spx_word32_t));
+#ifndef FIXED_POINT
+   st->Yf_weight = (spx_word32_t*)speex_arena_alloc(a, (frame_size+1)*sizeof(spx_word32_t));
+#endif
+   st->Rf = (spx_word32_t*)speex_arena_alloc(a, (frame_size+1)*sizeof(spx_word32_t));
+   st->Xf = (spx_word32_t*)speex_arena_alloc(a, (frame_size+1)*sizeof(spx_word32_t));
+   st->Yh = (spx_word32_t*)speex_arena_alloc(a, (frame_size+1)*sizeof(spx_word32_t));
+   st->Eh = (spx_word32_t*)speex_arena_alloc(a, (frame_size+1)*sizeof(spx_word32_t));
+
+   st->X = (spx_word16_t*)speex_arena_alloc(filt, K*(M+1)*N*sizeof(spx_word16_t));
+   st->Y = (spx_word16_t*)speex_arena_alloc(a, C*N*sizeof(spx_word16_t));
+   st->E = (spx_word16_t*)speex_arena_alloc(a, C*N*sizeof(spx_word16_t));
+   st->W = (spx_word32_t*)speex_arena_alloc(filt, C*K*M*N*sizeof(spx_word32_t));
+#ifdef TWO_PATH
+   st->foreground = (spx_word16_t*)speex_arena_alloc(filt, M*N*C*K*sizeof(spx_word16_t));
+#endif
+   st->PHI = (spx_word32_t*)speex_arena_alloc(a, N*sizeof(spx_word32_t));
+   st->power = (spx_word32_t*)speex_arena_alloc(a, (frame_size+1)*sizeof(spx_word32_t));
+   st->power_1 = (spx_float_t*)speex_arena_alloc(a, (frame_size+1)*sizeof(spx_float_t));
+   st->window = (spx_word16_t*)speex_arena_alloc(a, N*sizeof(spx_word16_t));
+   st->prop = (spx_word16_t*)speex_arena_alloc(a, M*sizeof(spx_word16_t));
+   st->wtmp = (spx_word16_t*)speex_arena_alloc(a, N*sizeof(spx_word16_t));
+#ifdef FIXED_POINT
+   st->wtmp2 = (spx_word16_t*)speex_arena_alloc(a, N*sizeof(spx_word16_t));
+#endif
+   st->memX = (spx_word16_t*)speex_arena_alloc(a, K*sizeof(spx_word16_t));
+   st->memD = (spx_word16_t*)speex_arena_alloc(a, C*sizeof(spx_word16_t));
+   st->memE = (spx_word16_t*)speex_arena_alloc(a, C*sizeof(spx_word16_t));
+   st->notch_mem = (spx_mem_t*)speex_arena_alloc(a, 2*C*sizeof(spx_mem_t));
+   st->chan_sums = (spx_word32_t*)speex_arena_alloc(a, C*MDF_SUMS*sizeof(spx_word32_t));
+   st->play_buf = (spx_int16_t*)speex_arena_alloc(a, K*(PLAYBACK_DELAY+1)*frame_size*sizeof(spx_int16_t));
+
+   return ret;
+}
+
+EXPORT int speex_echo_state_get_size_mc(int frame_size, int filter_length, int nb_mic, int nb_speakers)
+{
+   SpeexArena a;
+   speex_arena_measure(&a);
+   mdf_layout(&a, &a, frame_size, (filter_length+frame_size-1)/frame_size, nb_mic, nb_speakers);
+   return (int)speex_arena_footprint(&a);
+}
+
 EXPORT SpeexEchoState *speex_echo_state_init_mc(int frame_size, int filter_length, int nb_mic, int nb_speakers)
+{
+   return speex_echo_state_init_mc_mem(frame_size, filter_length, nb_mic, nb_speakers, NULL, 0);
+}
+
+EXPORT SpeexEchoState *speex_echo_state_init_mc_mem(int frame_size, int filter_length, int nb_mic, int nb_speakers, void *mem, int mem_size)
 {
    int i,N,M, C, K;
-   SpeexEchoState *st = (SpeexEchoState *)speex_alloc(sizeof(SpeexEchoState));
+   SpeexEchoState *st;
+   SpeexArena hot, filt;
+   void *owned = NULL, *owned_filter = NULL;
+
+   M = (filter_length+frame_size-1)/frame_size;
+   if (mem)
+   {
+      int size = speex_echo_state_get_size_mc(frame_size, filter_length, nb_mic, nb_speakers);
+      if (mem_size < size)
+      {
+         speex_warning_int("Echo canceller needs a bigger memory block:", size);
+         return NULL;
+      }
+      SPEEX_MEMSET((char*)mem, 0, size);
+      speex_arena_init(&hot, mem, size);
+      st = mdf_layout(&hot, &hot, frame_size, M, nb_mic, nb_speakers);
+   } else {
+      size_t hot_size, filt_size;
+      speex_arena_measure(&hot);
+      speex_arena_measure(&filt);
+      mdf_layout(&hot, &filt, frame_size, M, nb_mic, nb_speakers);
+      hot_size = speex_arena_footprint(&hot);
+      filt_size = speex_arena_footprint(&filt);
+      /* Per-bin arrays first: they are the ones to keep internal if only one fits */
+      owned = speex_alloc_tier(hot_size, SPEEX_MEM_HOT);
+      owned_filter = speex_alloc_tier(filt_size, SPEEX_MEM_HOT);
+      if (!owned || !owned_filter)
+      {
+         speex_free_tier(owned);
+         speex_free_tier(owned_filter);
+         return NULL;
+      }
+      speex_arena_init(&hot, owned, hot_size);
+      speex_arena_init(&filt, owned_filter, filt_size);
+      st = mdf_layout(&hot, &filt, frame_size, M, nb_mic, nb_speakers);
+   }
+   st->mem = owned;
+   st->mem_filter = owned_filter;
+   st->serial_scratch.fft_table = st->fft_table;
+   st->serial_scratch.PHI = st->PHI;
+   st->serial_scratch.wtmp = st->wtmp;
+#ifdef FIXED_POINT
+   st->serial_scratch.wtmp2 = st->wtmp2;
+#endif
+   st->scratch = &st->serial_scratch;
+   st->parallel.workers = 1;
+   st->parallel.run = NULL;
+   st->parallel.ctx = NULL;
+   st->mem_parallel = NULL;
+   SPEEX_MEMSET(&st->telemetry, 0, 1);
+#ifdef SPEEXDSP_PROFILE
+   profile_clear(&st->serial_scratch.profile);
+#endif
 
    st->K = nb_speakers;
    st->C = nb_mic;
@@ -418,6 +625,10 @@ EXPORT SpeexEchoState *speex_echo_state_init_mc(int frame_size, int filter_lengt
    N = st->window_size;
    M = st->M = (filter_length+st->frame_size-1)/frame_size;
    st->cancel_count=0;
+   st->X_head = 0;
+   st->constraint_count = 2;
+   st->constraint_boost = 0;
+   st->boost_frames = 0;
    st->sum_adapt = 0;
    st->saturated = 0;
    st->screwed_up = 0;
@@ -433,34 +644,7 @@ EXPORT SpeexEchoState *speex_echo_state_init_mc(int frame_size, int filter_lengt
 #endif
    st->leak_estimate = 0;
 
-   st->fft_table = spx_fft_init(N);
-
-   st->e = (spx_word16_t*)speex_alloc(C*N*sizeof(spx_word16_t));
-   st->x = (spx_word16_t*)speex_alloc(K*N*sizeof(spx_word16_t));
-   st->input = (spx_word16_t*)speex_alloc(C*st->frame_size*sizeof(spx_word16_t));
-   st->y = (spx_word16_t*)speex_alloc(C*N*sizeof(spx_word16_t));
-   st->last_y = (spx_word16_t*)speex_alloc(C*N*sizeof(spx_word16_t));
-   st->Yf = (spx_word32_t*)speex_alloc((st->frame_size+1)*sizeof(spx_word32_t));
-   st->Rf = (spx_word32_t*)speex_alloc((st->frame_size+1)*sizeof(spx_word32_t));
-   st->Xf = (spx_word32_t*)speex_alloc((st->frame_size+1)*sizeof(spx_word32_t));
-   st->Yh = (spx_word32_t*)speex_alloc((st->frame_size+1)*sizeof(spx_word32_t));
-   st->Eh = (spx_word32_t*)speex_alloc((st->frame_size+1)*sizeof(spx_word32_t));
-
-   st->X = (spx_word16_t*)speex_alloc(K*(M+1)*N*sizeof(spx_word16_t));
-   st->Y = (spx_word16_t*)speex_alloc(C*N*sizeof(spx_word16_t));
-   st->E = (spx_word16_t*)speex_alloc(C*N*sizeof(spx_word16_t));
-   st->W = (spx_word32_t*)speex_alloc(C*K*M*N*sizeof(spx_word32_t));
-#ifdef TWO_PATH
-   st->foreground = (spx_word16_t*)speex_alloc(M*N*C*K*sizeof(spx_word16_t));
-#endif
-   st->PHI = (spx_word32_t*)speex_alloc(N*sizeof(spx_word32_t));
-   st->power = (spx_word32_t*)speex_alloc((frame_size+1)*sizeof(spx_word32_t));
-   st->power_1 = (spx_float_t*)speex_alloc((frame_size+1)*sizeof(spx_float_t));
-   st->window = (spx_word16_t*)speex_alloc(N*sizeof(spx_word16_t));
-   st->prop = (spx_word16_t*)speex_alloc(M*sizeof(spx_word16_t));
-   st->wtmp = (spx_word16_t*)speex_alloc(N*sizeof(spx_word16_t));
 #ifdef FIXED_POINT
-   st->wtmp2 = (spx_word16_t*)speex_alloc(N*sizeof(spx_word16_t));
    for (i=0;i<N>>1;i++)
    {
       st->window[i] = (16383-SHL16(spx_cos(DIV32_16(MULT16_16(25736,i<<1),N)),1));
@@ -491,10 +675,14 @@ EXPORT SpeexEchoState *speex_echo_state_init_mc(int frame_size, int filter_lengt
       }
    }
 
-   st->memX = (spx_word16_t*)speex_alloc(K*sizeof(spx_word16_t));
-   st->memD = (spx_word16_t*)speex_alloc(C*sizeof(spx_word16_t));
-   st->memE = (spx_word16_t*)speex_alloc(C*sizeof(spx_word16_t));
    st->preemph = QCONST16(.9,15);
+#ifndef FIXED_POINT
+   /* Y holds the spectrum of the (pre-emphasised) echo estimate over one rectangular
+      frame, while speex_echo_get_residual() looks at the de-emphasised echo over
+      two Hann-windowed frames (3/4 of the energy). Undo the pre-emphasis per bin. */
+   for (i=0;i<=st->frame_size;i++)
+      st->Yf_weight[i] = .75f/(1.f + st->preemph*st->preemph - 2.f*st->preemph*cos(M_PI*i/st->frame_size));
+#endif
    if (st->sampling_rate<12000)
       st->notch_radius = QCONST16(.9, 15);
    else if (st->sampling_rate<24000)
@@ -502,7 +690,6 @@ EXPORT SpeexEchoState *speex_echo_state_init_mc(int frame_size, int filter_lengt
    else
       st->notch_radius = QCONST16(.992, 15);
 
-   st->notch_mem = (spx_mem_t*)speex_alloc(2*C*sizeof(spx_mem_t));
    st->adapted = 0;
    st->Pey = st->Pyy = FLOAT_ONE;
 
@@ -511,7 +698,6 @@ EXPORT SpeexEchoState *speex_echo_state_init_mc(int frame_size, int filter_lengt
    st->Dvar1 = st->Dvar2 = FLOAT_ZERO;
 #endif
 
-   st->play_buf = (spx_int16_t*)speex_alloc(K*(PLAYBACK_DELAY+1)*st->frame_size*sizeof(spx_int16_t));
    st->play_buf_pos = PLAYBACK_DELAY*st->frame_size;
    st->play_buf_started = 0;
 
@@ -523,19 +709,21 @@ EXPORT void speex_echo_state_reset(SpeexEchoState *st)
 {
    int i, M, N, C, K;
    st->cancel_count=0;
+   st->boost_frames = 0;
    st->screwed_up = 0;
    N = st->window_size;
    M = st->M;
    C=st->C;
    K=st->K;
-   for (i=0;i<N*M;i++)
+   for (i=0;i<N*M*C*K;i++)
       st->W[i] = 0;
 #ifdef TWO_PATH
-   for (i=0;i<N*M;i++)
+   for (i=0;i<N*M*C*K;i++)
       st->foreground[i] = 0;
 #endif
-   for (i=0;i<N*(M+1);i++)
+   for (i=0;i<N*(M+1)*K;i++)
       st->X[i] = 0;
+   st->X_head = 0;
    for (i=0;i<=st->frame_size;i++)
    {
       st->power[i] = 0;
@@ -577,45 +765,99 @@ EXPORT void speex_echo_state_reset(SpeexEchoState *st)
 
 }
 
-/** Destroys an echo canceller state */
-EXPORT void speex_echo_state_destroy(SpeexEchoState *st)
+#ifdef SPEEXDSP_PROFILE
+static const char *const mdf_stage_names[SPEEX_ECHO_STAGES] = {
+   "input", "fft", "filter", "adapt", "constraint", "output", "residual"
+};
+#endif
+
+/* Back to a single job slot */
+static void mdf_free_parallel(SpeexEchoState *st)
 {
-   spx_fft_destroy(st->fft_table);
+   int i;
+   if (st->mem_parallel)
+   {
+#ifdef SPEEXDSP_PROFILE
+      /* Keep the time spent by the workers */
+      st->serial_scratch.profile = st->scratch[0].profile;
+      for (i=1;i<st->parallel.workers;i++)
+      {
+         int k;
+         for (k=0;k<SPEEX_PROFILE_MAX_STAGES;k++)
+            st->serial_scratch.profile.ticks[k] += st->scratch[i].profile.ticks[k];
+      }
+#endif
+      for (i=1;i<st->parallel.workers;i++)
+         spx_fft_destroy(st->scratch[i].fft_table);
+      speex_free_tier(st->mem_parallel);
+      st->mem_parallel = NULL;
+   }
+   st->scratch = &st->serial_scratch;
+   st->parallel.workers = 1;
+   st->parallel.run = NULL;
+   st->parallel.ctx = NULL;
+}
 
-   speex_free(st->e);
-   speex_free(st->x);
-   speex_free(st->input);
-   speex_free(st->y);
-   speex_free(st->last_y);
-   speex_free(st->Yf);
-   speex_free(st->Rf);
-   speex_free(st->Xf);
-   speex_free(st->Yh);
-   speex_free(st->Eh);
-
-   speex_free(st->X);
-   speex_free(st->Y);
-   speex_free(st->E);
-   speex_free(st->W);
-#ifdef TWO_PATH
-   speex_free(st->foreground);
+/* Gives every worker of the pool its own job slot (FFT scratch, gradient and
+   constraint buffers). Slot 0 keeps using the state's own arrays. */
+static int mdf_set_parallel(SpeexEchoState *st, const SpeexEchoParallel *par)
+{
+   int i, workers, N = st->window_size;
+   size_t size;
+   char *mem;
+
+   mdf_free_parallel(st);
+   if (!par || !par->run || par->workers <= 1)
+      return 0;
+   workers = par->workers;
+   size = workers*sizeof(MdfScratch) + (workers-1)*N*(sizeof(spx_word32_t) + sizeof(spx_word16_t));
+#ifdef FIXED_POINT
+   size += (workers-1)*N*sizeof(spx_word16_t);
 #endif
-   speex_free(st->PHI);
-   speex_free(st->power);
-   speex_free(st->power_1);
-   speex_free(st->window);
-   speex_free(st->prop);
-   speex_free(st->wtmp);
+   mem = (char*)speex_alloc_tier(size, SPEEX_MEM_HOT);
+   if (!mem)
+      return -1;
+   st->scratch = (MdfScratch*)mem;
+   st->scratch[0] = st->serial_scratch;
+   mem += workers*sizeof(MdfScratch);
+   for (i=1;i<workers;i++)
+   {
+      MdfScratch *sc = &st->scratch[i];
+      sc->PHI = (spx_word32_t*)mem;
+      mem += N*sizeof(spx_word32_t);
+      sc->wtmp = (spx_word16_t*)mem;
+      mem += N*sizeof(spx_word16_t);
 #ifdef FIXED_POINT
-   speex_free(st->wtmp2);
+      sc->wtmp2 = (spx_word16_t*)mem;
+      mem += N*sizeof(spx_word16_t);
+#endif
+      sc->fft_table = spx_fft_init(N);
+      if (!sc->fft_table)
+      {
+         while (--i >= 1)
+            spx_fft_destroy(st->scratch[i].fft_table);
+         speex_free_tier(st->scratch);
+         st->scratch = &st->serial_scratch;
+         return -1;
+      }
+#ifdef SPEEXDSP_PROFILE
+      profile_clear(&sc->profile);
 #endif
-   speex_free(st->memX);
-   speex_free(st->memD);
-   speex_free(st->memE);
-   speex_free(st->notch_mem);
+   }
+   st->mem_parallel = st->scratch;
+   st->parallel = *par;
+   return 0;
+}
+
+/** Destroys an echo canceller state */
+EXPORT void speex_echo_state_destroy(SpeexEchoState *st)
+{
+   mdf_free_parallel(st);
+   spx_fft_destroy(st->fft_table);
 
-   speex_free(st->play_buf);
-   speex_free(st);
+   /* Everything else lives in the state's blocks */
+   speex_free_tier(st->mem_filter);
+   speex_free_tier(st->mem);
 
 #ifdef DUMP_ECHO_CANCEL_DATA
    fclose(rFile);
@@ -680,8 +922,253 @@ EXPORT void speex_echo_cancel(SpeexEchoState *st, const spx_int16_t *in, const s
    speex_echo_cancellation(st, in, far_end, out);
 }
 
-/** Performs echo cancellation on a frame */
-EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, const spx_int16_t *far_end, spx_int16_t *out)
+/* Whether partition j gets the gradient constraint in frame count when n of
+   the M partitions are constrained per frame: the first one every time and
+   n-1 of the others in turn (the AUMDF uses n=2), or all of them in turn for
+   n=1 */
+static inline int mdf_constrained(int j, int n, int M, int count)
+{
+   if (n >= M)
+      return 1;
+   if (n <= 1)
+      return j == count%M;
+   if (j == 0)
+      return 1;
+   return (j-1 + M-1 - (count%(M-1))*(n-1)%(M-1)) % (M-1) < n-1;
+}
+
+/* Frame j of the far-end ring (0 is the latest, M the oldest) */
+static inline spx_word16_t *mdf_X_block(SpeexEchoState *st, int j)
+{
+   int b = st->X_head + j;
+   if (b > st->M)
+      b -= st->M+1;
+   return st->X + b*st->window_size*st->K;
+}
+
+/* How many N-word blocks of the latest M frames follow frame 0 before the
+   ring wraps around */
+static inline int mdf_X_wrap(SpeexEchoState *st)
+{
+   return MIN32(st->M, st->M+1-st->X_head)*st->K;
+}
+
+#define MDF_KEEP 0
+#define MDF_UPDATE_FOREGROUND 1
+#define MDF_RESET_BACKGROUND 2
+
+/* What the jobs of a frame need besides the state */
+typedef struct {
+   SpeexEchoState *st;
+   const spx_int16_t *in;
+   const float *in_float;
+   spx_int16_t *out;
+   float *out_float;
+   spx_word16_t *X0;
+   int X_wrap;
+   int adapt;        /* Apply the weight gradient */
+   int constrained;  /* Partitions constrained this frame */
+   int update;       /* MDF_KEEP, MDF_UPDATE_FOREGROUND or MDF_RESET_BACKGROUND */
+   int jobs;         /* Size of the current batch */
+} MdfFrame;
+
+/* Runs job 0 to jobs-1 splitting units (partitions, microphones, ...) between
+   them, on the worker pool if there is one. Job w uses job slot w and times
+   itself, so the caller charges its own work before and restarts the clock
+   after (waiting for the other workers is not charged to any stage). */
+static void mdf_run(SpeexEchoState *st, MdfFrame *f, void (*job)(void *arg, int index), int units)
+{
+   f->jobs = MIN32(units, st->parallel.workers);
+   if (f->jobs > 1)
+      st->parallel.run(st->parallel.ctx, job, f, f->jobs);
+   else
+      job(f, 0);
+   PROFILE_BEGIN(&st->scratch[0].profile);
+}
+
+/* Weight norms of a slice of the partitions */
+static void mdf_job_prop(void *arg, int w)
+{
+   MdfFrame *f = (MdfFrame*)arg;
+   SpeexEchoState *st = f->st;
+   int M = st->M;
+   PROFILE_BEGIN(&st->scratch[w].profile);
+   mdf_prop_norms(st->W, st->window_size, M, st->C*st->K, st->prop, M*w/f->jobs, M*(w+1)/f->jobs);
+   PROFILE_STAGE(&st->scratch[w].profile, SPEEX_ECHO_STAGE_ADAPT);
+}
+
+/* Gradient step and constraint for a slice of the (mic, speaker, partition) blocks */
+static void mdf_job_update(void *arg, int w)
+{
+   MdfFrame *f = (MdfFrame*)arg;
+   SpeexEchoState *st = f->st;
+   MdfScratch *sc = &st->scratch[w];
+   int N = st->window_size, M = st->M, K = st->K;
+   int units = st->C*K*M;
+   int u, i;
+
+   PROFILE_BEGIN(&sc->profile);
+   for (u=units*w/f->jobs;u<units*(w+1)/f->jobs;u++)
+   {
+      int chan = u/(K*M), speak = u/M%K, j = u%M;
+      spx_word32_t *W = &st->W[chan*N*K*M + j*N*K + speak*N];
+
+      if (f->adapt)
+      {
+         weighted_spectral_mul_conj(st->power_1, FLOAT_SHL(PSEUDOFLOAT(st->prop[j]),-15), mdf_X_block(st, j+1)+speak*N, st->E+chan*N, sc->PHI, N);
+         for (i=0;i<N;i++)
+            W[i] += sc->PHI[i];
+         PROFILE_STAGE(&sc->profile, SPEEX_ECHO_STAGE_ADAPT);
+      }
+      /* This is a variant of the Alternatively Updated MDF (AUMDF) */
+      /* Constraining all partitions makes this an MDF filter */
+      if (mdf_constrained(j, f->constrained, M, st->cancel_count))
+      {
+#ifdef FIXED_POINT
+         for (i=0;i<N;i++)
+            sc->wtmp2[i] = EXTRACT16(PSHR32(W[i],NORMALIZE_SCALEDOWN+16));
+         spx_ifft(sc->fft_table, sc->wtmp2, sc->wtmp);
+         for (i=0;i<st->frame_size;i++)
+         {
+            sc->wtmp[i]=0;
+         }
+         for (i=st->frame_size;i<N;i++)
+         {
+            sc->wtmp[i]=SHL16(sc->wtmp[i],NORMALIZE_SCALEUP);
+         }
+         spx_fft(sc->fft_table, sc->wtmp, sc->wtmp2);
+         /* The "-1" in the shift is a sort of kludge that trades less efficient update speed for decrease noise */
+         for (i=0;i<N;i++)
+            W[i] -= SHL32(EXTEND32(sc->wtmp2[i]),16+NORMALIZE_SCALEDOWN-NORMALIZE_SCALEUP-1);
+#else
+         spx_ifft(sc->fft_table, W, sc->wtmp);
+         for (i=st->frame_size;i<N;i++)
+         {
+            sc->wtmp[i]=0;
+         }
+         spx_fft(sc->fft_table, sc->wtmp, W);
+#endif
+         PROFILE_STAGE(&sc->profile, SPEEX_ECHO_STAGE_CONSTRAINT);
+      }
+   }
+}
+
+/* Foreground and background filter outputs of every jobs-th microphone */
+static void mdf_job_filter(void *arg, int w)
+{
+   MdfFrame *f = (MdfFrame*)arg;
+   SpeexEchoState *st = f->st;
+   MdfScratch *sc = &st->scratch[w];
+   int N = st->window_size, M = st->M, K = st->K;
+   int chan, i;
+
+   PROFILE_BEGIN(&sc->profile);
+   for (chan=w;chan<st->C;chan+=f->jobs)
+   {
+      spx_word32_t *sums = st->chan_sums + chan*MDF_SUMS;
+#ifdef TWO_PATH
+      /* Compute foreground filter */
+      spectral_mul_accum16(f->X0, st->X, f->X_wrap, st->foreground+chan*N*K*M, st->Y+chan*N, N, M*K);
+      spx_ifft(sc->fft_table, st->Y+chan*N, st->e+chan*N);
+      for (i=0;i<st->frame_size;i++)
+         st->e[chan*N+i] = SUB16(st->input[chan*st->frame_size+i], st->e[chan*N+i+st->frame_size]);
+      sums[MDF_SFF] = mdf_inner_prod(st->e+chan*N, st->e+chan*N, st->frame_size);
+
+      /* Difference in response, this is used to estimate the variance of our residual power estimate */
+      spectral_mul_accum(f->X0, st->X, f->X_wrap, st->W+chan*N*K*M, st->Y+chan*N, N, M*K);
+      spx_ifft(sc->fft_table, st->Y+chan*N, st->y+chan*N);
+      for (i=0;i<st->frame_size;i++)
+         st->e[chan*N+i] = SUB16(st->e[chan*N+i+st->frame_size], st->y[chan*N+i+st->frame_size]);
+      sums[MDF_DBF] = 10+mdf_inner_prod(st->e+chan*N, st->e+chan*N, st->frame_size);
+      for (i=0;i<st->frame_size;i++)
+         st->e[chan*N+i] = SUB16(st->input[chan*st->frame_size+i], st->y[chan*N+i+st->frame_size]);
+      sums[MDF_SEE] = mdf_inner_prod(st->e+chan*N, st->e+chan*N, st->frame_size);
+#else
+      sums[MDF_SFF] = sums[MDF_DBF] = sums[MDF_SEE] = 0;
+#endif
+   }
+   PROFILE_STAGE(&sc->profile, SPEEX_ECHO_STAGE_FILTER);
+}
+
+/* Output, error spectrum and echo estimate spectrum of every jobs-th microphone,
+   after switching filters if the frame decided so */
+static void mdf_job_output(void *arg, int w)
+{
+   MdfFrame *f = (MdfFrame*)arg;
+   SpeexEchoState *st = f->st;
+   MdfScratch *sc = &st->scratch[w];
+   int N = st->window_size, M = st->M, K = st->K;
+   int chan, i;
+
+   PROFILE_BEGIN(&sc->profile);
+   for (chan=w;chan<st->C;chan+=f->jobs)
+   {
+      spx_word32_t *sums = st->chan_sums + chan*MDF_SUMS;
+#ifdef TWO_PATH
+      if (f->update == MDF_UPDATE_FOREGROUND)
+      {
+         /* Copy background filter to foreground filter */
+         for (i=chan*N*M*K;i<(chan+1)*N*M*K;i++)
+            st->foreground[i] = EXTRACT16(PSHR32(st->W[i],16));
+         /* Apply a smooth transition so as to not introduce blocking artifacts */
+         for (i=0;i<st->frame_size;i++)
+            st->e[chan*N+i+st->frame_size] = MULT16_16_Q15(st->window[i+st->frame_size],st->e[chan*N+i+st->frame_size]) + MULT16_16_Q15(st->window[i],st->y[chan*N+i+st->frame_size]);
+      } else if (f->update == MDF_RESET_BACKGROUND) {
+         /* Copy foreground filter to background filter */
+         for (i=chan*N*M*K;i<(chan+1)*N*M*K;i++)
+            st->W[i] = SHL32(EXTEND32(st->foreground[i]),16);
+         /* We also need to copy the output so as to get correct adaptation */
+         for (i=0;i<st->frame_size;i++)
+            st->y[chan*N+i+st->frame_size] = st->e[chan*N+i+st->frame_size];
+         for (i=0;i<st->frame_size;i++)
+            st->e[chan*N+i] = SUB16(st->input[chan*st->frame_size+i], st->y[chan*N+i+st->frame_size]);
+      }
+#endif
+
+      /* Compute error signal (for the output with de-emphasis) */
+      for (i=0;i<st->frame_size;i++)
+      {
+         spx_word32_t tmp_out;
+#ifdef TWO_PATH
+         tmp_out = SUB32(EXTEND32(st->input[chan*st->frame_size+i]), EXTEND32(st->e[chan*N+i+st->frame_size]));
+#else
+         tmp_out = SUB32(EXTEND32(st->input[chan*st->frame_size+i]), EXTEND32(st->y[chan*N+i+st->frame_size]));
+#endif
+         tmp_out = ADD32(tmp_out, EXTEND32(MULT16_16_P15(st->preemph, st->memE[chan])));
+         if (f->out_float)
+            f->out_float[i*st->C+chan] = tmp_out;
+         else
+            f->out[i*st->C+chan] = WORD2INT(tmp_out);
+         st->memE[chan] = tmp_out;
+      }
+
+      /* Compute error signal (filter update version) */
+      for (i=0;i<st->frame_size;i++)
+      {
+         st->e[chan*N+i+st->frame_size] = st->e[chan*N+i];
+         st->e[chan*N+i] = 0;
+      }
+
+      /* Compute a bunch of correlations */
+      /* FIXME: bad merge */
+      sums[MDF_SEY] = mdf_inner_prod(st->e+chan*N+st->frame_size, st->y+chan*N+st->frame_size, st->frame_size);
+      sums[MDF_SYY] = mdf_inner_prod(st->y+chan*N+st->frame_size, st->y+chan*N+st->frame_size, st->frame_size);
+      sums[MDF_SDD] = mdf_inner_prod(st->input+chan*st->frame_size, st->input+chan*st->frame_size, st->frame_size);
+      PROFILE_STAGE(&sc->profile, SPEEX_ECHO_STAGE_OUTPUT);
+
+      /* Convert error to frequency domain */
+      spx_fft(sc->fft_table, st->e+chan*N, st->E+chan*N);
+      for (i=0;i<st->frame_size;i++)
+         st->y[i+chan*N] = 0;
+      spx_fft(sc->fft_table, st->y+chan*N, st->Y+chan*N);
+      PROFILE_STAGE(&sc->profile, SPEEX_ECHO_STAGE_FFT);
+   }
+}
+
+/* One frame of echo cancellation. Either the 16-bit buffers or the float ones
+   (in_float, far_float, out_float) are given, the others are NULL */
+static void echo_cancellation_frame(SpeexEchoState *st, const spx_int16_t *in, const float *in_float,
+                                    const spx_int16_t *far_end, const float *far_float, spx_int16_t *out, float *out_float)
 {
    int i,j, chan, speak;
    int N,M, C, K;
@@ -696,13 +1183,20 @@ EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, c
    spx_float_t alpha, alpha_1;
    spx_word16_t RER;
    spx_word32_t tmp32;
+   spx_word16_t *X0;
+   int X_wrap;
+   int constrained;
+   int clipped;
+   MdfFrame frame;
 
    N = st->window_size;
    M = st->M;
    C = st->C;
    K = st->K;
 
+   PROFILE_FRAME(&st->scratch[0].profile);
    st->cancel_count++;
+   st->telemetry.frames++;
 #ifdef FIXED_POINT
    ss=DIV32_16(11469,M);
    ss_1 = SUB16(32767,ss);
@@ -714,7 +1208,7 @@ EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, c
    for (chan = 0; chan < C; chan++)
    {
       /* Apply a notch filter to make sure DC doesn't end up causing problems */
-      filter_dc_notch16(in+chan, st->notch_radius, st->input+chan*st->frame_size, st->frame_size, st->notch_mem+2*chan, C);
+      filter_dc_notch16(in, in_float, chan, st->notch_radius, st->input+chan*st->frame_size, st->frame_size, st->notch_mem+2*chan, C);
       /* Copy input data to buffer and apply pre-emphasis */
       /* Copy input data to buffer */
       for (i=0;i<st->frame_size;i++)
@@ -746,8 +1240,9 @@ EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, c
       for (i=0;i<st->frame_size;i++)
       {
          spx_word32_t tmp32;
+         const spx_word16_t far_sample = mdf_sample(far_end, far_float, i*K+speak);
          st->x[speak*N+i] = st->x[speak*N+i+st->frame_size];
-         tmp32 = SUB32(EXTEND32(far_end[i*K+speak]), EXTEND32(MULT16_16_P15(st->preemph, st->memX[speak])));
+         tmp32 = SUB32(EXTEND32(far_sample), EXTEND32(MULT16_16_P15(st->preemph, st->memX[speak])));
 #ifdef FIXED_POINT
          /*FIXME: If saturation occurs here, we need to freeze adaptation for M frames (not just one) */
          if (tmp32 > 32767)
@@ -762,126 +1257,78 @@ EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, c
          }
 #endif
          st->x[speak*N+i+st->frame_size] = EXTRACT16(tmp32);
-         st->memX[speak] = far_end[i*K+speak];
+         st->memX[speak] = far_sample;
       }
    }
 
+   PROFILE_STAGE(&st->scratch[0].profile, SPEEX_ECHO_STAGE_INPUT);
+
+   /* The oldest frame of the ring makes room for the new one (instead of
+      shifting all M+1 frames) */
+   st->X_head = st->X_head ? st->X_head-1 : M;
+   X0 = mdf_X_block(st, 0);
+   X_wrap = mdf_X_wrap(st);
    for (speak = 0; speak < K; speak++)
    {
-      /* Shift memory: this could be optimized eventually*/
-      for (j=M-1;j>=0;j--)
-      {
-         for (i=0;i<N;i++)
-            st->X[(j+1)*N*K+speak*N+i] = st->X[j*N*K+speak*N+i];
-      }
       /* Convert x (echo input) to frequency domain */
-      spx_fft(st->fft_table, st->x+speak*N, &st->X[speak*N]);
+      spx_fft(st->fft_table, st->x+speak*N, X0+speak*N);
    }
 
    Sxx = 0;
    for (speak = 0; speak < K; speak++)
    {
       Sxx += mdf_inner_prod(st->x+speak*N+st->frame_size, st->x+speak*N+st->frame_size, st->frame_size);
-      power_spectrum_accum(st->X+speak*N, st->Xf, N);
+      power_spectrum_accum(X0+speak*N, st->Xf, N);
    }
+   PROFILE_STAGE(&st->scratch[0].profile, SPEEX_ECHO_STAGE_FFT);
 
-   Sff = 0;
-   for (chan = 0; chan < C; chan++)
-   {
-#ifdef TWO_PATH
-      /* Compute foreground filter */
-      spectral_mul_accum16(st->X, st->foreground+chan*N*K*M, st->Y+chan*N, N, M*K);
-      spx_ifft(st->fft_table, st->Y+chan*N, st->e+chan*N);
-      for (i=0;i<st->frame_size;i++)
-         st->e[chan*N+i] = SUB16(st->input[chan*st->frame_size+i], st->e[chan*N+i+st->frame_size]);
-      Sff += mdf_inner_prod(st->e+chan*N, st->e+chan*N, st->frame_size);
-#endif
-   }
+   frame.st = st;
+   frame.in = in;
+   frame.in_float = in_float;
+   frame.out = out;
+   frame.out_float = out_float;
+   frame.X0 = X0;
+   frame.X_wrap = X_wrap;
+   frame.update = MDF_KEEP;
 
    /* Adjust proportional adaption rate */
    /* FIXME: Adjust that for C, K*/
    if (st->adapted)
-      mdf_adjust_prop (st->W, N, M, C*K, st->prop);
-   /* Compute weight gradient */
-   if (st->saturated == 0)
    {
-      for (chan = 0; chan < C; chan++)
-      {
-         for (speak = 0; speak < K; speak++)
-         {
-            for (j=M-1;j>=0;j--)
-            {
-               weighted_spectral_mul_conj(st->power_1, FLOAT_SHL(PSEUDOFLOAT(st->prop[j]),-15), &st->X[(j+1)*N*K+speak*N], st->E+chan*N, st->PHI, N);
-               for (i=0;i<N;i++)
-                  st->W[chan*N*K*M + j*N*K + speak*N + i] += st->PHI[i];
-            }
-         }
-      }
-   } else {
-      st->saturated--;
+      mdf_run(st, &frame, mdf_job_prop, M);
+      mdf_prop_normalize(M, st->prop);
    }
+   /* Compute weight gradient */
+   frame.adapt = st->saturated == 0;
+   if (!frame.adapt)
+      st->saturated--;
 
    /* FIXME: MC conversion required */
    /* Update weight to prevent circular convolution (MDF / AUMDF) */
-   for (chan = 0; chan < C; chan++)
-   {
-      for (speak = 0; speak < K; speak++)
-      {
-         for (j=0;j<M;j++)
-         {
-            /* This is a variant of the Alternatively Updated MDF (AUMDF) */
-            /* Remove the "if" to make this an MDF filter */
-            if (j==0 || st->cancel_count%(M-1) == j-1)
-            {
-#ifdef FIXED_POINT
-               for (i=0;i<N;i++)
-                  st->wtmp2[i] = EXTRACT16(PSHR32(st->W[chan*N*K*M + j*N*K + speak*N + i],NORMALIZE_SCALEDOWN+16));
-               spx_ifft(st->fft_table, st->wtmp2, st->wtmp);
-               for (i=0;i<st->frame_size;i++)
-               {
-                  st->wtmp[i]=0;
-               }
-               for (i=st->frame_size;i<N;i++)
-               {
-                  st->wtmp[i]=SHL16(st->wtmp[i],NORMALIZE_SCALEUP);
-               }
-               spx_fft(st->fft_table, st->wtmp, st->wtmp2);
-               /* The "-1" in the shift is a sort of kludge that trades less efficient update speed for decrease noise */
-               for (i=0;i<N;i++)
-                  st->W[chan*N*K*M + j*N*K + speak*N + i] -= SHL32(EXTEND32(st->wtmp2[i]),16+NORMALIZE_SCALEDOWN-NORMALIZE_SCALEUP-1);
-#else
-               spx_ifft(st->fft_table, &st->W[chan*N*K*M + j*N*K + speak*N], st->wtmp);
-               for (i=st->frame_size;i<N;i++)
-               {
-                  st->wtmp[i]=0;
-               }
-               spx_fft(st->fft_table, st->wtmp, &st->W[chan*N*K*M + j*N*K + speak*N]);
-#endif
-            }
-         }
-      }
-   }
+   constrained = st->constraint_count;
+   if (st->constraint_boost > constrained && (!st->adapted || st->boost_frames > 0))
+      constrained = st->constraint_boost;
+   if (st->boost_frames > 0)
+      st->boost_frames--;
+   frame.constrained = constrained;
+   PROFILE_STAGE(&st->scratch[0].profile, SPEEX_ECHO_STAGE_ADAPT);
+   mdf_run(st, &frame, mdf_job_update, C*K*M);
 
    /* So we can use power_spectrum_accum */
    for (i=0;i<=st->frame_size;i++)
       st->Rf[i] = st->Yf[i] = st->Xf[i] = 0;
+   PROFILE_STAGE(&st->scratch[0].profile, SPEEX_ECHO_STAGE_RESIDUAL);
 
+   mdf_run(st, &frame, mdf_job_filter, C);
+   Sff = 0;
    Dbf = 0;
    See = 0;
-#ifdef TWO_PATH
-   /* Difference in response, this is used to estimate the variance of our residual power estimate */
    for (chan = 0; chan < C; chan++)
    {
-      spectral_mul_accum(st->X, st->W+chan*N*K*M, st->Y+chan*N, N, M*K);
-      spx_ifft(st->fft_table, st->Y+chan*N, st->y+chan*N);
-      for (i=0;i<st->frame_size;i++)
-         st->e[chan*N+i] = SUB16(st->e[chan*N+i+st->frame_size], st->y[chan*N+i+st->frame_size]);
-      Dbf += 10+mdf_inner_prod(st->e+chan*N, st->e+chan*N, st->frame_size);
-      for (i=0;i<st->frame_size;i++)
-         st->e[chan*N+i] = SUB16(st->input[chan*st->frame_size+i], st->y[chan*N+i+st->frame_size]);
-      See += mdf_inner_prod(st->e+chan*N, st->e+chan*N, st->frame_size);
+      Sff += st->chan_sums[chan*MDF_SUMS+MDF_SFF];
+      Dbf += st->chan_sums[chan*MDF_SUMS+MDF_DBF];
+      See += st->chan_sums[chan*MDF_SUMS+MDF_SEE];
    }
-#endif
 
 #ifndef TWO_PATH
    Sff = See;
@@ -918,13 +1365,9 @@ EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, c
    {
       st->Davg1 = st->Davg2 = 0;
       st->Dvar1 = st->Dvar2 = FLOAT_ZERO;
-      /* Copy background filter to foreground filter */
-      for (i=0;i<N*M*C*K;i++)
-         st->foreground[i] = EXTRACT16(PSHR32(st->W[i],16));
-      /* Apply a smooth transition so as to not introduce blocking artifacts */
-      for (chan = 0; chan < C; chan++)
-         for (i=0;i<st->frame_size;i++)
-            st->e[chan*N+i+st->frame_size] = MULT16_16_Q15(st->window[i+st->frame_size],st->e[chan*N+i+st->frame_size]) + MULT16_16_Q15(st->window[i],st->y[chan*N+i+st->frame_size]);
+      /* Copy background filter to foreground filter (done by the output jobs) */
+      frame.update = MDF_UPDATE_FOREGROUND;
+      st->telemetry.foreground_updates++;
    } else {
       int reset_background=0;
       /* Otherwise, check if the background filter is significantly worse */
@@ -936,74 +1379,48 @@ EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, c
          reset_background = 1;
       if (reset_background)
       {
-         /* Copy foreground filter to background filter */
-         for (i=0;i<N*M*C*K;i++)
-            st->W[i] = SHL32(EXTEND32(st->foreground[i]),16);
-         /* We also need to copy the output so as to get correct adaptation */
-         for (chan = 0; chan < C; chan++)
-         {
-            for (i=0;i<st->frame_size;i++)
-               st->y[chan*N+i+st->frame_size] = st->e[chan*N+i+st->frame_size];
-            for (i=0;i<st->frame_size;i++)
-               st->e[chan*N+i] = SUB16(st->input[chan*st->frame_size+i], st->y[chan*N+i+st->frame_size]);
-         }
+         /* Copy foreground filter to background filter (done by the output jobs) */
+         frame.update = MDF_RESET_BACKGROUND;
+         st->telemetry.background_resets++;
          See = Sff;
          st->Davg1 = st->Davg2 = 0;
          st->Dvar1 = st->Dvar2 = FLOAT_ZERO;
+         /* Readapting from the foreground filter, constrain more for a while */
+         st->boost_frames = M;
       }
    }
 #endif
+   PROFILE_STAGE(&st->scratch[0].profile, SPEEX_ECHO_STAGE_OUTPUT);
 
+   mdf_run(st, &frame, mdf_job_output, C);
    Sey = Syy = Sdd = 0;
    for (chan = 0; chan < C; chan++)
    {
-      /* Compute error signal (for the output with de-emphasis) */
-      for (i=0;i<st->frame_size;i++)
-      {
-         spx_word32_t tmp_out;
-#ifdef TWO_PATH
-         tmp_out = SUB32(EXTEND32(st->input[chan*st->frame_size+i]), EXTEND32(st->e[chan*N+i+st->frame_size]));
-#else
-         tmp_out = SUB32(EXTEND32(st->input[chan*st->frame_size+i]), EXTEND32(st->y[chan*N+i+st->frame_size]));
-#endif
-         tmp_out = ADD32(tmp_out, EXTEND32(MULT16_16_P15(st->preemph, st->memE[chan])));
-      /* This is an arbitrary test for saturation in the microphone signal */
-         if (in[i*C+chan] <= -32000 || in[i*C+chan] >= 32000)
-         {
-         if (st->saturated == 0)
-            st->saturated = 1;
-         }
-         out[i*C+chan] = WORD2INT(tmp_out);
-         st->memE[chan] = tmp_out;
-      }
-
+      spx_word32_t *sums = st->chan_sums + chan*MDF_SUMS;
 #ifdef DUMP_ECHO_CANCEL_DATA
-      dump_audio(in, far_end, out, st->frame_size);
+      if (out)
+         dump_audio(in, far_end, out, st->frame_size);
 #endif
-
-      /* Compute error signal (filter update version) */
-      for (i=0;i<st->frame_size;i++)
-      {
-         st->e[chan*N+i+st->frame_size] = st->e[chan*N+i];
-         st->e[chan*N+i] = 0;
-      }
-
-      /* Compute a bunch of correlations */
-      /* FIXME: bad merge */
-      Sey += mdf_inner_prod(st->e+chan*N+st->frame_size, st->y+chan*N+st->frame_size, st->frame_size);
-      Syy += mdf_inner_prod(st->y+chan*N+st->frame_size, st->y+chan*N+st->frame_size, st->frame_size);
-      Sdd += mdf_inner_prod(st->input+chan*st->frame_size, st->input+chan*st->frame_size, st->frame_size);
-
-      /* Convert error to frequency domain */
-      spx_fft(st->fft_table, st->e+chan*N, st->E+chan*N);
-      for (i=0;i<st->frame_size;i++)
-         st->y[i+chan*N] = 0;
-      spx_fft(st->fft_table, st->y+chan*N, st->Y+chan*N);
-
+      Sey += sums[MDF_SEY];
+      Syy += sums[MDF_SYY];
+      Sdd += sums[MDF_SDD];
       /* Compute power spectrum of echo (X), error (E) and filter response (Y) */
       power_spectrum_accum(st->E+chan*N, st->Rf, N);
       power_spectrum_accum(st->Y+chan*N, st->Yf, N);
-
+   }
+   /* This is an arbitrary test for saturation in the microphone signal */
+   clipped = 0;
+   for (i=0;i<st->frame_size*C;i++)
+   {
+      const spx_word16_t in_sample = mdf_sample(in, in_float, i);
+      if (in_sample <= -32000 || in_sample >= 32000)
+         clipped = 1;
+   }
+   if (clipped)
+   {
+      st->telemetry.saturations++;
+      if (st->saturated == 0)
+         st->saturated = 1;
    }
 
    /*printf ("%f %f %f %f\n", Sff, See, Syy, Sdd, st->update_cond);*/
@@ -1018,7 +1435,12 @@ EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, c
       /* Things have gone really bad */
       st->screwed_up += 50;
       for (i=0;i<st->frame_size*C;i++)
-         out[i] = 0;
+      {
+         if (out_float)
+            out_float[i] = 0;
+         else
+            out[i] = 0;
+      }
    } else if (SHR32(Sff, 2) > ADD32(Sdd, SHR32(MULT16_16(N, 10000),6)))
    {
       /* AEC seems to add lots of echo instead of removing it, let's see if it will improve */
@@ -1030,17 +1452,25 @@ EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, c
    if (st->screwed_up>=50)
    {
       speex_warning("The echo canceller started acting funny and got slapped (reset). It swears it will behave now.");
+      st->telemetry.resets++;
       speex_echo_state_reset(st);
+      PROFILE_STAGE(&st->scratch[0].profile, SPEEX_ECHO_STAGE_RESIDUAL);
       return;
    }
 
+   st->telemetry.Sdd = Sdd;
+   st->telemetry.Sff = Sff;
+   st->telemetry.Sdd_avg = ADD32(MULT16_32_Q15(QCONST16(.98f,15),st->telemetry.Sdd_avg), MULT16_32_Q15(QCONST16(.02f,15),Sdd));
+   st->telemetry.Sff_avg = ADD32(MULT16_32_Q15(QCONST16(.98f,15),st->telemetry.Sff_avg), MULT16_32_Q15(QCONST16(.02f,15),Sff));
+   st->telemetry.Syy_avg = ADD32(MULT16_32_Q15(QCONST16(.98f,15),st->telemetry.Syy_avg), MULT16_32_Q15(QCONST16(.02f,15),Syy));
+
    /* Add a small noise floor to make sure not to have problems when dividing */
    See = MAX32(See, SHR32(MULT16_16(N, 100),6));
 
    for (speak = 0; speak < K; speak++)
    {
       Sxx += mdf_inner_prod(st->x+speak*N+st->frame_size, st->x+speak*N+st->frame_size, st->frame_size);
-      power_spectrum_accum(st->X+speak*N, st->Xf, N);
+      power_spectrum_accum(X0+speak*N, st->Xf, N);
    }
 
 
@@ -1117,6 +1547,7 @@ EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, c
    if (RER > .5)
       RER = .5;
 #endif
+   st->telemetry.RER = RER;
 
    /* We consider that the filter has had minimal adaptation if the following is true*/
    if (!st->adapted && st->sum_adapt > SHL32(EXTEND32(M),15) && MULT16_32_Q15(st->leak_estimate,Syy) > MULT16_32_Q15(QCONST16(.03f,15),Syy))
@@ -1126,6 +1557,7 @@ EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, c
 
    if (st->adapted)
    {
+      spx_float_t r_sum = FLOAT_ZERO, e_sum = FLOAT_ZERO;
       /* Normal learning rate calculation once we're past the minimal adaptation phase */
       for (i=0;i<=st->frame_size;i++)
       {
@@ -1141,9 +1573,12 @@ EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, c
             r = .5*e;
 #endif
          r = MULT16_32_Q15(QCONST16(.7,15),r) + MULT16_32_Q15(QCONST16(.3,15),(spx_word32_t)(MULT16_32_Q15(RER,e)));
+         r_sum = FLOAT_ADD(r_sum, PSEUDOFLOAT(r));
+         e_sum = FLOAT_ADD(e_sum, PSEUDOFLOAT(e));
          /*st->power_1[i] = adapt_rate*r/(e*(1+st->power[i]));*/
          st->power_1[i] = FLOAT_SHL(FLOAT_DIV32_FLOAT(r,FLOAT_MUL32U(e,st->power[i]+10)),WEIGHT_SHIFT+16);
       }
+      st->telemetry.rate = FLOAT_EXTRACT16(FLOAT_SHL(FLOAT_DIVU(r_sum,e_sum),15));
    } else {
       /* Temporary adaption rate if filter is not yet adapted enough */
       spx_word16_t adapt_rate=0;
@@ -1162,6 +1597,8 @@ EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, c
       }
       for (i=0;i<=st->frame_size;i++)
          st->power_1[i] = FLOAT_SHL(FLOAT_DIV32(EXTEND32(adapt_rate),ADD32(st->power[i],10)),WEIGHT_SHIFT+1);
+      /* Twice the mask above in the scale of r/e */
+      st->telemetry.rate = ADD16(adapt_rate, adapt_rate);
 
 
       /* How much have we adapted so far? */
@@ -1175,13 +1612,25 @@ EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, c
    {
       /* If the filter is adapted, take the filtered echo */
       for (i=0;i<st->frame_size;i++)
-         st->last_y[st->frame_size+i] = in[i]-out[i];
+         st->last_y[st->frame_size+i] = mdf_sample(in, in_float, i) - (out_float ? out_float[i] : out[i]);
    } else {
       /* If filter isn't adapted yet, all we can do is take the far end signal directly */
       /* moved earlier: for (i=0;i<N;i++)
       st->last_y[i] = st->x[i];*/
    }
+   PROFILE_STAGE(&st->scratch[0].profile, SPEEX_ECHO_STAGE_RESIDUAL);
+}
+
+/** Performs echo cancellation on a frame */
+EXPORT void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *in, const spx_int16_t *far_end, spx_int16_t *out)
+{
+   echo_cancellation_frame(st, in, NULL, far_end, NULL, out, NULL);
+}
 
+/** Performs echo cancellation on a float frame */
+EXPORT void speex_echo_cancellation_float(SpeexEchoState *st, const float *in, const float *far_end, float *out)
+{
+   echo_cancellation_frame(st, NULL, in, NULL, far_end, NULL, out);
 }
 
 /* Compute spectrum of estimated echo for use in an echo post-filter */
@@ -1218,6 +1667,66 @@ void speex_echo_get_residual(SpeexEchoState *st, spx_word32_t *residual_echo, in
 
 }
 
+/* Same as speex_echo_get_residual(), but reuses the echo spectrum computed by
+   the last speex_echo_cancellation() call instead of running another FFT.
+   This is what the preprocessor uses in fused mode. Like the classic estimate
+   it describes the first microphone: Yf sums the echo of all of them. */
+void speex_echo_get_residual_fused(SpeexEchoState *st, spx_word32_t *residual_echo, int len)
+{
+#ifdef FIXED_POINT
+   speex_echo_get_residual(st, residual_echo, len);
+#else
+   int i;
+   spx_word16_t leak2;
+
+   /* Until the filter has adapted there is no echo estimate (see last_y) */
+   if (!st->adapted)
+   {
+      for (i=0;i<=st->frame_size;i++)
+         residual_echo[i] = 0;
+      return;
+   }
+
+   if (st->leak_estimate>.5)
+      leak2 = 1;
+   else
+      leak2 = 2*st->leak_estimate;
+   power_spectrum(st->Y, residual_echo, st->window_size);
+   for (i=0;i<=st->frame_size;i++)
+      residual_echo[i] = leak2*st->Yf_weight[i]*residual_echo[i];
+#endif
+}
+
+#ifdef FIXED_POINT
+#define MDF_Q15_FLOAT(x) ((x)*(1.f/32768.f))
+#else
+#define MDF_Q15_FLOAT(x) (x)
+#endif
+
+/* Energy ratio in dB, with a floor of 1 on both sides */
+static float mdf_db(spx_word32_t num, spx_word32_t den)
+{
+   return 10.f*(float)log10((1.f+(float)num)/(1.f+(float)den));
+}
+
+static void mdf_telemetry_report(SpeexEchoState *st, SpeexEchoTelemetry *out)
+{
+   const MdfTelemetry *t = &st->telemetry;
+   out->erle = mdf_db(t->Sdd, t->Sff);
+   out->erle_avg = mdf_db(t->Sdd_avg, t->Sff_avg);
+   out->echo_level = mdf_db(t->Syy_avg, t->Sdd_avg);
+   out->leak = MDF_Q15_FLOAT(st->leak_estimate);
+   out->residual_ratio = MDF_Q15_FLOAT(t->RER);
+   out->adapt_rate = MDF_Q15_FLOAT(t->rate);
+   out->adapted = st->adapted;
+   out->saturated = st->saturated;
+   out->frames = t->frames;
+   out->foreground_updates = t->foreground_updates;
+   out->background_resets = t->background_resets;
+   out->resets = t->resets;
+   out->saturations = t->saturations;
+}
+
 EXPORT int speex_echo_ctl(SpeexEchoState *st, int request, void *ptr)
 {
    switch(request)
@@ -1246,6 +1755,55 @@ EXPORT int speex_echo_ctl(SpeexEchoState *st, int request, void *ptr)
       case SPEEX_ECHO_GET_SAMPLING_RATE:
          (*(int*)ptr) = st->sampling_rate;
          break;
+      case SPEEX_ECHO_SET_CONSTRAINT_PARTITIONS:
+         st->constraint_count = MAX32(1, *(int*)ptr);
+         break;
+      case SPEEX_ECHO_GET_CONSTRAINT_PARTITIONS:
+         (*(int*)ptr) = st->constraint_count;
+         break;
+      case SPEEX_ECHO_SET_CONSTRAINT_BOOST:
+         st->constraint_boost = MAX32(0, *(int*)ptr);
+         break;
+      case SPEEX_ECHO_GET_CONSTRAINT_BOOST:
+         (*(int*)ptr) = st->constraint_boost;
+         break;
+      case SPEEX_ECHO_SET_PARALLEL:
+         if (mdf_set_parallel(st, (const SpeexEchoParallel*)ptr) != 0)
+         {
+            speex_warning("Not enough memory for the echo canceller workers");
+            return -1;
+         }
+         break;
+      case SPEEX_ECHO_GET_PARALLEL:
+         (*(SpeexEchoParallel*)ptr) = st->parallel;
+         break;
+      case SPEEX_ECHO_GET_TELEMETRY:
+         mdf_telemetry_report(st, (SpeexEchoTelemetry*)ptr);
+         break;
+      case SPEEX_ECHO_RESET_TELEMETRY:
+         SPEEX_MEMSET(&st->telemetry, 0, 1);
+         break;
+#ifdef SPEEXDSP_PROFILE
+      case SPEEX_ECHO_GET_PROFILE:
+      {
+         int i;
+         profile_report((SpeexProfile*)ptr, &st->scratch[0].profile, mdf_stage_names, SPEEX_ECHO_STAGES);
+         for (i=0;i<st->parallel.workers;i++)
+            profile_add((SpeexProfile*)ptr, &st->scratch[i].profile);
+      }
+         break;
+      case SPEEX_ECHO_RESET_PROFILE:
+      {
+         int i;
+         for (i=0;i<st->parallel.workers;i++)
+            profile_clear(&st->scratch[i].profile);
+      }
+         break;
+#else
+      case SPEEX_ECHO_GET_PROFILE:
+      case SPEEX_ECHO_RESET_PROFILE:
+         return -1;
+#endif
       case SPEEX_ECHO_GET_IMPULSE_RESPONSE_SIZE:
          /*FIXME: Implement this for multiple channels */
          *((spx_int32_t *)ptr) = st->M * st->frame_size;
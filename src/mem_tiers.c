@@ -0,0 +1,97 @@
+/* File: mem_tiers.c
+   Host model of the ESP32 memory tiers (see mem_tiers.h)
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted under the same terms as the rest of SpeexDSP.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef SPEEXDSP_HOST_BUILD
+
+#include "os_support.h"
+#include "mem_tiers.h"
+
+/* Each block starts with its size and tier; 16 bytes keeps the payload aligned */
+#define TIER_HEADER 16
+
+static SpeexMemTierStats tiers;
+static speex_lock_t tiers_lock = SPEEX_LOCK_INITIALIZER;
+
+void speex_mem_tiers_set_capacity(size_t internal_bytes)
+{
+   speex_lock(&tiers_lock);
+   tiers.internal_capacity = internal_bytes;
+   speex_unlock(&tiers_lock);
+}
+
+void speex_mem_tiers_get_stats(SpeexMemTierStats *stats)
+{
+   speex_lock(&tiers_lock);
+   *stats = tiers;
+   speex_unlock(&tiers_lock);
+}
+
+void speex_mem_tiers_reset_peaks(void)
+{
+   speex_lock(&tiers_lock);
+   tiers.internal_peak = tiers.internal_used;
+   tiers.psram_peak = tiers.psram_used;
+   tiers.hot_fallbacks = 0;
+   speex_unlock(&tiers_lock);
+}
+
+void *speex_mem_tiers_alloc(size_t size, int tier)
+{
+   char *block = (char*)calloc(size + TIER_HEADER, 1);
+   if (!block)
+      return NULL;
+
+   speex_lock(&tiers_lock);
+   if (tier == SPEEX_MEM_HOT)
+   {
+      if (tiers.internal_capacity && tiers.internal_used + size > tiers.internal_capacity)
+      {
+         tiers.hot_fallbacks++;
+         tier = SPEEX_MEM_COLD;
+      }
+   }
+   if (tier == SPEEX_MEM_HOT)
+   {
+      tiers.internal_used += size;
+      if (tiers.internal_used > tiers.internal_peak)
+         tiers.internal_peak = tiers.internal_used;
+   } else {
+      tier = SPEEX_MEM_COLD;
+      tiers.psram_used += size;
+      if (tiers.psram_used > tiers.psram_peak)
+         tiers.psram_peak = tiers.psram_used;
+   }
+   speex_unlock(&tiers_lock);
+
+   *(size_t*)block = size;
+   *(int*)(block + sizeof(size_t)) = tier;
+   return block + TIER_HEADER;
+}
+
+void speex_mem_tiers_free(void *ptr)
+{
+   char *block;
+   size_t size;
+   if (!ptr)
+      return;
+   block = (char*)ptr - TIER_HEADER;
+   size = *(size_t*)block;
+
+   speex_lock(&tiers_lock);
+   if (*(int*)(block + sizeof(size_t)) == SPEEX_MEM_HOT)
+      tiers.internal_used -= size;
+   else
+      tiers.psram_used -= size;
+   speex_unlock(&tiers_lock);
+   free(block);
+}
+
+#endif
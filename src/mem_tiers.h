@@ -0,0 +1,52 @@
+/* File: mem_tiers.h
+   Host model of the ESP32 memory tiers
+
+   On the device speex_alloc_tier() puts hot arrays in internal RAM and cold
+   ones in PSRAM. The host build routes the same calls through this model,
+   which gives "internal RAM" a configurable capacity, falls back to "PSRAM"
+   when it is exhausted (as heap_caps_calloc() failing does on the device) and
+   keeps usage counters per tier, so placement can be checked and
+   benchmarked without hardware. Access latency is not modelled.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted under the same terms as the rest of SpeexDSP.
+*/
+
+#ifndef MEM_TIERS_H
+#define MEM_TIERS_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+   size_t internal_capacity;  /**< Simulated internal RAM, 0 for unlimited */
+   size_t internal_used;      /**< Bytes currently placed in internal RAM */
+   size_t internal_peak;      /**< Highest internal_used since the last reset */
+   size_t psram_used;         /**< Bytes currently placed in PSRAM */
+   size_t psram_peak;         /**< Highest psram_used since the last reset */
+   int hot_fallbacks;         /**< Hot requests that did not fit and went to PSRAM */
+} SpeexMemTierStats;
+
+/** Sets the simulated internal RAM size in bytes (0 = unlimited, the default) */
+void speex_mem_tiers_set_capacity(size_t internal_bytes);
+
+/** Copies the current counters */
+void speex_mem_tiers_get_stats(SpeexMemTierStats *stats);
+
+/** Resets the peaks to the current usage and clears the fallback count */
+void speex_mem_tiers_reset_peaks(void);
+
+/** Backend of speex_alloc_tier() on the host (zeroed memory) */
+void *speex_mem_tiers_alloc(size_t size, int tier);
+
+/** Backend of speex_free_tier() on the host */
+void speex_mem_tiers_free(void *ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
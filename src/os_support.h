@@ -41,6 +41,11 @@
 
 #include "config.h"
 
+/** Memory tiers for speex_alloc_tier(): hot arrays are touched on every frame and
+    belong in the fastest memory, cold ones hold bulk or rarely used data */
+#define SPEEX_MEM_COLD 0
+#define SPEEX_MEM_HOT  1
+
 #ifdef OS_SUPPORT_CUSTOM
 #include "os_support_custom.h"
 #endif
@@ -90,6 +95,24 @@ static inline void speex_free_scratch (void *ptr)
 }
 #endif
 
+/** Same as speex_alloc, with a hint on how often the area is accessed (SPEEX_MEM_HOT or SPEEX_MEM_COLD).
+    Platforms with several kinds of memory can keep hot data in the fast one. Free with speex_free_tier() */
+#ifndef OVERRIDE_SPEEX_ALLOC_TIER
+static inline void *speex_alloc_tier (int size, int tier)
+{
+   (void)tier;
+   return speex_alloc(size);
+}
+#endif
+
+/** Frees memory obtained from speex_alloc_tier() */
+#ifndef OVERRIDE_SPEEX_FREE_TIER
+static inline void speex_free_tier (void *ptr)
+{
+   speex_free(ptr);
+}
+#endif
+
 /** Copy n elements from src to dst. The 0* term provides compile-time type checking  */
 #ifndef OVERRIDE_SPEEX_COPY
 #define SPEEX_COPY(dst, src, n) (memcpy((dst), (src), (n)*sizeof(*(dst)) + 0*((dst)-(src)) ))
@@ -106,6 +129,22 @@ static inline void speex_free_scratch (void *ptr)
 #define SPEEX_MEMSET(dst, c, n) (memset((dst), (c), (n)*sizeof(*(dst))))
 #endif
 
+/** Lock protecting tables shared by all states (e.g. the FFT plan cache). The default does
+    nothing, which is only safe if states are created and destroyed from a single thread */
+#ifndef OVERRIDE_SPEEX_LOCK
+typedef int speex_lock_t;
+#define SPEEX_LOCK_INITIALIZER 0
+#define speex_lock(l) ((void)(l))
+#define speex_unlock(l) ((void)(l))
+#endif
+
+/** Clock for the stage profiler (SPEEXDSP_PROFILE builds only). The default is
+    clock(), which is coarse; platforms should provide a cycle or ns counter */
+#if defined(SPEEXDSP_PROFILE) && !defined(OVERRIDE_SPEEX_PROFILE_TICKS)
+#include <time.h>
+#define speex_profile_ticks() ((unsigned int)clock())
+#define speex_profile_ticks_per_second() ((unsigned int)CLOCKS_PER_SEC)
+#endif
 
 #ifndef OVERRIDE_SPEEX_FATAL
 static inline void _speex_fatal(const char *str, const char *file, int line)
@@ -14,6 +14,9 @@
 #include <freertos/FreeRTOS.h> // For pvPortMalloc, vPortFree
 #include <freertos/portable.h> // For FreeRTOS portability
 #define TAG "Speex"
+#elif defined(SPEEXDSP_HOST_BUILD)
+#include <pthread.h>           // For the shared-table lock on the host
+#include "mem_tiers.h"         // Host model of internal RAM / PSRAM
 #endif
 
 #ifdef __cplusplus
@@ -73,6 +76,37 @@ static inline void speex_free_scratch(void* ptr) {
 #endif
 }
 
+// Hot arrays (touched on every frame) go to internal RAM, cold ones to PSRAM.
+// If internal RAM is exhausted, hot arrays fall back to the normal heap.
+#define OVERRIDE_SPEEX_ALLOC_TIER
+static inline void* speex_alloc_tier(int size, int tier) {
+   if (size <= 0) return NULL;
+#if defined(ESP_PLATFORM) && defined(USE_PSRAM)
+   if (tier == SPEEX_MEM_HOT) {
+      void* ptr = heap_caps_calloc(1, size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+      if (ptr) return ptr;
+   }
+   return speex_alloc(size);
+#elif defined(SPEEXDSP_HOST_BUILD)
+   return speex_mem_tiers_alloc((size_t)size, tier);
+#else
+   (void)tier;
+   return speex_alloc(size);
+#endif
+}
+
+#define OVERRIDE_SPEEX_FREE_TIER
+static inline void speex_free_tier(void* ptr) {
+   if (!ptr) return;
+#if defined(ESP_PLATFORM) && defined(USE_PSRAM)
+   heap_caps_free(ptr);  // Handles both internal RAM and PSRAM
+#elif defined(SPEEXDSP_HOST_BUILD)
+   speex_mem_tiers_free(ptr);
+#else
+   speex_free(ptr);
+#endif
+}
+
 #define OVERRIDE_SPEEX_REALLOC
 static inline void* speex_realloc(void* ptr, int size) {
    if (size <= 0) {
@@ -98,6 +132,51 @@ static inline void* speex_realloc(void* ptr, int size) {
 #endif
 }
 
+// Lock for process-wide tables shared between states (FFT plans, ...).
+// Only held for a few pointer updates, never around an allocation.
+#define OVERRIDE_SPEEX_LOCK
+#ifdef ESP_PLATFORM
+typedef portMUX_TYPE speex_lock_t;
+#define SPEEX_LOCK_INITIALIZER portMUX_INITIALIZER_UNLOCKED
+#define speex_lock(l) portENTER_CRITICAL(l)
+#define speex_unlock(l) portEXIT_CRITICAL(l)
+#elif defined(SPEEXDSP_HOST_BUILD)
+typedef pthread_mutex_t speex_lock_t;
+#define SPEEX_LOCK_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+#define speex_lock(l) pthread_mutex_lock(l)
+#define speex_unlock(l) pthread_mutex_unlock(l)
+#else
+#undef OVERRIDE_SPEEX_LOCK
+#endif
+
+// Clock for the stage profiler: the CPU cycle counter on the ESP32 (32 bits,
+// only differences are used), nanoseconds on the host
+#ifdef SPEEXDSP_PROFILE
+#define OVERRIDE_SPEEX_PROFILE_TICKS
+#ifdef ESP_PLATFORM
+#include <esp_idf_version.h>
+#include <esp_rom_sys.h>
+#if ESP_IDF_VERSION_MAJOR >= 5
+#include <esp_cpu.h>
+#define speex_profile_ticks() ((unsigned int)esp_cpu_get_cycle_count())
+#else
+#include <hal/cpu_hal.h>
+#define speex_profile_ticks() ((unsigned int)cpu_hal_get_cycle_count())
+#endif
+#define speex_profile_ticks_per_second() (esp_rom_get_cpu_ticks_per_us() * 1000000u)
+#elif defined(SPEEXDSP_HOST_BUILD)
+#include <time.h>
+static inline unsigned int speex_profile_ticks(void) {
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (unsigned int)(ts.tv_sec * 1000000000ull + ts.tv_nsec);
+}
+#define speex_profile_ticks_per_second() 1000000000u
+#else
+#undef OVERRIDE_SPEEX_PROFILE_TICKS
+#endif
+#endif
+
 // Memory operations (unchanged from original unless needed)
 #define OVERRIDE_SPEEX_COPY
 #define SPEEX_COPY(dst, src, n) (memcpy((dst), (src), (n)*sizeof(*(dst)) + 0*((dst)-(src))))
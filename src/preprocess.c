@@ -65,6 +65,7 @@
 #include "filterbank.h"
 #include "math_approx.h"
 #include "os_support.h"
+#include "profile.h"
 
 #define LOUDNESS_EXP 5.f
 #define AMP_SCALE .001f
@@ -192,6 +193,7 @@ struct SpeexPreprocessState_ {
    int    echo_suppress;
    int    echo_suppress_active;
    SpeexEchoState *echo_state;
+   int    echo_fused;        /**< Take the residual echo from the canceller's own spectrum */
 
    spx_word16_t	speech_prob;  /**< Probability last frame was speech */
 
@@ -240,9 +242,14 @@ struct SpeexPreprocessState_ {
    int    was_speech;
    int    min_count;         /**< Number of frames processed so far */
    void  *fft_lookup;        /**< Lookup table for the FFT */
+   void  *mem;               /**< Block holding the state and its hot arrays, NULL if caller-provided */
+   void  *mem_cold;          /**< Block holding the cold arrays, NULL if caller-provided */
 #ifdef FIXED_POINT
    int    frame_shift;
 #endif
+#ifdef SPEEXDSP_PROFILE
+   SpeexProfileCounters profile; /**< Time spent per stage */
+#endif
 };
 
 
@@ -386,12 +393,108 @@ static void compute_gain_floor(int noise_suppress, int effective_echo_suppress,
 }
 
 #endif
+/* Carves the state and all its arrays from the arenas, returns NULL while measuring.
+   Uses ps_size == frame_size, as speex_preprocess_state_init_mem() does. Only
+   the AGC loudness weights, which nothing reads with the AGC off, are cold; the
+   reverb estimate goes into the noise estimate of every frame, so it is hot. */
+static SpeexPreprocessState *preprocess_layout(SpeexArena *a, SpeexArena *cold, int frame_size, int sampling_rate)
+{
+   SpeexPreprocessState *st, *ret;
+   SpeexPreprocessState dummy;
+   int N = frame_size;
+   int N3 = 2*N - frame_size;
+   int M = NB_BANDS;
+
+   /* While measuring, the array pointers go to a throwaway struct */
+   ret = (SpeexPreprocessState*)speex_arena_alloc(a, sizeof(SpeexPreprocessState));
+   st = ret ? ret : &dummy;
+   st->bank = filterbank_new_arena(a, M, sampling_rate, N, 1);
+   st->fft_lookup = spx_fft_init_arena(2*N, a);
+
+   st->frame = (spx_word16_t*)speex_arena_alloc(a, 2*N*sizeof(spx_word16_t));
+   st->window = (spx_word16_t*)speex_arena_alloc(a, 2*N*sizeof(spx_word16_t));
+   st->ft = (spx_word16_t*)speex_arena_alloc(a, 2*N*sizeof(spx_word16_t));
+
+   st->ps = (spx_word32_t*)speex_arena_alloc(a, (N+M)*sizeof(spx_word32_t));
+   st->noise = (spx_word32_t*)speex_arena_alloc(a, (N+M)*sizeof(spx_word32_t));
+   st->echo_noise = (spx_word32_t*)speex_arena_alloc(a, (N+M)*sizeof(spx_word32_t));
+   st->residual_echo = (spx_word32_t*)speex_arena_alloc(a, (N+M)*sizeof(spx_word32_t));
+   st->reverb_estimate = (spx_word32_t*)speex_arena_alloc(a, (N+M)*sizeof(spx_word32_t));
+   st->old_ps = (spx_word32_t*)speex_arena_alloc(a, (N+M)*sizeof(spx_word32_t));
+   st->prior = (spx_word16_t*)speex_arena_alloc(a, (N+M)*sizeof(spx_word16_t));
+   st->post = (spx_word16_t*)speex_arena_alloc(a, (N+M)*sizeof(spx_word16_t));
+   st->gain = (spx_word16_t*)speex_arena_alloc(a, (N+M)*sizeof(spx_word16_t));
+   st->gain2 = (spx_word16_t*)speex_arena_alloc(a, (N+M)*sizeof(spx_word16_t));
+   st->gain_floor = (spx_word16_t*)speex_arena_alloc(a, (N+M)*sizeof(spx_word16_t));
+   st->zeta = (spx_word16_t*)speex_arena_alloc(a, (N+M)*sizeof(spx_word16_t));
+
+   st->S = (spx_word32_t*)speex_arena_alloc(a, N*sizeof(spx_word32_t));
+   st->Smin = (spx_word32_t*)speex_arena_alloc(a, N*sizeof(spx_word32_t));
+   st->Stmp = (spx_word32_t*)speex_arena_alloc(a, N*sizeof(spx_word32_t));
+   st->update_prob = (int*)speex_arena_alloc(a, N*sizeof(int));
+
+   st->inbuf = (spx_word16_t*)speex_arena_alloc(a, N3*sizeof(spx_word16_t));
+   st->outbuf = (spx_word16_t*)speex_arena_alloc(a, N3*sizeof(spx_word16_t));
+#ifndef FIXED_POINT
+   st->loudness_weight = (float*)speex_arena_alloc(cold, N*sizeof(float));
+#endif
+
+   return ret;
+}
+
+EXPORT int speex_preprocess_state_get_size(int frame_size, int sampling_rate)
+{
+   SpeexArena a;
+   speex_arena_measure(&a);
+   preprocess_layout(&a, &a, frame_size, sampling_rate);
+   return (int)speex_arena_footprint(&a);
+}
+
 EXPORT SpeexPreprocessState *speex_preprocess_state_init(int frame_size, int sampling_rate)
+{
+   return speex_preprocess_state_init_mem(frame_size, sampling_rate, NULL, 0);
+}
+
+EXPORT SpeexPreprocessState *speex_preprocess_state_init_mem(int frame_size, int sampling_rate, void *mem, int mem_size)
 {
    int i;
    int N, N3, N4, M;
+   SpeexPreprocessState *st;
+   SpeexArena hot, cold;
+   void *owned = NULL, *owned_cold = NULL;
 
-   SpeexPreprocessState *st = (SpeexPreprocessState *)speex_alloc(sizeof(SpeexPreprocessState));
+   if (mem)
+   {
+      int size = speex_preprocess_state_get_size(frame_size, sampling_rate);
+      if (mem_size < size)
+      {
+         speex_warning_int("Preprocessor needs a bigger memory block:", size);
+         return NULL;
+      }
+      SPEEX_MEMSET((char*)mem, 0, size);
+      speex_arena_init(&hot, mem, size);
+      st = preprocess_layout(&hot, &hot, frame_size, sampling_rate);
+   } else {
+      size_t hot_size, cold_size;
+      speex_arena_measure(&hot);
+      speex_arena_measure(&cold);
+      preprocess_layout(&hot, &cold, frame_size, sampling_rate);
+      hot_size = speex_arena_footprint(&hot);
+      cold_size = speex_arena_footprint(&cold);
+      owned = speex_alloc_tier(hot_size, SPEEX_MEM_HOT);
+      owned_cold = speex_alloc_tier(cold_size, SPEEX_MEM_COLD);
+      if (!owned || !owned_cold)
+      {
+         speex_free_tier(owned);
+         speex_free_tier(owned_cold);
+         return NULL;
+      }
+      speex_arena_init(&hot, owned, hot_size);
+      speex_arena_init(&cold, owned_cold, cold_size);
+      st = preprocess_layout(&hot, &cold, frame_size, sampling_rate);
+   }
+   st->mem = owned;
+   st->mem_cold = owned_cold;
    st->frame_size = frame_size;
 
    /* Round ps_size down to the nearest power of two */
@@ -409,7 +512,6 @@ EXPORT SpeexPreprocessState *speex_preprocess_state_init(int frame_size, int sam
       }
    }
 
-
    if (st->ps_size < 3*st->frame_size/4)
       st->ps_size = st->ps_size * 3 / 2;
 #else
@@ -434,35 +536,13 @@ EXPORT SpeexPreprocessState *speex_preprocess_state_init(int frame_size, int sam
    st->speech_prob_continue = SPEECH_PROB_CONTINUE_DEFAULT;
 
    st->echo_state = NULL;
+#ifdef SPEEXDSP_PROFILE
+   profile_clear(&st->profile);
+#endif
+   st->echo_fused = 0;
 
    st->nbands = NB_BANDS;
    M = st->nbands;
-   st->bank = filterbank_new(M, sampling_rate, N, 1);
-
-   st->frame = (spx_word16_t*)speex_alloc(2*N*sizeof(spx_word16_t));
-   st->window = (spx_word16_t*)speex_alloc(2*N*sizeof(spx_word16_t));
-   st->ft = (spx_word16_t*)speex_alloc(2*N*sizeof(spx_word16_t));
-
-   st->ps = (spx_word32_t*)speex_alloc((N+M)*sizeof(spx_word32_t));
-   st->noise = (spx_word32_t*)speex_alloc((N+M)*sizeof(spx_word32_t));
-   st->echo_noise = (spx_word32_t*)speex_alloc((N+M)*sizeof(spx_word32_t));
-   st->residual_echo = (spx_word32_t*)speex_alloc((N+M)*sizeof(spx_word32_t));
-   st->reverb_estimate = (spx_word32_t*)speex_alloc((N+M)*sizeof(spx_word32_t));
-   st->old_ps = (spx_word32_t*)speex_alloc((N+M)*sizeof(spx_word32_t));
-   st->prior = (spx_word16_t*)speex_alloc((N+M)*sizeof(spx_word16_t));
-   st->post = (spx_word16_t*)speex_alloc((N+M)*sizeof(spx_word16_t));
-   st->gain = (spx_word16_t*)speex_alloc((N+M)*sizeof(spx_word16_t));
-   st->gain2 = (spx_word16_t*)speex_alloc((N+M)*sizeof(spx_word16_t));
-   st->gain_floor = (spx_word16_t*)speex_alloc((N+M)*sizeof(spx_word16_t));
-   st->zeta = (spx_word16_t*)speex_alloc((N+M)*sizeof(spx_word16_t));
-
-   st->S = (spx_word32_t*)speex_alloc(N*sizeof(spx_word32_t));
-   st->Smin = (spx_word32_t*)speex_alloc(N*sizeof(spx_word32_t));
-   st->Stmp = (spx_word32_t*)speex_alloc(N*sizeof(spx_word32_t));
-   st->update_prob = (int*)speex_alloc(N*sizeof(int));
-
-   st->inbuf = (spx_word16_t*)speex_alloc(N3*sizeof(spx_word16_t));
-   st->outbuf = (spx_word16_t*)speex_alloc(N3*sizeof(spx_word16_t));
 
    conj_window(st->window, 2*N3);
    for (i=2*N3;i<2*st->ps_size;i++)
@@ -496,7 +576,6 @@ EXPORT SpeexPreprocessState *speex_preprocess_state_init(int frame_size, int sam
 #ifndef FIXED_POINT
    st->agc_enabled = 0;
    st->agc_level = 8000;
-   st->loudness_weight = (float*)speex_alloc(N*sizeof(float));
    for (i=0;i<N;i++)
    {
       float ff=((float)i)*.5*sampling_rate/((float)N);
@@ -517,8 +596,6 @@ EXPORT SpeexPreprocessState *speex_preprocess_state_init(int frame_size, int sam
 #endif
    st->was_speech = 0;
 
-   st->fft_lookup = spx_fft_init(2*N);
-
    st->nb_adapt=0;
    st->min_count=0;
    return st;
@@ -526,36 +603,10 @@ EXPORT SpeexPreprocessState *speex_preprocess_state_init(int frame_size, int sam
 
 EXPORT void speex_preprocess_state_destroy(SpeexPreprocessState *st)
 {
-   speex_free(st->frame);
-   speex_free(st->ft);
-   speex_free(st->ps);
-   speex_free(st->gain2);
-   speex_free(st->gain_floor);
-   speex_free(st->window);
-   speex_free(st->noise);
-   speex_free(st->reverb_estimate);
-   speex_free(st->old_ps);
-   speex_free(st->gain);
-   speex_free(st->prior);
-   speex_free(st->post);
-#ifndef FIXED_POINT
-   speex_free(st->loudness_weight);
-#endif
-   speex_free(st->echo_noise);
-   speex_free(st->residual_echo);
-
-   speex_free(st->S);
-   speex_free(st->Smin);
-   speex_free(st->Stmp);
-   speex_free(st->update_prob);
-   speex_free(st->zeta);
-
-   speex_free(st->inbuf);
-   speex_free(st->outbuf);
-
    spx_fft_destroy(st->fft_lookup);
-   filterbank_destroy(st->bank);
-   speex_free(st);
+   /* Everything else (including the filterbank) lives in the state's blocks */
+   speex_free_tier(st->mem_cold);
+   speex_free_tier(st->mem);
 }
 
 /* FIXME: The AGC doesn't work yet with fixed-point*/
@@ -609,15 +660,13 @@ static void speex_compute_agc(SpeexPreprocessState *st, spx_word16_t Pframe, spx
 }
 #endif
 
-static void preprocess_analysis(SpeexPreprocessState *st, spx_int16_t *x)
+/* 'Build' the input frame from 16-bit samples */
+static void preprocess_load(SpeexPreprocessState *st, const spx_int16_t *x)
 {
    int i;
-   int N = st->ps_size;
-   int N3 = 2*N - st->frame_size;
+   int N3 = 2*st->ps_size - st->frame_size;
    int N4 = st->frame_size - N3;
-   spx_word32_t *ps=st->ps;
 
-   /* 'Build' input frame */
    for (i=0;i<N3;i++)
       st->frame[i]=st->inbuf[i];
    for (i=0;i<st->frame_size;i++)
@@ -626,6 +675,36 @@ static void preprocess_analysis(SpeexPreprocessState *st, spx_int16_t *x)
    /* Update inbuf */
    for (i=0;i<N3;i++)
       st->inbuf[i]=x[N4+i];
+}
+
+/* Same from float samples on the 16-bit scale */
+static void preprocess_load_float(SpeexPreprocessState *st, const float *x)
+{
+   int i;
+   int N3 = 2*st->ps_size - st->frame_size;
+   int N4 = st->frame_size - N3;
+
+   for (i=0;i<N3;i++)
+      st->frame[i]=st->inbuf[i];
+#ifdef FIXED_POINT
+   for (i=0;i<st->frame_size;i++)
+      st->frame[N3+i]=WORD2INT(x[i]);
+   for (i=0;i<N3;i++)
+      st->inbuf[i]=WORD2INT(x[N4+i]);
+#else
+   for (i=0;i<st->frame_size;i++)
+      st->frame[N3+i]=x[i];
+   for (i=0;i<N3;i++)
+      st->inbuf[i]=x[N4+i];
+#endif
+}
+
+/* Analysis of the frame built by preprocess_load() */
+static void preprocess_analysis(SpeexPreprocessState *st)
+{
+   int i;
+   int N = st->ps_size;
+   spx_word32_t *ps=st->ps;
 
    /* Windowing */
    for (i=0;i<2*N;i++)
@@ -711,19 +790,20 @@ static void update_noise_prob(SpeexPreprocessState *st)
 #define NOISE_OVERCOMPENS 1.
 
 void speex_echo_get_residual(SpeexEchoState *st, spx_word32_t *Yout, int len);
+void speex_echo_get_residual_fused(SpeexEchoState *st, spx_word32_t *Yout, int len);
 
 EXPORT int speex_preprocess(SpeexPreprocessState *st, spx_int16_t *x, spx_int32_t *echo)
 {
    return speex_preprocess_run(st, x);
 }
 
-EXPORT int speex_preprocess_run(SpeexPreprocessState *st, spx_int16_t *x)
+/* Denoises the frame loaded by preprocess_load(), leaving the windowed
+   output in st->frame for the overlap-add */
+static void preprocess_frame(SpeexPreprocessState *st)
 {
    int i;
    int M;
    int N = st->ps_size;
-   int N3 = 2*N - st->frame_size;
-   int N4 = st->frame_size - N3;
    spx_word32_t *ps=st->ps;
    spx_word32_t Zframe;
    spx_word16_t Pframe;
@@ -741,7 +821,10 @@ EXPORT int speex_preprocess_run(SpeexPreprocessState *st, spx_int16_t *x)
    /* Deal with residual echo if provided */
    if (st->echo_state)
    {
-      speex_echo_get_residual(st->echo_state, st->residual_echo, N);
+      if (st->echo_fused)
+         speex_echo_get_residual_fused(st->echo_state, st->residual_echo, N);
+      else
+         speex_echo_get_residual(st->echo_state, st->residual_echo, N);
 #ifndef FIXED_POINT
       /* If there are NaNs or ridiculous values, it'll show up in the DC and we just reset everything to zero */
       if (!(st->residual_echo[0] >=0 && st->residual_echo[0]<N*1e9f))
@@ -757,7 +840,9 @@ EXPORT int speex_preprocess_run(SpeexPreprocessState *st, spx_int16_t *x)
       for (i=0;i<N+M;i++)
          st->echo_noise[i] = 0;
    }
-   preprocess_analysis(st, x);
+   PROFILE_STAGE(&st->profile, SPEEX_PREPROCESS_STAGE_ECHO);
+   preprocess_analysis(st);
+   PROFILE_STAGE(&st->profile, SPEEX_PREPROCESS_STAGE_ANALYSIS);
 
    update_noise_prob(st);
 
@@ -776,6 +861,7 @@ EXPORT int speex_preprocess_run(SpeexPreprocessState *st, spx_int16_t *x)
          st->noise[i] = MAX32(EXTEND32(0),MULT16_32_Q15(beta_1,st->noise[i]) + MULT16_32_Q15(beta,SHL32(st->ps[i],NOISE_SHIFT)));
    }
    filterbank_compute_bank32(st->bank, st->noise, st->noise+N);
+   PROFILE_STAGE(&st->profile, SPEEX_PREPROCESS_STAGE_NOISE);
 
    /* Special case for first frame */
    if (st->nb_adapt==1)
@@ -942,11 +1028,13 @@ EXPORT int speex_preprocess_run(SpeexPreprocessState *st, spx_int16_t *x)
    }
    st->ft[0] = MULT16_16_P15(st->gain2[0],st->ft[0]);
    st->ft[2*N-1] = MULT16_16_P15(st->gain2[N-1],st->ft[2*N-1]);
+   PROFILE_STAGE(&st->profile, SPEEX_PREPROCESS_STAGE_GAIN);
 
    /*FIXME: This *will* not work for fixed-point */
 #ifndef FIXED_POINT
    if (st->agc_enabled)
       speex_compute_agc(st, Pframe, st->ft);
+   PROFILE_STAGE(&st->profile, SPEEX_PREPROCESS_STAGE_AGC);
 #endif
 
    /* Inverse FFT with 1/N scaling */
@@ -954,6 +1042,7 @@ EXPORT int speex_preprocess_run(SpeexPreprocessState *st, spx_int16_t *x)
    /* Scale back to original (lower) amplitude */
    for (i=0;i<2*N;i++)
       st->frame[i] = PSHR16(st->frame[i], st->frame_shift);
+   PROFILE_STAGE(&st->profile, SPEEX_PREPROCESS_STAGE_SYNTHESIS);
 
    /*FIXME: This *will* not work for fixed-point */
 #ifndef FIXED_POINT
@@ -970,24 +1059,28 @@ EXPORT int speex_preprocess_run(SpeexPreprocessState *st, spx_int16_t *x)
             st->frame[i] *= damp;
       }
    }
+   PROFILE_STAGE(&st->profile, SPEEX_PREPROCESS_STAGE_AGC);
 #endif
 
    /* Synthesis window (for WOLA) */
    for (i=0;i<2*N;i++)
       st->frame[i] = MULT16_16_Q15(st->frame[i], st->window[i]);
 
-   /* Perform overlap and add */
-   for (i=0;i<N3;i++)
-      x[i] = WORD2INT(ADD32(EXTEND32(st->outbuf[i]), EXTEND32(st->frame[i])));
-   for (i=0;i<N4;i++)
-      x[N3+i] = st->frame[N3+i];
+   st->speech_prob = Pframe;
+}
+
+/* Updates outbuf after the overlap-add and returns the VAD decision */
+static int preprocess_finish(SpeexPreprocessState *st)
+{
+   int i;
+   int N3 = 2*st->ps_size - st->frame_size;
 
    /* Update outbuf */
    for (i=0;i<N3;i++)
       st->outbuf[i] = st->frame[st->frame_size+i];
+   PROFILE_STAGE(&st->profile, SPEEX_PREPROCESS_STAGE_SYNTHESIS);
 
    /* FIXME: This VAD is a kludge */
-   st->speech_prob = Pframe;
    if (st->vad_enabled)
    {
       if (st->speech_prob > st->speech_prob_start || (st->was_speech && st->speech_prob > st->speech_prob_continue))
@@ -1004,6 +1097,46 @@ EXPORT int speex_preprocess_run(SpeexPreprocessState *st, spx_int16_t *x)
    }
 }
 
+EXPORT int speex_preprocess_run(SpeexPreprocessState *st, spx_int16_t *x)
+{
+   int i;
+   int N3 = 2*st->ps_size - st->frame_size;
+   int N4 = st->frame_size - N3;
+
+   PROFILE_FRAME(&st->profile);
+   preprocess_load(st, x);
+   PROFILE_STAGE(&st->profile, SPEEX_PREPROCESS_STAGE_ANALYSIS);
+   preprocess_frame(st);
+
+   /* Perform overlap and add */
+   for (i=0;i<N3;i++)
+      x[i] = WORD2INT(ADD32(EXTEND32(st->outbuf[i]), EXTEND32(st->frame[i])));
+   for (i=0;i<N4;i++)
+      x[N3+i] = st->frame[N3+i];
+
+   return preprocess_finish(st);
+}
+
+EXPORT int speex_preprocess_run_float(SpeexPreprocessState *st, float *x)
+{
+   int i;
+   int N3 = 2*st->ps_size - st->frame_size;
+   int N4 = st->frame_size - N3;
+
+   PROFILE_FRAME(&st->profile);
+   preprocess_load_float(st, x);
+   PROFILE_STAGE(&st->profile, SPEEX_PREPROCESS_STAGE_ANALYSIS);
+   preprocess_frame(st);
+
+   /* Overlap and add, without rounding or clipping */
+   for (i=0;i<N3;i++)
+      x[i] = ADD32(EXTEND32(st->outbuf[i]), EXTEND32(st->frame[i]));
+   for (i=0;i<N4;i++)
+      x[N3+i] = st->frame[N3+i];
+
+   return preprocess_finish(st);
+}
+
 EXPORT void speex_preprocess_estimate_update(SpeexPreprocessState *st, spx_int16_t *x)
 {
    int i;
@@ -1015,7 +1148,8 @@ EXPORT void speex_preprocess_estimate_update(SpeexPreprocessState *st, spx_int16
    M = st->nbands;
    st->min_count++;
 
-   preprocess_analysis(st, x);
+   preprocess_load(st, x);
+   preprocess_analysis(st);
 
    update_noise_prob(st);
 
@@ -1039,6 +1173,12 @@ EXPORT void speex_preprocess_estimate_update(SpeexPreprocessState *st, spx_int16
 }
 
 
+#ifdef SPEEXDSP_PROFILE
+static const char *const preprocess_stage_names[SPEEX_PREPROCESS_STAGES] = {
+   "echo", "analysis", "noise", "gain", "agc", "synthesis"
+};
+#endif
+
 EXPORT int speex_preprocess_ctl(SpeexPreprocessState *state, int request, void *ptr)
 {
    int i;
@@ -1165,6 +1305,25 @@ EXPORT int speex_preprocess_ctl(SpeexPreprocessState *state, int request, void *
    case SPEEX_PREPROCESS_GET_ECHO_STATE:
       (*(SpeexEchoState**)ptr) = (SpeexEchoState*)st->echo_state;
       break;
+   case SPEEX_PREPROCESS_SET_ECHO_FUSED:
+      st->echo_fused = (*(spx_int32_t*)ptr);
+      break;
+   case SPEEX_PREPROCESS_GET_ECHO_FUSED:
+      (*(spx_int32_t*)ptr) = st->echo_fused;
+      break;
+#ifdef SPEEXDSP_PROFILE
+   case SPEEX_PREPROCESS_GET_PROFILE:
+      profile_report((SpeexProfile*)ptr, &st->profile, preprocess_stage_names, SPEEX_PREPROCESS_STAGES);
+      profile_add((SpeexProfile*)ptr, &st->profile);
+      break;
+   case SPEEX_PREPROCESS_RESET_PROFILE:
+      profile_clear(&st->profile);
+      break;
+#else
+   case SPEEX_PREPROCESS_GET_PROFILE:
+   case SPEEX_PREPROCESS_RESET_PROFILE:
+      return -1;
+#endif
 #ifndef FIXED_POINT
    case SPEEX_PREPROCESS_GET_AGC_LOUDNESS:
       (*(spx_int32_t*)ptr) = pow(st->loudness, 1.0/LOUDNESS_EXP);
@@ -0,0 +1,76 @@
+/* File: profile.h
+   Stage counters behind SpeexProfile
+
+   A state keeps one SpeexProfileCounters (the echo canceller one per job slot,
+   so workers never share counters). PROFILE_FRAME() counts a frame and marks
+   its start, PROFILE_BEGIN() only sets the mark (at the start of a job), and
+   PROFILE_STAGE() charges the time since the previous mark to a stage, so a
+   frame is timed with one clock read per stage boundary. Without
+   SPEEXDSP_PROFILE both expand to nothing and the counters do not exist.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted under the same terms as the rest of SpeexDSP.
+*/
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "speex/speexdsp_profile.h"
+#include "os_support.h"
+
+#ifdef SPEEXDSP_PROFILE
+
+typedef struct {
+   spx_uint32_t mark;   /* Clock at the end of the previous stage */
+   spx_uint32_t frames;
+   uint64_t ticks[SPEEX_PROFILE_MAX_STAGES];
+} SpeexProfileCounters;
+
+#define PROFILE_BEGIN(p) ((p)->mark = (spx_uint32_t)speex_profile_ticks())
+#define PROFILE_FRAME(p) ((p)->frames++, PROFILE_BEGIN(p))
+/* The difference is taken on 32 bits, so counter wrap-around is harmless */
+#define PROFILE_STAGE(p, stage) do { \
+      spx_uint32_t now_ = (spx_uint32_t)speex_profile_ticks(); \
+      (p)->ticks[stage] += (spx_uint32_t)(now_ - (p)->mark); \
+      (p)->mark = now_; \
+   } while (0)
+
+static inline void profile_clear(SpeexProfileCounters *p)
+{
+   int i;
+   p->frames = 0;
+   for (i=0;i<SPEEX_PROFILE_MAX_STAGES;i++)
+      p->ticks[i] = 0;
+}
+
+/* Starts a report on the frames counted in p: no ticks yet, the counters of
+   every job slot (p included) get added with profile_add() */
+static inline void profile_report(SpeexProfile *out, const SpeexProfileCounters *p, const char *const *names, int nb_stages)
+{
+   int i;
+   out->frames = p->frames;
+   out->ticks_per_second = (spx_uint32_t)speex_profile_ticks_per_second();
+   out->nb_stages = nb_stages;
+   for (i=0;i<SPEEX_PROFILE_MAX_STAGES;i++)
+   {
+      out->names[i] = i < nb_stages ? names[i] : NULL;
+      out->ticks[i] = 0;
+   }
+}
+
+static inline void profile_add(SpeexProfile *out, const SpeexProfileCounters *p)
+{
+   int i;
+   for (i=0;i<SPEEX_PROFILE_MAX_STAGES;i++)
+      out->ticks[i] += p->ticks[i];
+}
+
+#else
+
+#define PROFILE_BEGIN(p)
+#define PROFILE_FRAME(p)
+#define PROFILE_STAGE(p, stage)
+
+#endif
+
+#endif
@@ -64,6 +64,10 @@
 static void *speex_alloc(int size) {return calloc(size,1);}
 static void *speex_realloc(void *ptr, int size) {return realloc(ptr, size);}
 static void speex_free(void *ptr) {free(ptr);}
+typedef int speex_lock_t;
+#define SPEEX_LOCK_INITIALIZER 0
+#define speex_lock(l) ((void)(l))
+#define speex_unlock(l) ((void)(l))
 #ifndef EXPORT
 #define EXPORT
 #endif
@@ -102,6 +106,10 @@ static void speex_free(void *ptr) {free(ptr);}
 #include "resample_neon.h"
 #endif
 
+#ifdef USE_XTENSA_FPU
+#include "resample_xtensa.h"
+#endif
+
 /* Number of elements to allocate on the stack */
 #ifdef VAR_ARRAYS
 #define FIXED_STACK_ALLOC 8192
@@ -109,6 +117,56 @@ static void speex_free(void *ptr) {free(ptr);}
 #define FIXED_STACK_ALLOC 1024
 #endif
 
+/* Bytes of sinc tables kept around once no resampler uses them, so that a
+   stream torn down and set up again with the same ratio skips update_filter()'s
+   table computation. speex_resampler_cache_trim() drops them on demand. */
+#ifndef RESAMPLER_CACHE_IDLE_BYTES
+#define RESAMPLER_CACHE_IDLE_BYTES 65536
+#endif
+
+/* A sinc table depends only on these four values, so it is shared by every
+   resampler using the same ratio and quality. Immutable once published. */
+struct sinc_entry {
+   int quality;
+   spx_uint32_t num_rate;
+   spx_uint32_t den_rate;
+   int direct;
+   spx_uint32_t length;
+   int refcount;
+   int builtin;
+   const spx_word16_t *table;
+   struct sinc_entry *next;
+};
+
+/* Tables generated ahead of time by extra/tables/gen_resample_tables.c. Being
+   const they stay in flash on the ESP32 and cost neither RAM nor start-up time. */
+struct builtin_sinc_table {
+   int quality;
+   spx_uint32_t num_rate;
+   spx_uint32_t den_rate;
+   int direct;
+   spx_uint32_t length;
+   const spx_word16_t *table;
+};
+
+#if defined(RESAMPLE_BUILTIN_TABLES) && defined(FLOATING_POINT) && !defined(RESAMPLE_NO_BUILTIN_TABLES)
+#include "resample_tables.h"
+#define HAVE_BUILTIN_SINC_TABLES
+#endif
+
+/* Drift tracking: the ratio is kept over a denominator of about this size so
+   it can be nudged by about a ppm, and is never moved by more than
+   RESAMPLER_MAX_DRIFT_PPB. RESAMPLER_DRIFT_TIME_CONSTANT (seconds) sets how
+   fast speex_resampler_track_fill() follows the buffer level: lower locks
+   faster but lets more of the fill jitter through to the ratio. */
+#define DRIFT_FINE_DEN (1<<20)
+#ifndef RESAMPLER_MAX_DRIFT_PPB
+#define RESAMPLER_MAX_DRIFT_PPB 1000000
+#endif
+#ifndef RESAMPLER_DRIFT_TIME_CONSTANT
+#define RESAMPLER_DRIFT_TIME_CONSTANT 20.f
+#endif
+
 typedef int (*resampler_basic_func)(SpeexResamplerState *, spx_uint32_t , const spx_word16_t *, spx_uint32_t *, spx_word16_t *, spx_uint32_t *);
 
 struct SpeexResamplerState_ {
@@ -135,12 +193,21 @@ struct SpeexResamplerState_ {
    spx_uint32_t *magic_samples;
 
    spx_word16_t *mem;
-   spx_word16_t *sinc_table;
+   const spx_word16_t *sinc_table;
    spx_uint32_t sinc_table_length;
+   struct sinc_entry *sinc_entry;
    resampler_basic_func resampler_ptr;
 
    int    in_stride;
    int    out_stride;
+
+   /* Drift tracking, see speex_resampler_set_drift() */
+   int          drift_enabled;
+   spx_uint32_t drift_num;      /* num_rate without the correction */
+   spx_int32_t  drift_ppb;
+   spx_uint32_t drift_samples;  /* output samples since the last track call */
+   float        drift_fill;     /* smoothed buffer level */
+   float        drift_integ;
 } ;
 
 static const double kaiser12_table[68] = {
@@ -433,6 +500,117 @@ static int resampler_basic_direct_double(SpeexResamplerState *st, spx_uint32_t c
 }
 #endif
 
+#ifndef OVERRIDE_INNER_PRODUCT_X4_SINGLE
+/* Four products of the same taps a with b, b+step, b+2*step and b+3*step */
+static inline void inner_product_x4_single(const spx_word16_t *a, const spx_word16_t *b, int step, int len, spx_word32_t sum[4])
+{
+   int j;
+   spx_word32_t s0=0, s1=0, s2=0, s3=0;
+   for(j=0;j<len;j++)
+   {
+      s0 += MULT16_16(a[j], b[j]);
+      s1 += MULT16_16(a[j], b[j+step]);
+      s2 += MULT16_16(a[j], b[j+2*step]);
+      s3 += MULT16_16(a[j], b[j+3*step]);
+   }
+   sum[0] = SATURATE32PSHR(s0, 15, 32767);
+   sum[1] = SATURATE32PSHR(s1, 15, 32767);
+   sum[2] = SATURATE32PSHR(s2, 15, 32767);
+   sum[3] = SATURATE32PSHR(s3, 15, 32767);
+}
+#endif
+
+#ifndef OVERRIDE_INNER_PRODUCT_X2_SINGLE
+/* Two products of the same taps a with b and b+step */
+static inline void inner_product_x2_single(const spx_word16_t *a, const spx_word16_t *b, int step, int len, spx_word32_t sum[2])
+{
+   int j;
+   spx_word32_t s0=0, s1=0;
+   for(j=0;j<len;j++)
+   {
+      s0 += MULT16_16(a[j], b[j]);
+      s1 += MULT16_16(a[j], b[j+step]);
+   }
+   sum[0] = SATURATE32PSHR(s0, 15, 32767);
+   sum[1] = SATURATE32PSHR(s1, 15, 32767);
+}
+#endif
+
+/* Integer down-sampling (M:1, den_rate == 1): there is a single filter phase and
+   consecutive outputs are M input samples apart, so four of them are computed
+   at once with each tap loaded only once. The last few outputs of a block go
+   through resampler_basic_direct_single(). */
+static int resampler_integer_down_single(SpeexResamplerState *st, spx_uint32_t channel_index, const spx_word16_t *in, spx_uint32_t *in_len, spx_word16_t *out, spx_uint32_t *out_len)
+{
+   const int N = st->filt_len;
+   const int M = st->int_advance;
+   const int out_stride = st->out_stride;
+   int out_sample = 0;
+   int last_sample = st->last_sample[channel_index];
+   spx_uint32_t tail_len;
+   spx_word32_t sum[4];
+
+   while (last_sample + 3*M < (spx_int32_t)*in_len && out_sample + 4 <= (spx_int32_t)*out_len)
+   {
+      inner_product_x4_single(st->sinc_table, &in[last_sample], M, N, sum);
+      out[out_stride * out_sample++] = sum[0];
+      out[out_stride * out_sample++] = sum[1];
+      out[out_stride * out_sample++] = sum[2];
+      out[out_stride * out_sample++] = sum[3];
+      last_sample += 4*M;
+   }
+   st->last_sample[channel_index] = last_sample;
+
+   tail_len = *out_len - out_sample;
+   return out_sample + resampler_basic_direct_single(st, channel_index, in, in_len, out + out_stride * out_sample, &tail_len);
+}
+
+/* Integer up-sampling (1:M, num_rate == 1): output k*M+p is phase p of
+   the filter applied at input sample k, so for four consecutive inputs each
+   phase gives four outputs with its taps loaded once. Whatever is not a whole
+   group of four inputs starting at phase 0 goes through
+   resampler_basic_direct_single(). */
+static int resampler_integer_up_single(SpeexResamplerState *st, spx_uint32_t channel_index, const spx_word16_t *in, spx_uint32_t *in_len, spx_word16_t *out, spx_uint32_t *out_len)
+{
+   const int N = st->filt_len;
+   const int M = st->den_rate;
+   const int out_stride = st->out_stride;
+   int out_sample = 0;
+   int last_sample;
+   spx_uint32_t part_len;
+   spx_word32_t sum[4];
+
+   /* Finish the input sample we stopped in the middle of */
+   if (st->samp_frac_num[channel_index] != 0)
+   {
+      part_len = IMIN(*out_len, M - st->samp_frac_num[channel_index]);
+      out_sample = resampler_basic_direct_single(st, channel_index, in, in_len, out, &part_len);
+   }
+
+   last_sample = st->last_sample[channel_index];
+   if (st->samp_frac_num[channel_index] == 0)
+   {
+      while (last_sample + 3 < (spx_int32_t)*in_len && out_sample + 4*M <= (spx_int32_t)*out_len)
+      {
+         int p;
+         for (p=0;p<M;p++)
+         {
+            inner_product_x4_single(st->sinc_table + p*N, &in[last_sample], 1, N, sum);
+            out[out_stride * (out_sample + p)] = sum[0];
+            out[out_stride * (out_sample + M + p)] = sum[1];
+            out[out_stride * (out_sample + 2*M + p)] = sum[2];
+            out[out_stride * (out_sample + 3*M + p)] = sum[3];
+         }
+         out_sample += 4*M;
+         last_sample += 4;
+      }
+      st->last_sample[channel_index] = last_sample;
+   }
+
+   part_len = *out_len - out_sample;
+   return out_sample + resampler_basic_direct_single(st, channel_index, in, in_len, out + out_stride * out_sample, &part_len);
+}
+
 static int resampler_basic_interpolate_single(SpeexResamplerState *st, spx_uint32_t channel_index, const spx_word16_t *in, spx_uint32_t *in_len, spx_word16_t *out, spx_uint32_t *out_len)
 {
    const int N = st->filt_len;
@@ -600,6 +778,170 @@ static int multiply_frac(spx_uint32_t *result, spx_uint32_t value, spx_uint32_t
    return RESAMPLER_ERR_SUCCESS;
 }
 
+/* Most recently used first */
+static struct sinc_entry *sinc_cache = NULL;
+static speex_lock_t sinc_cache_lock = SPEEX_LOCK_INITIALIZER;
+
+/* Must be called with sinc_cache_lock held */
+static struct sinc_entry *sinc_cache_acquire(int quality, spx_uint32_t num_rate, spx_uint32_t den_rate, int direct)
+{
+   struct sinc_entry **p;
+   for (p=&sinc_cache;*p;p=&(*p)->next)
+   {
+      struct sinc_entry *entry = *p;
+      if (entry->quality == quality && entry->num_rate == num_rate
+          && entry->den_rate == den_rate && entry->direct == direct)
+      {
+         *p = entry->next;
+         entry->next = sinc_cache;
+         sinc_cache = entry;
+         entry->refcount++;
+         return entry;
+      }
+   }
+   return NULL;
+}
+
+/* Must be called with sinc_cache_lock held. Unlinks the idle tables past
+   max_idle bytes and returns them as a list for the caller to free. */
+static struct sinc_entry *sinc_cache_evict(size_t max_idle)
+{
+   struct sinc_entry **p = &sinc_cache;
+   struct sinc_entry *evicted = NULL;
+   size_t idle = 0;
+   while (*p)
+   {
+      struct sinc_entry *entry = *p;
+      if (entry->refcount == 0)
+      {
+         if (!entry->builtin)
+            idle += entry->length*sizeof(spx_word16_t);
+         if (idle > max_idle)
+         {
+            *p = entry->next;
+            entry->next = evicted;
+            evicted = entry;
+            continue;
+         }
+      }
+      p = &entry->next;
+   }
+   return evicted;
+}
+
+static void sinc_entry_free_list(struct sinc_entry *entry)
+{
+   while (entry)
+   {
+      struct sinc_entry *next = entry->next;
+      if (!entry->builtin)
+         speex_free((void*)entry->table);
+      speex_free(entry);
+      entry = next;
+   }
+}
+
+static void sinc_table_fill(const SpeexResamplerState *st, int direct, spx_word16_t *table)
+{
+   if (direct)
+   {
+      spx_uint32_t i;
+      for (i=0;i<st->den_rate;i++)
+      {
+         spx_int32_t j;
+         for (j=0;j<st->filt_len;j++)
+         {
+            table[i*st->filt_len+j] = sinc(st->cutoff,((j-(spx_int32_t)st->filt_len/2+1)-((float)i)/st->den_rate), st->filt_len, quality_map[st->quality].window_func);
+         }
+      }
+   } else {
+      spx_int32_t i;
+      for (i=-4;i<(spx_int32_t)(st->oversample*st->filt_len+4);i++)
+         table[i+4] = sinc(st->cutoff,(i/(float)st->oversample - st->filt_len/2), st->filt_len, quality_map[st->quality].window_func);
+   }
+}
+
+static const spx_word16_t *sinc_table_builtin(const SpeexResamplerState *st, int direct, spx_uint32_t length)
+{
+#ifdef HAVE_BUILTIN_SINC_TABLES
+   unsigned int i;
+   for (i=0;i<sizeof(builtin_sinc_tables)/sizeof(builtin_sinc_tables[0]);i++)
+   {
+      const struct builtin_sinc_table *t = &builtin_sinc_tables[i];
+      if (t->quality == st->quality && t->num_rate == st->num_rate && t->den_rate == st->den_rate
+          && t->direct == direct && t->length == length)
+         return t->table;
+   }
+#endif
+   return NULL;
+}
+
+/* Returns the shared table for the current filter of st, computing it if needed */
+static struct sinc_entry *sinc_cache_get(const SpeexResamplerState *st, int direct, spx_uint32_t length)
+{
+   struct sinc_entry *entry, *fresh;
+   const spx_word16_t *builtin;
+
+   speex_lock(&sinc_cache_lock);
+   entry = sinc_cache_acquire(st->quality, st->num_rate, st->den_rate, direct);
+   speex_unlock(&sinc_cache_lock);
+   if (entry)
+      return entry;
+
+   /* Compute outside the lock, then check nobody beat us to it */
+   fresh = (struct sinc_entry*)speex_alloc(sizeof(struct sinc_entry));
+   if (!fresh)
+      return NULL;
+   builtin = sinc_table_builtin(st, direct, length);
+   if (builtin)
+   {
+      fresh->table = builtin;
+      fresh->builtin = 1;
+   } else {
+      spx_word16_t *table = (spx_word16_t*)speex_alloc(length*sizeof(spx_word16_t));
+      if (!table)
+      {
+         speex_free(fresh);
+         return NULL;
+      }
+      sinc_table_fill(st, direct, table);
+      fresh->table = table;
+      fresh->builtin = 0;
+   }
+   fresh->quality = st->quality;
+   fresh->num_rate = st->num_rate;
+   fresh->den_rate = st->den_rate;
+   fresh->direct = direct;
+   fresh->length = length;
+   fresh->refcount = 1;
+   fresh->next = NULL;
+
+   speex_lock(&sinc_cache_lock);
+   entry = sinc_cache_acquire(st->quality, st->num_rate, st->den_rate, direct);
+   if (!entry)
+   {
+      fresh->next = sinc_cache;
+      sinc_cache = fresh;
+      entry = fresh;
+      fresh = NULL;
+   }
+   speex_unlock(&sinc_cache_lock);
+   sinc_entry_free_list(fresh);
+   return entry;
+}
+
+static void sinc_cache_release(struct sinc_entry *entry)
+{
+   struct sinc_entry *evicted = NULL;
+   if (!entry)
+      return;
+   speex_lock(&sinc_cache_lock);
+   if (--entry->refcount == 0)
+      evicted = sinc_cache_evict(RESAMPLER_CACHE_IDLE_BYTES);
+   speex_unlock(&sinc_cache_lock);
+   sinc_entry_free_list(evicted);
+}
+
 static int update_filter(SpeexResamplerState *st)
 {
    spx_uint32_t old_length = st->filt_len;
@@ -607,6 +949,7 @@ static int update_filter(SpeexResamplerState *st)
    int use_direct;
    spx_uint32_t min_sinc_table_length;
    spx_uint32_t min_alloc_size;
+   struct sinc_entry *entry;
 
    st->int_advance = st->num_rate/st->den_rate;
    st->frac_advance = st->num_rate%st->den_rate;
@@ -654,26 +997,15 @@ static int update_filter(SpeexResamplerState *st)
 
       min_sinc_table_length = st->filt_len*st->oversample+8;
    }
-   if (st->sinc_table_length < min_sinc_table_length)
-   {
-      spx_word16_t *sinc_table = (spx_word16_t *)speex_realloc(st->sinc_table,min_sinc_table_length*sizeof(spx_word16_t));
-      if (!sinc_table)
-         goto fail;
-
-      st->sinc_table = sinc_table;
-      st->sinc_table_length = min_sinc_table_length;
-   }
+   entry = sinc_cache_get(st, use_direct, min_sinc_table_length);
+   if (!entry)
+      goto fail;
+   sinc_cache_release(st->sinc_entry);
+   st->sinc_entry = entry;
+   st->sinc_table = entry->table;
+   st->sinc_table_length = entry->length;
    if (use_direct)
    {
-      spx_uint32_t i;
-      for (i=0;i<st->den_rate;i++)
-      {
-         spx_int32_t j;
-         for (j=0;j<st->filt_len;j++)
-         {
-            st->sinc_table[i*st->filt_len+j] = sinc(st->cutoff,((j-(spx_int32_t)st->filt_len/2+1)-((float)i)/st->den_rate), st->filt_len, quality_map[st->quality].window_func);
-         }
-      }
 #ifdef FIXED_POINT
       st->resampler_ptr = resampler_basic_direct_single;
 #else
@@ -682,11 +1014,16 @@ static int update_filter(SpeexResamplerState *st)
       else
          st->resampler_ptr = resampler_basic_direct_single;
 #endif
+      if (st->resampler_ptr == resampler_basic_direct_single)
+      {
+         /* 2:1, 3:1, 1:2, 1:3 and the like */
+         if (st->den_rate == 1)
+            st->resampler_ptr = resampler_integer_down_single;
+         else if (st->num_rate == 1)
+            st->resampler_ptr = resampler_integer_up_single;
+      }
       /*fprintf (stderr, "resampler uses direct sinc table and normalised cutoff %f\n", cutoff);*/
    } else {
-      spx_int32_t i;
-      for (i=-4;i<(spx_int32_t)(st->oversample*st->filt_len+4);i++)
-         st->sinc_table[i+4] = sinc(st->cutoff,(i/(float)st->oversample - st->filt_len/2), st->filt_len, quality_map[st->quality].window_func);
 #ifdef FIXED_POINT
       st->resampler_ptr = resampler_basic_interpolate_single;
 #else
@@ -822,7 +1159,9 @@ EXPORT SpeexResamplerState *speex_resampler_init_frac(spx_uint32_t nb_channels,
    st->num_rate = 0;
    st->den_rate = 0;
    st->quality = -1;
+   st->sinc_table = NULL;
    st->sinc_table_length = 0;
+   st->sinc_entry = NULL;
    st->mem_alloc_size = 0;
    st->filt_len = 0;
    st->mem = 0;
@@ -835,6 +1174,10 @@ EXPORT SpeexResamplerState *speex_resampler_init_frac(spx_uint32_t nb_channels,
 
    st->buffer_size = 160;
 
+   st->drift_enabled = 0;
+   st->drift_ppb = 0;
+   st->drift_samples = 0;
+
    /* Per channel data */
    if (!(st->last_sample = (spx_int32_t*)speex_alloc(nb_channels*sizeof(spx_int32_t))))
       goto fail;
@@ -869,7 +1212,7 @@ fail:
 EXPORT void speex_resampler_destroy(SpeexResamplerState *st)
 {
    speex_free(st->mem);
-   speex_free(st->sinc_table);
+   sinc_cache_release(st->sinc_entry);
    speex_free(st->last_sample);
    speex_free(st->magic_samples);
    speex_free(st->samp_frac_num);
@@ -888,6 +1231,8 @@ static int speex_resampler_process_native(SpeexResamplerState *st, spx_uint32_t
 
    /* Call the right resampler through the function ptr */
    out_sample = st->resampler_ptr(st, channel_index, mem, in_len, out, out_len);
+   if (channel_index == 0)
+      st->drift_samples += out_sample;
 
    if (st->last_sample[channel_index] < (spx_int32_t)*in_len)
       *in_len = st->last_sample[channel_index];
@@ -1036,12 +1381,247 @@ EXPORT int speex_resampler_process_int(SpeexResamplerState *st, spx_uint32_t cha
    return st->resampler_ptr == resampler_basic_zero ? RESAMPLER_ERR_ALLOC_FAILED : RESAMPLER_ERR_SUCCESS;
 }
 
+/* Longest filter whose interpolated taps resampler_multi_single() builds on
+   the stack (quality 5 down to a third of the rate); longer ones interpolate
+   channel by channel */
+#define MULTI_MAX_TAPS 256
+
+/* One output frame of the filter taps a, for channels step apart in in */
+static inline void multi_channel_products(const spx_word16_t *a, const spx_word16_t *in, int step, int N, int C, spx_word16_t *y)
+{
+   int c = 0;
+   spx_word32_t sum[4];
+   for (;c+4<=C;c+=4)
+   {
+      inner_product_x4_single(a, &in[c*step], step, N, sum);
+      y[c] = sum[0];
+      y[c+1] = sum[1];
+      y[c+2] = sum[2];
+      y[c+3] = sum[3];
+   }
+   if (c+2<=C)
+   {
+      inner_product_x2_single(a, &in[c*step], step, N, sum);
+      y[c] = sum[0];
+      y[c+1] = sum[1];
+      c += 2;
+   }
+   if (c<C)
+   {
+#ifndef OVERRIDE_INNER_PRODUCT_SINGLE
+      int j;
+      spx_word32_t acc = 0;
+      for(j=0;j<N;j++) acc += MULT16_16(a[j], in[c*step+j]);
+      y[c] = SATURATE32PSHR(acc, 15, 32767);
+#else
+      y[c] = inner_product_single(a, &in[c*step], N);
+#endif
+   }
+}
+
+/* All channels in one pass, for the interleaved calls: the filter phase is
+   worked out once per output frame and applied to every channel. The channel
+   histories are mem_alloc_size apart, so up to four channels share each load
+   of the taps. With the interpolated filter the taps for the phase are built
+   first, which takes the cost of one channel instead of four tap lookups per
+   channel. Only used while the channels are in lockstep, which they always
+   are when the stream only goes through the interleaved calls. out is
+   interleaved. */
+static int resampler_multi_single(SpeexResamplerState *st, const spx_word16_t *in, spx_uint32_t in_len, spx_word16_t *out, spx_uint32_t out_len, int direct)
+{
+   const int N = st->filt_len;
+   const int C = st->nb_channels;
+   const int step = st->mem_alloc_size;
+   int out_sample = 0;
+   int last_sample = st->last_sample[0];
+   spx_uint32_t samp_frac_num = st->samp_frac_num[0];
+   const int int_advance = st->int_advance;
+   const int frac_advance = st->frac_advance;
+   const spx_uint32_t den_rate = st->den_rate;
+   spx_uint32_t c;
+#ifndef FIXED_POINT
+   spx_word16_t taps[MULTI_MAX_TAPS];
+#endif
+
+   while (!(last_sample >= (spx_int32_t)in_len || out_sample >= (spx_int32_t)out_len))
+   {
+      spx_word16_t *y = out + C*out_sample;
+      if (direct)
+      {
+         multi_channel_products(& st->sinc_table[samp_frac_num*N], &in[last_sample], step, N, C, y);
+      } else {
+         const int offset = samp_frac_num*st->oversample/st->den_rate;
+         const spx_word16_t *sinct = st->sinc_table + st->oversample + 4 - offset - 2;
+#ifdef FIXED_POINT
+         const spx_word16_t frac = PDIV32(SHL32((samp_frac_num*st->oversample) % st->den_rate,15),st->den_rate);
+#else
+         const spx_word16_t frac = ((float)((samp_frac_num*st->oversample) % st->den_rate))/st->den_rate;
+#endif
+         spx_word16_t interp[4];
+         cubic_coef(frac, interp);
+#ifndef FIXED_POINT
+         if (N <= MULTI_MAX_TAPS)
+         {
+            int j;
+            for(j=0;j<N;j++)
+            {
+               const spx_word16_t *s = sinct + j*st->oversample;
+               taps[j] = interp[0]*s[0] + interp[1]*s[1] + interp[2]*s[2] + interp[3]*s[3];
+            }
+            multi_channel_products(taps, &in[last_sample], step, N, C, y);
+         } else
+#endif
+         for (c=0;c<(spx_uint32_t)C;c++)
+         {
+            const spx_word16_t *iptr = &in[c*step + last_sample];
+#ifndef OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
+            int j;
+            spx_word32_t sum;
+            spx_word32_t accum[4] = {0,0,0,0};
+            for(j=0;j<N;j++) {
+              const spx_word16_t curr_in=iptr[j];
+              accum[0] += MULT16_16(curr_in,sinct[j*st->oversample]);
+              accum[1] += MULT16_16(curr_in,sinct[j*st->oversample+1]);
+              accum[2] += MULT16_16(curr_in,sinct[j*st->oversample+2]);
+              accum[3] += MULT16_16(curr_in,sinct[j*st->oversample+3]);
+            }
+            sum = MULT16_32_Q15(interp[0],accum[0]) + MULT16_32_Q15(interp[1],accum[1]) + MULT16_32_Q15(interp[2],accum[2]) + MULT16_32_Q15(interp[3],accum[3]);
+            y[c] = SATURATE32PSHR(sum, 15, 32767);
+#else
+            y[c] = interpolate_product_single(iptr, sinct, N, st->oversample, interp);
+#endif
+         }
+      }
+      out_sample++;
+      last_sample += int_advance;
+      samp_frac_num += frac_advance;
+      if (samp_frac_num >= den_rate)
+      {
+         samp_frac_num -= den_rate;
+         last_sample++;
+      }
+   }
+
+   for (c=0;c<st->nb_channels;c++)
+   {
+      st->last_sample[c] = last_sample;
+      st->samp_frac_num[c] = samp_frac_num;
+   }
+   return out_sample;
+}
+
+/* Returns 1 for the direct filter, 0 for the interpolated one and -1 when the
+   channels have to be processed one by one (integer ratios, double precision,
+   channels out of step, magic samples pending) */
+static int multi_channel_mode(const SpeexResamplerState *st)
+{
+   spx_uint32_t i;
+   int direct;
+   if (st->nb_channels < 2)
+      return -1;
+   /* The integer-ratio kernels already share each load of the taps between
+      four outputs of the same channel */
+   if (st->resampler_ptr == resampler_basic_direct_single)
+      direct = 1;
+   else if (st->resampler_ptr == resampler_basic_interpolate_single)
+      direct = 0;
+   else
+      return -1;
+   for (i=0;i<st->nb_channels;i++)
+   {
+      if (st->magic_samples[i] || st->last_sample[i] != st->last_sample[0]
+          || st->samp_frac_num[i] != st->samp_frac_num[0])
+         return -1;
+   }
+   return direct;
+}
+
+/* Runs one chunk already copied into the channel histories, like
+   speex_resampler_process_native() does for a single channel */
+static void speex_resampler_process_multi(SpeexResamplerState *st, int direct, spx_uint32_t *in_len, spx_word16_t *out, spx_uint32_t *out_len)
+{
+   const int N = st->filt_len;
+   spx_uint32_t c, ilen;
+   int j;
+
+   st->started = 1;
+   *out_len = resampler_multi_single(st, st->mem, *in_len, out, *out_len, direct);
+   st->drift_samples += *out_len;
+
+   if (st->last_sample[0] < (spx_int32_t)*in_len)
+      *in_len = st->last_sample[0];
+   ilen = *in_len;
+   for (c=0;c<st->nb_channels;c++)
+   {
+      spx_word16_t *mem = st->mem + c*st->mem_alloc_size;
+      st->last_sample[c] -= ilen;
+      for(j=0;j<N-1;++j)
+         mem[j] = mem[j+ilen];
+   }
+}
+
 EXPORT int speex_resampler_process_interleaved_float(SpeexResamplerState *st, const float *in, spx_uint32_t *in_len, float *out, spx_uint32_t *out_len)
 {
    spx_uint32_t i;
    int istride_save, ostride_save;
    spx_uint32_t bak_out_len = *out_len;
    spx_uint32_t bak_in_len = *in_len;
+   int direct = multi_channel_mode(st);
+
+   if (direct >= 0)
+   {
+      const spx_uint32_t C = st->nb_channels;
+      const int filt_offs = st->filt_len - 1;
+      const spx_uint32_t xlen = st->mem_alloc_size - filt_offs;
+      spx_uint32_t ilen = *in_len;
+      spx_uint32_t olen = *out_len;
+#ifdef FIXED_POINT
+      const spx_uint32_t ylen = FIXED_STACK_ALLOC / C;
+      spx_word16_t ystack[FIXED_STACK_ALLOC];
+#endif
+      while (ilen && olen)
+      {
+         spx_uint32_t ichunk = (ilen > xlen) ? xlen : ilen;
+#ifdef FIXED_POINT
+         spx_uint32_t ochunk = (olen > ylen) ? ylen : olen;
+#else
+         spx_uint32_t ochunk = olen;
+#endif
+         spx_uint32_t c, j;
+         for (c=0;c<C;c++)
+         {
+            spx_word16_t *x = st->mem + c*st->mem_alloc_size + filt_offs;
+            if (in)
+            {
+               for(j=0;j<ichunk;++j)
+#ifdef FIXED_POINT
+                  x[j] = WORD2INT(in[j*C+c]);
+#else
+                  x[j] = in[j*C+c];
+#endif
+            } else {
+               for(j=0;j<ichunk;++j)
+                  x[j] = 0;
+            }
+         }
+#ifdef FIXED_POINT
+         speex_resampler_process_multi(st, direct, &ichunk, ystack, &ochunk);
+         for (j=0;j<ochunk*C;j++)
+            out[j] = ystack[j];
+#else
+         speex_resampler_process_multi(st, direct, &ichunk, out, &ochunk);
+#endif
+         ilen -= ichunk;
+         olen -= ochunk;
+         out += ochunk*C;
+         if (in)
+            in += ichunk*C;
+      }
+      *in_len -= ilen;
+      *out_len -= olen;
+      return RESAMPLER_ERR_SUCCESS;
+   }
+
    istride_save = st->in_stride;
    ostride_save = st->out_stride;
    st->in_stride = st->out_stride = st->nb_channels;
@@ -1065,6 +1645,58 @@ EXPORT int speex_resampler_process_interleaved_int(SpeexResamplerState *st, cons
    int istride_save, ostride_save;
    spx_uint32_t bak_out_len = *out_len;
    spx_uint32_t bak_in_len = *in_len;
+   int direct = multi_channel_mode(st);
+
+   if (direct >= 0)
+   {
+      const spx_uint32_t C = st->nb_channels;
+      const int filt_offs = st->filt_len - 1;
+      const spx_uint32_t xlen = st->mem_alloc_size - filt_offs;
+      spx_uint32_t ilen = *in_len;
+      spx_uint32_t olen = *out_len;
+#ifndef FIXED_POINT
+      const spx_uint32_t ylen = FIXED_STACK_ALLOC / C;
+      spx_word16_t ystack[FIXED_STACK_ALLOC];
+#endif
+      while (ilen && olen)
+      {
+         spx_uint32_t ichunk = (ilen > xlen) ? xlen : ilen;
+#ifndef FIXED_POINT
+         spx_uint32_t ochunk = (olen > ylen) ? ylen : olen;
+#else
+         spx_uint32_t ochunk = olen;
+#endif
+         spx_uint32_t c, j;
+         for (c=0;c<C;c++)
+         {
+            spx_word16_t *x = st->mem + c*st->mem_alloc_size + filt_offs;
+            if (in)
+            {
+               for(j=0;j<ichunk;++j)
+                  x[j] = in[j*C+c];
+            } else {
+               for(j=0;j<ichunk;++j)
+                  x[j] = 0;
+            }
+         }
+#ifndef FIXED_POINT
+         speex_resampler_process_multi(st, direct, &ichunk, ystack, &ochunk);
+         for (j=0;j<ochunk*C;j++)
+            out[j] = WORD2INT(ystack[j]);
+#else
+         speex_resampler_process_multi(st, direct, &ichunk, out, &ochunk);
+#endif
+         ilen -= ichunk;
+         olen -= ochunk;
+         out += ochunk*C;
+         if (in)
+            in += ichunk*C;
+      }
+      *in_len -= ilen;
+      *out_len -= olen;
+      return RESAMPLER_ERR_SUCCESS;
+   }
+
    istride_save = st->in_stride;
    ostride_save = st->out_stride;
    st->in_stride = st->out_stride = st->nb_channels;
@@ -1122,6 +1754,8 @@ EXPORT int speex_resampler_set_rate_frac(SpeexResamplerState *st, spx_uint32_t r
    st->out_rate = out_rate;
    st->num_rate = ratio_num;
    st->den_rate = ratio_den;
+   st->drift_enabled = 0;
+   st->drift_ppb = 0;
 
    fact = compute_gcd(st->num_rate, st->den_rate);
 
@@ -1151,6 +1785,88 @@ EXPORT void speex_resampler_get_ratio(SpeexResamplerState *st, spx_uint32_t *rat
    *ratio_den = st->den_rate;
 }
 
+/* Moves the ratio over to a fine denominator once, so that later corrections
+   only touch num_rate and the advances. The filter is built one last time
+   (interpolated, since a direct table would need den_rate phases) and is then
+   kept as the correction changes. */
+static int drift_enable(SpeexResamplerState *st)
+{
+   spx_uint32_t scale, i;
+   scale = DRIFT_FINE_DEN / st->den_rate;
+   if (scale > (UINT32_MAX/2) / st->num_rate)
+      scale = (UINT32_MAX/2) / st->num_rate;
+   if (scale < 1)
+      scale = 1;
+   st->num_rate *= scale;
+   st->den_rate *= scale;
+   for (i=0;i<st->nb_channels;i++)
+      st->samp_frac_num[i] *= scale;
+   st->drift_num = st->num_rate;
+   st->drift_enabled = 1;
+   st->drift_fill = 0;
+   st->drift_integ = 0;
+   st->drift_samples = 0;
+   if (st->initialised)
+      return update_filter(st);
+   return RESAMPLER_ERR_SUCCESS;
+}
+
+EXPORT int speex_resampler_set_drift(SpeexResamplerState *st, spx_int32_t ppb)
+{
+   double num;
+   if (!st->drift_enabled)
+   {
+      int err = drift_enable(st);
+      if (err != RESAMPLER_ERR_SUCCESS)
+         return err;
+   }
+   if (ppb > RESAMPLER_MAX_DRIFT_PPB)
+      ppb = RESAMPLER_MAX_DRIFT_PPB;
+   else if (ppb < -RESAMPLER_MAX_DRIFT_PPB)
+      ppb = -RESAMPLER_MAX_DRIFT_PPB;
+   st->drift_ppb = ppb;
+   num = st->drift_num * (1. + ppb*1e-9);
+   st->num_rate = (spx_uint32_t)floor(num + .5);
+   st->int_advance = st->num_rate/st->den_rate;
+   st->frac_advance = st->num_rate%st->den_rate;
+   return RESAMPLER_ERR_SUCCESS;
+}
+
+EXPORT void speex_resampler_get_drift(SpeexResamplerState *st, spx_int32_t *ppb)
+{
+   *ppb = st->drift_ppb;
+}
+
+EXPORT int speex_resampler_track_fill(SpeexResamplerState *st, spx_int32_t fill, spx_int32_t target)
+{
+   /* PI loop on the smoothed level, critically damped with time constant tau
+      (in output samples); the level is smoothed over tau/8 */
+   float tau = RESAMPLER_DRIFT_TIME_CONSTANT * st->out_rate;
+   float n, alpha, err;
+   if (!st->drift_enabled)
+   {
+      int ret = speex_resampler_set_drift(st, 0);
+      if (ret != RESAMPLER_ERR_SUCCESS)
+         return ret;
+      st->drift_fill = fill;
+   }
+   n = st->drift_samples;
+   st->drift_samples = 0;
+   if (n <= 0 || tau <= 0)
+      return RESAMPLER_ERR_SUCCESS;
+   alpha = 8*n/tau;
+   if (alpha > 1)
+      alpha = 1;
+   st->drift_fill += alpha*(fill - st->drift_fill);
+   err = st->drift_fill - target;
+   st->drift_integ += err*n/(tau*tau);
+   if (st->drift_integ > RESAMPLER_MAX_DRIFT_PPB*1e-9f)
+      st->drift_integ = RESAMPLER_MAX_DRIFT_PPB*1e-9f;
+   else if (st->drift_integ < -RESAMPLER_MAX_DRIFT_PPB*1e-9f)
+      st->drift_integ = -RESAMPLER_MAX_DRIFT_PPB*1e-9f;
+   return speex_resampler_set_drift(st, (spx_int32_t)floor(1e9*(1.4f*err/tau + st->drift_integ) + .5));
+}
+
 EXPORT int speex_resampler_set_quality(SpeexResamplerState *st, int quality)
 {
    if (quality > 10 || quality < 0)
@@ -1220,6 +1936,15 @@ EXPORT int speex_resampler_reset_mem(SpeexResamplerState *st)
    return RESAMPLER_ERR_SUCCESS;
 }
 
+EXPORT void speex_resampler_cache_trim(void)
+{
+   struct sinc_entry *evicted;
+   speex_lock(&sinc_cache_lock);
+   evicted = sinc_cache_evict(0);
+   speex_unlock(&sinc_cache_lock);
+   sinc_entry_free_list(evicted);
+}
+
 EXPORT const char *speex_resampler_strerror(int err)
 {
    switch (err)
@@ -0,0 +1,145 @@
+/* File: resample_neon.h
+   Resampler inner products for ARM NEON (floating-point build)
+
+   Same contract as resample_sse.h: the interpolating kernels and the
+   double-precision kernels (AArch64 only) reproduce the scalar arithmetic of
+   resample.c, the single-precision direct product sums in a different order.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted under the same terms as resample.c.
+*/
+
+#ifndef RESAMPLE_NEON_H
+#define RESAMPLE_NEON_H
+
+#include <arm_neon.h>
+
+static inline float resample_hsum_f32(float32x4_t v)
+{
+   float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+   return vget_lane_f32(vpadd_f32(s, s), 0);
+}
+
+#define OVERRIDE_INNER_PRODUCT_SINGLE
+static inline float inner_product_single(const float *a, const float *b, unsigned int len)
+{
+   unsigned int i = 0;
+   float ret;
+   float32x4_t sum0 = vdupq_n_f32(0);
+   float32x4_t sum1 = vdupq_n_f32(0);
+   for (;i+8<=len;i+=8)
+   {
+      sum0 = vaddq_f32(sum0, vmulq_f32(vld1q_f32(a+i), vld1q_f32(b+i)));
+      sum1 = vaddq_f32(sum1, vmulq_f32(vld1q_f32(a+i+4), vld1q_f32(b+i+4)));
+   }
+   ret = resample_hsum_f32(vaddq_f32(sum0, sum1));
+   for (;i<len;i++)
+      ret += a[i]*b[i];
+   return ret;
+}
+
+#define OVERRIDE_INNER_PRODUCT_X4_SINGLE
+static inline void inner_product_x4_single(const float *a, const float *b, int step, int len, float sum[4])
+{
+   int i = 0;
+   float32x4_t s0 = vdupq_n_f32(0);
+   float32x4_t s1 = vdupq_n_f32(0);
+   float32x4_t s2 = vdupq_n_f32(0);
+   float32x4_t s3 = vdupq_n_f32(0);
+   for (;i+4<=len;i+=4)
+   {
+      float32x4_t t = vld1q_f32(a+i);
+      s0 = vaddq_f32(s0, vmulq_f32(t, vld1q_f32(b+i)));
+      s1 = vaddq_f32(s1, vmulq_f32(t, vld1q_f32(b+i+step)));
+      s2 = vaddq_f32(s2, vmulq_f32(t, vld1q_f32(b+i+2*step)));
+      s3 = vaddq_f32(s3, vmulq_f32(t, vld1q_f32(b+i+3*step)));
+   }
+   sum[0] = resample_hsum_f32(s0);
+   sum[1] = resample_hsum_f32(s1);
+   sum[2] = resample_hsum_f32(s2);
+   sum[3] = resample_hsum_f32(s3);
+   for (;i<len;i++)
+   {
+      sum[0] += a[i]*b[i];
+      sum[1] += a[i]*b[i+step];
+      sum[2] += a[i]*b[i+2*step];
+      sum[3] += a[i]*b[i+3*step];
+   }
+}
+
+#define OVERRIDE_INNER_PRODUCT_X2_SINGLE
+static inline void inner_product_x2_single(const float *a, const float *b, int step, int len, float sum[2])
+{
+   int i = 0;
+   float32x4_t s0 = vdupq_n_f32(0);
+   float32x4_t s1 = vdupq_n_f32(0);
+   for (;i+4<=len;i+=4)
+   {
+      float32x4_t t = vld1q_f32(a+i);
+      s0 = vaddq_f32(s0, vmulq_f32(t, vld1q_f32(b+i)));
+      s1 = vaddq_f32(s1, vmulq_f32(t, vld1q_f32(b+i+step)));
+   }
+   sum[0] = resample_hsum_f32(s0);
+   sum[1] = resample_hsum_f32(s1);
+   for (;i<len;i++)
+   {
+      sum[0] += a[i]*b[i];
+      sum[1] += a[i]*b[i+step];
+   }
+}
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
+static inline float interpolate_product_single(const float *a, const float *b, unsigned int len, const spx_uint32_t oversample, float *frac)
+{
+   unsigned int i;
+   float accum[4];
+   float32x4_t sum = vdupq_n_f32(0);
+   for (i=0;i<len;i++)
+      sum = vaddq_f32(sum, vmulq_f32(vdupq_n_f32(a[i]), vld1q_f32(b+i*oversample)));
+   vst1q_f32(accum, sum);
+   return frac[0]*accum[0] + frac[1]*accum[1] + frac[2]*accum[2] + frac[3]*accum[3];
+}
+
+#if defined(__aarch64__)
+
+#define OVERRIDE_INNER_PRODUCT_DOUBLE
+static inline double inner_product_double(const float *a, const float *b, unsigned int len)
+{
+   unsigned int i = 0;
+   double accum[4];
+   float64x2_t sum0 = vdupq_n_f64(0);
+   float64x2_t sum1 = vdupq_n_f64(0);
+   for (;i+4<=len;i+=4)
+   {
+      float32x4_t p = vmulq_f32(vld1q_f32(a+i), vld1q_f32(b+i));
+      sum0 = vaddq_f64(sum0, vcvt_f64_f32(vget_low_f32(p)));
+      sum1 = vaddq_f64(sum1, vcvt_high_f64_f32(p));
+   }
+   vst1q_f64(accum, sum0);
+   vst1q_f64(accum+2, sum1);
+   for (;i<len;i++)
+      accum[i&3] += a[i]*b[i];
+   return accum[0] + accum[1] + accum[2] + accum[3];
+}
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_DOUBLE
+static inline double interpolate_product_double(const float *a, const float *b, unsigned int len, const spx_uint32_t oversample, float *frac)
+{
+   unsigned int i;
+   double accum[4];
+   float64x2_t sum0 = vdupq_n_f64(0);
+   float64x2_t sum1 = vdupq_n_f64(0);
+   for (i=0;i<len;i++)
+   {
+      float32x4_t p = vmulq_f32(vdupq_n_f32(a[i]), vld1q_f32(b+i*oversample));
+      sum0 = vaddq_f64(sum0, vcvt_f64_f32(vget_low_f32(p)));
+      sum1 = vaddq_f64(sum1, vcvt_high_f64_f32(p));
+   }
+   vst1q_f64(accum, sum0);
+   vst1q_f64(accum+2, sum1);
+   return frac[0]*accum[0] + frac[1]*accum[1] + frac[2]*accum[2] + frac[3]*accum[3];
+}
+
+#endif /* __aarch64__ */
+
+#endif
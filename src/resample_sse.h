@@ -0,0 +1,211 @@
+/* File: resample_sse.h
+   Resampler inner products for x86 (SSE, SSE2 and AVX when enabled)
+
+   Replaces the scalar loops of resampler_basic_direct_*() and
+   resampler_basic_interpolate_*() in resample.c. The filter length is a
+   multiple of 8 (update_filter() rounds it up), the tails are handled anyway.
+
+   The interpolating kernels keep the scalar code's arithmetic exactly (four
+   per-tap accumulators, same final summation order). The direct products
+   sum in a different order, so the output may differ in the last bit; the
+   double-precision one still accumulates in double.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted under the same terms as resample.c.
+*/
+
+#ifndef RESAMPLE_SSE_H
+#define RESAMPLE_SSE_H
+
+#include <xmmintrin.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+static inline float resample_hsum_ps(__m128 v)
+{
+   v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+   v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 0x55));
+   return _mm_cvtss_f32(v);
+}
+
+#define OVERRIDE_INNER_PRODUCT_SINGLE
+static inline float inner_product_single(const float *a, const float *b, unsigned int len)
+{
+   unsigned int i = 0;
+   float ret;
+#if defined(__AVX__)
+   __m256 sum = _mm256_setzero_ps();
+   for (;i+8<=len;i+=8)
+   {
+#if defined(__FMA__)
+      sum = _mm256_fmadd_ps(_mm256_loadu_ps(a+i), _mm256_loadu_ps(b+i), sum);
+#else
+      sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(a+i), _mm256_loadu_ps(b+i)));
+#endif
+   }
+   ret = resample_hsum_ps(_mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1)));
+#else
+   /* Two accumulators hide the latency of the adds */
+   __m128 sum0 = _mm_setzero_ps();
+   __m128 sum1 = _mm_setzero_ps();
+   for (;i+8<=len;i+=8)
+   {
+      sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(a+i), _mm_loadu_ps(b+i)));
+      sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(a+i+4), _mm_loadu_ps(b+i+4)));
+   }
+   ret = resample_hsum_ps(_mm_add_ps(sum0, sum1));
+#endif
+   for (;i<len;i++)
+      ret += a[i]*b[i];
+   return ret;
+}
+
+#define OVERRIDE_INNER_PRODUCT_X4_SINGLE
+static inline void inner_product_x4_single(const float *a, const float *b, int step, int len, float sum[4])
+{
+   int i = 0;
+   const float *b1 = b+step, *b2 = b+2*step, *b3 = b+3*step;
+   /* Two sets of accumulators so the adds are not back to back */
+   __m128 s0 = _mm_setzero_ps(), s1 = _mm_setzero_ps(), s2 = _mm_setzero_ps(), s3 = _mm_setzero_ps();
+   __m128 u0 = _mm_setzero_ps(), u1 = _mm_setzero_ps(), u2 = _mm_setzero_ps(), u3 = _mm_setzero_ps();
+   for (;i+8<=len;i+=8)
+   {
+      __m128 t = _mm_loadu_ps(a+i);
+      __m128 v = _mm_loadu_ps(a+i+4);
+      s0 = _mm_add_ps(s0, _mm_mul_ps(t, _mm_loadu_ps(b+i)));
+      s1 = _mm_add_ps(s1, _mm_mul_ps(t, _mm_loadu_ps(b1+i)));
+      s2 = _mm_add_ps(s2, _mm_mul_ps(t, _mm_loadu_ps(b2+i)));
+      s3 = _mm_add_ps(s3, _mm_mul_ps(t, _mm_loadu_ps(b3+i)));
+      u0 = _mm_add_ps(u0, _mm_mul_ps(v, _mm_loadu_ps(b+i+4)));
+      u1 = _mm_add_ps(u1, _mm_mul_ps(v, _mm_loadu_ps(b1+i+4)));
+      u2 = _mm_add_ps(u2, _mm_mul_ps(v, _mm_loadu_ps(b2+i+4)));
+      u3 = _mm_add_ps(u3, _mm_mul_ps(v, _mm_loadu_ps(b3+i+4)));
+   }
+   s0 = _mm_add_ps(s0, u0);
+   s1 = _mm_add_ps(s1, u1);
+   s2 = _mm_add_ps(s2, u2);
+   s3 = _mm_add_ps(s3, u3);
+   /* Four horizontal sums in one go */
+   _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+   _mm_storeu_ps(sum, _mm_add_ps(_mm_add_ps(s0, s1), _mm_add_ps(s2, s3)));
+   for (;i<len;i++)
+   {
+      sum[0] += a[i]*b[i];
+      sum[1] += a[i]*b1[i];
+      sum[2] += a[i]*b2[i];
+      sum[3] += a[i]*b3[i];
+   }
+}
+
+#define OVERRIDE_INNER_PRODUCT_X2_SINGLE
+static inline void inner_product_x2_single(const float *a, const float *b, int step, int len, float sum[2])
+{
+   int i = 0;
+   const float *b1 = b+step;
+   __m128 s0 = _mm_setzero_ps(), s1 = _mm_setzero_ps();
+   __m128 u0 = _mm_setzero_ps(), u1 = _mm_setzero_ps();
+   for (;i+8<=len;i+=8)
+   {
+      __m128 t = _mm_loadu_ps(a+i);
+      __m128 v = _mm_loadu_ps(a+i+4);
+      s0 = _mm_add_ps(s0, _mm_mul_ps(t, _mm_loadu_ps(b+i)));
+      s1 = _mm_add_ps(s1, _mm_mul_ps(t, _mm_loadu_ps(b1+i)));
+      u0 = _mm_add_ps(u0, _mm_mul_ps(v, _mm_loadu_ps(b+i+4)));
+      u1 = _mm_add_ps(u1, _mm_mul_ps(v, _mm_loadu_ps(b1+i+4)));
+   }
+   sum[0] = resample_hsum_ps(_mm_add_ps(s0, u0));
+   sum[1] = resample_hsum_ps(_mm_add_ps(s1, u1));
+   for (;i<len;i++)
+   {
+      sum[0] += a[i]*b[i];
+      sum[1] += a[i]*b1[i];
+   }
+}
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
+static inline float interpolate_product_single(const float *a, const float *b, unsigned int len, const spx_uint32_t oversample, float *frac)
+{
+   unsigned int i;
+   float accum[4];
+   /* The four taps around each input sample are contiguous in the table */
+   __m128 sum = _mm_setzero_ps();
+   for (i=0;i<len;i++)
+      sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load1_ps(a+i), _mm_loadu_ps(b+i*oversample)));
+   _mm_storeu_ps(accum, sum);
+   return frac[0]*accum[0] + frac[1]*accum[1] + frac[2]*accum[2] + frac[3]*accum[3];
+}
+
+#if defined(__SSE2__)
+
+#define OVERRIDE_INNER_PRODUCT_DOUBLE
+static inline double inner_product_double(const float *a, const float *b, unsigned int len)
+{
+   unsigned int i = 0;
+   double accum[4];
+   /* Products stay single precision like in resample.c. Splitting each lane's
+      running sum in two breaks the chain of dependent double adds, which is
+      what limits the scalar loop at quality 9-10 */
+#if defined(__AVX__)
+   __m256d sum0 = _mm256_setzero_pd();
+   __m256d sum1 = _mm256_setzero_pd();
+   for (;i+8<=len;i+=8)
+   {
+      sum0 = _mm256_add_pd(sum0, _mm256_cvtps_pd(_mm_mul_ps(_mm_loadu_ps(a+i), _mm_loadu_ps(b+i))));
+      sum1 = _mm256_add_pd(sum1, _mm256_cvtps_pd(_mm_mul_ps(_mm_loadu_ps(a+i+4), _mm_loadu_ps(b+i+4))));
+   }
+   _mm256_storeu_pd(accum, _mm256_add_pd(sum0, sum1));
+#else
+   __m128d sum0 = _mm_setzero_pd();
+   __m128d sum1 = _mm_setzero_pd();
+   __m128d sum2 = _mm_setzero_pd();
+   __m128d sum3 = _mm_setzero_pd();
+   for (;i+8<=len;i+=8)
+   {
+      __m128 p0 = _mm_mul_ps(_mm_loadu_ps(a+i), _mm_loadu_ps(b+i));
+      __m128 p1 = _mm_mul_ps(_mm_loadu_ps(a+i+4), _mm_loadu_ps(b+i+4));
+      sum0 = _mm_add_pd(sum0, _mm_cvtps_pd(p0));
+      sum1 = _mm_add_pd(sum1, _mm_cvtps_pd(_mm_movehl_ps(p0, p0)));
+      sum2 = _mm_add_pd(sum2, _mm_cvtps_pd(p1));
+      sum3 = _mm_add_pd(sum3, _mm_cvtps_pd(_mm_movehl_ps(p1, p1)));
+   }
+   _mm_storeu_pd(accum, _mm_add_pd(sum0, sum2));
+   _mm_storeu_pd(accum+2, _mm_add_pd(sum1, sum3));
+#endif
+   for (;i<len;i++)
+      accum[i&3] += a[i]*b[i];
+   return accum[0] + accum[1] + accum[2] + accum[3];
+}
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_DOUBLE
+static inline double interpolate_product_double(const float *a, const float *b, unsigned int len, const spx_uint32_t oversample, float *frac)
+{
+   unsigned int i;
+   double accum[4];
+   /* As in resample.c, the products are formed in single precision */
+#if defined(__AVX__)
+   __m256d sum = _mm256_setzero_pd();
+   for (i=0;i<len;i++)
+      sum = _mm256_add_pd(sum, _mm256_cvtps_pd(_mm_mul_ps(_mm_load1_ps(a+i), _mm_loadu_ps(b+i*oversample))));
+   _mm256_storeu_pd(accum, sum);
+#else
+   __m128d sum0 = _mm_setzero_pd();
+   __m128d sum1 = _mm_setzero_pd();
+   for (i=0;i<len;i++)
+   {
+      __m128 p = _mm_mul_ps(_mm_load1_ps(a+i), _mm_loadu_ps(b+i*oversample));
+      sum0 = _mm_add_pd(sum0, _mm_cvtps_pd(p));
+      sum1 = _mm_add_pd(sum1, _mm_cvtps_pd(_mm_movehl_ps(p, p)));
+   }
+   _mm_storeu_pd(accum, sum0);
+   _mm_storeu_pd(accum+2, sum1);
+#endif
+   return frac[0]*accum[0] + frac[1]*accum[1] + frac[2]*accum[2] + frac[3]*accum[3];
+}
+
+#endif /* __SSE2__ */
+
+#endif
@@ -0,0 +1,4420 @@
+/* File: resample_tables.h
+   Precomputed resampler filter tables (100448 bytes)
+
+   Generated by extra/tables/gen_resample_tables.c, do not edit.
+   Rates: 8000 16000 24000 32000 44100 48000
+   Qualities: 3 4 5
+*/
+
+#ifndef RESAMPLE_TABLES_H
+#define RESAMPLE_TABLES_H
+
+static const spx_word16_t resample_table_0[96] = {
+   -2.55462201e-05f, 0.000100863319f, -0.000259486202f, 0.000532516337f, -0.000937428325f, 0.00146290124f,
+   -0.00205293158f, 0.00259332452f, -0.00290520536f, 0.00274869404f, -0.00183912949f, -0.000122978759f,
+   0.00341105997f, -0.00822512992f, 0.0146448240f, -0.0225911140f, 0.0318041369f, -0.0418437906f,
+   0.0521155559f, -0.0619213060f, 0.0705289021f, -0.0772518814f, 0.0815309584f, 0.916999996f,
+   0.0815309584f, -0.0772518814f, 0.0705289021f, -0.0619213060f, 0.0521155559f, -0.0418437906f,
+   0.0318041369f, -0.0225911140f, 0.0146448240f, -0.00822512992f, 0.00341105997f, -0.000122978759f,
+   -0.00183912949f, 0.00274869404f, -0.00290520536f, 0.00259332452f, -0.00205293158f, 0.00146290124f,
+   -0.000937428325f, 0.000532516337f, -0.000259486202f, 0.000100863319f, -2.55462201e-05f, 7.79471463e-07f,
+   -5.56055857e-05f, 0.000124210739f, -0.000208601530f, 0.000278921216f, -0.000280493317f, 0.000132974586f,
+   0.000263932860f, -0.00101651670f, 0.00221492327f, -0.00390401552f, 0.00605115714f, -0.00851545297f,
+   0.0110230874f, -0.0131545104f, 0.0143441595f, -0.0138897803f, 0.0109615317f, -0.00458457274f,
+   -0.00646224432f, 0.0239769984f, -0.0513535291f, 0.0971789882f, -0.193332121f, 0.630190849f,
+   0.630190849f, -0.193332121f, 0.0971789882f, -0.0513535291f, 0.0239769984f, -0.00646224432f,
+   -0.00458457274f, 0.0109615317f, -0.0138897803f, 0.0143441595f, -0.0131545104f, 0.0110230874f,
+   -0.00851545297f, 0.00605115714f, -0.00390401552f, 0.00221492327f, -0.00101651670f, 0.000263932860f,
+   0.000132974586f, -0.000280493317f, 0.000278921216f, -0.000208601530f, 0.000124210739f, -5.56055857e-05f,
+};
+
+static const spx_word16_t resample_table_1[144] = {
+   -2.55462201e-05f, 0.000100863319f, -0.000259486202f, 0.000532516337f, -0.000937428325f, 0.00146290124f,
+   -0.00205293158f, 0.00259332452f, -0.00290520536f, 0.00274869404f, -0.00183912949f, -0.000122978759f,
+   0.00341105997f, -0.00822512992f, 0.0146448240f, -0.0225911140f, 0.0318041369f, -0.0418437906f,
+   0.0521155559f, -0.0619213060f, 0.0705289021f, -0.0772518814f, 0.0815309584f, 0.916999996f,
+   0.0815309584f, -0.0772518814f, 0.0705289021f, -0.0619213060f, 0.0521155559f, -0.0418437906f,
+   0.0318041369f, -0.0225911140f, 0.0146448240f, -0.00822512992f, 0.00341105997f, -0.000122978759f,
+   -0.00183912949f, 0.00274869404f, -0.00290520536f, 0.00259332452f, -0.00205293158f, 0.00146290124f,
+   -0.000937428325f, 0.000532516337f, -0.000259486202f, 0.000100863319f, -2.55462201e-05f, 7.79471463e-07f,
+   -6.31498478e-05f, 0.000153345623f, -0.000290291006f, 0.000461163872f, -0.000626633875f, 0.000713746296f,
+   -0.000614002289f, 0.000189377781f, 0.000712076435f, -0.00223040767f, 0.00445970148f, -0.00740920147f,
+   0.0109648611f, -0.0148570389f, 0.0186376702f, -0.0216685403f, 0.0231130589f, -0.0219097584f,
+   0.0166727491f, -0.00536799384f, -0.0157278515f, 0.0559369586f, -0.151943341f, 0.781856716f,
+   0.447262406f, -0.186824545f, 0.112286694f, -0.0721935779f, 0.0454876423f, -0.0263023041f,
+   0.0124034761f, -0.00267138681f, -0.00365595287f, 0.00723828655f, -0.00870670844f, 0.00866562594f,
+   -0.00766659901f, 0.00617886940f, -0.00456707692f, 0.00308273756f, -0.00186969305f, 0.000980703509f,
+   -0.000401484111f, 7.67977981e-05f, 6.57239507e-05f, -9.69657267e-05f, 7.45535290e-05f, -3.77751385e-05f,
+   -3.77751385e-05f, 7.45535290e-05f, -9.69657267e-05f, 6.57239507e-05f, 7.67977981e-05f, -0.000401484111f,
+   0.000980703509f, -0.00186969305f, 0.00308273756f, -0.00456707692f, 0.00617886940f, -0.00766659901f,
+   0.00866562594f, -0.00870670844f, 0.00723828655f, -0.00365595287f, -0.00267138681f, 0.0124034761f,
+   -0.0263023041f, 0.0454876423f, -0.0721935779f, 0.112286694f, -0.186824530f, 0.447262347f,
+   0.781856775f, -0.151943296f, 0.0559369586f, -0.0157278515f, -0.00536799384f, 0.0166727491f,
+   -0.0219097584f, 0.0231130589f, -0.0216685403f, 0.0186376702f, -0.0148570389f, 0.0109648611f,
+   -0.00740920147f, 0.00445970148f, -0.00223040767f, 0.000712076435f, 0.000189377781f, -0.000614002289f,
+   0.000713746296f, -0.000626633875f, 0.000461163872f, -0.000290291006f, 0.000153345623f, -6.31498478e-05f,
+};
+
+static const spx_word16_t resample_table_2[192] = {
+   -2.55462201e-05f, 0.000100863319f, -0.000259486202f, 0.000532516337f, -0.000937428325f, 0.00146290124f,
+   -0.00205293158f, 0.00259332452f, -0.00290520536f, 0.00274869404f, -0.00183912949f, -0.000122978759f,
+   0.00341105997f, -0.00822512992f, 0.0146448240f, -0.0225911140f, 0.0318041369f, -0.0418437906f,
+   0.0521155559f, -0.0619213060f, 0.0705289021f, -0.0772518814f, 0.0815309584f, 0.916999996f,
+   0.0815309584f, -0.0772518814f, 0.0705289021f, -0.0619213060f, 0.0521155559f, -0.0418437906f,
+   0.0318041369f, -0.0225911140f, 0.0146448240f, -0.00822512992f, 0.00341105997f, -0.000122978759f,
+   -0.00183912949f, 0.00274869404f, -0.00290520536f, 0.00259332452f, -0.00205293158f, 0.00146290124f,
+   -0.000937428325f, 0.000532516337f, -0.000259486202f, 0.000100863319f, -2.55462201e-05f, 7.79471463e-07f,
+   -6.09907365e-05f, 0.000155674265f, -0.000310688571f, 0.000523739320f, -0.000767252175f, 0.000978439697f,
+   -0.00105343643f, 0.000848515134f, -0.000190899285f, -0.00109920395f, 0.00317647564f, -0.00613067718f,
+   0.00994396303f, -0.0144512663f, 0.0193080194f, -0.0239690356f, 0.0276733227f, -0.0294181146f,
+   0.0278746206f, -0.0211105868f, 0.00566873513f, 0.0270214193f, -0.111785546f, 0.839412510f,
+   0.351414949f, -0.168736503f, 0.109927282f, -0.0760040060f, 0.0519656204f, -0.0336553007f,
+   0.0195830539f, -0.00906084385f, 0.00162252819f, 0.00317601813f, -0.00581203029f, 0.00678912131f,
+   -0.00660500675f, 0.00571390241f, -0.00449468708f, 0.00323224417f, -0.00211292063f, 0.00123262487f,
+   -0.000614981633f, 0.000233821687f, -3.59188198e-05f, -3.95071984e-05f, 4.70054110e-05f, -2.73021979e-05f,
+   -5.56055857e-05f, 0.000124210739f, -0.000208601530f, 0.000278921216f, -0.000280493317f, 0.000132974586f,
+   0.000263932860f, -0.00101651670f, 0.00221492327f, -0.00390401552f, 0.00605115714f, -0.00851545297f,
+   0.0110230874f, -0.0131545104f, 0.0143441595f, -0.0138897803f, 0.0109615317f, -0.00458457274f,
+   -0.00646224432f, 0.0239769984f, -0.0513535291f, 0.0971789882f, -0.193332121f, 0.630190849f,
+   0.630190849f, -0.193332121f, 0.0971789882f, -0.0513535291f, 0.0239769984f, -0.00646224432f,
+   -0.00458457274f, 0.0109615317f, -0.0138897803f, 0.0143441595f, -0.0131545104f, 0.0110230874f,
+   -0.00851545297f, 0.00605115714f, -0.00390401552f, 0.00221492327f, -0.00101651670f, 0.000263932860f,
+   0.000132974586f, -0.000280493317f, 0.000278921216f, -0.000208601530f, 0.000124210739f, -5.56055857e-05f,
+   -2.73021979e-05f, 4.70054110e-05f, -3.95071984e-05f, -3.59188198e-05f, 0.000233821687f, -0.000614981633f,
+   0.00123262487f, -0.00211292063f, 0.00323224417f, -0.00449468708f, 0.00571390241f, -0.00660500675f,
+   0.00678912131f, -0.00581203029f, 0.00317601813f, 0.00162252819f, -0.00906084385f, 0.0195830539f,
+   -0.0336553007f, 0.0519656204f, -0.0760040060f, 0.109927282f, -0.168736503f, 0.351414949f,
+   0.839412510f, -0.111785546f, 0.0270214193f, 0.00566873513f, -0.0211105868f, 0.0278746206f,
+   -0.0294181146f, 0.0276733227f, -0.0239690356f, 0.0193080194f, -0.0144512663f, 0.00994396303f,
+   -0.00613067718f, 0.00317647564f, -0.00109920395f, -0.000190899285f, 0.000848515134f, -0.00105343643f,
+   0.000978439697f, -0.000767252175f, 0.000523739320f, -0.000310688571f, 0.000155674265f, -6.09907365e-05f,
+};
+
+static const spx_word16_t resample_table_3[392] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, 7.79471463e-07f, -1.20261493e-05f,
+   -2.73021979e-05f, -4.27935011e-05f, -5.56055857e-05f, -6.26123219e-05f, -6.09907365e-05f, -4.88022270e-05f,
+   -2.55462201e-05f, 7.47355716e-06f, 4.70054110e-05f, 8.80177104e-05f, 0.000124210739f, 0.000148821156f,
+   0.000155674265f, 0.000140280710f, 0.000100863319f, 3.91120157e-05f, -3.95071984e-05f, -0.000125981489f,
+   -0.000208601530f, -0.000274343969f, -0.000310688571f, -0.000307610055f, -0.000259486202f, -0.000166593716f,
+   -3.59188198e-05f, 0.000118949596f, 0.000278921216f, 0.000421518460f, 0.000523739320f, 0.000565415132f,
+   0.000532516337f, 0.000420027121f, 0.000233821687f, -8.85814279e-06f, -0.000280493317f, -0.000546080642f,
+   -0.000767252175f, -0.000907459646f, -0.000937428325f, -0.000840205816f, -0.000614981633f, -0.000278988387f,
+   0.000132974586f, 0.000571588986f, 0.000978439697f, 0.00129339623f, 0.00146290124f, 0.00144828227f,
+   0.00123262487f, 0.000825431722f, 0.000263932860f, -0.000389470486f, -0.00105343643f, -0.00163733424f,
+   -0.00205293158f, -0.00222699810f, -0.00211292063f, -0.00169965613f, -0.00101651670f, -0.000132753936f,
+   0.000848515134f, 0.00180152489f, 0.00259332452f, 0.00310154981f, 0.00323224417f, 0.00293530035f,
+   0.00221492327f, 0.00113376370f, -0.000190899285f, -0.00159880018f, -0.00290520536f, -0.00392434886f,
+   -0.00449468708f, -0.00450306572f, -0.00390401552f, -0.00273125432f, -0.00109920395f, 0.000806449912f,
+   0.00274869404f, 0.00446756463f, 0.00571390241f, 0.00628409674f, 0.00605115714f, 0.00498765428f,
+   0.00317647564f, 0.000807812205f, -0.00183912949f, -0.00442761974f, -0.00660500675f, -0.00804945175f,
+   -0.00851545297f, -0.00787251443f, -0.00613067718f, -0.00344875641f, -0.000122978759f, 0.00344376732f,
+   0.00678912131f, 0.00944961235f, 0.0110230874f, 0.0112269325f, 0.00994396303f, 0.00724899629f,
+   0.00341105997f, -0.00113005703f, -0.00581203029f, -0.0100177117f, -0.0131545104f, -0.0147355190f,
+   -0.0144512663f, -0.0122225033f, -0.00822512992f, -0.00288248342f, 0.00317601813f, 0.00918643642f,
+   0.0143441595f, 0.0179089960f, 0.0193080194f, 0.0182222836f, 0.0146448240f, 0.00890048128f,
+   0.00162252819f, -0.00631308509f, -0.0138897803f, -0.0200775228f, -0.0239690356f, -0.0249079615f,
+   -0.0225911140f, -0.0171300117f, -0.00906084385f, 0.000701354758f, 0.0109615317f, 0.0203864649f,
+   0.0276733227f, 0.0317242444f, 0.0318041369f, 0.0276599023f, 0.0195830539f, 0.00840404723f,
+   -0.00458457274f, -0.0177711602f, -0.0294181146f, -0.0378835462f, -0.0418437906f, -0.0404876210f,
+   -0.0336553007f, -0.0219004098f, -0.00646224432f, 0.0108533371f, 0.0278746206f, 0.0423251651f,
+   0.0521155559f, 0.0556292422f, 0.0519656204f, 0.0411061235f, 0.0239769984f, 0.00239413604f,
+   -0.0211105868f, -0.0435672179f, -0.0619213060f, -0.0734227970f, -0.0760040060f, -0.0685978755f,
+   -0.0513535291f, -0.0257128663f, 0.00566873513f, 0.0391594917f, 0.0705289021f, 0.0954284966f,
+   0.109927282f, 0.111038804f, 0.0971789882f, 0.0684954226f, 0.0270214193f, -0.0233746562f,
+   -0.0772518814f, -0.128056422f, -0.168736503f, -0.192455769f, -0.193332121f, -0.167123199f,
+   -0.111785546f, -0.0278349649f, 0.0815309584f, 0.210573897f, 0.351414949f, 0.494658083f,
+   0.630190849f, 0.748069048f, 0.839412510f, 0.897216737f, 0.916999996f, 0.897216737f,
+   0.839412510f, 0.748069048f, 0.630190849f, 0.494658083f, 0.351414949f, 0.210573897f,
+   0.0815309584f, -0.0278349649f, -0.111785546f, -0.167123199f, -0.193332121f, -0.192455769f,
+   -0.168736503f, -0.128056422f, -0.0772518814f, -0.0233746562f, 0.0270214193f, 0.0684954226f,
+   0.0971789882f, 0.111038804f, 0.109927282f, 0.0954284966f, 0.0705289021f, 0.0391594917f,
+   0.00566873513f, -0.0257128663f, -0.0513535291f, -0.0685978755f, -0.0760040060f, -0.0734227970f,
+   -0.0619213060f, -0.0435672179f, -0.0211105868f, 0.00239413604f, 0.0239769984f, 0.0411061235f,
+   0.0519656204f, 0.0556292422f, 0.0521155559f, 0.0423251651f, 0.0278746206f, 0.0108533371f,
+   -0.00646224432f, -0.0219004098f, -0.0336553007f, -0.0404876210f, -0.0418437906f, -0.0378835462f,
+   -0.0294181146f, -0.0177711602f, -0.00458457274f, 0.00840404723f, 0.0195830539f, 0.0276599023f,
+   0.0318041369f, 0.0317242444f, 0.0276733227f, 0.0203864649f, 0.0109615317f, 0.000701354758f,
+   -0.00906084385f, -0.0171300117f, -0.0225911140f, -0.0249079615f, -0.0239690356f, -0.0200775228f,
+   -0.0138897803f, -0.00631308509f, 0.00162252819f, 0.00890048128f, 0.0146448240f, 0.0182222836f,
+   0.0193080194f, 0.0179089960f, 0.0143441595f, 0.00918643642f, 0.00317601813f, -0.00288248342f,
+   -0.00822512992f, -0.0122225033f, -0.0144512663f, -0.0147355190f, -0.0131545104f, -0.0100177117f,
+   -0.00581203029f, -0.00113005703f, 0.00341105997f, 0.00724899629f, 0.00994396303f, 0.0112269325f,
+   0.0110230874f, 0.00944961235f, 0.00678912131f, 0.00344376732f, -0.000122978759f, -0.00344875641f,
+   -0.00613067718f, -0.00787251443f, -0.00851545297f, -0.00804945175f, -0.00660500675f, -0.00442761974f,
+   -0.00183912949f, 0.000807812205f, 0.00317647564f, 0.00498765428f, 0.00605115714f, 0.00628409674f,
+   0.00571390241f, 0.00446756463f, 0.00274869404f, 0.000806449912f, -0.00109920395f, -0.00273125432f,
+   -0.00390401552f, -0.00450306572f, -0.00449468708f, -0.00392434886f, -0.00290520536f, -0.00159880018f,
+   -0.000190899285f, 0.00113376370f, 0.00221492327f, 0.00293530035f, 0.00323224417f, 0.00310154981f,
+   0.00259332452f, 0.00180152489f, 0.000848515134f, -0.000132753936f, -0.00101651670f, -0.00169965613f,
+   -0.00211292063f, -0.00222699810f, -0.00205293158f, -0.00163733424f, -0.00105343643f, -0.000389470486f,
+   0.000263932860f, 0.000825431722f, 0.00123262487f, 0.00144828227f, 0.00146290124f, 0.00129339623f,
+   0.000978439697f, 0.000571588986f, 0.000132974586f, -0.000278988387f, -0.000614981633f, -0.000840205816f,
+   -0.000937428325f, -0.000907459646f, -0.000767252175f, -0.000546080642f, -0.000280493317f, -8.85814279e-06f,
+   0.000233821687f, 0.000420027121f, 0.000532516337f, 0.000565415132f, 0.000523739320f, 0.000421518460f,
+   0.000278921216f, 0.000118949596f, -3.59188198e-05f, -0.000166593716f, -0.000259486202f, -0.000307610055f,
+   -0.000310688571f, -0.000274343969f, -0.000208601530f, -0.000125981489f, -3.95071984e-05f, 3.91120157e-05f,
+   0.000100863319f, 0.000140280710f, 0.000155674265f, 0.000148821156f, 0.000124210739f, 8.80177104e-05f,
+   4.70054110e-05f, 7.47355716e-06f, -2.55462201e-05f, -4.88022270e-05f, -6.09907365e-05f, -6.26123219e-05f,
+   -5.56055857e-05f, -4.27935011e-05f, -2.73021979e-05f, -1.20261493e-05f, 7.79471463e-07f, 0.00000000f,
+   0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_4[288] = {
+   -2.55462201e-05f, 0.000100863319f, -0.000259486202f, 0.000532516337f, -0.000937428325f, 0.00146290124f,
+   -0.00205293158f, 0.00259332452f, -0.00290520536f, 0.00274869404f, -0.00183912949f, -0.000122978759f,
+   0.00341105997f, -0.00822512992f, 0.0146448240f, -0.0225911140f, 0.0318041369f, -0.0418437906f,
+   0.0521155559f, -0.0619213060f, 0.0705289021f, -0.0772518814f, 0.0815309584f, 0.916999996f,
+   0.0815309584f, -0.0772518814f, 0.0705289021f, -0.0619213060f, 0.0521155559f, -0.0418437906f,
+   0.0318041369f, -0.0225911140f, 0.0146448240f, -0.00822512992f, 0.00341105997f, -0.000122978759f,
+   -0.00183912949f, 0.00274869404f, -0.00290520536f, 0.00259332452f, -0.00205293158f, 0.00146290124f,
+   -0.000937428325f, 0.000532516337f, -0.000259486202f, 0.000100863319f, -2.55462201e-05f, 7.79471463e-07f,
+   -5.41041845e-05f, 0.000148058491f, -0.000313473050f, 0.000559278589f, -0.000871736382f, 0.00120215840f,
+   -0.00145723543f, 0.00149524619f, -0.00113139616f, 0.000154690890f, 0.00164362660f, -0.00443148240f,
+   0.00829147082f, -0.0131759495f, 0.0188675188f, -0.0249499120f, 0.0307878535f, -0.0355058014f,
+   0.0379300602f, -0.0363891646f, 0.0280152634f, -0.00589235732f, -0.0588550307f, 0.882009447f,
+   0.256649822f, -0.143090576f, 0.101588830f, -0.0753502101f, 0.0552256592f, -0.0388061292f,
+   0.0253742039f, -0.0146919675f, 0.00660574809f, -0.000906704518f, -0.00270516984f, 0.00460693846f,
+   -0.00521607278f, 0.00494683674f, -0.00417112838f, 0.00319056748f, -0.00222233240f, 0.00139883545f,
+   -0.000778879737f, 0.000365528336f, -0.000126694227f, 1.44025744e-05f, 2.01424264e-05f, -1.69383893e-05f,
+   -6.31498478e-05f, 0.000153345623f, -0.000290291006f, 0.000461163872f, -0.000626633875f, 0.000713746296f,
+   -0.000614002289f, 0.000189377781f, 0.000712076435f, -0.00223040767f, 0.00445970148f, -0.00740920147f,
+   0.0109648611f, -0.0148570389f, 0.0186376702f, -0.0216685403f, 0.0231130589f, -0.0219097584f,
+   0.0166727491f, -0.00536799384f, -0.0157278515f, 0.0559369586f, -0.151943341f, 0.781856716f,
+   0.447262406f, -0.186824545f, 0.112286694f, -0.0721935779f, 0.0454876423f, -0.0263023041f,
+   0.0124034761f, -0.00267138681f, -0.00365595287f, 0.00723828655f, -0.00870670844f, 0.00866562594f,
+   -0.00766659901f, 0.00617886940f, -0.00456707692f, 0.00308273756f, -0.00186969305f, 0.000980703509f,
+   -0.000401484111f, 7.67977981e-05f, 6.57239507e-05f, -9.69657267e-05f, 7.45535290e-05f, -3.77751385e-05f,
+   -5.56055857e-05f, 0.000124210739f, -0.000208601530f, 0.000278921216f, -0.000280493317f, 0.000132974586f,
+   0.000263932860f, -0.00101651670f, 0.00221492327f, -0.00390401552f, 0.00605115714f, -0.00851545297f,
+   0.0110230874f, -0.0131545104f, 0.0143441595f, -0.0138897803f, 0.0109615317f, -0.00458457274f,
+   -0.00646224432f, 0.0239769984f, -0.0513535291f, 0.0971789882f, -0.193332121f, 0.630190849f,
+   0.630190849f, -0.193332121f, 0.0971789882f, -0.0513535291f, 0.0239769984f, -0.00646224432f,
+   -0.00458457274f, 0.0109615317f, -0.0138897803f, 0.0143441595f, -0.0131545104f, 0.0110230874f,
+   -0.00851545297f, 0.00605115714f, -0.00390401552f, 0.00221492327f, -0.00101651670f, 0.000263932860f,
+   0.000132974586f, -0.000280493317f, 0.000278921216f, -0.000208601530f, 0.000124210739f, -5.56055857e-05f,
+   -3.77751385e-05f, 7.45535290e-05f, -9.69657267e-05f, 6.57239507e-05f, 7.67977981e-05f, -0.000401484111f,
+   0.000980703509f, -0.00186969305f, 0.00308273756f, -0.00456707692f, 0.00617886940f, -0.00766659901f,
+   0.00866562594f, -0.00870670844f, 0.00723828655f, -0.00365595287f, -0.00267138681f, 0.0124034761f,
+   -0.0263023041f, 0.0454876423f, -0.0721935779f, 0.112286694f, -0.186824530f, 0.447262347f,
+   0.781856775f, -0.151943296f, 0.0559369586f, -0.0157278515f, -0.00536799384f, 0.0166727491f,
+   -0.0219097584f, 0.0231130589f, -0.0216685403f, 0.0186376702f, -0.0148570389f, 0.0109648611f,
+   -0.00740920147f, 0.00445970148f, -0.00223040767f, 0.000712076435f, 0.000189377781f, -0.000614002289f,
+   0.000713746296f, -0.000626633875f, 0.000461163872f, -0.000290291006f, 0.000153345623f, -6.31498478e-05f,
+   -1.69383893e-05f, 2.01424264e-05f, 1.44025744e-05f, -0.000126694227f, 0.000365528336f, -0.000778879737f,
+   0.00139883545f, -0.00222233240f, 0.00319056748f, -0.00417112838f, 0.00494683674f, -0.00521607278f,
+   0.00460693846f, -0.00270516984f, -0.000906704518f, 0.00660574809f, -0.0146919675f, 0.0253742039f,
+   -0.0388061292f, 0.0552256592f, -0.0753502101f, 0.101588830f, -0.143090621f, 0.256649822f,
+   0.882009447f, -0.0588551201f, -0.00589235732f, 0.0280152634f, -0.0363891646f, 0.0379300602f,
+   -0.0355058014f, 0.0307878535f, -0.0249499120f, 0.0188675188f, -0.0131759495f, 0.00829147082f,
+   -0.00443148240f, 0.00164362660f, 0.000154690890f, -0.00113139616f, 0.00149524619f, -0.00145723543f,
+   0.00120215840f, -0.000871736382f, 0.000559278589f, -0.000313473050f, 0.000148058491f, -5.41041845e-05f,
+};
+
+static const spx_word16_t resample_table_5[96] = {
+   -2.86833688e-06f, 4.36885566e-05f, 2.84283851e-05f, -8.02420618e-05f, -9.23651678e-05f, 0.000107822867f,
+   0.000209197213f, -9.38924495e-05f, -0.000381285092f, -7.58175565e-06f, 0.000587681367f, 0.000247815420f,
+   -0.000774446409f, -0.000667721091f, 0.000850755197f, 0.00127670355f, -0.000694756804f, -0.00202966086f,
+   0.000171792781f, 0.00280810613f, 0.000834504084f, -0.00341177895f, -0.00238197716f, 0.00356732169f,
+   0.00442651054f, -0.00295660947f, -0.00678455550f, 0.00126384420f, 0.00910992641f, 0.00176386687f,
+   -0.0108905593f, -0.00625347393f, 0.0114650130f, 0.0121530201f, -0.0100458609f, -0.0192015432f,
+   0.00571770314f, 0.0269319899f, 0.00267276727f, -0.0347113758f, -0.0169737116f, 0.0418145023f,
+   0.0414904244f, -0.0475207157f, -0.0920217782f, 0.0512190536f, 0.313479841f, 0.447499990f,
+   0.313479841f, 0.0512190536f, -0.0920217782f, -0.0475207157f, 0.0414904244f, 0.0418145023f,
+   -0.0169737116f, -0.0347113758f, 0.00267276727f, 0.0269319899f, 0.00571770314f, -0.0192015432f,
+   -0.0100458609f, 0.0121530201f, 0.0114650130f, -0.00625347393f, -0.0108905593f, 0.00176386687f,
+   0.00910992641f, 0.00126384420f, -0.00678455550f, -0.00295660947f, 0.00442651054f, 0.00356732169f,
+   -0.00238197716f, -0.00341177895f, 0.000834504084f, 0.00280810613f, 0.000171792781f, -0.00202966086f,
+   -0.000694756804f, 0.00127670355f, 0.000850755197f, -0.000667721091f, -0.000774446409f, 0.000247815420f,
+   0.000587681367f, -7.58175565e-06f, -0.000381285092f, -9.38924495e-05f, 0.000209197213f, 0.000107822867f,
+   -9.23651678e-05f, -8.02420618e-05f, 2.84283851e-05f, 4.36885566e-05f, -2.86833688e-06f, -1.54792415e-05f,
+};
+
+static const spx_word16_t resample_table_8[144] = {
+   -8.45361592e-06f, 7.95949381e-06f, 2.91257020e-05f, 3.11894873e-05f, -1.87697253e-06f, -5.34947067e-05f,
+   -7.57999587e-05f, -2.85183851e-05f, 7.18824886e-05f, 0.000143839905f, 9.99910335e-05f, -6.25949688e-05f,
+   -0.000225776559f, -0.000226149263f, -5.05450362e-06f, 0.000295843754f, 0.000408999942f, 0.000165207530f,
+   -0.000309750409f, -0.000629377668f, -0.000445145735f, 0.000207561345f, 0.000838951091f, 0.000851135701f,
+   7.65371442e-05f, -0.000957018579f, -0.00135310716f, -0.000597488368f, 0.000875348516f, 0.00187207072f,
+   0.00137721829f, -0.000473016786f, -0.00227452256f, -0.00238100463f, -0.000358990976f, 0.00237821438f,
+   0.00349739217f, 0.00168566965f, -0.00197107298f, -0.00452720048f, -0.00349365384f, 0.000842562760f,
+   0.00518602738f, 0.00566052040f, 0.00117589114f, -0.00512126926f, -0.00793393236f, -0.00416898262f,
+   0.00394028425f, 0.00992313400f, 0.00810201373f, -0.00123985333f, -0.0110988524f, -0.0128010279f,
+   -0.00338387024f, 0.0107832914f, 0.0179546587f, 0.0103877066f, -0.00807662588f, -0.0231409147f,
+   -0.0205106307f, 0.00154943496f, 0.0278763343f, 0.0356052220f, 0.0120239211f, -0.0316804759f,
+   -0.0625009462f, -0.0448940992f, 0.0341460332f, 0.151434064f, 0.256349027f, 0.298333317f,
+   0.256349027f, 0.151434064f, 0.0341460332f, -0.0448940992f, -0.0625009462f, -0.0316804759f,
+   0.0120239211f, 0.0356052220f, 0.0278763343f, 0.00154943496f, -0.0205106307f, -0.0231409147f,
+   -0.00807662588f, 0.0103877066f, 0.0179546587f, 0.0107832914f, -0.00338387024f, -0.0128010279f,
+   -0.0110988524f, -0.00123985333f, 0.00810201373f, 0.00992313400f, 0.00394028425f, -0.00416898262f,
+   -0.00793393236f, -0.00512126926f, 0.00117589114f, 0.00566052040f, 0.00518602738f, 0.000842562760f,
+   -0.00349365384f, -0.00452720048f, -0.00197107298f, 0.00168566965f, 0.00349739217f, 0.00237821438f,
+   -0.000358990976f, -0.00238100463f, -0.00227452256f, -0.000473016786f, 0.00137721829f, 0.00187207072f,
+   0.000875348516f, -0.000597488368f, -0.00135310716f, -0.000957018579f, 7.65371442e-05f, 0.000851135701f,
+   0.000838951091f, 0.000207561345f, -0.000445145735f, -0.000629377668f, -0.000309750409f, 0.000165207530f,
+   0.000408999942f, 0.000295843754f, -5.05450362e-06f, -0.000226149263f, -0.000225776559f, -6.25949688e-05f,
+   9.99910335e-05f, 0.000143839905f, 7.18824886e-05f, -2.85183851e-05f, -7.57999587e-05f, -5.34947067e-05f,
+   -1.87697253e-06f, 3.11894873e-05f, 2.91257020e-05f, 7.95949381e-06f, -8.45361592e-06f, -1.03194943e-05f,
+};
+
+static const spx_word16_t resample_table_9[144] = {
+   1.59189876e-05f, 6.23789747e-05f, -0.000106989413f, -5.70367702e-05f, 0.000287679810f, -0.000125189938f,
+   -0.000452298525f, 0.000591687509f, 0.000330415060f, -0.00125875534f, 0.000415122689f, 0.00170227140f,
+   -0.00191403716f, -0.00119497674f, 0.00374414143f, -0.000946033571f, -0.00476200925f, 0.00475642877f,
+   0.00337133929f, -0.00905440096f, 0.00168512552f, 0.0113210408f, -0.0102425385f, -0.00833796524f,
+   0.0198462680f, -0.00247970666f, -0.0256020557f, 0.0215665828f, 0.0207754131f, -0.0462818295f,
+   0.00309886993f, 0.0712104440f, -0.0633609518f, -0.0897881985f, 0.302868128f, 0.596666634f,
+   0.302868128f, -0.0897881985f, -0.0633609518f, 0.0712104440f, 0.00309886993f, -0.0462818295f,
+   0.0207754131f, 0.0215665828f, -0.0256020557f, -0.00247970666f, 0.0198462680f, -0.00833796524f,
+   -0.0102425385f, 0.0113210408f, 0.00168512552f, -0.00905440096f, 0.00337133929f, 0.00475642877f,
+   -0.00476200925f, -0.000946033571f, 0.00374414143f, -0.00119497674f, -0.00191403716f, 0.00170227140f,
+   0.000415122689f, -0.00125875534f, 0.000330415060f, 0.000591687509f, -0.000452298525f, -0.000125189938f,
+   0.000287679810f, -5.70367702e-05f, -0.000106989413f, 6.23789747e-05f, 1.59189876e-05f, -2.06389886e-05f,
+   -1.69072318e-05f, 5.82514040e-05f, -3.75394507e-06f, -0.000151599917f, 0.000143764977f, 0.000199982067f,
+   -0.000451553118f, -1.01090072e-05f, 0.000817999884f, -0.000619500817f, -0.000890291471f, 0.00167790218f,
+   0.000153074288f, -0.00270621432f, 0.00175069703f, 0.00275443657f, -0.00454904512f, -0.000717981951f,
+   0.00699478434f, -0.00394214597f, -0.00698730769f, 0.0103720548f, 0.00235178228f, -0.0158678647f,
+   0.00788056850f, 0.0162040275f, -0.0221977048f, -0.00676774047f, 0.0359093174f, -0.0161532518f,
+   -0.0410212614f, 0.0557526685f, 0.0240478422f, -0.125001892f, 0.0682920665f, 0.512698054f,
+   0.512698054f, 0.0682920665f, -0.125001892f, 0.0240478422f, 0.0557526685f, -0.0410212614f,
+   -0.0161532518f, 0.0359093174f, -0.00676774047f, -0.0221977048f, 0.0162040275f, 0.00788056850f,
+   -0.0158678647f, 0.00235178228f, 0.0103720548f, -0.00698730769f, -0.00394214597f, 0.00699478434f,
+   -0.000717981951f, -0.00454904512f, 0.00275443657f, 0.00175069703f, -0.00270621432f, 0.000153074288f,
+   0.00167790218f, -0.000890291471f, -0.000619500817f, 0.000817999884f, -1.01090072e-05f, -0.000451553118f,
+   0.000199982067f, 0.000143764977f, -0.000151599917f, -3.75394507e-06f, 5.82514040e-05f, -1.69072318e-05f,
+};
+
+static const spx_word16_t resample_table_12[192] = {
+   -7.68249993e-06f, -1.43416844e-06f, 1.02041358e-05f, 2.18442783e-05f, 2.53149319e-05f, 1.42141926e-05f,
+   -1.09173661e-05f, -4.01210309e-05f, -5.68682481e-05f, -4.61825839e-05f, -4.57670512e-06f, 5.39114335e-05f,
+   0.000100560545f, 0.000104598606f, 5.08288431e-05f, -4.69462248e-05f, -0.000145829064f, -0.000190642546f,
+   -0.000142245932f, -3.79087783e-06f, 0.000170578773f, 0.000293840683f, 0.000286832481f, 0.000123907710f,
+   -0.000141096636f, -0.000387223205f, -0.000478292088f, -0.000333860546f, 1.60516520e-05f, 0.000425377599f,
+   0.000688312924f, 0.000638351776f, 0.000244577823f, -0.000347378402f, -0.000861467968f, -0.00101483043f,
+   -0.000666221487f, 8.58963904e-05f, 0.000915626239f, 0.00140405307f, 0.00124381052f, 0.000417252042f,
+   -0.000749831379f, -0.00170588947f, -0.00192660769f, -0.00119098858f, 0.000260366098f, 0.00178366085f,
+   0.00260761566f, 0.00221325527f, 0.000635792094f, -0.00147830474f, -0.00312117417f, -0.00339227775f,
+   -0.00197361712f, 0.000631922099f, 0.00325147109f, 0.00455496321f, 0.00371292583f, 0.000881933433f,
+   -0.00275152363f, -0.00544527965f, -0.00571675133f, -0.00312673696f, 0.00136926363f, 0.00573250651f,
+   0.00773821678f, 0.00607651006f, 0.00112687738f, -0.00502293045f, -0.00941506680f, -0.00960077159f,
+   -0.00493679289f, 0.00285885157f, 0.0102611575f, 0.0134659950f, 0.0102577033f, 0.00133638363f,
+   -0.00961978082f, -0.0173556879f, -0.0174175762f, -0.00848685578f, 0.00646253582f, 0.0209072512f,
+   0.0273422375f, 0.0207452122f, 0.00147781114f, -0.0237603579f, -0.0436141044f, -0.0460108891f,
+   -0.0229684245f, 0.0256095268f, 0.0907824263f, 0.156739920f, 0.205689535f, 0.223749995f,
+   0.205689535f, 0.156739920f, 0.0907824263f, 0.0256095268f, -0.0229684245f, -0.0460108891f,
+   -0.0436141044f, -0.0237603579f, 0.00147781114f, 0.0207452122f, 0.0273422375f, 0.0209072512f,
+   0.00646253582f, -0.00848685578f, -0.0174175762f, -0.0173556879f, -0.00961978082f, 0.00133638363f,
+   0.0102577033f, 0.0134659950f, 0.0102611575f, 0.00285885157f, -0.00493679289f, -0.00960077159f,
+   -0.00941506680f, -0.00502293045f, 0.00112687738f, 0.00607651006f, 0.00773821678f, 0.00573250651f,
+   0.00136926363f, -0.00312673696f, -0.00571675133f, -0.00544527965f, -0.00275152363f, 0.000881933433f,
+   0.00371292583f, 0.00455496321f, 0.00325147109f, 0.000631922099f, -0.00197361712f, -0.00339227775f,
+   -0.00312117417f, -0.00147830474f, 0.000635792094f, 0.00221325527f, 0.00260761566f, 0.00178366085f,
+   0.000260366098f, -0.00119098858f, -0.00192660769f, -0.00170588947f, -0.000749831379f, 0.000417252042f,
+   0.00124381052f, 0.00140405307f, 0.000915626239f, 8.58963904e-05f, -0.000666221487f, -0.00101483043f,
+   -0.000861467968f, -0.000347378402f, 0.000244577823f, 0.000638351776f, 0.000688312924f, 0.000425377599f,
+   1.60516520e-05f, -0.000333860546f, -0.000478292088f, -0.000387223205f, -0.000141096636f, 0.000123907710f,
+   0.000286832481f, 0.000293840683f, 0.000170578773f, -3.79087783e-06f, -0.000142245932f, -0.000190642546f,
+   -0.000145829064f, -4.69462248e-05f, 5.08288431e-05f, 0.000104598606f, 0.000100560545f, 5.39114335e-05f,
+   -4.57670512e-06f, -4.61825839e-05f, -5.68682481e-05f, -4.01210309e-05f, -1.09173661e-05f, 1.42141926e-05f,
+   2.53149319e-05f, 2.18442783e-05f, 1.02041358e-05f, -1.43416844e-06f, -7.68249993e-06f, -7.73962074e-06f,
+};
+
+static const spx_word16_t resample_table_13[192] = {
+   3.06124057e-05f, 4.26425795e-05f, -0.000170604748f, 0.000161734308f, 0.000152486522f, -0.000571927638f,
+   0.000511736318f, 0.000371723116f, -0.00143487623f, 0.00127613288f, 0.000733733468f, -0.00304449117f,
+   0.00274687866f, 0.00125175610f, -0.00577982282f, 0.00535098277f, 0.00190737634f, -0.0101768337f,
+   0.00975441374f, 0.00264580012f, -0.0171502531f, 0.0171975195f, 0.00338063203f, -0.0288023129f,
+   0.0307834726f, 0.00400915090f, -0.0522527285f, 0.0627217516f, 0.00443343353f, -0.138032675f,
+   0.272347301f, 0.671249986f, 0.272347301f, -0.138032675f, 0.00443343353f, 0.0627217516f,
+   -0.0522527285f, 0.00400915090f, 0.0307834726f, -0.0288023129f, 0.00338063203f, 0.0171975195f,
+   -0.0171502531f, 0.00264580012f, 0.00975441374f, -0.0101768337f, 0.00190737634f, 0.00535098277f,
+   -0.00577982282f, 0.00125175610f, 0.00274687866f, -0.00304449117f, 0.000733733468f, 0.00127613288f,
+   -0.00143487623f, 0.000371723116f, 0.000511736318f, -0.000571927638f, 0.000152486522f, 0.000161734308f,
+   -0.000170604748f, 4.26425795e-05f, 3.06124057e-05f, -2.32188631e-05f, -4.30250520e-06f, 7.59448012e-05f,
+   -0.000120362587f, -1.37301158e-05f, 0.000313795812f, -0.000437487179f, -1.13726337e-05f, 0.000860497414f,
+   -0.00116166763f, 4.81549578e-05f, 0.00191505533f, -0.00258439989f, 0.000257689157f, 0.00373143912f,
+   -0.00511766830f, 0.000781098322f, 0.00663976604f, -0.00936353486f, 0.00189576636f, 0.0111387772f,
+   -0.0163358487f, 0.00410779100f, 0.0182295311f, -0.0282452162f, 0.00857650209f, 0.0307731107f,
+   -0.0520670600f, 0.0193876084f, 0.0622356348f, -0.130842313f, 0.0768285766f, 0.617068589f,
+   0.470219761f, -0.0689052790f, -0.0712810755f, 0.0820267126f, -0.0254605673f, -0.0288593750f,
+   0.0403979830f, -0.0148103787f, -0.0150687918f, 0.0232146494f, -0.00938021112f, -0.00825454947f,
+   0.0136648891f, -0.00592085160f, -0.00443488872f, 0.00782284699f, -0.00357294991f, -0.00224949419f,
+   0.00421215920f, -0.00199865643f, -0.00104213518f, 0.00206493982f, -0.00100157794f, -0.000423289923f,
+   0.000881522021f, -0.000426734914f, -0.000140838674f, 0.000301681634f, -0.000138546893f, -3.27520975e-05f,
+   6.55328331e-05f, -2.30473688e-05f, -2.30473688e-05f, 6.55328331e-05f, -3.27520975e-05f, -0.000138546893f,
+   0.000301681634f, -0.000140838674f, -0.000426734914f, 0.000881522021f, -0.000423289923f, -0.00100157794f,
+   0.00206493982f, -0.00104213518f, -0.00199865643f, 0.00421215920f, -0.00224949419f, -0.00357294991f,
+   0.00782284699f, -0.00443488872f, -0.00592085160f, 0.0136648891f, -0.00825454947f, -0.00938021112f,
+   0.0232146494f, -0.0150687918f, -0.0148103787f, 0.0403979830f, -0.0288593750f, -0.0254605673f,
+   0.0820267126f, -0.0712810755f, -0.0689052790f, 0.470219731f, 0.617068589f, 0.0768286288f,
+   -0.130842313f, 0.0622356348f, 0.0193876084f, -0.0520670600f, 0.0307731107f, 0.00857650209f,
+   -0.0282452162f, 0.0182295311f, 0.00410779100f, -0.0163358487f, 0.0111387772f, 0.00189576636f,
+   -0.00936353486f, 0.00663976604f, 0.000781098322f, -0.00511766830f, 0.00373143912f, 0.000257689157f,
+   -0.00258439989f, 0.00191505533f, 4.81549578e-05f, -0.00116166763f, 0.000860497414f, -1.13726337e-05f,
+   -0.000437487179f, 0.000313795812f, -1.37301158e-05f, -0.000120362587f, 7.59448012e-05f, -4.30250520e-06f,
+};
+
+static const spx_word16_t resample_table_15[536] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, -5.50906361e-06f, -5.67402640e-06f,
+   -5.33986986e-06f, -4.42797818e-06f, -2.90181765e-06f, -7.77301523e-07f, 1.87048204e-06f, 4.90475804e-06f,
+   8.13051338e-06f, 1.13025080e-05f, 1.41411037e-05f, 1.63512814e-05f, 1.76456961e-05f, 1.77708516e-05f,
+   1.65332804e-05f, 1.38240530e-05f, 9.63968796e-06f, 4.09583208e-06f, -2.56594922e-06f, -9.98245832e-06f,
+   -1.76822577e-05f, -2.51109668e-05f, -3.16646510e-05f, -3.67319881e-05f, -3.97413642e-05f, -4.02108235e-05f,
+   -3.77955548e-05f, -3.23306922e-05f, -2.38643825e-05f, -1.26767873e-05f, 7.15378917e-07f, 1.55732869e-05f,
+   3.09671159e-05f, 4.58285249e-05f, 5.90157179e-05f, 6.93913171e-05f, 7.59081522e-05f, 7.76973029e-05f,
+   7.41495387e-05f, 6.49856447e-05f, 5.03101473e-05f, 3.06382790e-05f, 6.89780563e-06f, -1.96022647e-05f,
+   -4.72288157e-05f, -7.41187396e-05f, -9.82915954e-05f, -0.000117784170f, -0.000130793269f, -0.000135822498f,
+   -0.000131816094f, -0.000118270516f, -9.53197523e-05f, -6.37783596e-05f, -2.51399524e-05f, 1.84755299e-05f,
+   6.44184111e-05f, 0.000109662338f, 0.000150986438f, 0.000185191151f, 0.000209321064f, 0.000220902191f,
+   0.000218150264f, 0.000200149836f, 0.000166987389f, 0.000119816679f, 6.08585397e-05f, -6.67841368e-06f,
+   -7.87506651e-05f, -0.000150701511f, -0.000217548513f, -0.000274304562f, -0.000316332793f, -0.000339691469f,
+   -0.000341461215f, -0.000320020423f, -0.000275239378f, -0.000208596524f, -0.000123187914f, -2.36120904e-05f,
+   8.42418594e-05f, 0.000193528074f, 0.000296847051f, 0.000386735221f, 0.000456165668f, 0.000499067944f,
+   0.000510809419f, 0.000488607620f, 0.000431838736f, 0.000342211802f, 0.000223801180f, 8.29015917e-05f,
+   -7.22611585e-05f, -0.000231990984f, -0.000385684136f, -0.000522520801f, -0.000632182870f, -0.000705604383f,
+   -0.000735658512f, -0.000717765186f, -0.000650357280f, -0.000535136729f, -0.000377176097f, -0.000184742661f,
+   3.10710093e-05f, 0.000256965781f, 0.000478202070f, 0.000679547549f, 0.000846276176f, 0.000965204381f,
+   0.00102566869f, 0.00102040009f, 0.000946197601f, 0.000804361654f, 0.000600854459f, 0.000346126151f,
+   5.46606534e-05f, -0.000255825493f, -0.000565385621f, -0.000853110687f, -0.00109847356f, -0.00128276658f,
+   -0.00139044342f, -0.00141034869f, -0.00133669050f, -0.00116969936f, -0.000915913726f, -0.000588051102f,
+   -0.000204472366f, 0.000211813065f, 0.000634439231f, 0.00103533978f, 0.00138652360f, 0.00166201277f,
+   0.00183963904f, 0.00190276711f, 0.00184166199f, 0.00165448128f, 0.00134776521f, 0.000936410856f,
+   0.000443031022f, -0.000103167993f, -0.000668093795f, -0.00121477747f, -0.00170578097f, -0.00210564560f,
+   -0.00238340907f, -0.00251485873f, -0.00248448970f, -0.00228693639f, -0.00192777754f, -0.00142368022f,
+   -0.000801754824f, -9.82496131e-05f, 0.000643527776f, 0.00137573271f, 0.00204905472f, 0.00261589093f,
+   0.00303366897f, 0.00326785981f, 0.00329468842f, 0.00310317916f, 0.00269644731f, 0.00209213374f,
+   0.00132181833f, 0.000429577834f, -0.000530485588f, -0.00149734365f, -0.00240687001f, -0.00319595402f,
+   -0.00380677637f, -0.00419086544f, -0.00431275368f, -0.00415289495f, -0.00370965805f, -0.00300020026f,
+   -0.00206014304f, -0.000941998034f, 0.000287597795f, 0.00155170355f, 0.00276774308f, 0.00385274808f,
+   0.00472885137f, 0.00532867573f, 0.00560025824f, 0.00551116373f, 0.00505148387f, 0.00423546834f,
+   0.00310163107f, 0.00171125843f, 0.000145342448f, -0.00149991340f, -0.00311879208f, -0.00460263249f,
+   -0.00584687991f, -0.00675816741f, -0.00726097962f, -0.00730342418f, -0.00686170906f, -0.00594296493f,
+   -0.00458618766f, -0.00286109257f, -0.000864930742f, 0.00128264120f, 0.00344639271f, 0.00548367482f,
+   0.00725342985f, 0.00862550177f, 0.00948969182f, 0.00976390764f, 0.00940086041f, 0.00839283969f,
+   0.00677413214f, 0.00462084822f, 0.00204802910f, -0.000795884756f, -0.00373700773f, -0.00658599567f,
+   -0.00914954022f, -0.0112426085f, -0.0127008557f, -0.0133923078f, -0.0132275876f, -0.0121679725f,
+   -0.0102306781f, -0.00749092968f, -0.00408040592f, -0.000182149335f, 0.00397802331f, 0.00814323500f,
+   0.0120398374f, 0.0153935272f, 0.0179463811f, 0.0194740482f, 0.0198016632f, 0.0188178979f,
+   0.0164860245f, 0.0128512550f, 0.00804377254f, 0.00227704598f, -0.00415864447f, -0.0109073482f,
+   -0.0175629221f, -0.0236879140f, -0.0288352240f, -0.0325713009f, -0.0344997272f, -0.0342839323f,
+   -0.0316677094f, -0.0264925975f, -0.0187107790f, -0.00839276519f, 0.00427050330f, 0.0189715680f,
+   0.0352963544f, 0.0527395271f, 0.0707248300f, 0.0886293203f, 0.105810888f, 0.121636488f,
+   0.135510907f, 0.146904081f, 0.155375570f, 0.160595164f, 0.162358269f, 0.160595164f,
+   0.155375570f, 0.146904081f, 0.135510907f, 0.121636488f, 0.105810888f, 0.0886293203f,
+   0.0707248300f, 0.0527395271f, 0.0352963544f, 0.0189715680f, 0.00427050330f, -0.00839276519f,
+   -0.0187107790f, -0.0264925975f, -0.0316677094f, -0.0342839323f, -0.0344997272f, -0.0325713009f,
+   -0.0288352240f, -0.0236879140f, -0.0175629221f, -0.0109073482f, -0.00415864447f, 0.00227704598f,
+   0.00804377254f, 0.0128512550f, 0.0164860245f, 0.0188178979f, 0.0198016632f, 0.0194740482f,
+   0.0179463811f, 0.0153935272f, 0.0120398374f, 0.00814323500f, 0.00397802331f, -0.000182149335f,
+   -0.00408040592f, -0.00749092968f, -0.0102306781f, -0.0121679725f, -0.0132275876f, -0.0133923078f,
+   -0.0127008557f, -0.0112426085f, -0.00914954022f, -0.00658599567f, -0.00373700773f, -0.000795884756f,
+   0.00204802910f, 0.00462084822f, 0.00677413214f, 0.00839283969f, 0.00940086041f, 0.00976390764f,
+   0.00948969182f, 0.00862550177f, 0.00725342985f, 0.00548367482f, 0.00344639271f, 0.00128264120f,
+   -0.000864930742f, -0.00286109257f, -0.00458618766f, -0.00594296493f, -0.00686170906f, -0.00730342418f,
+   -0.00726097962f, -0.00675816741f, -0.00584687991f, -0.00460263249f, -0.00311879208f, -0.00149991340f,
+   0.000145342448f, 0.00171125843f, 0.00310163107f, 0.00423546834f, 0.00505148387f, 0.00551116373f,
+   0.00560025824f, 0.00532867573f, 0.00472885137f, 0.00385274808f, 0.00276774308f, 0.00155170355f,
+   0.000287597795f, -0.000941998034f, -0.00206014304f, -0.00300020026f, -0.00370965805f, -0.00415289495f,
+   -0.00431275368f, -0.00419086544f, -0.00380677637f, -0.00319595402f, -0.00240687001f, -0.00149734365f,
+   -0.000530485588f, 0.000429577834f, 0.00132181833f, 0.00209213374f, 0.00269644731f, 0.00310317916f,
+   0.00329468842f, 0.00326785981f, 0.00303366897f, 0.00261589093f, 0.00204905472f, 0.00137573271f,
+   0.000643527776f, -9.82496131e-05f, -0.000801754824f, -0.00142368022f, -0.00192777754f, -0.00228693639f,
+   -0.00248448970f, -0.00251485873f, -0.00238340907f, -0.00210564560f, -0.00170578097f, -0.00121477747f,
+   -0.000668093795f, -0.000103167993f, 0.000443031022f, 0.000936410856f, 0.00134776521f, 0.00165448128f,
+   0.00184166199f, 0.00190276711f, 0.00183963904f, 0.00166201277f, 0.00138652360f, 0.00103533978f,
+   0.000634439231f, 0.000211813065f, -0.000204472366f, -0.000588051102f, -0.000915913726f, -0.00116969936f,
+   -0.00133669050f, -0.00141034869f, -0.00139044342f, -0.00128276658f, -0.00109847356f, -0.000853110687f,
+   -0.000565385621f, -0.000255825493f, 5.46606534e-05f, 0.000346126151f, 0.000600854459f, 0.000804361654f,
+   0.000946197601f, 0.00102040009f, 0.00102566869f, 0.000965204381f, 0.000846276176f, 0.000679547549f,
+   0.000478202070f, 0.000256965781f, 3.10710093e-05f, -0.000184742661f, -0.000377176097f, -0.000535136729f,
+   -0.000650357280f, -0.000717765186f, -0.000735658512f, -0.000705604383f, -0.000632182870f, -0.000522520801f,
+   -0.000385684136f, -0.000231990984f, -7.22611585e-05f, 8.29015917e-05f, 0.000223801180f, 0.000342211802f,
+   0.000431838736f, 0.000488607620f, 0.000510809419f, 0.000499067944f, 0.000456165668f, 0.000386735221f,
+   0.000296847051f, 0.000193528074f, 8.42418594e-05f, -2.36120904e-05f, -0.000123187914f, -0.000208596524f,
+   -0.000275239378f, -0.000320020423f, -0.000341461215f, -0.000339691469f, -0.000316332793f, -0.000274304562f,
+   -0.000217548513f, -0.000150701511f, -7.87506651e-05f, -6.67841368e-06f, 6.08585397e-05f, 0.000119816679f,
+   0.000166987389f, 0.000200149836f, 0.000218150264f, 0.000220902191f, 0.000209321064f, 0.000185191151f,
+   0.000150986438f, 0.000109662338f, 6.44184111e-05f, 1.84755299e-05f, -2.51399524e-05f, -6.37783596e-05f,
+   -9.53197523e-05f, -0.000118270516f, -0.000131816094f, -0.000135822498f, -0.000130793269f, -0.000117784170f,
+   -9.82915954e-05f, -7.41187396e-05f, -4.72288157e-05f, -1.96022647e-05f, 6.89780563e-06f, 3.06382790e-05f,
+   5.03101473e-05f, 6.49856447e-05f, 7.41495387e-05f, 7.76973029e-05f, 7.59081522e-05f, 6.93913171e-05f,
+   5.90157179e-05f, 4.58285249e-05f, 3.09671159e-05f, 1.55732869e-05f, 7.15378917e-07f, -1.26767873e-05f,
+   -2.38643825e-05f, -3.23306922e-05f, -3.77955548e-05f, -4.02108235e-05f, -3.97413642e-05f, -3.67319881e-05f,
+   -3.16646510e-05f, -2.51109668e-05f, -1.76822577e-05f, -9.98245832e-06f, -2.56594922e-06f, 4.09583208e-06f,
+   9.63968796e-06f, 1.38240530e-05f, 1.65332804e-05f, 1.77708516e-05f, 1.76456961e-05f, 1.63512814e-05f,
+   1.41411037e-05f, 1.13025080e-05f, 8.13051338e-06f, 4.90475804e-06f, 1.87048204e-06f, -7.77301523e-07f,
+   -2.90181765e-06f, -4.42797818e-06f, -5.33986986e-06f, -5.67402640e-06f, -5.50906361e-06f, 0.00000000f,
+   0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_16[552] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, 2.74682475e-06f, -1.75650179e-08f,
+   -3.49266520e-06f, -7.49327182e-06f, -1.17492391e-05f, -1.59175033e-05f, -1.96030487e-05f, -2.23872448e-05f,
+   -2.38627417e-05f, -2.36706801e-05f, -2.15417640e-05f, -1.73323770e-05f, -1.10525625e-05f, -2.88786100e-06f,
+   6.79265577e-06f, 1.74416600e-05f, 2.83568479e-05f, 3.87176478e-05f, 4.76361565e-05f, 5.42244197e-05f,
+   5.76623243e-05f, 5.72729514e-05f, 5.25931719e-05f, 4.34354151e-05f, 2.99358289e-05f, 1.25792121e-05f,
+   -7.79796301e-06f, -3.00335250e-05f, -5.26914046e-05f, -7.41448748e-05f, -9.26780631e-05f, -0.000106607542f,
+   -0.000114412498f, -0.000114867507f, -0.000107163687f, -9.10113886e-05f, -6.67138229e-05f, -3.52017232e-05f,
+   1.97368558e-06f, 4.26974075e-05f, 8.43895104e-05f, 0.000124157319f, 0.000158974872f, 0.000185894489f,
+   0.000202266092f, 0.000205958815f, 0.000195562592f, 0.000170552317f, 0.000131406166f, 7.96524109e-05f,
+   1.78512291e-05f, -5.05051139e-05f, -0.000121160694f, -0.000189345141f, -0.000250067736f, -0.000298459374f,
+   -0.000330126815f, -0.000341509352f, -0.000330193754f, -0.000295174948f, -0.000237042477f, -0.000158049646f,
+   -6.20859864e-05f, 4.54742803e-05f, 0.000158033188f, 0.000268159783f, 0.000368042180f, 0.000450013904f,
+   0.000507096993f, 0.000533558370f, 0.000525370939f, 0.000480637391f, 0.000399871846f, 0.000286121940f,
+   0.000144935024f, -1.58619932e-05f, -0.000186548554f, -0.000356066594f, -0.000512705708f, -0.000644855259f,
+   -0.000741837430f, -0.000794697669f, -0.000796944951f, -0.000745154393f, -0.000639404869f, -0.000483487791f,
+   -0.000284892245f, -5.44874383e-05f, 0.000193978747f, 0.000444681151f, 0.000680659374f, 0.000884940149f,
+   0.00104168558f, 0.00113736780f, 0.00116183038f, 0.00110917981f, 0.000978438649f, 0.000773907814f,
+   0.000505184988f, 0.000186790392f, -0.000162520402f, -0.000520830683f, -0.000864352449f, -0.00116899132f,
+   -0.00141191867f, -0.00157324958f, -0.00163754006f, -0.00159509631f, -0.00144294731f, -0.00118540484f,
+   -0.000834178412f, -0.000407949119f, 6.85061023e-05f, 0.000565709022f, 0.00105119136f, 0.00149159518f,
+   0.00185485184f, 0.00211246591f, 0.00224160426f, 0.00222695759f, 0.00206216821f, 0.00175066164f,
+   0.00130597921f, 0.000751319749f, 0.000118493394f, -0.000553856895f, -0.00122247508f, -0.00184225303f,
+   -0.00236913865f, -0.00276320986f, -0.00299151824f, -0.00303070340f, -0.00286900904f, -0.00250763190f,
+   -0.00196127687f, -0.00125776778f, -0.000436845061f, 0.000452023873f, 0.00135244790f, 0.00220465777f,
+   0.00294930069f, 0.00353153003f, 0.00390484394f, 0.00403463980f, 0.00390106183f, 0.00350102340f,
+   0.00284914160f, 0.00197759923f, 0.000934723532f, -0.000217457782f, -0.00140686694f, -0.00255565974f,
+   -0.00358529878f, -0.00442168955f, -0.00500044692f, -0.00527152279f, -0.00520327408f, -0.00478535984f,
+   -0.00403034594f, -0.00297390763f, -0.00167336571f, -0.000204889162f, 0.00134090951f, 0.00286427885f,
+   0.00426273467f, 0.00543765910f, 0.00630117673f, 0.00678238273f, 0.00683286646f, 0.00643086433f,
+   0.00558383670f, 0.00432925625f, 0.00273327203f, 0.000887655129f, -0.00109539472f, -0.00308970595f,
+   -0.00496307621f, -0.00658575213f, -0.00783921778f, -0.00862449594f, -0.00886958558f, -0.00853536464f,
+   -0.00761957979f, -0.00615852932f, -0.00422627293f, -0.00193128898f, 0.000589282485f, 0.00317754131f,
+   0.00566443242f, 0.00788048562f, 0.00966703612f, 0.0108871898f, 0.0114358077f, 0.0112478100f,
+   0.0103041679f, 0.00863511488f, 0.00632023113f, 0.00348528125f, 0.000295867736f, -0.00305181160f,
+   -0.00634260522f, -0.00935579371f, -0.0118794087f, -0.0137245869f, -0.0147390151f, -0.0148185445f,
+   -0.0139161889f, -0.0120476913f, -0.00929326564f, -0.00579518685f, -0.00175121345f, 0.00259590172f,
+   0.00697230361f, 0.0110895643f, 0.0146629130f, 0.0174300559f, 0.0191693529f, 0.0197161846f,
+   0.0189763997f, 0.0169357769f, 0.0136647876f, 0.00931808911f, 0.00412856881f, -0.00160389219f,
+   -0.00752859516f, -0.0132641466f, -0.0184216294f, -0.0226292256f, -0.0255571436f, -0.0269410405f,
+   -0.0266024508f, -0.0244649276f, -0.0205645151f, -0.0150536215f, -0.00819790177f, -0.000365867541f,
+   0.00798846595f, 0.0163491685f, 0.0241671093f, 0.0308922417f, 0.0360080227f, 0.0390654206f,
+   0.0397150069f, 0.0377349369f, 0.0330529884f, 0.0257611610f, 0.0161215737f, 0.00456298981f,
+   -0.00833225530f, -0.0218507387f, -0.0351789296f, -0.0474410541f, -0.0577424541f, -0.0652159974f,
+   -0.0690692216f, -0.0686296970f, -0.0633859262f, -0.0530223250f, -0.0374444015f, -0.0167943668f,
+   0.00854483806f, 0.0379574411f, 0.0706147105f, 0.105505683f, 0.141477793f, 0.177285627f,
+   0.211645454f, 0.243291885f, 0.271035314f, 0.293816388f, 0.310755014f, 0.321191341f,
+   0.324716538f, 0.321191341f, 0.310755014f, 0.293816388f, 0.271035314f, 0.243291885f,
+   0.211645454f, 0.177285627f, 0.141477793f, 0.105505683f, 0.0706147105f, 0.0379574411f,
+   0.00854483806f, -0.0167943668f, -0.0374444015f, -0.0530223250f, -0.0633859262f, -0.0686296970f,
+   -0.0690692216f, -0.0652159974f, -0.0577424541f, -0.0474410541f, -0.0351789296f, -0.0218507387f,
+   -0.00833225530f, 0.00456298981f, 0.0161215737f, 0.0257611610f, 0.0330529884f, 0.0377349369f,
+   0.0397150069f, 0.0390654206f, 0.0360080227f, 0.0308922417f, 0.0241671093f, 0.0163491685f,
+   0.00798846595f, -0.000365867541f, -0.00819790177f, -0.0150536215f, -0.0205645151f, -0.0244649276f,
+   -0.0266024508f, -0.0269410405f, -0.0255571436f, -0.0226292256f, -0.0184216294f, -0.0132641466f,
+   -0.00752859516f, -0.00160389219f, 0.00412856881f, 0.00931808911f, 0.0136647876f, 0.0169357769f,
+   0.0189763997f, 0.0197161846f, 0.0191693529f, 0.0174300559f, 0.0146629130f, 0.0110895643f,
+   0.00697230361f, 0.00259590172f, -0.00175121345f, -0.00579518685f, -0.00929326564f, -0.0120476913f,
+   -0.0139161889f, -0.0148185445f, -0.0147390151f, -0.0137245869f, -0.0118794087f, -0.00935579371f,
+   -0.00634260522f, -0.00305181160f, 0.000295867736f, 0.00348528125f, 0.00632023113f, 0.00863511488f,
+   0.0103041679f, 0.0112478100f, 0.0114358077f, 0.0108871898f, 0.00966703612f, 0.00788048562f,
+   0.00566443242f, 0.00317754131f, 0.000589282485f, -0.00193128898f, -0.00422627293f, -0.00615852932f,
+   -0.00761957979f, -0.00853536464f, -0.00886958558f, -0.00862449594f, -0.00783921778f, -0.00658575213f,
+   -0.00496307621f, -0.00308970595f, -0.00109539472f, 0.000887655129f, 0.00273327203f, 0.00432925625f,
+   0.00558383670f, 0.00643086433f, 0.00683286646f, 0.00678238273f, 0.00630117673f, 0.00543765910f,
+   0.00426273467f, 0.00286427885f, 0.00134090951f, -0.000204889162f, -0.00167336571f, -0.00297390763f,
+   -0.00403034594f, -0.00478535984f, -0.00520327408f, -0.00527152279f, -0.00500044692f, -0.00442168955f,
+   -0.00358529878f, -0.00255565974f, -0.00140686694f, -0.000217457782f, 0.000934723532f, 0.00197759923f,
+   0.00284914160f, 0.00350102340f, 0.00390106183f, 0.00403463980f, 0.00390484394f, 0.00353153003f,
+   0.00294930069f, 0.00220465777f, 0.00135244790f, 0.000452023873f, -0.000436845061f, -0.00125776778f,
+   -0.00196127687f, -0.00250763190f, -0.00286900904f, -0.00303070340f, -0.00299151824f, -0.00276320986f,
+   -0.00236913865f, -0.00184225303f, -0.00122247508f, -0.000553856895f, 0.000118493394f, 0.000751319749f,
+   0.00130597921f, 0.00175066164f, 0.00206216821f, 0.00222695759f, 0.00224160426f, 0.00211246591f,
+   0.00185485184f, 0.00149159518f, 0.00105119136f, 0.000565709022f, 6.85061023e-05f, -0.000407949119f,
+   -0.000834178412f, -0.00118540484f, -0.00144294731f, -0.00159509631f, -0.00163754006f, -0.00157324958f,
+   -0.00141191867f, -0.00116899132f, -0.000864352449f, -0.000520830683f, -0.000162520402f, 0.000186790392f,
+   0.000505184988f, 0.000773907814f, 0.000978438649f, 0.00110917981f, 0.00116183038f, 0.00113736780f,
+   0.00104168558f, 0.000884940149f, 0.000680659374f, 0.000444681151f, 0.000193978747f, -5.44874383e-05f,
+   -0.000284892245f, -0.000483487791f, -0.000639404869f, -0.000745154393f, -0.000796944951f, -0.000794697669f,
+   -0.000741837430f, -0.000644855259f, -0.000512705708f, -0.000356066594f, -0.000186548554f, -1.58619932e-05f,
+   0.000144935024f, 0.000286121940f, 0.000399871846f, 0.000480637391f, 0.000525370939f, 0.000533558370f,
+   0.000507096993f, 0.000450013904f, 0.000368042180f, 0.000268159783f, 0.000158033188f, 4.54742803e-05f,
+   -6.20859864e-05f, -0.000158049646f, -0.000237042477f, -0.000295174948f, -0.000330193754f, -0.000341509352f,
+   -0.000330126815f, -0.000298459374f, -0.000250067736f, -0.000189345141f, -0.000121160694f, -5.05051139e-05f,
+   1.78512291e-05f, 7.96524109e-05f, 0.000131406166f, 0.000170552317f, 0.000195562592f, 0.000205958815f,
+   0.000202266092f, 0.000185894489f, 0.000158974872f, 0.000124157319f, 8.43895104e-05f, 4.26974075e-05f,
+   1.97368558e-06f, -3.52017232e-05f, -6.67138229e-05f, -9.10113886e-05f, -0.000107163687f, -0.000114867507f,
+   -0.000114412498f, -0.000106607542f, -9.26780631e-05f, -7.41448748e-05f, -5.26914046e-05f, -3.00335250e-05f,
+   -7.79796301e-06f, 1.25792121e-05f, 2.99358289e-05f, 4.34354151e-05f, 5.25931719e-05f, 5.72729514e-05f,
+   5.76623243e-05f, 5.42244197e-05f, 4.76361565e-05f, 3.87176478e-05f, 2.83568479e-05f, 1.74416600e-05f,
+   6.79265577e-06f, -2.88786100e-06f, -1.10525625e-05f, -1.73323770e-05f, -2.15417640e-05f, -2.36706801e-05f,
+   -2.38627417e-05f, -2.23872448e-05f, -1.96030487e-05f, -1.59175033e-05f, -1.17492391e-05f, -7.49327182e-06f,
+   -3.49266520e-06f, -1.75650179e-08f, 2.74682475e-06f, 0.00000000f, 0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_17[712] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, -1.65271904e-05f, -1.70272542e-05f,
+   -1.67253074e-05f, -1.55050202e-05f, -1.32840523e-05f, -1.00232628e-05f, -5.73337093e-06f, -4.80438700e-07f,
+   5.61125580e-06f, 1.23589089e-05f, 1.95238281e-05f, 2.68172826e-05f, 3.39075268e-05f, 4.04363564e-05f,
+   4.60295669e-05f, 5.03142255e-05f, 5.29370918e-05f, 5.35830332e-05f, 5.19942878e-05f, 4.79881346e-05f,
+   4.14724673e-05f, 3.24598986e-05f, 2.10769704e-05f, 7.56912959e-06f, -7.69784765e-06f, -2.42448768e-05f,
+   -4.14897113e-05f, -5.87636023e-05f, -7.53329005e-05f, -9.04261324e-05f, -0.000103264087f, -0.000113094015f,
+   -0.000119224096f, -0.000121059646f, -0.000118136304f, -0.000110151799f, -9.69926914e-05f, -7.87538302e-05f,
+   -5.57521853e-05f, -2.85307287e-05f, 2.14613692e-06f, 3.53076975e-05f, 6.98016884e-05f, 0.000104328654f,
+   0.000137485578f, 0.000167817139f, 0.000193870757f, 0.000214259737f, 0.000227724449f, 0.000233195169f,
+   0.000229849524f, 0.000217164052f, 0.000194957975f, 0.000163425153f, 0.000123151491f, 7.51191910e-05f,
+   2.06934183e-05f, -3.84082959e-05f, -0.000100159901f, -0.000162289609f, -0.000222356233f, -0.000277836603f,
+   -0.000326223410f, -0.000365126733f, -0.000392379792f, -0.000406139297f, -0.000404982246f, -0.000387991313f,
+   -0.000354813150f, -0.000305720925f, -0.000241636488f, -0.000164134850f, -7.54198554e-05f, 2.17249562e-05f,
+   0.000124013139f, 0.000227756333f, 0.000328987022f, 0.000423600926f, 0.000507516379f, 0.000576823426f,
+   0.000627963222f, 0.000657883531f, 0.000664192019f, 0.000645283260f, 0.000600451778f, 0.000529966783f,
+   0.000435118040f, 0.000318219420f, 0.000182575619f, 3.24048233e-05f, -0.000127280815f, -0.000290822296f,
+   -0.000452104548f, -0.000604771194f, -0.000742468226f, -0.000859081920f, -0.000948997622f, -0.00100734597f,
+   -0.00103022892f, -0.00101492484f, -0.000960062782f, -0.000865710434f, -0.000733484339f, -0.000566546805f,
+   -0.000369563728f, -0.000148595282f, 8.90697265e-05f, 0.000335137825f, 0.000580580614f, 0.000815963896f,
+   0.00103177328f, 0.00121880358f, 0.00136849703f, 0.00147333473f, 0.00152716541f, 0.00152551301f,
+   0.00146582467f, 0.00134765811f, 0.00117279927f, 0.000945296430f, 0.000671403599f, 0.000359443278f,
+   1.95768498e-05f, -0.000336509082f, -0.000695967581f, -0.00104526174f, -0.00137062313f, -0.00165859261f,
+   -0.00189654867f, -0.00207322626f, -0.00217921310f, -0.00220738840f, -0.00215329765f, -0.00201545004f,
+   -0.00179545628f, -0.00149815227f, -0.00113152829f, -0.000706560444f, -0.000236912048f, 0.000261467183f,
+   0.000770889572f, 0.00127248699f, 0.00174691493f, 0.00217506709f, 0.00253882864f, 0.00282176514f,
+   0.00300986157f, 0.00309213880f, 0.00306120259f, 0.00291365851f, 0.00265041320f, 0.00227680104f,
+   0.00180256343f, 0.00124164438f, 0.000611829339f, -6.57756173e-05f, -0.000767465623f, -0.00146766042f,
+   -0.00213985448f, -0.00275758188f, -0.00329542067f, -0.00373000489f, -0.00404098118f, -0.00421191845f,
+   -0.00423104782f, -0.00409191102f, -0.00379380956f, -0.00334199215f, -0.00274774130f, -0.00202814094f,
+   -0.00120566436f, -0.000307459210f, 0.000635424396f, 0.00158912363f, 0.00251813047f, 0.00338657410f,
+   0.00415957114f, 0.00480459305f, 0.00529273134f, 0.00559998723f, 0.00570830237f, 0.00560648367f,
+   0.00529086310f, 0.00476569775f, 0.00404329598f, 0.00314382883f, 0.00209486601f, 0.000930521463f,
+   -0.000309503987f, -0.00158129830f, -0.00283821928f, -0.00403256621f, -0.00511734327f, -0.00604804186f,
+   -0.00678445632f, -0.00729226414f, -0.00754457666f, -0.00752319023f, -0.00721956743f, -0.00663549826f,
+   -0.00578333251f, -0.00468594441f, -0.00337613234f, -0.00189582631f, -0.000294748839f, 0.00137117924f,
+   0.00304173236f, 0.00465450110f, 0.00614716439f, 0.00745981373f, 0.00853737537f, 0.00933167059f,
+   0.00980357919f, 0.00992476940f, 0.00967911165f, 0.00906369183f, 0.00808934215f, 0.00678071985f,
+   0.00517573394f, 0.00332469167f, 0.00128873356f, -0.000862085901f, -0.00305113290f, -0.00519782677f,
+   -0.00722059608f, -0.00903979875f, -0.0105808238f, -0.0117770620f, -0.0125725977f, -0.0129246796f,
+   -0.0128057441f, -0.0122049162f, -0.0111289741f, -0.00960263610f, -0.00766825955f, -0.00538474973f,
+   -0.00282599428f, -7.85246593e-05f, 0.00276126480f, 0.00559048215f, 0.00830322970f, 0.0107945399f,
+   0.0129642831f, 0.0147211086f, 0.0159860272f, 0.0166958272f, 0.0168059096f, 0.0162925478f,
+   0.0151544530f, 0.0134135326f, 0.0111148674f, 0.00832570065f, 0.00513377506f, 0.00164467585f,
+   -0.00202146359f, -0.00573405344f, -0.00935637672f, -0.0127505446f, -0.0157826412f, -0.0183276553f,
+   -0.0202745032f, -0.0215305761f, -0.0220258068f, -0.0217159502f, -0.0205851272f, -0.0186473560f,
+   -0.0159470104f, -0.0125582563f, -0.00858327746f, -0.00414951937f, 0.000594298937f, 0.00548271509f,
+   0.0103391781f, 0.0149820941f, 0.0192314610f, 0.0229153279f, 0.0258765053f, 0.0279788841f,
+   0.0291131530f, 0.0292016845f, 0.0282025822f, 0.0261125006f, 0.0229680892f, 0.0188462064f,
+   0.0138625447f, 0.00816888921f, 0.00194876327f, -0.00458779139f, -0.0112109976f, -0.0176789928f,
+   -0.0237460639f, -0.0291713327f, -0.0337278247f, -0.0372110419f, -0.0394473709f, -0.0403014719f,
+   -0.0396827646f, -0.0375504717f, -0.0339170732f, -0.0288503096f, -0.0224727895f, -0.0149601791f,
+   -0.00653703045f, 0.00252881530f, 0.0119340699f, 0.0213488378f, 0.0304273181f, 0.0388189219f,
+   0.0461805835f, 0.0521887206f, 0.0565518886f, 0.0590219609f, 0.0594049878f, 0.0575704500f,
+   0.0534588806f, 0.0470875651f, 0.0385537669f, 0.0280358940f, 0.0157915931f, 0.00215388415f,
+   -0.0124759041f, -0.0276370347f, -0.0428208821f, -0.0574841611f, -0.0710637420f, -0.0829926580f,
+   -0.0927167609f, -0.0997116342f, -0.103499182f, -0.103663385f, -0.0998647809f, -0.0918529853f,
+   -0.0794777945f, -0.0626964569f, -0.0415790081f, -0.0163102280f, 0.0128114801f, 0.0453786179f,
+   0.0808819756f, 0.118721314f, 0.158218592f, 0.198633671f, 0.239181533f, 0.279052794f,
+   0.317432642f, 0.353522003f, 0.386557668f, 0.415832222f, 0.440712243f, 0.460655153f,
+   0.475223184f, 0.484095156f, 0.487074822f, 0.484095156f, 0.475223184f, 0.460655153f,
+   0.440712243f, 0.415832222f, 0.386557668f, 0.353522003f, 0.317432642f, 0.279052794f,
+   0.239181533f, 0.198633671f, 0.158218592f, 0.118721314f, 0.0808819756f, 0.0453786179f,
+   0.0128114801f, -0.0163102280f, -0.0415790081f, -0.0626964569f, -0.0794777945f, -0.0918529853f,
+   -0.0998647809f, -0.103663385f, -0.103499182f, -0.0997116342f, -0.0927167609f, -0.0829926580f,
+   -0.0710637420f, -0.0574841611f, -0.0428208821f, -0.0276370347f, -0.0124759041f, 0.00215388415f,
+   0.0157915931f, 0.0280358940f, 0.0385537669f, 0.0470875651f, 0.0534588806f, 0.0575704500f,
+   0.0594049878f, 0.0590219609f, 0.0565518886f, 0.0521887206f, 0.0461805835f, 0.0388189219f,
+   0.0304273181f, 0.0213488378f, 0.0119340699f, 0.00252881530f, -0.00653703045f, -0.0149601791f,
+   -0.0224727895f, -0.0288503096f, -0.0339170732f, -0.0375504717f, -0.0396827646f, -0.0403014719f,
+   -0.0394473709f, -0.0372110419f, -0.0337278247f, -0.0291713327f, -0.0237460639f, -0.0176789928f,
+   -0.0112109976f, -0.00458779139f, 0.00194876327f, 0.00816888921f, 0.0138625447f, 0.0188462064f,
+   0.0229680892f, 0.0261125006f, 0.0282025822f, 0.0292016845f, 0.0291131530f, 0.0279788841f,
+   0.0258765053f, 0.0229153279f, 0.0192314610f, 0.0149820941f, 0.0103391781f, 0.00548271509f,
+   0.000594298937f, -0.00414951937f, -0.00858327746f, -0.0125582563f, -0.0159470104f, -0.0186473560f,
+   -0.0205851272f, -0.0217159502f, -0.0220258068f, -0.0215305761f, -0.0202745032f, -0.0183276553f,
+   -0.0157826412f, -0.0127505446f, -0.00935637672f, -0.00573405344f, -0.00202146359f, 0.00164467585f,
+   0.00513377506f, 0.00832570065f, 0.0111148674f, 0.0134135326f, 0.0151544530f, 0.0162925478f,
+   0.0168059096f, 0.0166958272f, 0.0159860272f, 0.0147211086f, 0.0129642831f, 0.0107945399f,
+   0.00830322970f, 0.00559048215f, 0.00276126480f, -7.85246593e-05f, -0.00282599428f, -0.00538474973f,
+   -0.00766825955f, -0.00960263610f, -0.0111289741f, -0.0122049162f, -0.0128057441f, -0.0129246796f,
+   -0.0125725977f, -0.0117770620f, -0.0105808238f, -0.00903979875f, -0.00722059608f, -0.00519782677f,
+   -0.00305113290f, -0.000862085901f, 0.00128873356f, 0.00332469167f, 0.00517573394f, 0.00678071985f,
+   0.00808934215f, 0.00906369183f, 0.00967911165f, 0.00992476940f, 0.00980357919f, 0.00933167059f,
+   0.00853737537f, 0.00745981373f, 0.00614716439f, 0.00465450110f, 0.00304173236f, 0.00137117924f,
+   -0.000294748839f, -0.00189582631f, -0.00337613234f, -0.00468594441f, -0.00578333251f, -0.00663549826f,
+   -0.00721956743f, -0.00752319023f, -0.00754457666f, -0.00729226414f, -0.00678445632f, -0.00604804186f,
+   -0.00511734327f, -0.00403256621f, -0.00283821928f, -0.00158129830f, -0.000309503987f, 0.000930521463f,
+   0.00209486601f, 0.00314382883f, 0.00404329598f, 0.00476569775f, 0.00529086310f, 0.00560648367f,
+   0.00570830237f, 0.00559998723f, 0.00529273134f, 0.00480459305f, 0.00415957114f, 0.00338657410f,
+   0.00251813047f, 0.00158912363f, 0.000635424396f, -0.000307459210f, -0.00120566436f, -0.00202814094f,
+   -0.00274774130f, -0.00334199215f, -0.00379380956f, -0.00409191102f, -0.00423104782f, -0.00421191845f,
+   -0.00404098118f, -0.00373000489f, -0.00329542067f, -0.00275758188f, -0.00213985448f, -0.00146766042f,
+   -0.000767465623f, -6.57756173e-05f, 0.000611829339f, 0.00124164438f, 0.00180256343f, 0.00227680104f,
+   0.00265041320f, 0.00291365851f, 0.00306120259f, 0.00309213880f, 0.00300986157f, 0.00282176514f,
+   0.00253882864f, 0.00217506709f, 0.00174691493f, 0.00127248699f, 0.000770889572f, 0.000261467183f,
+   -0.000236912048f, -0.000706560444f, -0.00113152829f, -0.00149815227f, -0.00179545628f, -0.00201545004f,
+   -0.00215329765f, -0.00220738840f, -0.00217921310f, -0.00207322626f, -0.00189654867f, -0.00165859261f,
+   -0.00137062313f, -0.00104526174f, -0.000695967581f, -0.000336509082f, 1.95768498e-05f, 0.000359443278f,
+   0.000671403599f, 0.000945296430f, 0.00117279927f, 0.00134765811f, 0.00146582467f, 0.00152551301f,
+   0.00152716541f, 0.00147333473f, 0.00136849703f, 0.00121880358f, 0.00103177328f, 0.000815963896f,
+   0.000580580614f, 0.000335137825f, 8.90697265e-05f, -0.000148595282f, -0.000369563728f, -0.000566546805f,
+   -0.000733484339f, -0.000865710434f, -0.000960062782f, -0.00101492484f, -0.00103022892f, -0.00100734597f,
+   -0.000948997622f, -0.000859081920f, -0.000742468226f, -0.000604771194f, -0.000452104548f, -0.000290822296f,
+   -0.000127280815f, 3.24048233e-05f, 0.000182575619f, 0.000318219420f, 0.000435118040f, 0.000529966783f,
+   0.000600451778f, 0.000645283260f, 0.000664192019f, 0.000657883531f, 0.000627963222f, 0.000576823426f,
+   0.000507516379f, 0.000423600926f, 0.000328987022f, 0.000227756333f, 0.000124013139f, 2.17249562e-05f,
+   -7.54198554e-05f, -0.000164134850f, -0.000241636488f, -0.000305720925f, -0.000354813150f, -0.000387991313f,
+   -0.000404982246f, -0.000406139297f, -0.000392379792f, -0.000365126733f, -0.000326223410f, -0.000277836603f,
+   -0.000222356233f, -0.000162289609f, -0.000100159901f, -3.84082959e-05f, 2.06934183e-05f, 7.51191910e-05f,
+   0.000123151491f, 0.000163425153f, 0.000194957975f, 0.000217164052f, 0.000229849524f, 0.000233195169f,
+   0.000227724449f, 0.000214259737f, 0.000193870757f, 0.000167817139f, 0.000137485578f, 0.000104328654f,
+   6.98016884e-05f, 3.53076975e-05f, 2.14613692e-06f, -2.85307287e-05f, -5.57521853e-05f, -7.87538302e-05f,
+   -9.69926914e-05f, -0.000110151799f, -0.000118136304f, -0.000121059646f, -0.000119224096f, -0.000113094015f,
+   -0.000103264087f, -9.04261324e-05f, -7.53329005e-05f, -5.87636023e-05f, -4.14897113e-05f, -2.42448768e-05f,
+   -7.69784765e-06f, 7.56912959e-06f, 2.10769704e-05f, 3.24598986e-05f, 4.14724673e-05f, 4.79881346e-05f,
+   5.19942878e-05f, 5.35830332e-05f, 5.29370918e-05f, 5.03142255e-05f, 4.60295669e-05f, 4.04363564e-05f,
+   3.39075268e-05f, 2.68172826e-05f, 1.95238281e-05f, 1.23589089e-05f, 5.61125580e-06f, -4.80438700e-07f,
+   -5.73337093e-06f, -1.00232628e-05f, -1.32840523e-05f, -1.55050202e-05f, -1.67253074e-05f, -1.70272542e-05f,
+   -1.65271904e-05f, 0.00000000f, 0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_18[584] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, -1.92177922e-05f, -1.86340549e-05f,
+   -1.62060405e-05f, -1.17808586e-05f, -5.36852122e-06f, 2.83359054e-06f, 1.24311628e-05f, 2.28387144e-05f,
+   3.33053977e-05f, 4.29569336e-05f, 5.08517405e-05f, 5.60620210e-05f, 5.77466235e-05f, 5.52355814e-05f,
+   4.81091010e-05f, 3.62657920e-05f, 1.99703172e-05f, -1.21149654e-07f, -2.29660109e-05f, -4.71686908e-05f,
+   -7.10554887e-05f, -9.27709116e-05f, -0.000110403089f, -0.000122126541f, -0.000126355633f, -0.000121893048f,
+   -0.000108064174f, -8.48283380e-05f, -5.28461205e-05f, -1.35059881e-05f, 3.11082295e-05f, 7.82983407e-05f,
+   0.000124899030f, 0.000167464066f, 0.000202497147f, 0.000226707110f, 0.000237271684f, 0.000232093822f,
+   0.000210019294f, 0.000171012725f, 0.000116266121f, 4.82172036e-05f, -2.95130721e-05f, -0.000112281981f,
+   -0.000194664928f, -0.000270793069f, -0.000334735058f, -0.000380913611f, -0.000404543505f, -0.000402043690f,
+   -0.000371392205f, -0.000312396558f, -0.000226863805f, -0.000118620585f, 6.59210400e-06f, 0.000141384327f,
+   0.000277099491f, 0.000404349528f, 0.000513612700f, 0.000595904072f, 0.000643445586f, 0.000650315720f,
+   0.000612996053f, 0.000530796533f, 0.000406123407f, 0.000244499446f, 5.44309914e-05f, -0.000152993220f,
+   -0.000364677951f, -0.000566329109f, -0.000743351120f, -0.000881851825f, -0.000969653018f, -0.000997282332f,
+   -0.000958763994f, -0.000852306024f, -0.000680701225f, -0.000451417058f, -0.000176390022f, 0.000128523709f,
+   0.000444367499f, 0.000750244595f, 0.00102462480f, 0.00124677259f, 0.00139823928f, 0.00146429788f,
+   0.00143517158f, 0.00130700774f, 0.00108252070f, 0.000771173683f, 0.000388947024f, -4.23862730e-05f,
+   -0.000496407272f, -0.000943585823f, -0.00135315058f, -0.00169509707f, -0.00194232306f, -0.00207262510f,
+   -0.00207051332f, -0.00192864088f, -0.00164878729f, -0.00124216930f, -0.000729289488f, -0.000138983029f,
+   0.000493045780f, 0.00112634373f, 0.00171815488f, 0.00222626608f, 0.00261186482f, 0.00284242770f,
+   0.00289416034f, 0.00275416253f, 0.00242185034f, 0.00190962129f, 0.00124271237f, 0.000458094059f,
+   -0.000397379190f, -0.00126971968f, -0.00210104883f, -0.00283336570f, -0.00341242505f, -0.00379165518f,
+   -0.00393564906f, -0.00382313668f, -0.00344910985f, -0.00282593095f, -0.00198338297f, -0.000967435073f,
+   0.000162041164f, 0.00133469910f, 0.00247388612f, 0.00350162759f, 0.00434372667f, 0.00493503595f,
+   0.00522419810f, 0.00517780008f, 0.00478345621f, 0.00405150652f, 0.00301550073f, 0.00173088652f,
+   0.000272376928f, -0.00127033342f, -0.00279779336f, -0.00420718454f, -0.00539894868f, -0.00628377544f,
+   -0.00678886892f, -0.00686370907f, -0.00648436788f, -0.00565627031f, -0.00441515772f, -0.00282591349f,
+   -0.000979595818f, 0.00101169490f, 0.00302126608f, 0.00491586095f, 0.00656412775f, 0.00784566998f,
+   0.00865942705f, 0.00893136766f, 0.00862050522f, 0.00772306556f, 0.00627424708f, 0.00434759259f,
+   0.00205147220f, -0.000476472691f, -0.00307755079f, -0.00558152422f, -0.00781773869f, -0.00962627400f,
+   -0.0108692562f, -0.0114407958f, -0.0112754805f, -0.0103542637f, -0.00870765466f, -0.00641576434f,
+   -0.00360480323f, -0.000440744741f, 0.00288039539f, 0.00614411756f, 0.00913127698f, 0.0116322106f,
+   0.0134612834f, 0.0144700119f, 0.0145585658f, 0.0136842560f, 0.0118666403f, 0.00918878242f,
+   0.00579407532f, 0.00187935587f, -0.00231636036f, -0.00652574841f, -0.0104700439f, -0.0138769513f,
+   -0.0164990574f, -0.0181311071f, -0.0186253525f, -0.0179035999f, -0.0159651432f, -0.0128898807f,
+   -0.00883620698f, -0.00403365213f, 0.00122948678f, 0.00662287930f, 0.0117943371f, 0.0163922198f,
+   0.0200887043f, 0.0226023830f, 0.0237187091f, 0.0233068708f, 0.0213317592f, 0.0178601705f,
+   0.0130605102f, 0.00719582662f, 0.000610326184f, -0.00628998224f, -0.0130614815f, -0.0192505810f,
+   -0.0244231764f, -0.0281939823f, -0.0302538797f, -0.0303934254f, -0.0285207890f, -0.0246727597f,
+   -0.0190178081f, -0.0118506793f, -0.00357852015f, 0.00530086411f, 0.0142276827f, 0.0226140097f,
+   0.0298809391f, 0.0354967900f, 0.0390138961f, 0.0401015989f, 0.0385731198f, 0.0344043039f,
+   0.0277429391f, 0.0189070422f, 0.00837238971f, -0.00325074908f, -0.0152505608f, -0.0268546734f,
+   -0.0372771248f, -0.0457681082f, -0.0516640805f, -0.0544350892f, -0.0537254326f, -0.0493857302f,
+   -0.0414935239f, -0.0303607285f, -0.0165267810f, -0.000737273658f, 0.0160913486f, 0.0329194777f,
+   0.0486424156f, 0.0621554181f, 0.0724224001f, 0.0785443932f, 0.0798235908f, 0.0758191720f,
+   0.0663910881f, 0.0517288670f, 0.0323628895f, 0.00915729161f, -0.0167171881f, -0.0438283086f,
+   -0.0705446452f, -0.0951115713f, -0.115738191f, -0.130690128f, -0.138383761f, -0.137476444f,
+   -0.126949400f, -0.106175177f, -0.0749690980f, -0.0336197875f, 0.0171031393f, 0.0759651437f,
+   0.141306713f, 0.211104929f, 0.283054411f, 0.354666054f, 0.423374087f, 0.486650199f,
+   0.542118013f, 0.587661743f, 0.621523678f, 0.642386198f, 0.649433076f, 0.642386198f,
+   0.621523678f, 0.587661743f, 0.542118013f, 0.486650199f, 0.423374087f, 0.354666054f,
+   0.283054411f, 0.211104929f, 0.141306713f, 0.0759651437f, 0.0171031393f, -0.0336197875f,
+   -0.0749690980f, -0.106175177f, -0.126949400f, -0.137476444f, -0.138383761f, -0.130690128f,
+   -0.115738191f, -0.0951115713f, -0.0705446452f, -0.0438283086f, -0.0167171881f, 0.00915729161f,
+   0.0323628895f, 0.0517288670f, 0.0663910881f, 0.0758191720f, 0.0798235908f, 0.0785443932f,
+   0.0724224001f, 0.0621554181f, 0.0486424156f, 0.0329194777f, 0.0160913486f, -0.000737273658f,
+   -0.0165267810f, -0.0303607285f, -0.0414935239f, -0.0493857302f, -0.0537254326f, -0.0544350892f,
+   -0.0516640805f, -0.0457681082f, -0.0372771248f, -0.0268546734f, -0.0152505608f, -0.00325074908f,
+   0.00837238971f, 0.0189070422f, 0.0277429391f, 0.0344043039f, 0.0385731198f, 0.0401015989f,
+   0.0390138961f, 0.0354967900f, 0.0298809391f, 0.0226140097f, 0.0142276827f, 0.00530086411f,
+   -0.00357852015f, -0.0118506793f, -0.0190178081f, -0.0246727597f, -0.0285207890f, -0.0303934254f,
+   -0.0302538797f, -0.0281939823f, -0.0244231764f, -0.0192505810f, -0.0130614815f, -0.00628998224f,
+   0.000610326184f, 0.00719582662f, 0.0130605102f, 0.0178601705f, 0.0213317592f, 0.0233068708f,
+   0.0237187091f, 0.0226023830f, 0.0200887043f, 0.0163922198f, 0.0117943371f, 0.00662287930f,
+   0.00122948678f, -0.00403365213f, -0.00883620698f, -0.0128898807f, -0.0159651432f, -0.0179035999f,
+   -0.0186253525f, -0.0181311071f, -0.0164990574f, -0.0138769513f, -0.0104700439f, -0.00652574841f,
+   -0.00231636036f, 0.00187935587f, 0.00579407532f, 0.00918878242f, 0.0118666403f, 0.0136842560f,
+   0.0145585658f, 0.0144700119f, 0.0134612834f, 0.0116322106f, 0.00913127698f, 0.00614411756f,
+   0.00288039539f, -0.000440744741f, -0.00360480323f, -0.00641576434f, -0.00870765466f, -0.0103542637f,
+   -0.0112754805f, -0.0114407958f, -0.0108692562f, -0.00962627400f, -0.00781773869f, -0.00558152422f,
+   -0.00307755079f, -0.000476472691f, 0.00205147220f, 0.00434759259f, 0.00627424708f, 0.00772306556f,
+   0.00862050522f, 0.00893136766f, 0.00865942705f, 0.00784566998f, 0.00656412775f, 0.00491586095f,
+   0.00302126608f, 0.00101169490f, -0.000979595818f, -0.00282591349f, -0.00441515772f, -0.00565627031f,
+   -0.00648436788f, -0.00686370907f, -0.00678886892f, -0.00628377544f, -0.00539894868f, -0.00420718454f,
+   -0.00279779336f, -0.00127033342f, 0.000272376928f, 0.00173088652f, 0.00301550073f, 0.00405150652f,
+   0.00478345621f, 0.00517780008f, 0.00522419810f, 0.00493503595f, 0.00434372667f, 0.00350162759f,
+   0.00247388612f, 0.00133469910f, 0.000162041164f, -0.000967435073f, -0.00198338297f, -0.00282593095f,
+   -0.00344910985f, -0.00382313668f, -0.00393564906f, -0.00379165518f, -0.00341242505f, -0.00283336570f,
+   -0.00210104883f, -0.00126971968f, -0.000397379190f, 0.000458094059f, 0.00124271237f, 0.00190962129f,
+   0.00242185034f, 0.00275416253f, 0.00289416034f, 0.00284242770f, 0.00261186482f, 0.00222626608f,
+   0.00171815488f, 0.00112634373f, 0.000493045780f, -0.000138983029f, -0.000729289488f, -0.00124216930f,
+   -0.00164878729f, -0.00192864088f, -0.00207051332f, -0.00207262510f, -0.00194232306f, -0.00169509707f,
+   -0.00135315058f, -0.000943585823f, -0.000496407272f, -4.23862730e-05f, 0.000388947024f, 0.000771173683f,
+   0.00108252070f, 0.00130700774f, 0.00143517158f, 0.00146429788f, 0.00139823928f, 0.00124677259f,
+   0.00102462480f, 0.000750244595f, 0.000444367499f, 0.000128523709f, -0.000176390022f, -0.000451417058f,
+   -0.000680701225f, -0.000852306024f, -0.000958763994f, -0.000997282332f, -0.000969653018f, -0.000881851825f,
+   -0.000743351120f, -0.000566329109f, -0.000364677951f, -0.000152993220f, 5.44309914e-05f, 0.000244499446f,
+   0.000406123407f, 0.000530796533f, 0.000612996053f, 0.000650315720f, 0.000643445586f, 0.000595904072f,
+   0.000513612700f, 0.000404349528f, 0.000277099491f, 0.000141384327f, 6.59210400e-06f, -0.000118620585f,
+   -0.000226863805f, -0.000312396558f, -0.000371392205f, -0.000402043690f, -0.000404543505f, -0.000380913611f,
+   -0.000334735058f, -0.000270793069f, -0.000194664928f, -0.000112281981f, -2.95130721e-05f, 4.82172036e-05f,
+   0.000116266121f, 0.000171012725f, 0.000210019294f, 0.000232093822f, 0.000237271684f, 0.000226707110f,
+   0.000202497147f, 0.000167464066f, 0.000124899030f, 7.82983407e-05f, 3.11082295e-05f, -1.35059881e-05f,
+   -5.28461205e-05f, -8.48283380e-05f, -0.000108064174f, -0.000121893048f, -0.000126355633f, -0.000122126541f,
+   -0.000110403089f, -9.27709116e-05f, -7.10554887e-05f, -4.71686908e-05f, -2.29660109e-05f, -1.21149654e-07f,
+   1.99703172e-05f, 3.62657920e-05f, 4.81091010e-05f, 5.52355814e-05f, 5.77466235e-05f, 5.60620210e-05f,
+   5.08517405e-05f, 4.29569336e-05f, 3.33053977e-05f, 2.28387144e-05f, 1.24311628e-05f, 2.83359054e-06f,
+   -5.36852122e-06f, -1.17808586e-05f, -1.62060405e-05f, -1.86340549e-05f, -1.92177922e-05f, 0.00000000f,
+   0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_20[288] = {
+   -5.53779319e-06f, -4.22680796e-06f, -9.56112217e-07f, 3.97974691e-06f, 9.64320498e-06f, 1.45628510e-05f,
+   1.70390122e-05f, 1.55947437e-05f, 9.47612807e-06f, -9.38486266e-07f, -1.39600224e-05f, -2.67473533e-05f,
+   -3.58262696e-05f, -3.78999794e-05f, -3.07881965e-05f, -1.42591925e-05f, 9.49575224e-06f, 3.59412443e-05f,
+   5.89159681e-05f, 7.19199525e-05f, 6.97323994e-05f, 4.99955167e-05f, 1.43440184e-05f, -3.12974844e-05f,
+   -7.74569853e-05f, -0.000112888280f, -0.000127095031f, -0.000113074631f, -6.96144634e-05f, -2.52725181e-06f,
+   7.56934969e-05f, 0.000147921877f, 0.000195893779f, 0.000204499971f, 0.000165928417f, 8.26037649e-05f,
+   -3.19549617e-05f, -0.000154875204f, -0.000258148793f, -0.000314688834f, -0.000304948393f, -0.000222572868f,
+   -7.76134475e-05f, 0.000103780672f, 0.000283586036f, 0.000419475546f, 0.000474311615f, 0.000425567850f,
+   0.000272378442f, 3.82685721e-05f, -0.000231585582f, -0.000478509290f, -0.000642580213f, -0.000676553580f,
+   -0.000558315834f, -0.000298744184f, 5.72666831e-05f, 0.000437674258f, 0.000757253205f, 0.000936035358f,
+   0.000918429752f, 0.000688609143f, 0.000278168009f, -0.000236508393f, -0.000747506041f, -0.00113726128f,
+   -0.00130477245f, -0.00119050231f, -0.000793988875f, -0.000179495488f, 0.000532766338f, 0.00118910719f,
+   0.00163465156f, 0.00174869609f, 0.00147550355f, 0.000842834823f, -3.70154194e-05f, -0.000985536491f,
+   -0.00179297826f, -0.00226360024f, -0.00226151641f, -0.00174682692f, -0.000792782463f, 0.000421281380f,
+   0.00164192438f, 0.00259301369f, 0.00303664198f, 0.00283026020f, 0.00196692580f, 0.000587945571f,
+   -0.00103701942f, -0.00256063463f, -0.00363018829f, -0.00396696618f, -0.00343524572f, -0.00208449131f,
+   -0.000153100249f, 0.00197014213f, 0.00382167078f, 0.00496156700f, 0.00507454760f, 0.00405100686f,
+   0.00202832092f, -0.000619926665f, -0.00334862829f, -0.00554942619f, -0.00668194424f, -0.00640051393f,
+   -0.00464780163f, -0.00169193512f, 0.00190590101f, 0.00539164571f, 0.00796985626f, 0.00897732936f,
+   0.00804242678f, 0.00519385329f, 0.000890907075f, -0.00403831294f, -0.00854512490f, -0.0115704574f,
+   -0.0122769838f, -0.0102553153f, -0.00565790385f, 0.000774717482f, 0.00781072257f, 0.0139381671f,
+   0.0176573619f, 0.0178026110f, 0.0138301412f, 0.00601196056f, -0.00451113004f, -0.0158402380f,
+   -0.0255853683f, -0.0312504731f, -0.0306739248f, -0.0224470496f, -0.00623388123f, 0.0170730166f,
+   0.0453958884f, 0.0757170320f, 0.104493275f, 0.128174514f, 0.143740416f, 0.149166659f,
+   0.143740416f, 0.128174514f, 0.104493275f, 0.0757170320f, 0.0453958884f, 0.0170730166f,
+   -0.00623388123f, -0.0224470496f, -0.0306739248f, -0.0312504731f, -0.0255853683f, -0.0158402380f,
+   -0.00451113004f, 0.00601196056f, 0.0138301412f, 0.0178026110f, 0.0176573619f, 0.0139381671f,
+   0.00781072257f, 0.000774717482f, -0.00565790385f, -0.0102553153f, -0.0122769838f, -0.0115704574f,
+   -0.00854512490f, -0.00403831294f, 0.000890907075f, 0.00519385329f, 0.00804242678f, 0.00897732936f,
+   0.00796985626f, 0.00539164571f, 0.00190590101f, -0.00169193512f, -0.00464780163f, -0.00640051393f,
+   -0.00668194424f, -0.00554942619f, -0.00334862829f, -0.000619926665f, 0.00202832092f, 0.00405100686f,
+   0.00507454760f, 0.00496156700f, 0.00382167078f, 0.00197014213f, -0.000153100249f, -0.00208449131f,
+   -0.00343524572f, -0.00396696618f, -0.00363018829f, -0.00256063463f, -0.00103701942f, 0.000587945571f,
+   0.00196692580f, 0.00283026020f, 0.00303664198f, 0.00259301369f, 0.00164192438f, 0.000421281380f,
+   -0.000792782463f, -0.00174682692f, -0.00226151641f, -0.00226360024f, -0.00179297826f, -0.000985536491f,
+   -3.70154194e-05f, 0.000842834823f, 0.00147550355f, 0.00174869609f, 0.00163465156f, 0.00118910719f,
+   0.000532766338f, -0.000179495488f, -0.000793988875f, -0.00119050231f, -0.00130477245f, -0.00113726128f,
+   -0.000747506041f, -0.000236508393f, 0.000278168009f, 0.000688609143f, 0.000918429752f, 0.000936035358f,
+   0.000757253205f, 0.000437674258f, 5.72666831e-05f, -0.000298744184f, -0.000558315834f, -0.000676553580f,
+   -0.000642580213f, -0.000478509290f, -0.000231585582f, 3.82685721e-05f, 0.000272378442f, 0.000425567850f,
+   0.000474311615f, 0.000419475546f, 0.000283586036f, 0.000103780672f, -7.76134475e-05f, -0.000222572868f,
+   -0.000304948393f, -0.000314688834f, -0.000258148793f, -0.000154875204f, -3.19549617e-05f, 8.26037649e-05f,
+   0.000165928417f, 0.000204499971f, 0.000195893779f, 0.000147921877f, 7.56934969e-05f, -2.52725181e-06f,
+   -6.96144634e-05f, -0.000113074631f, -0.000127095031f, -0.000112888280f, -7.74569853e-05f, -3.12974844e-05f,
+   1.43440184e-05f, 4.99955167e-05f, 6.97323994e-05f, 7.19199525e-05f, 5.89159681e-05f, 3.59412443e-05f,
+   9.49575224e-06f, -1.42591925e-05f, -3.07881965e-05f, -3.78999794e-05f, -3.58262696e-05f, -2.67473533e-05f,
+   -1.39600224e-05f, -9.38486266e-07f, 9.47612807e-06f, 1.55947437e-05f, 1.70390122e-05f, 1.45628510e-05f,
+   9.64320498e-06f, 3.97974691e-06f, -9.56112217e-07f, -4.22680796e-06f, -5.53779319e-06f, -5.15974716e-06f,
+};
+
+static const spx_word16_t resample_table_21[456] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, -1.99234114e-06f, 7.52077540e-06f,
+   1.89193488e-05f, 3.09404277e-05f, 4.19357129e-05f, 5.00453934e-05f, 5.34338578e-05f, 5.05621611e-05f,
+   4.04617604e-05f, 2.29875041e-05f, -1.03156663e-06f, -2.97301613e-05f, -6.02829386e-05f, -8.91227755e-05f,
+   -0.000112292153f, -0.000125896971f, -0.000126635787f, -0.000112303795f, -8.22447037e-05f, -3.76628523e-05f,
+   1.82581334e-05f, 8.04716037e-05f, 0.000142434132f, 0.000196711509f, 0.000235771207f, 0.000252892321f,
+   0.000243089788f, 0.000203942385f, 0.000136208677f, 4.41333286e-05f, -6.46365661e-05f, -0.000179548617f,
+   -0.000288057141f, -0.000376868848f, -0.000433437992f, -0.000447519298f, -0.000412638066f, -0.000327247253f,
+   -0.000195466753f, -2.72109774e-05f, 0.000162346245f, 0.000353976560f, 0.000526198186f, 0.000657533295f,
+   0.000728951884f, 0.000726326893f, 0.000642536499f, 0.000478963368f, 0.000246160314f, -3.64769912e-05f,
+   -0.000342085812f, -0.000638683909f, -0.000892319658f, -0.00107074541f, -0.00114722049f, -0.00110402703f,
+   -0.000935267075f, -0.000648578512f, -0.000265407347f, 0.000180157891f, 0.000644152926f, 0.00107683451f,
+   0.00142776803f, 0.00165140931f, 0.00171262247f, 0.00159136264f, 0.00128620653f, 0.000815978914f,
+   0.000219256297f, -0.000448378065f, -0.00111916068f, -0.00171978958f, -0.00217903964f, -0.00243585301f,
+   -0.00244685868f, -0.00219248305f, -0.00168087031f, -0.000949011417f, -6.07642032e-05f, 0.000898276456f,
+   0.00182859448f, 0.00262674177f, 0.00319643854f, 0.00345965591f, 0.00336644636f, 0.00290239369f,
+   0.00209249137f, 0.00100123987f, -0.000271843397f, -0.00160075165f, -0.00284502236f, -0.00386413792f,
+   -0.00453292299f, -0.00475607440f, -0.00448060082f, -0.00370429782f, -0.00247921259f, -0.000909409020f,
+   0.000857099367f, 0.00264173443f, 0.00425284216f, 0.00550572295f, 0.00624314696f, 0.00635409821f,
+   0.00578862894f, 0.00456694514f, 0.00278143794f, 0.000590839249f, -0.00179284508f, -0.00412433501f,
+   -0.00614960445f, -0.00763288653f, -0.00838322099f, -0.00827773660f, -0.00727865333f, -0.00544237439f,
+   -0.00291867997f, 6.01755601e-05f, 0.00319990120f, 0.00617244607f, 0.00864953268f, 0.0103379041f,
+   0.0110129323f, 0.0105465436f, 0.00892628077f, 0.00626292173f, 0.00278523820f, -0.00117825344f,
+   -0.00522929057f, -0.00893872511f, -0.0118912170f, -0.0137304123f, -0.0142003447f, -0.0131782014f,
+   -0.0106945224f, -0.00693786005f, -0.00224296865f, 0.00293748034f, 0.00807523821f, 0.0126191117f,
+   0.0160527676f, 0.0179518033f, 0.0180337746f, 0.0161958020f, 0.0125347599f, 0.00734719960f,
+   0.00110790262f, -0.00557170203f, -0.0120016886f, -0.0174833834f, -0.0213833135f, -0.0232041050f,
+   -0.0226444416f, -0.0196411815f, -0.0143882707f, -0.00732919993f, 0.000877263199f, 0.00941630267f,
+   0.0173955504f, 0.0239359755f, 0.0282659456f, 0.0298087280f, 0.0282537639f, 0.0236034878f,
+   0.0161893182f, 0.00665372005f, -0.00410159724f, -0.0149973221f, -0.0248816852f, -0.0326482132f,
+   -0.0373552665f, -0.0383343361f, -0.0352753848f, -0.0282790549f, -0.0178685486f, -0.00495776720f,
+   0.00922327396f, 0.0232399181f, 0.0355926044f, 0.0448704213f, 0.0499043353f, 0.0499038585f,
+   0.0445620790f, 0.0341164730f, 0.0193570815f, 0.00157739094f, -0.0175293423f, -0.0360211320f,
+   -0.0518934987f, -0.0632831678f, -0.0686700717f, -0.0670577064f, -0.0581109002f, -0.0422359072f,
+   -0.0205909424f, 0.00497831497f, 0.0320760831f, 0.0579584949f, 0.0797841549f, 0.0948917642f,
+   0.101080373f, 0.0968654230f, 0.0816852823f, 0.0560356304f, 0.0215151571f, -0.0192263816f,
+   -0.0626398250f, -0.104518607f, -0.140314221f, -0.165502250f, -0.175968081f, -0.168379992f,
+   -0.140519619f, -0.0915335193f, -0.0220874064f, 0.0655964613f, 0.167825282f, 0.279642463f,
+   0.395139962f, 0.507859588f, 0.611242890f, 0.699101985f, 0.766071320f, 0.808004200f,
+   0.822281241f, 0.808004200f, 0.766071320f, 0.699101985f, 0.611242890f, 0.507859588f,
+   0.395139962f, 0.279642463f, 0.167825282f, 0.0655964613f, -0.0220874064f, -0.0915335193f,
+   -0.140519619f, -0.168379992f, -0.175968081f, -0.165502250f, -0.140314221f, -0.104518607f,
+   -0.0626398250f, -0.0192263816f, 0.0215151571f, 0.0560356304f, 0.0816852823f, 0.0968654230f,
+   0.101080373f, 0.0948917642f, 0.0797841549f, 0.0579584949f, 0.0320760831f, 0.00497831497f,
+   -0.0205909424f, -0.0422359072f, -0.0581109002f, -0.0670577064f, -0.0686700717f, -0.0632831678f,
+   -0.0518934987f, -0.0360211320f, -0.0175293423f, 0.00157739094f, 0.0193570815f, 0.0341164730f,
+   0.0445620790f, 0.0499038585f, 0.0499043353f, 0.0448704213f, 0.0355926044f, 0.0232399181f,
+   0.00922327396f, -0.00495776720f, -0.0178685486f, -0.0282790549f, -0.0352753848f, -0.0383343361f,
+   -0.0373552665f, -0.0326482132f, -0.0248816852f, -0.0149973221f, -0.00410159724f, 0.00665372005f,
+   0.0161893182f, 0.0236034878f, 0.0282537639f, 0.0298087280f, 0.0282659456f, 0.0239359755f,
+   0.0173955504f, 0.00941630267f, 0.000877263199f, -0.00732919993f, -0.0143882707f, -0.0196411815f,
+   -0.0226444416f, -0.0232041050f, -0.0213833135f, -0.0174833834f, -0.0120016886f, -0.00557170203f,
+   0.00110790262f, 0.00734719960f, 0.0125347599f, 0.0161958020f, 0.0180337746f, 0.0179518033f,
+   0.0160527676f, 0.0126191117f, 0.00807523821f, 0.00293748034f, -0.00224296865f, -0.00693786005f,
+   -0.0106945224f, -0.0131782014f, -0.0142003447f, -0.0137304123f, -0.0118912170f, -0.00893872511f,
+   -0.00522929057f, -0.00117825344f, 0.00278523820f, 0.00626292173f, 0.00892628077f, 0.0105465436f,
+   0.0110129323f, 0.0103379041f, 0.00864953268f, 0.00617244607f, 0.00319990120f, 6.01755601e-05f,
+   -0.00291867997f, -0.00544237439f, -0.00727865333f, -0.00827773660f, -0.00838322099f, -0.00763288653f,
+   -0.00614960445f, -0.00412433501f, -0.00179284508f, 0.000590839249f, 0.00278143794f, 0.00456694514f,
+   0.00578862894f, 0.00635409821f, 0.00624314696f, 0.00550572295f, 0.00425284216f, 0.00264173443f,
+   0.000857099367f, -0.000909409020f, -0.00247921259f, -0.00370429782f, -0.00448060082f, -0.00475607440f,
+   -0.00453292299f, -0.00386413792f, -0.00284502236f, -0.00160075165f, -0.000271843397f, 0.00100123987f,
+   0.00209249137f, 0.00290239369f, 0.00336644636f, 0.00345965591f, 0.00319643854f, 0.00262674177f,
+   0.00182859448f, 0.000898276456f, -6.07642032e-05f, -0.000949011417f, -0.00168087031f, -0.00219248305f,
+   -0.00244685868f, -0.00243585301f, -0.00217903964f, -0.00171978958f, -0.00111916068f, -0.000448378065f,
+   0.000219256297f, 0.000815978914f, 0.00128620653f, 0.00159136264f, 0.00171262247f, 0.00165140931f,
+   0.00142776803f, 0.00107683451f, 0.000644152926f, 0.000180157891f, -0.000265407347f, -0.000648578512f,
+   -0.000935267075f, -0.00110402703f, -0.00114722049f, -0.00107074541f, -0.000892319658f, -0.000638683909f,
+   -0.000342085812f, -3.64769912e-05f, 0.000246160314f, 0.000478963368f, 0.000642536499f, 0.000726326893f,
+   0.000728951884f, 0.000657533295f, 0.000526198186f, 0.000353976560f, 0.000162346245f, -2.72109774e-05f,
+   -0.000195466753f, -0.000327247253f, -0.000412638066f, -0.000447519298f, -0.000433437992f, -0.000376868848f,
+   -0.000288057141f, -0.000179548617f, -6.46365661e-05f, 4.41333286e-05f, 0.000136208677f, 0.000203942385f,
+   0.000243089788f, 0.000252892321f, 0.000235771207f, 0.000196711509f, 0.000142434132f, 8.04716037e-05f,
+   1.82581334e-05f, -3.76628523e-05f, -8.22447037e-05f, -0.000112303795f, -0.000126635787f, -0.000125896971f,
+   -0.000112292153f, -8.91227755e-05f, -6.02829386e-05f, -2.97301613e-05f, -1.03156663e-06f, 2.29875041e-05f,
+   4.04617604e-05f, 5.05621611e-05f, 5.34338578e-05f, 5.00453934e-05f, 4.19357129e-05f, 3.09404277e-05f,
+   1.89193488e-05f, 7.52077540e-06f, -1.99234114e-06f, 0.00000000f, 0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_22[128] = {
+   -2.30558362e-05f, 5.98695151e-05f, -0.000125067963f, 0.000227435303f, -0.000374036812f, 0.000568111253f,
+   -0.000806654687f, 0.00107793382f, -0.00135919894f, 0.00161496026f, -0.00179612718f, 0.00184036337f,
+   -0.00167384103f, 0.00121464510f, -0.000377504883f, -0.000920005084f, 0.00275031966f, -0.00516837602f,
+   0.00820439402f, -0.0118572814f, 0.0160900448f, -0.0208269935f, 0.0259540305f, -0.0313215330f,
+   0.0367504731f, -0.0420410447f, 0.0469835587f, -0.0513706803f, 0.0550104119f, -0.0577381402f,
+   0.0594277754f, 0.939999998f, 0.0594277754f, -0.0577381402f, 0.0550104119f, -0.0513706803f,
+   0.0469835587f, -0.0420410447f, 0.0367504731f, -0.0313215330f, 0.0259540305f, -0.0208269935f,
+   0.0160900448f, -0.0118572814f, 0.00820439402f, -0.00516837602f, 0.00275031966f, -0.000920005084f,
+   -0.000377504883f, 0.00121464510f, -0.00167384103f, 0.00184036337f, -0.00179612718f, 0.00161496026f,
+   -0.00135919894f, 0.00107793382f, -0.000806654687f, 0.000568111253f, -0.000374036812f, 0.000227435303f,
+   -0.000125067963f, 5.98695151e-05f, -2.30558362e-05f, 5.78570825e-06f, -3.47103814e-05f, 6.50652801e-05f,
+   -0.000100215293f, 0.000132720146f, -0.000150253953f, 0.000135141323f, -6.45011460e-05f, -8.87974093e-05f,
+   0.000354223099f, -0.000760739029f, 0.00133299269f, -0.00208679587f, 0.00302409451f, -0.00412797881f,
+   0.00535796676f, -0.00664613536f, 0.00789451879f, -0.00897387415f, 0.00972402003f, -0.00995517708f,
+   0.00944981910f, -0.00796315912f, 0.00521939434f, -0.000899386592f, -0.00539148971f, 0.0141942464f,
+   -0.0263579581f, 0.0434275717f, -0.0687073320f, 0.110881560f, -0.202110976f, 0.633213758f,
+   0.633213758f, -0.202110976f, 0.110881560f, -0.0687073320f, 0.0434275717f, -0.0263579581f,
+   0.0141942464f, -0.00539148971f, -0.000899386592f, 0.00521939434f, -0.00796315912f, 0.00944981910f,
+   -0.00995517708f, 0.00972402003f, -0.00897387415f, 0.00789451879f, -0.00664613536f, 0.00535796676f,
+   -0.00412797881f, 0.00302409451f, -0.00208679587f, 0.00133299269f, -0.000760739029f, 0.000354223099f,
+   -8.87974093e-05f, -6.45011460e-05f, 0.000135141323f, -0.000150253953f, 0.000132720146f, -0.000100215293f,
+   6.50652801e-05f, -3.47103814e-05f,
+};
+
+static const spx_word16_t resample_table_23[192] = {
+   -2.30558362e-05f, 5.98695151e-05f, -0.000125067963f, 0.000227435303f, -0.000374036812f, 0.000568111253f,
+   -0.000806654687f, 0.00107793382f, -0.00135919894f, 0.00161496026f, -0.00179612718f, 0.00184036337f,
+   -0.00167384103f, 0.00121464510f, -0.000377504883f, -0.000920005084f, 0.00275031966f, -0.00516837602f,
+   0.00820439402f, -0.0118572814f, 0.0160900448f, -0.0208269935f, 0.0259540305f, -0.0313215330f,
+   0.0367504731f, -0.0420410447f, 0.0469835587f, -0.0513706803f, 0.0550104119f, -0.0577381402f,
+   0.0594277754f, 0.939999998f, 0.0594277754f, -0.0577381402f, 0.0550104119f, -0.0513706803f,
+   0.0469835587f, -0.0420410447f, 0.0367504731f, -0.0313215330f, 0.0259540305f, -0.0208269935f,
+   0.0160900448f, -0.0118572814f, 0.00820439402f, -0.00516837602f, 0.00275031966f, -0.000920005084f,
+   -0.000377504883f, 0.00121464510f, -0.00167384103f, 0.00184036337f, -0.00179612718f, 0.00161496026f,
+   -0.00135919894f, 0.00107793382f, -0.000806654687f, 0.000568111253f, -0.000374036812f, 0.000227435303f,
+   -0.000125067963f, 5.98695151e-05f, -2.30558362e-05f, 5.78570825e-06f, -4.17607516e-05f, 8.37052867e-05f,
+   -0.000141682176f, 0.000213069899f, -0.000290363590f, 0.000359863508f, -0.000400741264f, 0.000384752755f,
+   -0.000276815961f, 3.66889326e-05f, 0.000378255005f, -0.00100904761f, 0.00189007446f, -0.00304341177f,
+   0.00447263569f, -0.00615678495f, 0.00804481376f, -0.0100511117f, 0.0120521672f, -0.0138845397f,
+   0.0153436242f, -0.0161819234f, 0.0161047690f, -0.0147581054f, 0.0116997911f, -0.00633267546f,
+   -0.00225106115f, 0.0156570096f, -0.0372914970f, 0.0763205066f, -0.169462666f, 0.795056105f,
+   0.439441890f, -0.184924573f, 0.116274454f, -0.0814810395f, 0.0590184554f, -0.0426922478f,
+   0.0301143657f, -0.0201919004f, 0.0123517700f, -0.00624680799f, 0.00162928866f, 0.00170633954f,
+   -0.00394970551f, 0.00528386328f, -0.00588704413f, 0.00592956878f, -0.00556956185f, 0.00494809216f,
+   -0.00418555085f, 0.00337910908f, -0.00260201190f, 0.00190437504f, -0.00131540175f, 0.000846654584f,
+   -0.000495894987f, 0.000251177524f, -9.47567969e-05f, 6.47911838e-06f, 3.34738834e-05f, -4.26533879e-05f,
+   3.51953022e-05f, -2.13937801e-05f, -2.13937801e-05f, 3.51953022e-05f, -4.26533879e-05f, 3.34738834e-05f,
+   6.47911838e-06f, -9.47567969e-05f, 0.000251177524f, -0.000495894987f, 0.000846654584f, -0.00131540175f,
+   0.00190437504f, -0.00260201190f, 0.00337910908f, -0.00418555085f, 0.00494809216f, -0.00556956185f,
+   0.00592956878f, -0.00588704413f, 0.00528386328f, -0.00394970551f, 0.00170633954f, 0.00162928866f,
+   -0.00624680799f, 0.0123517700f, -0.0201919004f, 0.0301143657f, -0.0426922478f, 0.0590184554f,
+   -0.0814810395f, 0.116274454f, -0.184924543f, 0.439441800f, 0.795056164f, -0.169462621f,
+   0.0763205066f, -0.0372914970f, 0.0156570096f, -0.00225106115f, -0.00633267546f, 0.0116997911f,
+   -0.0147581054f, 0.0161047690f, -0.0161819234f, 0.0153436242f, -0.0138845397f, 0.0120521672f,
+   -0.0100511117f, 0.00804481376f, -0.00615678495f, 0.00447263569f, -0.00304341177f, 0.00189007446f,
+   -0.00100904761f, 0.000378255005f, 3.66889326e-05f, -0.000276815961f, 0.000384752755f, -0.000400741264f,
+   0.000359863508f, -0.000290363590f, 0.000213069899f, -0.000141682176f, 8.37052867e-05f, -4.17607516e-05f,
+};
+
+static const spx_word16_t resample_table_24[256] = {
+   -2.30558362e-05f, 5.98695151e-05f, -0.000125067963f, 0.000227435303f, -0.000374036812f, 0.000568111253f,
+   -0.000806654687f, 0.00107793382f, -0.00135919894f, 0.00161496026f, -0.00179612718f, 0.00184036337f,
+   -0.00167384103f, 0.00121464510f, -0.000377504883f, -0.000920005084f, 0.00275031966f, -0.00516837602f,
+   0.00820439402f, -0.0118572814f, 0.0160900448f, -0.0208269935f, 0.0259540305f, -0.0313215330f,
+   0.0367504731f, -0.0420410447f, 0.0469835587f, -0.0513706803f, 0.0550104119f, -0.0577381402f,
+   0.0594277754f, 0.939999998f, 0.0594277754f, -0.0577381402f, 0.0550104119f, -0.0513706803f,
+   0.0469835587f, -0.0420410447f, 0.0367504731f, -0.0313215330f, 0.0259540305f, -0.0208269935f,
+   0.0160900448f, -0.0118572814f, 0.00820439402f, -0.00516837602f, 0.00275031966f, -0.000920005084f,
+   -0.000377504883f, 0.00121464510f, -0.00167384103f, 0.00184036337f, -0.00179612718f, 0.00161496026f,
+   -0.00135919894f, 0.00107793382f, -0.000806654687f, 0.000568111253f, -0.000374036812f, 0.000227435303f,
+   -0.000125067963f, 5.98695151e-05f, -2.30558362e-05f, 5.78570825e-06f, -4.16044095e-05f, 8.62503948e-05f,
+   -0.000151739936f, 0.000238315450f, -0.000341760984f, 0.000451746542f, -0.000550398254f, 0.000611378578f,
+   -0.000599712483f, 0.000472650572f, -0.000181702140f, -0.000323987304f, 0.00109314942f, -0.00216675992f,
+   0.00357159902f, -0.00531371357f, 0.00737183215f, -0.00969147403f, 0.0121802138f, -0.0147040011f,
+   0.0170846414f, -0.0190973505f, 0.0204667039f, -0.0208566058f, 0.0198467243f, -0.0168761890f,
+   0.0111102602f, -0.00110102270f, -0.0162000768f, 0.0490889587f, -0.132295236f, 0.856708467f,
+   0.338699102f, -0.161524504f, 0.108598866f, -0.0803700238f, 0.0613115989f, -0.0468478613f,
+   0.0352234095f, -0.0256598108f, 0.0177716836f, -0.0113404002f, 0.00621511415f, -0.00226648618f,
+   -0.000634196738f, 0.00262215221f, -0.00383961969f, 0.00443181209f, -0.00454160012f, 0.00430343486f,
+   -0.00383815425f, 0.00324894930f, -0.00261889189f, 0.00201016990f, -0.00146487844f, 0.00100707216f,
+   -0.000645748631f, 0.000378362281f, -0.000194421766f, 7.89003752e-05f, -1.51523545e-05f, -1.28385509e-05f,
+   1.89091370e-05f, -1.38778933e-05f, -3.47103814e-05f, 6.50652801e-05f, -0.000100215293f, 0.000132720146f,
+   -0.000150253953f, 0.000135141323f, -6.45011460e-05f, -8.87974093e-05f, 0.000354223099f, -0.000760739029f,
+   0.00133299269f, -0.00208679587f, 0.00302409451f, -0.00412797881f, 0.00535796676f, -0.00664613536f,
+   0.00789451879f, -0.00897387415f, 0.00972402003f, -0.00995517708f, 0.00944981910f, -0.00796315912f,
+   0.00521939434f, -0.000899386592f, -0.00539148971f, 0.0141942464f, -0.0263579581f, 0.0434275717f,
+   -0.0687073320f, 0.110881560f, -0.202110976f, 0.633213758f, 0.633213758f, -0.202110976f,
+   0.110881560f, -0.0687073320f, 0.0434275717f, -0.0263579581f, 0.0141942464f, -0.00539148971f,
+   -0.000899386592f, 0.00521939434f, -0.00796315912f, 0.00944981910f, -0.00995517708f, 0.00972402003f,
+   -0.00897387415f, 0.00789451879f, -0.00664613536f, 0.00535796676f, -0.00412797881f, 0.00302409451f,
+   -0.00208679587f, 0.00133299269f, -0.000760739029f, 0.000354223099f, -8.87974093e-05f, -6.45011460e-05f,
+   0.000135141323f, -0.000150253953f, 0.000132720146f, -0.000100215293f, 6.50652801e-05f, -3.47103814e-05f,
+   -1.38778933e-05f, 1.89091370e-05f, -1.28385509e-05f, -1.51523545e-05f, 7.89003752e-05f, -0.000194421766f,
+   0.000378362281f, -0.000645748631f, 0.00100707216f, -0.00146487844f, 0.00201016990f, -0.00261889189f,
+   0.00324894930f, -0.00383815425f, 0.00430343486f, -0.00454160012f, 0.00443181209f, -0.00383961969f,
+   0.00262215221f, -0.000634196738f, -0.00226648618f, 0.00621511415f, -0.0113404002f, 0.0177716836f,
+   -0.0256598108f, 0.0352234095f, -0.0468478613f, 0.0613115989f, -0.0803700238f, 0.108598866f,
+   -0.161524504f, 0.338699102f, 0.856708467f, -0.132295236f, 0.0490889587f, -0.0162000768f,
+   -0.00110102270f, 0.0111102602f, -0.0168761890f, 0.0198467243f, -0.0208566058f, 0.0204667039f,
+   -0.0190973505f, 0.0170846414f, -0.0147040011f, 0.0121802138f, -0.00969147403f, 0.00737183215f,
+   -0.00531371357f, 0.00357159902f, -0.00216675992f, 0.00109314942f, -0.000323987304f, -0.000181702140f,
+   0.000472650572f, -0.000599712483f, 0.000611378578f, -0.000550398254f, 0.000451746542f, -0.000341760984f,
+   0.000238315450f, -0.000151739936f, 8.62503948e-05f, -4.16044095e-05f,
+};
+
+static const spx_word16_t resample_table_25[520] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, 5.78570825e-06f, -3.09836878e-06f,
+   -1.38778933e-05f, -2.50493576e-05f, -3.47103814e-05f, -4.08327942e-05f, -4.16044095e-05f, -3.57910612e-05f,
+   -2.30558362e-05f, -4.17341971e-06f, 1.89091370e-05f, 4.32156012e-05f, 6.50652801e-05f, 8.05721720e-05f,
+   8.62503948e-05f, 7.96424356e-05f, 5.98695151e-05f, 2.79996257e-05f, -1.28385509e-05f, -5.76727107e-05f,
+   -0.000100215293f, -0.000133672889f, -0.000151739936f, -0.000149641914f, -0.000125067963f, -7.88357647e-05f,
+   -1.51523545e-05f, 5.86221067e-05f, 0.000132720146f, 0.000196168621f, 0.000238315450f, 0.000250469835f,
+   0.000227435303f, 0.000168676052f, 7.89003752e-05f, -3.20741019e-05f, -0.000150253953f, -0.000259106222f,
+   -0.000341760984f, -0.000383476930f, -0.000374036812f, -0.000309710565f, -0.000194421766f, -3.99333949e-05f,
+   0.000135141323f, 0.000307422801f, 0.000451746542f, 0.000544680457f, 0.000568111253f, 0.000512366882f,
+   0.000378362281f, 0.000178426373f, -6.45011460e-05f, -0.000319283339f, -0.000550398254f, -0.000722728088f,
+   -0.000806654687f, -0.000782824762f, -0.000645748631f, -0.000405760074f, -8.87974093e-05f, 0.000266107643f,
+   0.000611378578f, 0.000897086167f, 0.00107793382f, 0.00112013123f, 0.00100707216f, 0.000743052515f,
+   0.000354223099f, -0.000113534232f, -0.000599712483f, -0.00103675714f, -0.00135919894f, -0.00151318125f,
+   -0.00146487844f, -0.00120681105f, -0.000760739029f, -0.000176599831f, 0.000472650572f, 0.00109982421f,
+   0.00161496026f, 0.00193787529f, 0.00201016990f, 0.00180500862f, 0.00133299269f, 0.000643121253f,
+   -0.000181702140f, -0.00103414792f, -0.00179612718f, -0.00235482212f, -0.00261889189f, -0.00253278669f,
+   -0.00208679587f, -0.00132126745f, -0.000323987304f, 0.000779309310f, 0.00184036337f, 0.00270794379f,
+   0.00324894930f, 0.00336819375f, 0.00302409451f, 0.00223765313f, 0.00109314942f, -0.000270041113f,
+   -0.00167384103f, -0.00292438618f, -0.00383815425f, -0.00426843809f, -0.00412797881f, -0.00340452883f,
+   -0.00216675992f, -0.000559013919f, 0.00121464510f, 0.00291585946f, 0.00430343486f, 0.00516696926f,
+   0.00535796676f, 0.00481391745f, 0.00357159902f, 0.00176719972f, -0.000377504883f, -0.00258167181f,
+   -0.00454160012f, -0.00597185176f, -0.00664613536f, -0.00643192604f, -0.00531371357f, -0.00340115116f,
+   -0.000920005084f, 0.00181340484f, 0.00443181209f, 0.00656568818f, 0.00789451879f, 0.00819396786f,
+   0.00737183215f, 0.00548733724f, 0.00275031966f, -0.000500769180f, -0.00383961969f, -0.00680714939f,
+   -0.00897387415f, -0.0100009041f, -0.00969147403f, -0.00802503619f, -0.00516837602f, -0.00146136992f,
+   0.00262215221f, 0.00653398503f, 0.00972402003f, 0.0117166415f, 0.0121802138f, 0.0109796645f,
+   0.00820439402f, 0.00416609226f, -0.000634196738f, -0.00556683773f, -0.00995517708f, -0.0131669361f,
+   -0.0147040011f, -0.0142775122f, -0.0118572814f, -0.00768778287f, -0.00226648618f, 0.00371332886f,
+   0.00944981910f, 0.0141388029f, 0.0170846414f, 0.0178015251f, 0.0160900448f, 0.0120775290f,
+   0.00621511415f, -0.000770043815f, -0.00796315912f, -0.0143794697f, -0.0190973505f, -0.0213885084f,
+   -0.0208269935f, -0.0173617750f, -0.0113404002f, -0.00347912195f, 0.00521939434f, 0.0135917682f,
+   0.0204667039f, 0.0248264316f, 0.0259540305f, 0.0235456973f, 0.0177716836f, 0.00927414931f,
+   -0.000899386592f, -0.0114218574f, -0.0208566058f, -0.0278499965f, -0.0313215330f, -0.0306254402f,
+   -0.0256598108f, -0.0169063155f, -0.00539148971f, 0.00742840394f, 0.0198467243f, 0.0301292092f,
+   0.0367504731f, 0.0386139341f, 0.0352234095f, 0.0267809946f, 0.0141942464f, -0.00101266301f,
+   -0.0168761890f, -0.0312402025f, -0.0420410447f, -0.0475947000f, -0.0468478613f, -0.0395553857f,
+   -0.0263579581f, -0.00874310173f, 0.0111102602f, 0.0305903684f, 0.0469835587f, 0.0578376018f,
+   0.0613115989f, 0.0564623512f, 0.0434275717f, 0.0234743450f, -0.00110102270f, -0.0272167362f,
+   -0.0513706803f, -0.0700836629f, -0.0803700238f, -0.0801730230f, -0.0687073320f, -0.0466579087f,
+   -0.0162000768f, 0.0191737395f, 0.0550104119f, 0.0864035711f, 0.108598866f, 0.117625691f,
+   0.110881560f, 0.0875929892f, 0.0490889587f, -0.00115721545f, -0.0577381402f, -0.113764875f,
+   -0.161524504f, -0.193277165f, -0.202110976f, -0.182760328f, -0.132295236f, -0.0505989678f,
+   0.0594277754f, 0.191968143f, 0.338699102f, 0.489473909f, 0.633213758f, 0.758920789f,
+   0.856708467f, 0.918743551f, 0.939999998f, 0.918743551f, 0.856708467f, 0.758920789f,
+   0.633213758f, 0.489473909f, 0.338699102f, 0.191968143f, 0.0594277754f, -0.0505989678f,
+   -0.132295236f, -0.182760328f, -0.202110976f, -0.193277165f, -0.161524504f, -0.113764875f,
+   -0.0577381402f, -0.00115721545f, 0.0490889587f, 0.0875929892f, 0.110881560f, 0.117625691f,
+   0.108598866f, 0.0864035711f, 0.0550104119f, 0.0191737395f, -0.0162000768f, -0.0466579087f,
+   -0.0687073320f, -0.0801730230f, -0.0803700238f, -0.0700836629f, -0.0513706803f, -0.0272167362f,
+   -0.00110102270f, 0.0234743450f, 0.0434275717f, 0.0564623512f, 0.0613115989f, 0.0578376018f,
+   0.0469835587f, 0.0305903684f, 0.0111102602f, -0.00874310173f, -0.0263579581f, -0.0395553857f,
+   -0.0468478613f, -0.0475947000f, -0.0420410447f, -0.0312402025f, -0.0168761890f, -0.00101266301f,
+   0.0141942464f, 0.0267809946f, 0.0352234095f, 0.0386139341f, 0.0367504731f, 0.0301292092f,
+   0.0198467243f, 0.00742840394f, -0.00539148971f, -0.0169063155f, -0.0256598108f, -0.0306254402f,
+   -0.0313215330f, -0.0278499965f, -0.0208566058f, -0.0114218574f, -0.000899386592f, 0.00927414931f,
+   0.0177716836f, 0.0235456973f, 0.0259540305f, 0.0248264316f, 0.0204667039f, 0.0135917682f,
+   0.00521939434f, -0.00347912195f, -0.0113404002f, -0.0173617750f, -0.0208269935f, -0.0213885084f,
+   -0.0190973505f, -0.0143794697f, -0.00796315912f, -0.000770043815f, 0.00621511415f, 0.0120775290f,
+   0.0160900448f, 0.0178015251f, 0.0170846414f, 0.0141388029f, 0.00944981910f, 0.00371332886f,
+   -0.00226648618f, -0.00768778287f, -0.0118572814f, -0.0142775122f, -0.0147040011f, -0.0131669361f,
+   -0.00995517708f, -0.00556683773f, -0.000634196738f, 0.00416609226f, 0.00820439402f, 0.0109796645f,
+   0.0121802138f, 0.0117166415f, 0.00972402003f, 0.00653398503f, 0.00262215221f, -0.00146136992f,
+   -0.00516837602f, -0.00802503619f, -0.00969147403f, -0.0100009041f, -0.00897387415f, -0.00680714939f,
+   -0.00383961969f, -0.000500769180f, 0.00275031966f, 0.00548733724f, 0.00737183215f, 0.00819396786f,
+   0.00789451879f, 0.00656568818f, 0.00443181209f, 0.00181340484f, -0.000920005084f, -0.00340115116f,
+   -0.00531371357f, -0.00643192604f, -0.00664613536f, -0.00597185176f, -0.00454160012f, -0.00258167181f,
+   -0.000377504883f, 0.00176719972f, 0.00357159902f, 0.00481391745f, 0.00535796676f, 0.00516696926f,
+   0.00430343486f, 0.00291585946f, 0.00121464510f, -0.000559013919f, -0.00216675992f, -0.00340452883f,
+   -0.00412797881f, -0.00426843809f, -0.00383815425f, -0.00292438618f, -0.00167384103f, -0.000270041113f,
+   0.00109314942f, 0.00223765313f, 0.00302409451f, 0.00336819375f, 0.00324894930f, 0.00270794379f,
+   0.00184036337f, 0.000779309310f, -0.000323987304f, -0.00132126745f, -0.00208679587f, -0.00253278669f,
+   -0.00261889189f, -0.00235482212f, -0.00179612718f, -0.00103414792f, -0.000181702140f, 0.000643121253f,
+   0.00133299269f, 0.00180500862f, 0.00201016990f, 0.00193787529f, 0.00161496026f, 0.00109982421f,
+   0.000472650572f, -0.000176599831f, -0.000760739029f, -0.00120681105f, -0.00146487844f, -0.00151318125f,
+   -0.00135919894f, -0.00103675714f, -0.000599712483f, -0.000113534232f, 0.000354223099f, 0.000743052515f,
+   0.00100707216f, 0.00112013123f, 0.00107793382f, 0.000897086167f, 0.000611378578f, 0.000266107643f,
+   -8.87974093e-05f, -0.000405760074f, -0.000645748631f, -0.000782824762f, -0.000806654687f, -0.000722728088f,
+   -0.000550398254f, -0.000319283339f, -6.45011460e-05f, 0.000178426373f, 0.000378362281f, 0.000512366882f,
+   0.000568111253f, 0.000544680457f, 0.000451746542f, 0.000307422801f, 0.000135141323f, -3.99333949e-05f,
+   -0.000194421766f, -0.000309710565f, -0.000374036812f, -0.000383476930f, -0.000341760984f, -0.000259106222f,
+   -0.000150253953f, -3.20741019e-05f, 7.89003752e-05f, 0.000168676052f, 0.000227435303f, 0.000250469835f,
+   0.000238315450f, 0.000196168621f, 0.000132720146f, 5.86221067e-05f, -1.51523545e-05f, -7.88357647e-05f,
+   -0.000125067963f, -0.000149641914f, -0.000151739936f, -0.000133672889f, -0.000100215293f, -5.76727107e-05f,
+   -1.28385509e-05f, 2.79996257e-05f, 5.98695151e-05f, 7.96424356e-05f, 8.62503948e-05f, 8.05721720e-05f,
+   6.50652801e-05f, 4.32156012e-05f, 1.89091370e-05f, -4.17341971e-06f, -2.30558362e-05f, -3.57910612e-05f,
+   -4.16044095e-05f, -4.08327942e-05f, -3.47103814e-05f, -2.50493576e-05f, -1.38778933e-05f, -3.09836878e-06f,
+   5.78570825e-06f, 0.00000000f, 0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_26[384] = {
+   -2.30558362e-05f, 5.98695151e-05f, -0.000125067963f, 0.000227435303f, -0.000374036812f, 0.000568111253f,
+   -0.000806654687f, 0.00107793382f, -0.00135919894f, 0.00161496026f, -0.00179612718f, 0.00184036337f,
+   -0.00167384103f, 0.00121464510f, -0.000377504883f, -0.000920005084f, 0.00275031966f, -0.00516837602f,
+   0.00820439402f, -0.0118572814f, 0.0160900448f, -0.0208269935f, 0.0259540305f, -0.0313215330f,
+   0.0367504731f, -0.0420410447f, 0.0469835587f, -0.0513706803f, 0.0550104119f, -0.0577381402f,
+   0.0594277754f, 0.939999998f, 0.0594277754f, -0.0577381402f, 0.0550104119f, -0.0513706803f,
+   0.0469835587f, -0.0420410447f, 0.0367504731f, -0.0313215330f, 0.0259540305f, -0.0208269935f,
+   0.0160900448f, -0.0118572814f, 0.00820439402f, -0.00516837602f, 0.00275031966f, -0.000920005084f,
+   -0.000377504883f, 0.00121464510f, -0.00167384103f, 0.00184036337f, -0.00179612718f, 0.00161496026f,
+   -0.00135919894f, 0.00107793382f, -0.000806654687f, 0.000568111253f, -0.000374036812f, 0.000227435303f,
+   -0.000125067963f, 5.98695151e-05f, -2.30558362e-05f, 5.78570825e-06f, -3.85026069e-05f, 8.33021259e-05f,
+   -0.000152783847f, 0.000250158395f, -0.000374868308f, 0.000520677655f, -0.000673815259f, 0.000811440754f,
+   -0.000900722574f, 0.000898854807f, -0.000754177105f, 0.000408648542f, 0.000198238064f, -0.00112440577f,
+   0.00241892808f, -0.00411515497f, 0.00622354820f, -0.00872480497f, 0.0115639707f, -0.0146453632f,
+   0.0178290475f, -0.0209279172f, 0.0237045214f, -0.0258643925f, 0.0270400345f, -0.0267513525f,
+   0.0243078675f, -0.0185525510f, 0.00709639909f, 0.0165982097f, -0.0811843798f, 0.902412355f,
+   0.239773139f, -0.130993128f, 0.0950422212f, -0.0745732263f, 0.0598829240f, -0.0480757616f,
+   0.0380724110f, -0.0294328276f, 0.0219726209f, -0.0156102711f, 0.0102980323f, -0.00598880416f,
+   0.00262147700f, -0.000115832023f, -0.00162656559f, 0.00271768146f, -0.00327699282f, 0.00342456065f,
+   -0.00327462750f, 0.00293022371f, -0.00247917650f, 0.00199186918f, -0.00152051088f, 0.00109993538f,
+   -0.000749539759f, 0.000476020970f, -0.000276518491f, 0.000141812838f, -5.92440811e-05f, 1.51718323e-05f,
+   3.18203365e-06f, -6.54451969e-06f, -4.17607516e-05f, 8.37052867e-05f, -0.000141682176f, 0.000213069899f,
+   -0.000290363590f, 0.000359863508f, -0.000400741264f, 0.000384752755f, -0.000276815961f, 3.66889326e-05f,
+   0.000378255005f, -0.00100904761f, 0.00189007446f, -0.00304341177f, 0.00447263569f, -0.00615678495f,
+   0.00804481376f, -0.0100511117f, 0.0120521672f, -0.0138845397f, 0.0153436242f, -0.0161819234f,
+   0.0161047690f, -0.0147581054f, 0.0116997911f, -0.00633267546f, -0.00225106115f, 0.0156570096f,
+   -0.0372914970f, 0.0763205066f, -0.169462666f, 0.795056105f, 0.439441890f, -0.184924573f,
+   0.116274454f, -0.0814810395f, 0.0590184554f, -0.0426922478f, 0.0301143657f, -0.0201919004f,
+   0.0123517700f, -0.00624680799f, 0.00162928866f, 0.00170633954f, -0.00394970551f, 0.00528386328f,
+   -0.00588704413f, 0.00592956878f, -0.00556956185f, 0.00494809216f, -0.00418555085f, 0.00337910908f,
+   -0.00260201190f, 0.00190437504f, -0.00131540175f, 0.000846654584f, -0.000495894987f, 0.000251177524f,
+   -9.47567969e-05f, 6.47911838e-06f, 3.34738834e-05f, -4.26533879e-05f, 3.51953022e-05f, -2.13937801e-05f,
+   -3.47103814e-05f, 6.50652801e-05f, -0.000100215293f, 0.000132720146f, -0.000150253953f, 0.000135141323f,
+   -6.45011460e-05f, -8.87974093e-05f, 0.000354223099f, -0.000760739029f, 0.00133299269f, -0.00208679587f,
+   0.00302409451f, -0.00412797881f, 0.00535796676f, -0.00664613536f, 0.00789451879f, -0.00897387415f,
+   0.00972402003f, -0.00995517708f, 0.00944981910f, -0.00796315912f, 0.00521939434f, -0.000899386592f,
+   -0.00539148971f, 0.0141942464f, -0.0263579581f, 0.0434275717f, -0.0687073320f, 0.110881560f,
+   -0.202110976f, 0.633213758f, 0.633213758f, -0.202110976f, 0.110881560f, -0.0687073320f,
+   0.0434275717f, -0.0263579581f, 0.0141942464f, -0.00539148971f, -0.000899386592f, 0.00521939434f,
+   -0.00796315912f, 0.00944981910f, -0.00995517708f, 0.00972402003f, -0.00897387415f, 0.00789451879f,
+   -0.00664613536f, 0.00535796676f, -0.00412797881f, 0.00302409451f, -0.00208679587f, 0.00133299269f,
+   -0.000760739029f, 0.000354223099f, -8.87974093e-05f, -6.45011460e-05f, 0.000135141323f, -0.000150253953f,
+   0.000132720146f, -0.000100215293f, 6.50652801e-05f, -3.47103814e-05f, -2.13937801e-05f, 3.51953022e-05f,
+   -4.26533879e-05f, 3.34738834e-05f, 6.47911838e-06f, -9.47567969e-05f, 0.000251177524f, -0.000495894987f,
+   0.000846654584f, -0.00131540175f, 0.00190437504f, -0.00260201190f, 0.00337910908f, -0.00418555085f,
+   0.00494809216f, -0.00556956185f, 0.00592956878f, -0.00588704413f, 0.00528386328f, -0.00394970551f,
+   0.00170633954f, 0.00162928866f, -0.00624680799f, 0.0123517700f, -0.0201919004f, 0.0301143657f,
+   -0.0426922478f, 0.0590184554f, -0.0814810395f, 0.116274454f, -0.184924543f, 0.439441800f,
+   0.795056164f, -0.169462621f, 0.0763205066f, -0.0372914970f, 0.0156570096f, -0.00225106115f,
+   -0.00633267546f, 0.0116997911f, -0.0147581054f, 0.0161047690f, -0.0161819234f, 0.0153436242f,
+   -0.0138845397f, 0.0120521672f, -0.0100511117f, 0.00804481376f, -0.00615678495f, 0.00447263569f,
+   -0.00304341177f, 0.00189007446f, -0.00100904761f, 0.000378255005f, 3.66889326e-05f, -0.000276815961f,
+   0.000384752755f, -0.000400741264f, 0.000359863508f, -0.000290363590f, 0.000213069899f, -0.000141682176f,
+   8.37052867e-05f, -4.17607516e-05f, -6.54451969e-06f, 3.18203365e-06f, 1.51718323e-05f, -5.92440811e-05f,
+   0.000141812838f, -0.000276518491f, 0.000476020970f, -0.000749539759f, 0.00109993538f, -0.00152051088f,
+   0.00199186918f, -0.00247917650f, 0.00293022371f, -0.00327462750f, 0.00342456065f, -0.00327699282f,
+   0.00271768146f, -0.00162656559f, -0.000115832023f, 0.00262147700f, -0.00598880416f, 0.0102980323f,
+   -0.0156102711f, 0.0219726209f, -0.0294328276f, 0.0380724110f, -0.0480757616f, 0.0598829240f,
+   -0.0745732263f, 0.0950422212f, -0.130993187f, 0.239773139f, 0.902412355f, -0.0811844692f,
+   0.0165982097f, 0.00709639909f, -0.0185525510f, 0.0243078675f, -0.0267513525f, 0.0270400345f,
+   -0.0258643925f, 0.0237045214f, -0.0209279172f, 0.0178290475f, -0.0146453632f, 0.0115639707f,
+   -0.00872480497f, 0.00622354820f, -0.00411515497f, 0.00241892808f, -0.00112440577f, 0.000198238064f,
+   0.000408648542f, -0.000754177105f, 0.000898854807f, -0.000900722574f, 0.000811440754f, -0.000673815259f,
+   0.000520677655f, -0.000374868308f, 0.000250158395f, -0.000152783847f, 8.33021259e-05f, -3.85026069e-05f,
+};
+
+static const spx_word16_t resample_table_27[128] = {
+   -6.66232609e-07f, 2.67281921e-05f, 1.06017469e-05f, -4.67392310e-05f, -3.39137805e-05f, 6.79476652e-05f,
+   7.61974370e-05f, -8.32159567e-05f, -0.000141770986f, 8.16196698e-05f, 0.000231822298f, -4.88236292e-05f,
+   -0.000342332991f, -3.16442165e-05f, 0.000462119642f, 0.000176097252f, -0.000571403070f, -0.000397451135f,
+   0.000641351042f, 0.000701257435f, -0.000635026605f, -0.00108143664f, 0.000510021986f, 0.00151631830f,
+   -0.000222911141f, -0.00196561869f, -0.000264680799f, 0.00236913841f, 0.000978657161f, -0.00264770864f,
+   -0.00192452024f, 0.00270684925f, 0.00307971379f, -0.00244319695f, -0.00438710628f, 0.00175346970f,
+   0.00575069524f, -0.000545239483f, -0.00703394646f, -0.00125139812f, 0.00806116406f, 0.00367252086f,
+   -0.00862128008f, -0.00671096705f, 0.00847258605f, 0.0103101032f, -0.00734553905f, -0.0143617196f,
+   0.00493747974f, 0.0187088829f, -0.000888338254f, -0.0231540762f, -0.00528995646f, 0.0274718795f,
+   0.0143987890f, -0.0314254351f, -0.0280800313f, 0.0347851142f, 0.0506248772f, -0.0373475589f,
+   -0.0980255082f, 0.0389531367f, 0.315572798f, 0.460500002f, 0.315572798f, 0.0389531367f,
+   -0.0980255082f, -0.0373475589f, 0.0506248772f, 0.0347851142f, -0.0280800313f, -0.0314254351f,
+   0.0143987890f, 0.0274718795f, -0.00528995646f, -0.0231540762f, -0.000888338254f, 0.0187088829f,
+   0.00493747974f, -0.0143617196f, -0.00734553905f, 0.0103101032f, 0.00847258605f, -0.00671096705f,
+   -0.00862128008f, 0.00367252086f, 0.00806116406f, -0.00125139812f, -0.00703394646f, -0.000545239483f,
+   0.00575069524f, 0.00175346970f, -0.00438710628f, -0.00244319695f, 0.00307971379f, 0.00270684925f,
+   -0.00192452024f, -0.00264770864f, 0.000978657161f, 0.00236913841f, -0.000264680799f, -0.00196561869f,
+   -0.000222911141f, 0.00151631830f, 0.000510021986f, -0.00108143664f, -0.000635026605f, 0.000701257435f,
+   0.000641351042f, -0.000397451135f, -0.000571403070f, 0.000176097252f, 0.000462119642f, -3.16442165e-05f,
+   -0.000342332991f, -4.88236292e-05f, 0.000231822298f, 8.16196698e-05f, -0.000141770986f, -8.32159567e-05f,
+   7.61974370e-05f, 6.79476652e-05f, -3.39137805e-05f, -4.67392310e-05f, 1.06017469e-05f, 2.67281921e-05f,
+   -6.66232609e-07f, -1.15874109e-05f,
+};
+
+static const spx_word16_t resample_table_30[192] = {
+   -5.28037299e-06f, 6.07103266e-06f, 1.78187947e-05f, 1.57091854e-05f, -5.49113702e-06f, -3.11594886e-05f,
+   -3.46432134e-05f, -2.43741897e-06f, 4.52982313e-05f, 6.37608755e-05f, 2.28603512e-05f, -5.54773069e-05f,
+   -0.000102949722f, -6.12709409e-05f, 5.44131144e-05f, 0.000149229556f, 0.000122368205f, -3.25479450e-05f,
+   -0.000195785440f, -0.000208538622f, -2.10977505e-05f, 0.000231344413f, 0.000318103732f, 0.000117398165f,
+   -0.000240155350f, -0.000443591474f, -0.000264967442f, 0.000202788244f, 0.000570340024f, 0.000467504986f,
+   -9.79076285e-05f, -0.000675785996f, -0.000720960088f, -9.49783644e-05f, 0.000729779480f, 0.00101087894f,
+   0.000391861860f, -0.000696190342f, -0.00131041254f, -0.000800031063f, 0.000535902625f, 0.00157942309f,
+   0.00131369906f, -0.000211231250f, -0.00176513626f, -0.00191007229f, -0.000308576768f, 0.00180456624f,
+   0.00254633487f, 0.00104117044f, -0.00162879797f, -0.00315823383f, -0.00198476668f, 0.00116897980f,
+   0.00366054219f, 0.00311250705f, -0.000363480154f, -0.00394959422f, -0.00436791684f, -0.000834265433f,
+   0.00390765257f, 0.00566215767f, 0.00244834740f, -0.00340854982f, -0.00687294314f, -0.00447397819f,
+   0.00232322770f, 0.00784477871f, 0.00687341765f, -0.000523343624f, -0.00838888437f, -0.00957447942f,
+   -0.00212035934f, 0.00827933569f, 0.0124725895f, 0.00575128431f, -0.00723807281f, -0.0154360514f,
+   -0.0105645582f, 0.00489091594f, 0.0183145870f, 0.0169028025f, -0.000646117202f, -0.0209502913f,
+   -0.0255150124f, -0.00666681537f, 0.0231900774f, 0.0383968763f, 0.0201122724f, -0.0248983726f,
+   -0.0626380518f, -0.0519109182f, 0.0259687603f, 0.148814261f, 0.261463106f, 0.307000011f,
+   0.261463106f, 0.148814261f, 0.0259687603f, -0.0519109182f, -0.0626380518f, -0.0248983726f,
+   0.0201122724f, 0.0383968763f, 0.0231900774f, -0.00666681537f, -0.0255150124f, -0.0209502913f,
+   -0.000646117202f, 0.0169028025f, 0.0183145870f, 0.00489091594f, -0.0105645582f, -0.0154360514f,
+   -0.00723807281f, 0.00575128431f, 0.0124725895f, 0.00827933569f, -0.00212035934f, -0.00957447942f,
+   -0.00838888437f, -0.000523343624f, 0.00687341765f, 0.00784477871f, 0.00232322770f, -0.00447397819f,
+   -0.00687294314f, -0.00340854982f, 0.00244834740f, 0.00566215767f, 0.00390765257f, -0.000834265433f,
+   -0.00436791684f, -0.00394959422f, -0.000363480154f, 0.00311250705f, 0.00366054219f, 0.00116897980f,
+   -0.00198476668f, -0.00315823383f, -0.00162879797f, 0.00104117044f, 0.00254633487f, 0.00180456624f,
+   -0.000308576768f, -0.00191007229f, -0.00176513626f, -0.000211231250f, 0.00131369906f, 0.00157942309f,
+   0.000535902625f, -0.000800031063f, -0.00131041254f, -0.000696190342f, 0.000391861860f, 0.00101087894f,
+   0.000729779480f, -9.49783644e-05f, -0.000720960088f, -0.000675785996f, -9.79076285e-05f, 0.000467504986f,
+   0.000570340024f, 0.000202788244f, -0.000264967442f, -0.000443591474f, -0.000240155350f, 0.000117398165f,
+   0.000318103732f, 0.000231344413f, -2.10977505e-05f, -0.000208538622f, -0.000195785440f, -3.25479450e-05f,
+   0.000122368205f, 0.000149229556f, 5.44131144e-05f, -6.12709409e-05f, -0.000102949722f, -5.54773069e-05f,
+   2.28603512e-05f, 6.37608755e-05f, 4.52982313e-05f, -2.43741897e-06f, -3.46432134e-05f, -3.11594886e-05f,
+   -5.49113702e-06f, 1.57091854e-05f, 1.78187947e-05f, 6.07103266e-06f, -5.28037299e-06f, -7.72494059e-06f,
+};
+
+static const spx_word16_t resample_table_31[192] = {
+   1.21420653e-05f, 3.14183708e-05f, -6.23189771e-05f, -4.87483794e-06f, 0.000127521751f, -0.000110954614f,
+   -0.000122541882f, 0.000298459112f, -6.50958900e-05f, -0.000417077244f, 0.000462688826f, 0.000234796331f,
+   -0.000887182949f, 0.000405576488f, 0.000935009972f, -0.00135157199f, -0.000189956729f, 0.00202175789f,
+   -0.00139238068f, -0.00160006213f, 0.00315884617f, -0.000422462501f, -0.00382014457f, 0.00360913249f,
+   0.00208234088f, -0.00631646765f, 0.00233795960f, 0.00622501411f, -0.00789918844f, -0.00166853087f,
+   0.0113243153f, -0.00681709964f, -0.00894795638f, 0.0156895574f, -0.00104668725f, -0.0191489588f,
+   0.0165586714f, 0.0115025686f, -0.0308721028f, 0.00978183188f, 0.0338056050f, -0.0419005826f,
+   -0.0133336307f, 0.0767937526f, -0.0497967452f, -0.103821836f, 0.297628522f, 0.614000022f,
+   0.297628522f, -0.103821836f, -0.0497967452f, 0.0767937526f, -0.0133336307f, -0.0419005826f,
+   0.0338056050f, 0.00978183188f, -0.0308721028f, 0.0115025686f, 0.0165586714f, -0.0191489588f,
+   -0.00104668725f, 0.0156895574f, -0.00894795638f, -0.00681709964f, 0.0113243153f, -0.00166853087f,
+   -0.00789918844f, 0.00622501411f, 0.00233795960f, -0.00631646765f, 0.00208234088f, 0.00360913249f,
+   -0.00382014457f, -0.000422462501f, 0.00315884617f, -0.00160006213f, -0.00139238068f, 0.00202175789f,
+   -0.000189956729f, -0.00135157199f, 0.000935009972f, 0.000405576488f, -0.000887182949f, 0.000234796331f,
+   0.000462688826f, -0.000417077244f, -6.50958900e-05f, 0.000298459112f, -0.000122541882f, -0.000110954614f,
+   0.000127521751f, -4.87483794e-06f, -6.23189771e-05f, 3.14183708e-05f, 1.21420653e-05f, -1.54498812e-05f,
+   -1.05607460e-05f, 3.56375895e-05f, -1.09822740e-05f, -6.92864269e-05f, 9.05964625e-05f, 4.57207025e-05f,
+   -0.000205899443f, 0.000108826229f, 0.000244736410f, -0.000391570880f, -4.21955010e-05f, 0.000636207464f,
+   -0.000480310700f, -0.000529934885f, 0.00114068005f, -0.000195815257f, -0.00144192018f, 0.00145955896f,
+   0.000783723721f, -0.00262082508f, 0.00107180525f, 0.00262739812f, -0.00353027252f, -0.000617153535f,
+   0.00509266974f, -0.00325759593f, -0.00396953337f, 0.00732108438f, -0.000726960308f, -0.00873583369f,
+   0.00781530514f, 0.00489669479f, -0.0137458863f, 0.00464645540f, 0.0137468353f, -0.0167777687f,
+   -0.00424071867f, 0.0249451790f, -0.0144761456f, -0.0211291164f, 0.0366291739f, -0.00129223440f,
+   -0.0510300249f, 0.0463801548f, 0.0402245447f, -0.125276104f, 0.0519375205f, 0.522926211f,
+   0.522926211f, 0.0519375205f, -0.125276104f, 0.0402245447f, 0.0463801548f, -0.0510300249f,
+   -0.00129223440f, 0.0366291739f, -0.0211291164f, -0.0144761456f, 0.0249451790f, -0.00424071867f,
+   -0.0167777687f, 0.0137468353f, 0.00464645540f, -0.0137458863f, 0.00489669479f, 0.00781530514f,
+   -0.00873583369f, -0.000726960308f, 0.00732108438f, -0.00396953337f, -0.00325759593f, 0.00509266974f,
+   -0.000617153535f, -0.00353027252f, 0.00262739812f, 0.00107180525f, -0.00262082508f, 0.000783723721f,
+   0.00145955896f, -0.00144192018f, -0.000195815257f, 0.00114068005f, -0.000529934885f, -0.000480310700f,
+   0.000636207464f, -4.21955010e-05f, -0.000391570880f, 0.000244736410f, 0.000108826229f, -0.000205899443f,
+   4.57207025e-05f, 9.05964625e-05f, -6.92864269e-05f, -1.09822740e-05f, 3.56375895e-05f, -1.05607460e-05f,
+};
+
+static const spx_word16_t resample_table_34[256] = {
+   -5.10521522e-06f, -3.33116304e-07f, 7.14204543e-06f, 1.33640960e-05f, 1.35945902e-05f, 5.30087345e-06f,
+   -9.36003107e-06f, -2.33696155e-05f, -2.78106218e-05f, -1.69568902e-05f, 7.19686341e-06f, 3.39738326e-05f,
+   4.81742536e-05f, 3.80987185e-05f, 3.46554111e-06f, -4.16079783e-05f, -7.35260619e-05f, -7.08854932e-05f,
+   -2.74730264e-05f, 4.08098349e-05f, 0.000100442165f, 0.000115911149f, 6.96506831e-05f, -2.44118146e-05f,
+   -0.000122717174f, -0.000171166495f, -0.000133701105f, -1.58221083e-05f, 0.000131189154f, 0.000231059821f,
+   0.000220823335f, 8.80486259e-05f, -0.000114068636f, -0.000285701535f, -0.000328213937f, -0.000198725567f,
+   5.79010084e-05f, 0.000320675521f, 0.000447663275f, 0.000350628718f, 5.07993173e-05f, -0.000317513302f,
+   -0.000564535323f, -0.000540718320f, -0.000223258234f, 0.000255010993f, 0.000657407625f, 0.000758159149f,
+   0.000465694728f, -0.000111455571f, -0.000698620453f, -0.000982809346f, -0.000776358298f, -0.000132340399f,
+   0.000655935146f, 0.00118456921f, 0.00114275038f, 0.000489328580f, -0.000495336717f, -0.00132385432f,
+   -0.00153937982f, -0.000962260121f, 0.000184883131f, 0.00135342462f, 0.00192654552f, 0.00153985689f,
+   0.000300596526f, -0.00122159848f, -0.00225042063f, -0.00219355314f, -0.000974455616f, 0.000876734848f,
+   0.00244465680f, 0.00287534762f, 0.00183318462f, -0.000272619742f, -0.00243348256f, -0.00351697323f,
+   -0.00285206828f, -0.000625699060f, 0.00213607913f, 0.00403058203f, 0.00398178957f, 0.00183626043f,
+   -0.00147155428f, -0.00431064004f, -0.00514643174f, -0.00335548352f, 0.000363789237f, 0.00423629303f,
+   0.00624252344f, 0.00515505159f, 0.00125549175f, -0.00367276953f, -0.00713845016f, -0.00718085980f,
+   -0.00344715011f, 0.00246873987f, 0.00767199462f, 0.00935444143f, 0.00627258886f, -0.000444169127f,
+   -0.00764122279f, -0.0115770381f, -0.00981637649f, -0.00264497823f, 0.00677691773f, 0.0137359397f,
+   0.0142425345f, 0.00719939452f, -0.00466383481f, -0.0157127175f, -0.0199422613f, -0.0140400156f,
+   0.000499499612f, 0.0173925571f, 0.0279984809f, 0.0253124386f, 0.00781298149f, -0.0186737794f,
+   -0.0422237031f, -0.0490127541f, -0.0289585609f, 0.0194765683f, 0.0874351189f, 0.157786399f,
+   0.210640967f, 0.230250001f, 0.210640967f, 0.157786399f, 0.0874351189f, 0.0194765683f,
+   -0.0289585609f, -0.0490127541f, -0.0422237031f, -0.0186737794f, 0.00781298149f, 0.0253124386f,
+   0.0279984809f, 0.0173925571f, 0.000499499612f, -0.0140400156f, -0.0199422613f, -0.0157127175f,
+   -0.00466383481f, 0.00719939452f, 0.0142425345f, 0.0137359397f, 0.00677691773f, -0.00264497823f,
+   -0.00981637649f, -0.0115770381f, -0.00764122279f, -0.000444169127f, 0.00627258886f, 0.00935444143f,
+   0.00767199462f, 0.00246873987f, -0.00344715011f, -0.00718085980f, -0.00713845016f, -0.00367276953f,
+   0.00125549175f, 0.00515505159f, 0.00624252344f, 0.00423629303f, 0.000363789237f, -0.00335548352f,
+   -0.00514643174f, -0.00431064004f, -0.00147155428f, 0.00183626043f, 0.00398178957f, 0.00403058203f,
+   0.00213607913f, -0.000625699060f, -0.00285206828f, -0.00351697323f, -0.00243348256f, -0.000272619742f,
+   0.00183318462f, 0.00287534762f, 0.00244465680f, 0.000876734848f, -0.000974455616f, -0.00219355314f,
+   -0.00225042063f, -0.00122159848f, 0.000300596526f, 0.00153985689f, 0.00192654552f, 0.00135342462f,
+   0.000184883131f, -0.000962260121f, -0.00153937982f, -0.00132385432f, -0.000495336717f, 0.000489328580f,
+   0.00114275038f, 0.00118456921f, 0.000655935146f, -0.000132340399f, -0.000776358298f, -0.000982809346f,
+   -0.000698620453f, -0.000111455571f, 0.000465694728f, 0.000758159149f, 0.000657407625f, 0.000255010993f,
+   -0.000223258234f, -0.000540718320f, -0.000564535323f, -0.000317513302f, 5.07993173e-05f, 0.000350628718f,
+   0.000447663275f, 0.000320675521f, 5.79010084e-05f, -0.000198725567f, -0.000328213937f, -0.000285701535f,
+   -0.000114068636f, 8.80486259e-05f, 0.000220823335f, 0.000231059821f, 0.000131189154f, -1.58221083e-05f,
+   -0.000133701105f, -0.000171166495f, -0.000122717174f, -2.44118146e-05f, 6.96506831e-05f, 0.000115911149f,
+   0.000100442165f, 4.08098349e-05f, -2.74730264e-05f, -7.08854932e-05f, -7.35260619e-05f, -4.16079783e-05f,
+   3.46554111e-06f, 3.80987185e-05f, 4.81742536e-05f, 3.39738326e-05f, 7.19686341e-06f, -1.69568902e-05f,
+   -2.78106218e-05f, -2.33696155e-05f, -9.36003107e-06f, 5.30087345e-06f, 1.35945902e-05f, 1.33640960e-05f,
+   7.14204543e-06f, -3.33116304e-07f, -5.10521522e-06f, -5.79370544e-06f,
+};
+
+static const spx_word16_t resample_table_35[264] = {
+   -2.59029948e-05f, -1.92947596e-06f, 6.93237234e-05f, -0.000109574677f, 3.17486556e-05f, 0.000160327167f,
+   -0.000297854218f, 0.000160169497f, 0.000266093877f, -0.000638832396f, 0.000479688839f, 0.000316148449f,
+   -0.00115942571f, 0.00111624599f, 0.000174483648f, -0.00183479651f, 0.00220599887f, -0.000370185531f,
+   -0.00255436893f, 0.00386368996f, -0.00160265574f, -0.00309022889f, 0.00614440721f, -0.00387124671f,
+   -0.00306977308f, 0.00900842436f, -0.00758545147f, -0.00194124808f, 0.0123002566f, -0.0132632656f,
+   0.00111525867f, 0.0157512017f, -0.0217456836f, 0.00749998679f, 0.0190095492f, -0.0350092389f,
+   0.0204548500f, 0.0216946322f, -0.0600116365f, 0.0522805303f, 0.0234649032f, -0.147110492f,
+   0.262337506f, 0.690750003f, 0.262337506f, -0.147110492f, 0.0234649032f, 0.0522805303f,
+   -0.0600116365f, 0.0216946322f, 0.0204548500f, -0.0350092389f, 0.0190095492f, 0.00749998679f,
+   -0.0217456836f, 0.0157512017f, 0.00111525867f, -0.0132632656f, 0.0123002566f, -0.00194124808f,
+   -0.00758545147f, 0.00900842436f, -0.00306977308f, -0.00387124671f, 0.00614440721f, -0.00309022889f,
+   -0.00160265574f, 0.00386368996f, -0.00255436893f, -0.000370185531f, 0.00220599887f, -0.00183479651f,
+   0.000174483648f, 0.00111624599f, -0.00115942571f, 0.000316148449f, 0.000479688839f, -0.000638832396f,
+   0.000266093877f, 0.000160169497f, -0.000297854218f, 0.000160327167f, 3.17486556e-05f, -0.000109574677f,
+   6.93237234e-05f, -1.92947596e-06f, -2.59029948e-05f, 1.59728497e-05f, -5.57611975e-06f, -3.13969504e-05f,
+   7.06425199e-05f, -4.49888648e-05f, -7.61987103e-05f, 0.000205693941f, -0.000170567917f, -0.000108905035f,
+   0.000446621678f, -0.000461421936f, -5.82347820e-05f, 0.000797527959f, -0.00101454183f, 0.000202498137f,
+   0.00120955124f, -0.00192315492f, 0.000858803047f, 0.00155189703f, -0.00324358325f, 0.00214549596f,
+   0.00158735272f, -0.00495562842f, 0.00432625273f, 0.000954589050f, -0.00692354795f, 0.00767275598f,
+   -0.000851162011f, -0.00886208005f, 0.0124684572f, -0.00453361450f, -0.0102989487f, 0.0190944746f,
+   -0.0111991633f, -0.0104815224f, 0.0283714999f, -0.0231232550f, -0.00798816513f, 0.0429404378f,
+   -0.0473040193f, 0.00150191830f, 0.0760411695f, -0.126755804f, 0.0584424362f, 0.631931543f,
+   0.473385036f, -0.0869053304f, -0.0560702719f, 0.0841344893f, -0.0422333255f, -0.0140471766f,
+   0.0414355434f, -0.0296653695f, -0.00134502992f, 0.0232876875f, -0.0218542702f, 0.00383215281f,
+   0.0129722422f, -0.0158150811f, 0.00566472067f, 0.00661739055f, -0.0109452056f, 0.00573337637f,
+   0.00275675859f, -0.00711711729f, 0.00490035443f, 0.000592358585f, -0.00427243579f, 0.00371700292f,
+   -0.000434127025f, -0.00231291354f, 0.00253518857f, -0.000754669541f, -0.00108603272f, 0.00155115814f,
+   -0.000698461779f, -0.000407274783f, 0.000839563843f, -0.000495467160f, -9.25041968e-05f, 0.000390500791f,
+   -0.000283970818f, 1.43891211e-05f, 0.000147350307f, -0.000127525811f, 2.61959121e-05f, 3.93674527e-05f,
+   -3.83894403e-05f, 1.04808469e-05f, 1.04808469e-05f, -3.83894403e-05f, 3.93674527e-05f, 2.61959121e-05f,
+   -0.000127525811f, 0.000147350307f, 1.43891211e-05f, -0.000283970818f, 0.000390500791f, -9.25041968e-05f,
+   -0.000495467160f, 0.000839563843f, -0.000407274783f, -0.000698461779f, 0.00155115814f, -0.00108603272f,
+   -0.000754669541f, 0.00253518857f, -0.00231291354f, -0.000434127025f, 0.00371700292f, -0.00427243579f,
+   0.000592358585f, 0.00490035443f, -0.00711711729f, 0.00275675859f, 0.00573337637f, -0.0109452056f,
+   0.00661739055f, 0.00566472067f, -0.0158150811f, 0.0129722422f, 0.00383215281f, -0.0218542702f,
+   0.0232876875f, -0.00134502992f, -0.0296653695f, 0.0414355434f, -0.0140471766f, -0.0422333255f,
+   0.0841344893f, -0.0560702719f, -0.0869053304f, 0.473385006f, 0.631931543f, 0.0584424809f,
+   -0.126755804f, 0.0760411695f, 0.00150191830f, -0.0473040193f, 0.0429404378f, -0.00798816513f,
+   -0.0231232550f, 0.0283714999f, -0.0104815224f, -0.0111991633f, 0.0190944746f, -0.0102989487f,
+   -0.00453361450f, 0.0124684572f, -0.00886208005f, -0.000851162011f, 0.00767275598f, -0.00692354795f,
+   0.000954589050f, 0.00432625273f, -0.00495562842f, 0.00158735272f, 0.00214549596f, -0.00324358325f,
+   0.00155189703f, 0.000858803047f, -0.00192315492f, 0.00120955124f, 0.000202498137f, -0.00101454183f,
+   0.000797527959f, -5.82347820e-05f, -0.000461421936f, 0.000446621678f, -0.000108905035f, -0.000170567917f,
+   0.000205693941f, -7.61987103e-05f, -4.49888648e-05f, 7.06425199e-05f, -3.13969504e-05f, -5.57611975e-06f,
+};
+
+static const spx_word16_t resample_table_37[712] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, -4.04363027e-06f, -3.92676247e-06f,
+   -3.44213208e-06f, -2.56939620e-06f, -1.32108960e-06f, 2.53844320e-07f, 2.06972959e-06f, 4.00718318e-06f,
+   5.91914431e-06f, 7.64053584e-06f, 9.00047144e-06f, 9.83627251e-06f, 1.00080406e-05f, 9.41493181e-06f,
+   8.00663292e-06f, 5.79396965e-06f, 2.85479746e-06f, -6.64625418e-07f, -4.55424288e-06f, -8.55076723e-06f,
+   -1.23529071e-05f, -1.56420301e-05f, -1.81062751e-05f, -1.94654094e-05f, -1.94980203e-05f, -1.80636198e-05f,
+   -1.51220929e-05f, -1.07468059e-05f, -5.12907673e-06f, 1.42489739e-06f, 8.50761535e-06f, 1.56332153e-05f,
+   2.22670806e-05f, 2.78635271e-05f, 3.19069768e-05f, 3.39540602e-05f, 3.36742014e-05f, 3.08842718e-05f,
+   2.55755840e-05f, 1.79282561e-05f, 8.31420584e-06f, -2.71585759e-06f, -1.44605574e-05f, -2.61073164e-05f,
+   -3.67858520e-05f, -4.56299713e-05f, -5.18412635e-05f, -5.47559030e-05f, -5.39041357e-05f, -4.90602724e-05f,
+   -4.02779842e-05f, -2.79061460e-05f, -1.25856641e-05f, 4.77740241e-06f, 2.30617188e-05f, 4.09962049e-05f,
+   5.72455683e-05f, 7.05045095e-05f, 7.95955129e-05f, 8.35657847e-05f, 8.17730324e-05f, 7.39533280e-05f,
+   6.02670734e-05f, 4.13134258e-05f, 1.81176856e-05f, -7.91717412e-06f, -3.50910195e-05f, -6.15091776e-05f,
+   -8.52094890e-05f, -0.000104304127f, -0.000117119067f, -0.000122332625f, -0.000119092903f, -0.000107109219f,
+   -8.67081326e-05f, -5.88451840e-05f, -2.50759585e-05f, 1.25221259e-05f, 5.14737803e-05f, 8.90560841e-05f,
+   0.000122484984f, 0.000149115745f, 0.000166639264f, 0.000173271343f, 0.000167911960f, 0.000150262596f,
+   0.000120895107f, 8.12548897e-05f, 3.36099147e-05f, -1.90700684e-05f, -7.32940898e-05f, -0.000125264807f,
+   -0.000171140782f, -0.000207314224f, -0.000230677149f, -0.000238877095f, -0.000230524456f, -0.000205343618f,
+   -0.000164251876f, -0.000109351357f, -4.38450043e-05f, 2.81416978e-05f, 0.000101811966f, 0.000171999825f,
+   0.000233528204f, 0.000281582848f, 0.000312068354f, 0.000321942556f, 0.000309485797f, 0.000274487247f,
+   0.000218336980f, 0.000143998041f, 5.58736501e-05f, -4.04348866e-05f, -0.000138482239f, -0.000231386424f,
+   -0.000312307355f, -0.000374942378f, -0.000413990201f, -0.000425584702f, -0.000407633663f, -0.000360050180f,
+   -0.000284854759f, -0.000186110818f, -6.97487631e-05f, 5.67807765e-05f, 0.000184979363f, 0.000305841764f,
+   0.000410484994f, 0.000490790815f, 0.000540004403f, 0.000553283491f, 0.000528124045f, 0.000464641256f,
+   0.000365667016f, 0.000236667489f, 8.54766913e-05f, -7.81639610e-05f, -0.000243230112f, -0.000398120406f,
+   -0.000531468017f, -0.000632965122f, -0.000694119139f, -0.000708944805f, -0.000674490526f, -0.000591157994f,
+   -0.000462830736f, -0.000296720711f, -0.000103011967f, 0.000105748513f, 0.000315460667f, 0.000511378574f,
+   0.000679145160f, 0.000805831514f, 0.000880887324f, 0.000897000253f, 0.000850720156f, 0.000742868811f,
+   0.000578647829f, 0.000367424538f, 0.000122259051f, -0.000140914024f, -0.000404263701f, -0.000649269903f,
+   -0.000858007348f, -0.00101442670f, -0.00110555883f, -0.00112254103f, -0.00106140249f, -0.000923526648f,
+   -0.000715749746f, -0.000450077729f, -0.000143044657f, 0.000185306606f, 0.000512699306f, 0.000816099287f,
+   0.00107333355f, 0.00126467308f, 0.00137429475f, 0.00139155996f, 0.00131193595f, 0.00113754114f,
+   0.000877227401f, 0.000546194497f, 0.000165162593f, -0.000240914727f, -0.000644445478f, -0.00101703266f,
+   -0.00133147475f, -0.00156369153f, -0.00169453025f, -0.00171129638f, -0.00160885544f, -0.00139026542f,
+   -0.00106683525f, -0.000657619152f, -0.000188336635f, 0.000310183095f, 0.000804024457f, 0.00125844730f,
+   0.00164027559f, 0.00192031404f, 0.00207551010f, 0.00209077913f, 0.00196033926f, 0.00168841798f,
+   0.00128930761f, 0.000786679389f, 0.000212241895f, -0.000396190095f, -0.000997184659f, -0.00154845219f,
+   -0.00200976385f, -0.00234587584f, -0.00252913730f, -0.00254167872f, -0.00237699552f, -0.00204076292f,
+   -0.00155085861f, -0.000936486351f, -0.000236508291f, 0.000502929732f, 0.00123143836f, 0.00189774437f,
+   0.00245322916f, 0.00285546039f, 0.00307133072f, 0.00307967560f, 0.00287315575f, 0.00245919987f,
+   0.00185998937f, 0.00111135631f, 0.000260729255f, -0.000635770324f, -0.00151702401f, -0.00232099392f,
+   -0.00298900018f, -0.00346998125f, -0.00372426864f, -0.00372672617f, -0.00346899149f, -0.00296057994f,
+   -0.00222883280f, -0.00131754822f, -0.000284471229f, 0.000802238297f, 0.00186849153f, 0.00283920625f,
+   0.00364347897f, 0.00421972666f, 0.00452024117f, 0.00451496569f, 0.00419418747f, 0.00356985489f,
+   0.00267549371f, 0.00156454043f, 0.000307301205f, -0.00101340364f, -0.00230752910f, -0.00348392758f,
+   -0.00445657084f, -0.00515074050f, -0.00550860539f, -0.00549378851f, -0.00509463577f, -0.00432584342f,
+   -0.00322835310f, -0.00186738977f, -0.000328733819f, 0.00128648314f, 0.00286829239f, 0.00430524256f,
+   0.00549202552f, 0.00633703126f, 0.00676918263f, 0.00674356474f, 0.00624547154f, 0.00529251806f,
+   0.00393456640f, 0.00225140504f, 0.000348359201f, -0.00165008567f, -0.00360822957f, -0.00538805733f,
+   -0.00685873255f, -0.00790592190f, -0.00844026823f, -0.00840453152f, -0.00777879357f, -0.00658324221f,
+   -0.00487836497f, -0.00276232464f, -0.000365756365f, 0.00215594540f, 0.00463236077f, 0.00688905548f,
+   0.00875944551f, 0.0100965817f, 0.0107839797f, 0.0107449936f, 0.00994972512f, 0.00841912255f,
+   0.00622581737f, 0.00349142426f, 0.000380567712f, -0.00290847430f, -0.00615556864f, -0.00913271122f,
+   -0.0116191255f, -0.0134165213f, -0.0143636754f, -0.0143491542f, -0.0133213541f, -0.0112951091f,
+   -0.00835419726f, -0.00464946218f, -0.000392423710f, 0.00415534759f, 0.00869678706f, 0.0129168583f,
+   0.0165021420f, 0.0191616341f, 0.0206469763f, 0.0207712799f, 0.0194251705f, 0.0165888872f,
+   0.0123396469f, 0.00685344264f, 0.000401111465f, -0.00666150451f, -0.0139087923f, -0.0208656229f,
+   -0.0270313751f, -0.0319065824f, -0.0350208320f, -0.0359602608f, -0.0343932211f, -0.0300924648f,
+   -0.0229526460f, -0.0130018154f, -0.000406396954f, 0.0145312073f, 0.0313819237f, 0.0496065542f,
+   0.0685782954f, 0.0876102746f, 0.105986893f, 0.122997232f, 0.137968764f, 0.150299832f,
+   0.159488738f, 0.165158391f, 0.167074829f, 0.165158391f, 0.159488738f, 0.150299832f,
+   0.137968764f, 0.122997232f, 0.105986893f, 0.0876102746f, 0.0685782954f, 0.0496065542f,
+   0.0313819237f, 0.0145312073f, -0.000406396954f, -0.0130018154f, -0.0229526460f, -0.0300924648f,
+   -0.0343932211f, -0.0359602608f, -0.0350208320f, -0.0319065824f, -0.0270313751f, -0.0208656229f,
+   -0.0139087923f, -0.00666150451f, 0.000401111465f, 0.00685344264f, 0.0123396469f, 0.0165888872f,
+   0.0194251705f, 0.0207712799f, 0.0206469763f, 0.0191616341f, 0.0165021420f, 0.0129168583f,
+   0.00869678706f, 0.00415534759f, -0.000392423710f, -0.00464946218f, -0.00835419726f, -0.0112951091f,
+   -0.0133213541f, -0.0143491542f, -0.0143636754f, -0.0134165213f, -0.0116191255f, -0.00913271122f,
+   -0.00615556864f, -0.00290847430f, 0.000380567712f, 0.00349142426f, 0.00622581737f, 0.00841912255f,
+   0.00994972512f, 0.0107449936f, 0.0107839797f, 0.0100965817f, 0.00875944551f, 0.00688905548f,
+   0.00463236077f, 0.00215594540f, -0.000365756365f, -0.00276232464f, -0.00487836497f, -0.00658324221f,
+   -0.00777879357f, -0.00840453152f, -0.00844026823f, -0.00790592190f, -0.00685873255f, -0.00538805733f,
+   -0.00360822957f, -0.00165008567f, 0.000348359201f, 0.00225140504f, 0.00393456640f, 0.00529251806f,
+   0.00624547154f, 0.00674356474f, 0.00676918263f, 0.00633703126f, 0.00549202552f, 0.00430524256f,
+   0.00286829239f, 0.00128648314f, -0.000328733819f, -0.00186738977f, -0.00322835310f, -0.00432584342f,
+   -0.00509463577f, -0.00549378851f, -0.00550860539f, -0.00515074050f, -0.00445657084f, -0.00348392758f,
+   -0.00230752910f, -0.00101340364f, 0.000307301205f, 0.00156454043f, 0.00267549371f, 0.00356985489f,
+   0.00419418747f, 0.00451496569f, 0.00452024117f, 0.00421972666f, 0.00364347897f, 0.00283920625f,
+   0.00186849153f, 0.000802238297f, -0.000284471229f, -0.00131754822f, -0.00222883280f, -0.00296057994f,
+   -0.00346899149f, -0.00372672617f, -0.00372426864f, -0.00346998125f, -0.00298900018f, -0.00232099392f,
+   -0.00151702401f, -0.000635770324f, 0.000260729255f, 0.00111135631f, 0.00185998937f, 0.00245919987f,
+   0.00287315575f, 0.00307967560f, 0.00307133072f, 0.00285546039f, 0.00245322916f, 0.00189774437f,
+   0.00123143836f, 0.000502929732f, -0.000236508291f, -0.000936486351f, -0.00155085861f, -0.00204076292f,
+   -0.00237699552f, -0.00254167872f, -0.00252913730f, -0.00234587584f, -0.00200976385f, -0.00154845219f,
+   -0.000997184659f, -0.000396190095f, 0.000212241895f, 0.000786679389f, 0.00128930761f, 0.00168841798f,
+   0.00196033926f, 0.00209077913f, 0.00207551010f, 0.00192031404f, 0.00164027559f, 0.00125844730f,
+   0.000804024457f, 0.000310183095f, -0.000188336635f, -0.000657619152f, -0.00106683525f, -0.00139026542f,
+   -0.00160885544f, -0.00171129638f, -0.00169453025f, -0.00156369153f, -0.00133147475f, -0.00101703266f,
+   -0.000644445478f, -0.000240914727f, 0.000165162593f, 0.000546194497f, 0.000877227401f, 0.00113754114f,
+   0.00131193595f, 0.00139155996f, 0.00137429475f, 0.00126467308f, 0.00107333355f, 0.000816099287f,
+   0.000512699306f, 0.000185306606f, -0.000143044657f, -0.000450077729f, -0.000715749746f, -0.000923526648f,
+   -0.00106140249f, -0.00112254103f, -0.00110555883f, -0.00101442670f, -0.000858007348f, -0.000649269903f,
+   -0.000404263701f, -0.000140914024f, 0.000122259051f, 0.000367424538f, 0.000578647829f, 0.000742868811f,
+   0.000850720156f, 0.000897000253f, 0.000880887324f, 0.000805831514f, 0.000679145160f, 0.000511378574f,
+   0.000315460667f, 0.000105748513f, -0.000103011967f, -0.000296720711f, -0.000462830736f, -0.000591157994f,
+   -0.000674490526f, -0.000708944805f, -0.000694119139f, -0.000632965122f, -0.000531468017f, -0.000398120406f,
+   -0.000243230112f, -7.81639610e-05f, 8.54766913e-05f, 0.000236667489f, 0.000365667016f, 0.000464641256f,
+   0.000528124045f, 0.000553283491f, 0.000540004403f, 0.000490790815f, 0.000410484994f, 0.000305841764f,
+   0.000184979363f, 5.67807765e-05f, -6.97487631e-05f, -0.000186110818f, -0.000284854759f, -0.000360050180f,
+   -0.000407633663f, -0.000425584702f, -0.000413990201f, -0.000374942378f, -0.000312307355f, -0.000231386424f,
+   -0.000138482239f, -4.04348866e-05f, 5.58736501e-05f, 0.000143998041f, 0.000218336980f, 0.000274487247f,
+   0.000309485797f, 0.000321942556f, 0.000312068354f, 0.000281582848f, 0.000233528204f, 0.000171999825f,
+   0.000101811966f, 2.81416978e-05f, -4.38450043e-05f, -0.000109351357f, -0.000164251876f, -0.000205343618f,
+   -0.000230524456f, -0.000238877095f, -0.000230677149f, -0.000207314224f, -0.000171140782f, -0.000125264807f,
+   -7.32940898e-05f, -1.90700684e-05f, 3.36099147e-05f, 8.12548897e-05f, 0.000120895107f, 0.000150262596f,
+   0.000167911960f, 0.000173271343f, 0.000166639264f, 0.000149115745f, 0.000122484984f, 8.90560841e-05f,
+   5.14737803e-05f, 1.25221259e-05f, -2.50759585e-05f, -5.88451840e-05f, -8.67081326e-05f, -0.000107109219f,
+   -0.000119092903f, -0.000122332625f, -0.000117119067f, -0.000104304127f, -8.52094890e-05f, -6.15091776e-05f,
+   -3.50910195e-05f, -7.91717412e-06f, 1.81176856e-05f, 4.13134258e-05f, 6.02670734e-05f, 7.39533280e-05f,
+   8.17730324e-05f, 8.35657847e-05f, 7.95955129e-05f, 7.05045095e-05f, 5.72455683e-05f, 4.09962049e-05f,
+   2.30617188e-05f, 4.77740241e-06f, -1.25856641e-05f, -2.79061460e-05f, -4.02779842e-05f, -4.90602724e-05f,
+   -5.39041357e-05f, -5.47559030e-05f, -5.18412635e-05f, -4.56299713e-05f, -3.67858520e-05f, -2.61073164e-05f,
+   -1.44605574e-05f, -2.71585759e-06f, 8.31420584e-06f, 1.79282561e-05f, 2.55755840e-05f, 3.08842718e-05f,
+   3.36742014e-05f, 3.39540602e-05f, 3.19069768e-05f, 2.78635271e-05f, 2.22670806e-05f, 1.56332153e-05f,
+   8.50761535e-06f, 1.42489739e-06f, -5.12907673e-06f, -1.07468059e-05f, -1.51220929e-05f, -1.80636198e-05f,
+   -1.94980203e-05f, -1.94654094e-05f, -1.81062751e-05f, -1.56420301e-05f, -1.23529071e-05f, -8.55076723e-06f,
+   -4.55424288e-06f, -6.64625418e-07f, 2.85479746e-06f, 5.79396965e-06f, 8.00663292e-06f, 9.41493181e-06f,
+   1.00080406e-05f, 9.83627251e-06f, 9.00047144e-06f, 7.64053584e-06f, 5.91914431e-06f, 4.00718318e-06f,
+   2.06972959e-06f, 2.53844320e-07f, -1.32108960e-06f, -2.56939620e-06f, -3.44213208e-06f, -3.92676247e-06f,
+   -4.04363027e-06f, 0.00000000f, 0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_38[712] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, -8.08726054e-06f, -7.85352495e-06f,
+   -6.88426417e-06f, -5.13879240e-06f, -2.64217920e-06f, 5.07688640e-07f, 4.13945918e-06f, 8.01436636e-06f,
+   1.18382886e-05f, 1.52810717e-05f, 1.80009429e-05f, 1.96725450e-05f, 2.00160812e-05f, 1.88298636e-05f,
+   1.60132658e-05f, 1.15879393e-05f, 5.70959492e-06f, -1.32925084e-06f, -9.10848576e-06f, -1.71015345e-05f,
+   -2.47058142e-05f, -3.12840602e-05f, -3.62125502e-05f, -3.89308188e-05f, -3.89960405e-05f, -3.61272396e-05f,
+   -3.02441858e-05f, -2.14936117e-05f, -1.02581535e-05f, 2.84979478e-06f, 1.70152307e-05f, 3.12664306e-05f,
+   4.45341611e-05f, 5.57270541e-05f, 6.38139536e-05f, 6.79081204e-05f, 6.73484028e-05f, 6.17685437e-05f,
+   5.11511680e-05f, 3.58565121e-05f, 1.66284117e-05f, -5.43171518e-06f, -2.89211148e-05f, -5.22146329e-05f,
+   -7.35717040e-05f, -9.12599426e-05f, -0.000103682527f, -0.000109511806f, -0.000107808271f, -9.81205449e-05f,
+   -8.05559685e-05f, -5.58122920e-05f, -2.51713282e-05f, 9.55480482e-06f, 4.61234376e-05f, 8.19924098e-05f,
+   0.000114491137f, 0.000141009019f, 0.000159191026f, 0.000167131569f, 0.000163546065f, 0.000147906656f,
+   0.000120534147f, 8.26268515e-05f, 3.62353712e-05f, -1.58343482e-05f, -7.01820391e-05f, -0.000123018355f,
+   -0.000170418978f, -0.000208608253f, -0.000234238134f, -0.000244665251f, -0.000238185807f, -0.000214218438f,
+   -0.000173416265f, -0.000117690368f, -5.01519171e-05f, 2.50442517e-05f, 0.000102947561f, 0.000178112168f,
+   0.000244969968f, 0.000298231491f, 0.000333278527f, 0.000346542685f, 0.000335823919f, 0.000300525193f,
+   0.000241790214f, 0.000162509779f, 6.72198294e-05f, -3.81401369e-05f, -0.000146588180f, -0.000250529614f,
+   -0.000342281564f, -0.000414628448f, -0.000461354299f, -0.000477754191f, -0.000461048912f, -0.000410687237f,
+   -0.000328503753f, -0.000218702713f, -8.76900085e-05f, 5.62833957e-05f, 0.000203623931f, 0.000343999651f,
+   0.000467056409f, 0.000563165697f, 0.000624136708f, 0.000643885112f, 0.000618971593f, 0.000548974494f,
+   0.000436673959f, 0.000287996081f, 0.000111747300f, -8.08697732e-05f, -0.000276964478f, -0.000462772849f,
+   -0.000624614710f, -0.000749884755f, -0.000827980402f, -0.000851169403f, -0.000815267325f, -0.000720100361f,
+   -0.000569709518f, -0.000372221635f, -0.000139497526f, 0.000113561553f, 0.000369958725f, 0.000611683528f,
+   0.000820969988f, 0.000981581630f, 0.00108000881f, 0.00110656698f, 0.00105624809f, 0.000929282513f,
+   0.000731334032f, 0.000473334978f, 0.000170953383f, -0.000156327922f, -0.000486460223f, -0.000796240813f,
+   -0.00106293603f, -0.00126593024f, -0.00138823828f, -0.00141788961f, -0.00134898105f, -0.00118231599f,
+   -0.000925661472f, -0.000593441422f, -0.000206023935f, 0.000211497027f, 0.000630921335f, 0.00102275715f,
+   0.00135829032f, 0.00161166303f, 0.00176177465f, 0.00179400051f, 0.00170144031f, 0.00148573762f,
+   0.00115729566f, 0.000734849076f, 0.000244518102f, -0.000281828048f, -0.000808527402f, -0.00129853981f,
+   -0.00171601470f, -0.00202885340f, -0.00221111765f, -0.00224508205f, -0.00212280499f, -0.00184705330f,
+   -0.00143149949f, -0.000900155457f, -0.000286089315f, 0.000370613212f, 0.00102539861f, 0.00163219857f,
+   0.00214666710f, 0.00252934615f, 0.00274858950f, 0.00278311991f, 0.00262387190f, 0.00227508228f,
+   0.00175445480f, 0.00109238899f, 0.000330325187f, -0.000481829455f, -0.00128889096f, -0.00203406531f,
+   -0.00266294950f, -0.00312738307f, -0.00338906050f, -0.00342259277f, -0.00321771088f, -0.00278053083f,
+   -0.00213367050f, -0.00131523830f, -0.000376673270f, 0.000620366191f, 0.00160804891f, 0.00251689460f,
+   0.00328055117f, 0.00384062808f, 0.00415102020f, 0.00418155827f, 0.00392067851f, 0.00337683596f,
+   0.00257861521f, 0.00157335878f, 0.000424483791f, -0.000792380190f, -0.00199436932f, -0.00309690437f,
+   -0.00401952770f, -0.00469175167f, -0.00505827460f, -0.00508335745f, -0.00475399103f, -0.00408152584f,
+   -0.00310171722f, -0.00187297270f, -0.000473016582f, 0.00100585946f, 0.00246287673f, 0.00379548874f,
+   0.00490645831f, 0.00571092078f, 0.00614266144f, 0.00615935121f, 0.00574631151f, 0.00491839973f,
+   0.00371997873f, 0.00222271262f, 0.000521458511f, -0.00127154065f, -0.00303404802f, -0.00464198785f,
+   -0.00597800035f, -0.00693996251f, -0.00744853728f, -0.00745345233f, -0.00693798298f, -0.00592115987f,
+   -0.00445766561f, -0.00263509643f, -0.000568942458f, 0.00160447659f, 0.00373698305f, 0.00567841250f,
+   0.00728695793f, 0.00843945332f, 0.00904048234f, 0.00902993139f, 0.00838837493f, 0.00713970978f,
+   0.00535098743f, 0.00312908087f, 0.000614602410f, -0.00202680728f, -0.00461505819f, -0.00696785515f,
+   -0.00891314168f, -0.0103014810f, -0.0110172108f, -0.0109875770f, -0.0101892715f, -0.00865168683f,
+   -0.00645670621f, -0.00373477954f, -0.000657467637f, 0.00257296627f, 0.00573658478f, 0.00861048512f,
+   0.0109840510f, 0.0126740625f, 0.0135383653f, 0.0134871295f, 0.0124909431f, 0.0105850361f,
+   0.00786913279f, 0.00450281007f, 0.000696718402f, -0.00330017135f, -0.00721645914f, -0.0107761147f,
+   -0.0137174651f, -0.0158118438f, -0.0168805365f, -0.0168090630f, -0.0155575871f, -0.0131664844f,
+   -0.00975672994f, -0.00552464928f, -0.000731512730f, 0.00431189081f, 0.00926472154f, 0.0137781110f,
+   0.0175188910f, 0.0201931633f, 0.0215679593f, 0.0214899871f, 0.0198994502f, 0.0168382451f,
+   0.0124516347f, 0.00698284851f, 0.000761135423f, -0.00581694860f, -0.0123111373f, -0.0182654224f,
+   -0.0232382510f, -0.0268330425f, -0.0287273508f, -0.0286983084f, -0.0266427081f, -0.0225902181f,
+   -0.0167083945f, -0.00929892436f, -0.000784847420f, 0.00831069518f, 0.0173935741f, 0.0258337166f,
+   0.0330042839f, 0.0383232683f, 0.0412939526f, 0.0415425599f, 0.0388503410f, 0.0331777744f,
+   0.0246792939f, 0.0137068853f, 0.000802222930f, -0.0133230090f, -0.0278175846f, -0.0417312458f,
+   -0.0540627502f, -0.0638131648f, -0.0700416639f, -0.0719205216f, -0.0687864423f, -0.0601849295f,
+   -0.0459052920f, -0.0260036308f, -0.000812793907f, 0.0290624145f, 0.0627638474f, 0.0992131084f,
+   0.137156591f, 0.175220549f, 0.211973786f, 0.245994464f, 0.275937527f, 0.300599664f,
+   0.318977475f, 0.330316782f, 0.334149659f, 0.330316782f, 0.318977475f, 0.300599664f,
+   0.275937527f, 0.245994464f, 0.211973786f, 0.175220549f, 0.137156591f, 0.0992131084f,
+   0.0627638474f, 0.0290624145f, -0.000812793907f, -0.0260036308f, -0.0459052920f, -0.0601849295f,
+   -0.0687864423f, -0.0719205216f, -0.0700416639f, -0.0638131648f, -0.0540627502f, -0.0417312458f,
+   -0.0278175846f, -0.0133230090f, 0.000802222930f, 0.0137068853f, 0.0246792939f, 0.0331777744f,
+   0.0388503410f, 0.0415425599f, 0.0412939526f, 0.0383232683f, 0.0330042839f, 0.0258337166f,
+   0.0173935741f, 0.00831069518f, -0.000784847420f, -0.00929892436f, -0.0167083945f, -0.0225902181f,
+   -0.0266427081f, -0.0286983084f, -0.0287273508f, -0.0268330425f, -0.0232382510f, -0.0182654224f,
+   -0.0123111373f, -0.00581694860f, 0.000761135423f, 0.00698284851f, 0.0124516347f, 0.0168382451f,
+   0.0198994502f, 0.0214899871f, 0.0215679593f, 0.0201931633f, 0.0175188910f, 0.0137781110f,
+   0.00926472154f, 0.00431189081f, -0.000731512730f, -0.00552464928f, -0.00975672994f, -0.0131664844f,
+   -0.0155575871f, -0.0168090630f, -0.0168805365f, -0.0158118438f, -0.0137174651f, -0.0107761147f,
+   -0.00721645914f, -0.00330017135f, 0.000696718402f, 0.00450281007f, 0.00786913279f, 0.0105850361f,
+   0.0124909431f, 0.0134871295f, 0.0135383653f, 0.0126740625f, 0.0109840510f, 0.00861048512f,
+   0.00573658478f, 0.00257296627f, -0.000657467637f, -0.00373477954f, -0.00645670621f, -0.00865168683f,
+   -0.0101892715f, -0.0109875770f, -0.0110172108f, -0.0103014810f, -0.00891314168f, -0.00696785515f,
+   -0.00461505819f, -0.00202680728f, 0.000614602410f, 0.00312908087f, 0.00535098743f, 0.00713970978f,
+   0.00838837493f, 0.00902993139f, 0.00904048234f, 0.00843945332f, 0.00728695793f, 0.00567841250f,
+   0.00373698305f, 0.00160447659f, -0.000568942458f, -0.00263509643f, -0.00445766561f, -0.00592115987f,
+   -0.00693798298f, -0.00745345233f, -0.00744853728f, -0.00693996251f, -0.00597800035f, -0.00464198785f,
+   -0.00303404802f, -0.00127154065f, 0.000521458511f, 0.00222271262f, 0.00371997873f, 0.00491839973f,
+   0.00574631151f, 0.00615935121f, 0.00614266144f, 0.00571092078f, 0.00490645831f, 0.00379548874f,
+   0.00246287673f, 0.00100585946f, -0.000473016582f, -0.00187297270f, -0.00310171722f, -0.00408152584f,
+   -0.00475399103f, -0.00508335745f, -0.00505827460f, -0.00469175167f, -0.00401952770f, -0.00309690437f,
+   -0.00199436932f, -0.000792380190f, 0.000424483791f, 0.00157335878f, 0.00257861521f, 0.00337683596f,
+   0.00392067851f, 0.00418155827f, 0.00415102020f, 0.00384062808f, 0.00328055117f, 0.00251689460f,
+   0.00160804891f, 0.000620366191f, -0.000376673270f, -0.00131523830f, -0.00213367050f, -0.00278053083f,
+   -0.00321771088f, -0.00342259277f, -0.00338906050f, -0.00312738307f, -0.00266294950f, -0.00203406531f,
+   -0.00128889096f, -0.000481829455f, 0.000330325187f, 0.00109238899f, 0.00175445480f, 0.00227508228f,
+   0.00262387190f, 0.00278311991f, 0.00274858950f, 0.00252934615f, 0.00214666710f, 0.00163219857f,
+   0.00102539861f, 0.000370613212f, -0.000286089315f, -0.000900155457f, -0.00143149949f, -0.00184705330f,
+   -0.00212280499f, -0.00224508205f, -0.00221111765f, -0.00202885340f, -0.00171601470f, -0.00129853981f,
+   -0.000808527402f, -0.000281828048f, 0.000244518102f, 0.000734849076f, 0.00115729566f, 0.00148573762f,
+   0.00170144031f, 0.00179400051f, 0.00176177465f, 0.00161166303f, 0.00135829032f, 0.00102275715f,
+   0.000630921335f, 0.000211497027f, -0.000206023935f, -0.000593441422f, -0.000925661472f, -0.00118231599f,
+   -0.00134898105f, -0.00141788961f, -0.00138823828f, -0.00126593024f, -0.00106293603f, -0.000796240813f,
+   -0.000486460223f, -0.000156327922f, 0.000170953383f, 0.000473334978f, 0.000731334032f, 0.000929282513f,
+   0.00105624809f, 0.00110656698f, 0.00108000881f, 0.000981581630f, 0.000820969988f, 0.000611683528f,
+   0.000369958725f, 0.000113561553f, -0.000139497526f, -0.000372221635f, -0.000569709518f, -0.000720100361f,
+   -0.000815267325f, -0.000851169403f, -0.000827980402f, -0.000749884755f, -0.000624614710f, -0.000462772849f,
+   -0.000276964478f, -8.08697732e-05f, 0.000111747300f, 0.000287996081f, 0.000436673959f, 0.000548974494f,
+   0.000618971593f, 0.000643885112f, 0.000624136708f, 0.000563165697f, 0.000467056409f, 0.000343999651f,
+   0.000203623931f, 5.62833957e-05f, -8.76900085e-05f, -0.000218702713f, -0.000328503753f, -0.000410687237f,
+   -0.000461048912f, -0.000477754191f, -0.000461354299f, -0.000414628448f, -0.000342281564f, -0.000250529614f,
+   -0.000146588180f, -3.81401369e-05f, 6.72198294e-05f, 0.000162509779f, 0.000241790214f, 0.000300525193f,
+   0.000335823919f, 0.000346542685f, 0.000333278527f, 0.000298231491f, 0.000244969968f, 0.000178112168f,
+   0.000102947561f, 2.50442517e-05f, -5.01519171e-05f, -0.000117690368f, -0.000173416265f, -0.000214218438f,
+   -0.000238185807f, -0.000244665251f, -0.000234238134f, -0.000208608253f, -0.000170418978f, -0.000123018355f,
+   -7.01820391e-05f, -1.58343482e-05f, 3.62353712e-05f, 8.26268515e-05f, 0.000120534147f, 0.000147906656f,
+   0.000163546065f, 0.000167131569f, 0.000159191026f, 0.000141009019f, 0.000114491137f, 8.19924098e-05f,
+   4.61234376e-05f, 9.55480482e-06f, -2.51713282e-05f, -5.58122920e-05f, -8.05559685e-05f, -9.81205449e-05f,
+   -0.000107808271f, -0.000109511806f, -0.000103682527f, -9.12599426e-05f, -7.35717040e-05f, -5.22146329e-05f,
+   -2.89211148e-05f, -5.43171518e-06f, 1.66284117e-05f, 3.58565121e-05f, 5.11511680e-05f, 6.17685437e-05f,
+   6.73484028e-05f, 6.79081204e-05f, 6.38139536e-05f, 5.57270541e-05f, 4.45341611e-05f, 3.12664306e-05f,
+   1.70152307e-05f, 2.84979478e-06f, -1.02581535e-05f, -2.14936117e-05f, -3.02441858e-05f, -3.61272396e-05f,
+   -3.89960405e-05f, -3.89308188e-05f, -3.62125502e-05f, -3.12840602e-05f, -2.47058142e-05f, -1.71015345e-05f,
+   -9.10848576e-06f, -1.32925084e-06f, 5.70959492e-06f, 1.15879393e-05f, 1.60132658e-05f, 1.88298636e-05f,
+   2.00160812e-05f, 1.96725450e-05f, 1.80009429e-05f, 1.52810717e-05f, 1.18382886e-05f, 8.01436636e-06f,
+   4.13945918e-06f, 5.07688640e-07f, -2.64217920e-06f, -5.13879240e-06f, -6.88426417e-06f, -7.85352495e-06f,
+   -8.08726054e-06f, 0.00000000f, 0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_39[968] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, 2.83857685e-06f, 4.51104313e-07f,
+   -2.29772695e-06f, -5.31509249e-06f, -8.48347190e-06f, -1.16648325e-05f, -1.47052606e-05f, -1.74411671e-05f,
+   -1.97068257e-05f, -2.13423227e-05f, -2.22018552e-05f, -2.21623977e-05f, -2.11317001e-05f, -1.90555929e-05f,
+   -1.59237588e-05f, -1.17748250e-05f, -6.69766223e-06f, -8.33334468e-07f, 5.62887681e-06f, 1.24557164e-05f,
+   1.93763262e-05f, 2.60927663e-05f, 3.22909509e-05f, 3.76531170e-05f, 4.18732234e-05f, 4.46707636e-05f,
+   4.58059767e-05f, 4.50933039e-05f, 4.24146019e-05f, 3.77286742e-05f, 3.10792238e-05f, 2.25994972e-05f,
+   1.25129845e-05f, 1.12934651e-06f, -1.11627232e-05f, -2.39072760e-05f, -3.65948326e-05f, -4.86833451e-05f,
+   -5.96180616e-05f, -6.88544169e-05f, -7.58837123e-05f, -8.02567738e-05f, -8.16071552e-05f, -7.96727327e-05f,
+   -7.43138880e-05f, -6.55271724e-05f, -5.34535102e-05f, -3.83838815e-05f, -2.07531139e-05f, -1.13200804e-06f,
+   1.97887948e-05f, 4.12215159e-05f, 6.23063461e-05f, 8.21472131e-05f, 9.98457108e-05f, 0.000114537390f,
+   0.000125433740f, 0.000131857159f, 0.000133277295f, 0.000129340726f, 0.000119897879f, 0.000105019033f,
+   8.50031356e-05f, 6.03821645e-05f, 3.19067549e-05f, 5.29984561e-07f, -3.26222289e-05f, -6.62896055e-05f,
+   -9.91187117e-05f, -0.000129720676f, -0.000156723167f, -0.000178827206f, -0.000194868684f, -0.000203871445f,
+   -0.000205097327f, -0.000198089692f, -0.000182708434f, -0.000159146730f, -0.000127944048f, -8.99834340e-05f,
+   -4.64665500e-05f, 1.11647785e-06f, 5.10348909e-05f, 0.000101378355f, 0.000150121021f, 0.000195207977f,
+   0.000234633684f, 0.000266523421f, 0.000289224001f, 0.000301376334f, 0.000301987486f, 0.000290488591f,
+   0.000266774383f, 0.000231233134f, 0.000184750126f, 0.000128701591f, 6.49103822e-05f, -4.40150689e-06f,
+   -7.66875164e-05f, -0.000149167914f, -0.000218924048f, -0.000283024739f, -0.000338636804f, -0.000383142382f,
+   -0.000414262700f, -0.000430160580f, -0.000429537642f, -0.000411699642f, -0.000376625278f, -0.000324985944f,
+   -0.000258149783f, -0.000178162576f, -8.76811755e-05f, 1.01012383e-05f, 0.000111563808f, 0.000212790153f,
+   0.000309703231f, 0.000398241420f, 0.000474514032f, 0.000534959428f, 0.000576516846f, 0.000596763857f,
+   0.000594029378f, 0.000567503797f, 0.000517304696f, 0.000444504229f, 0.000351121533f, 0.000240092180f,
+   0.000115165276f, -1.92032585e-05f, -0.000158006631f, -0.000295871636f, -0.000427244609f, -0.000546633906f,
+   -0.000648817746f, -0.000729059626f, -0.000783338328f, -0.000808508252f, -0.000802478695f, -0.000764327589f,
+   -0.000694391609f, -0.000594287063f, -0.000466894708f, -0.000316304388f, -0.000147671148f, 3.29382892e-05f,
+   0.000218759436f, 0.000402581907f, 0.000577001541f, 0.000734742614f, 0.000868936360f, 0.000973406772f,
+   0.00104294741f, 0.00107356627f, 0.00106268423f, 0.00100928801f, 0.000914031174f, 0.000779255934f,
+   0.000608955743f, 0.000408695720f, 0.000185408178f, -5.28152523e-05f, -0.000297014194f, -0.000537695305f,
+   -0.000765164732f, -0.000969953893f, -0.00114318472f, -0.00127691485f, -0.00136453356f, -0.00140104047f,
+   -0.00138330762f, -0.00131025806f, -0.00118299166f, -0.00100479193f, -0.000781070790f, -0.000519245747f,
+   -0.000228467936f, 8.06613898e-05f, 0.000396472926f, 0.000706669700f, 0.000998761272f, 0.00126061682f,
+   0.00148090918f, 0.00164959428f, 0.00175838172f, 0.00180109637f, 0.00177399267f, 0.00167597889f,
+   0.00150875363f, 0.00127680751f, 0.000987327425f, 0.000650032773f, 0.000276807143f, -0.000118670912f,
+   -0.000521427137f, -0.000915759185f, -0.00128579757f, -0.00161618763f, -0.00189268647f, -0.00210273848f,
+   -0.00223607640f, -0.00228515756f, -0.00224555773f, -0.00211622799f, -0.00189965998f, -0.00160185876f,
+   -0.00123221381f, -0.000803266477f, -0.000330235343f, 0.000169466715f, 0.000676869939f, 0.00117217505f,
+   0.00163544482f, 0.00204748847f, 0.00239058700f, 0.00264922064f, 0.00281080068f, 0.00286621321f,
+   0.00281028403f, 0.00264209136f, 0.00236514397f, 0.00198733341f, 0.00152074418f, 0.000981351826f,
+   0.000388405548f, -0.000236183769f, -0.000868665753f, -0.00148430490f, -0.00205835560f, -0.00256705703f,
+   -0.00298858061f, -0.00330393156f, -0.00349780358f, -0.00355927786f, -0.00348236365f, -0.00326637086f,
+   -0.00291609229f, -0.00244173547f, -0.00185867341f, -0.00118699134f, -0.000450811378f, 0.000322586711f,
+   0.00110373832f, 0.00186206901f, 0.00256710313f, 0.00318969111f, 0.00370316650f, 0.00408445299f,
+   0.00431509363f, 0.00438209949f, 0.00427858764f, 0.00400421908f, 0.00356539036f, 0.00297513301f,
+   0.00225277175f, 0.00142335310f, 0.000516789500f, -0.000433238252f, -0.00139047555f, -0.00231743185f,
+   -0.00317686121f, -0.00393326115f, -0.00455428287f, -0.00501207216f, -0.00528451009f, -0.00535623170f,
+   -0.00521937525f, -0.00487409579f, -0.00432876870f, -0.00359983603f, -0.00271136523f, -0.00169432885f,
+   -0.000585523783f, 0.000573757919f, 0.00173921953f, 0.00286519108f, 0.00390643394f, 0.00481996220f,
+   0.00556675019f, 0.00611334434f, 0.00643336028f, 0.00650868891f, 0.00633038580f, 0.00589926168f,
+   0.00522610359f, 0.00433145510f, 0.00324505661f, 0.00200492679f, 0.000656062737f, -0.000751217944f,
+   -0.00216308888f, -0.00352419959f, -0.00477986410f, -0.00587826315f, -0.00677249813f, -0.00742253335f,
+   -0.00779697997f, -0.00787453540f, -0.00764502725f, -0.00711010303f, -0.00628346112f, -0.00519056153f,
+   -0.00386790093f, -0.00236191065f, -0.000727337087f, 0.000974772498f, 0.00267926930f, 0.00431930693f,
+   0.00582898501f, 0.00714600086f, 0.00821411889f, 0.00898549892f, 0.00942282658f, 0.00950102322f,
+   0.00920848362f, 0.00854787324f, 0.00753638335f, 0.00620533852f, 0.00459932350f, 0.00277480925f,
+   0.000798184192f, -0.00125668617f, -0.00331112207f, -0.00528453197f, -0.00709759630f, -0.00867546070f,
+   -0.00995069742f, -0.0108660981f, -0.0113772219f, -0.0114544341f, -0.0110843722f, -0.0102708908f,
+   -0.00903532840f, -0.00741603598f, -0.00546728447f, -0.00325760012f, -0.000867376337f, 0.00161407830f,
+   0.00409175409f, 0.00646844041f, 0.00864856225f, 0.0105420221f, 0.0120677650f, 0.0131571321f,
+   0.0137569206f, 0.0138318334f, 0.0133662270f, 0.0123652490f, 0.0108551439f, 0.00888267346f,
+   0.00651379488f, 0.00383164408f, 0.000933653384f, -0.00207203766f, -0.00507034687f, -0.00794368237f,
+   -0.0105764531f, -0.0128596257f, -0.0146951452f, -0.0160000324f, -0.0167099889f, -0.0167823583f,
+   -0.0161983594f, -0.0149643784f, -0.0131123541f, -0.0106991725f, -0.00780507643f, -0.00453112042f,
+   -0.000995757058f, 0.00266933581f, 0.00632405095f, 0.00982509367f, 0.0130314790f, 0.0158100799f,
+   0.0180410109f, 0.0196226332f, 0.0204759706f, 0.0205484107f, 0.0198163968f, 0.0182871241f,
+   0.0159990638f, 0.0130212996f, 0.00945165567f, 0.00541366590f, 0.00105246727f, -0.00347025087f,
+   -0.00798207242f, -0.0123062497f, -0.0162684415f, -0.0197035335f, -0.0224622972f, -0.0244175922f,
+   -0.0254699681f, -0.0255522449f, -0.0246330313f, -0.0227189753f, -0.0198555905f, -0.0161266271f,
+   -0.0116519434f, -0.00658394024f, -0.00110263738f, 0.00459044939f, 0.0102794366f, 0.0157419555f,
+   0.0207575280f, 0.0251161028f, 0.0286264420f, 0.0311241373f, 0.0324787013f, 0.0325996689f,
+   0.0314413644f, 0.0290060788f, 0.0253455676f, 0.0205606800f, 0.0147991460f, 0.00825149287f,
+   0.00114522956f, -0.00626257062f, -0.0136940414f, -0.0208603721f, -0.0274724085f, -0.0332515724f,
+   -0.0379409380f, -0.0413156450f, -0.0431926474f, -0.0434391573f, -0.0419796109f, -0.0388006717f,
+   -0.0339541957f, -0.0275578462f, -0.0197933260f, -0.0109021980f, -0.00117934588f, 0.00903575774f,
+   0.0193697494f, 0.0294277202f, 0.0388067774f, 0.0471106432f, 0.0539643280f, 0.0590288453f,
+   0.0620151684f, 0.0626970679f, 0.0609222464f, 0.0566214435f, 0.0498149954f, 0.0406166650f,
+   0.0292344298f, 0.0159681849f, 0.00120425702f, -0.0145931449f, -0.0308933537f, -0.0471132174f,
+   -0.0626335144f, -0.0768168792f, -0.0890270472f, -0.0986487642f, -0.105107710f, -0.107889816f,
+   -0.106559329f, -0.100775100f, -0.0903044194f, -0.0750340000f, -0.0549777076f, -0.0302806348f,
+   -0.00121942430f, 0.0318013057f, 0.0682562739f, 0.107510880f, 0.148835614f, 0.191423669f,
+   0.234411046f, 0.276898682f, 0.317975879f, 0.356744498f, 0.392342985f, 0.423969716f,
+   0.450904906f, 0.472530305f, 0.488346338f, 0.497985899f, 0.501224518f, 0.497985899f,
+   0.488346338f, 0.472530305f, 0.450904906f, 0.423969716f, 0.392342985f, 0.356744498f,
+   0.317975879f, 0.276898682f, 0.234411046f, 0.191423669f, 0.148835614f, 0.107510880f,
+   0.0682562739f, 0.0318013057f, -0.00121942430f, -0.0302806348f, -0.0549777076f, -0.0750340000f,
+   -0.0903044194f, -0.100775100f, -0.106559329f, -0.107889816f, -0.105107710f, -0.0986487642f,
+   -0.0890270472f, -0.0768168792f, -0.0626335144f, -0.0471132174f, -0.0308933537f, -0.0145931449f,
+   0.00120425702f, 0.0159681849f, 0.0292344298f, 0.0406166650f, 0.0498149954f, 0.0566214435f,
+   0.0609222464f, 0.0626970679f, 0.0620151684f, 0.0590288453f, 0.0539643280f, 0.0471106432f,
+   0.0388067774f, 0.0294277202f, 0.0193697494f, 0.00903575774f, -0.00117934588f, -0.0109021980f,
+   -0.0197933260f, -0.0275578462f, -0.0339541957f, -0.0388006717f, -0.0419796109f, -0.0434391573f,
+   -0.0431926474f, -0.0413156450f, -0.0379409380f, -0.0332515724f, -0.0274724085f, -0.0208603721f,
+   -0.0136940414f, -0.00626257062f, 0.00114522956f, 0.00825149287f, 0.0147991460f, 0.0205606800f,
+   0.0253455676f, 0.0290060788f, 0.0314413644f, 0.0325996689f, 0.0324787013f, 0.0311241373f,
+   0.0286264420f, 0.0251161028f, 0.0207575280f, 0.0157419555f, 0.0102794366f, 0.00459044939f,
+   -0.00110263738f, -0.00658394024f, -0.0116519434f, -0.0161266271f, -0.0198555905f, -0.0227189753f,
+   -0.0246330313f, -0.0255522449f, -0.0254699681f, -0.0244175922f, -0.0224622972f, -0.0197035335f,
+   -0.0162684415f, -0.0123062497f, -0.00798207242f, -0.00347025087f, 0.00105246727f, 0.00541366590f,
+   0.00945165567f, 0.0130212996f, 0.0159990638f, 0.0182871241f, 0.0198163968f, 0.0205484107f,
+   0.0204759706f, 0.0196226332f, 0.0180410109f, 0.0158100799f, 0.0130314790f, 0.00982509367f,
+   0.00632405095f, 0.00266933581f, -0.000995757058f, -0.00453112042f, -0.00780507643f, -0.0106991725f,
+   -0.0131123541f, -0.0149643784f, -0.0161983594f, -0.0167823583f, -0.0167099889f, -0.0160000324f,
+   -0.0146951452f, -0.0128596257f, -0.0105764531f, -0.00794368237f, -0.00507034687f, -0.00207203766f,
+   0.000933653384f, 0.00383164408f, 0.00651379488f, 0.00888267346f, 0.0108551439f, 0.0123652490f,
+   0.0133662270f, 0.0138318334f, 0.0137569206f, 0.0131571321f, 0.0120677650f, 0.0105420221f,
+   0.00864856225f, 0.00646844041f, 0.00409175409f, 0.00161407830f, -0.000867376337f, -0.00325760012f,
+   -0.00546728447f, -0.00741603598f, -0.00903532840f, -0.0102708908f, -0.0110843722f, -0.0114544341f,
+   -0.0113772219f, -0.0108660981f, -0.00995069742f, -0.00867546070f, -0.00709759630f, -0.00528453197f,
+   -0.00331112207f, -0.00125668617f, 0.000798184192f, 0.00277480925f, 0.00459932350f, 0.00620533852f,
+   0.00753638335f, 0.00854787324f, 0.00920848362f, 0.00950102322f, 0.00942282658f, 0.00898549892f,
+   0.00821411889f, 0.00714600086f, 0.00582898501f, 0.00431930693f, 0.00267926930f, 0.000974772498f,
+   -0.000727337087f, -0.00236191065f, -0.00386790093f, -0.00519056153f, -0.00628346112f, -0.00711010303f,
+   -0.00764502725f, -0.00787453540f, -0.00779697997f, -0.00742253335f, -0.00677249813f, -0.00587826315f,
+   -0.00477986410f, -0.00352419959f, -0.00216308888f, -0.000751217944f, 0.000656062737f, 0.00200492679f,
+   0.00324505661f, 0.00433145510f, 0.00522610359f, 0.00589926168f, 0.00633038580f, 0.00650868891f,
+   0.00643336028f, 0.00611334434f, 0.00556675019f, 0.00481996220f, 0.00390643394f, 0.00286519108f,
+   0.00173921953f, 0.000573757919f, -0.000585523783f, -0.00169432885f, -0.00271136523f, -0.00359983603f,
+   -0.00432876870f, -0.00487409579f, -0.00521937525f, -0.00535623170f, -0.00528451009f, -0.00501207216f,
+   -0.00455428287f, -0.00393326115f, -0.00317686121f, -0.00231743185f, -0.00139047555f, -0.000433238252f,
+   0.000516789500f, 0.00142335310f, 0.00225277175f, 0.00297513301f, 0.00356539036f, 0.00400421908f,
+   0.00427858764f, 0.00438209949f, 0.00431509363f, 0.00408445299f, 0.00370316650f, 0.00318969111f,
+   0.00256710313f, 0.00186206901f, 0.00110373832f, 0.000322586711f, -0.000450811378f, -0.00118699134f,
+   -0.00185867341f, -0.00244173547f, -0.00291609229f, -0.00326637086f, -0.00348236365f, -0.00355927786f,
+   -0.00349780358f, -0.00330393156f, -0.00298858061f, -0.00256705703f, -0.00205835560f, -0.00148430490f,
+   -0.000868665753f, -0.000236183769f, 0.000388405548f, 0.000981351826f, 0.00152074418f, 0.00198733341f,
+   0.00236514397f, 0.00264209136f, 0.00281028403f, 0.00286621321f, 0.00281080068f, 0.00264922064f,
+   0.00239058700f, 0.00204748847f, 0.00163544482f, 0.00117217505f, 0.000676869939f, 0.000169466715f,
+   -0.000330235343f, -0.000803266477f, -0.00123221381f, -0.00160185876f, -0.00189965998f, -0.00211622799f,
+   -0.00224555773f, -0.00228515756f, -0.00223607640f, -0.00210273848f, -0.00189268647f, -0.00161618763f,
+   -0.00128579757f, -0.000915759185f, -0.000521427137f, -0.000118670912f, 0.000276807143f, 0.000650032773f,
+   0.000987327425f, 0.00127680751f, 0.00150875363f, 0.00167597889f, 0.00177399267f, 0.00180109637f,
+   0.00175838172f, 0.00164959428f, 0.00148090918f, 0.00126061682f, 0.000998761272f, 0.000706669700f,
+   0.000396472926f, 8.06613898e-05f, -0.000228467936f, -0.000519245747f, -0.000781070790f, -0.00100479193f,
+   -0.00118299166f, -0.00131025806f, -0.00138330762f, -0.00140104047f, -0.00136453356f, -0.00127691485f,
+   -0.00114318472f, -0.000969953893f, -0.000765164732f, -0.000537695305f, -0.000297014194f, -5.28152523e-05f,
+   0.000185408178f, 0.000408695720f, 0.000608955743f, 0.000779255934f, 0.000914031174f, 0.00100928801f,
+   0.00106268423f, 0.00107356627f, 0.00104294741f, 0.000973406772f, 0.000868936360f, 0.000734742614f,
+   0.000577001541f, 0.000402581907f, 0.000218759436f, 3.29382892e-05f, -0.000147671148f, -0.000316304388f,
+   -0.000466894708f, -0.000594287063f, -0.000694391609f, -0.000764327589f, -0.000802478695f, -0.000808508252f,
+   -0.000783338328f, -0.000729059626f, -0.000648817746f, -0.000546633906f, -0.000427244609f, -0.000295871636f,
+   -0.000158006631f, -1.92032585e-05f, 0.000115165276f, 0.000240092180f, 0.000351121533f, 0.000444504229f,
+   0.000517304696f, 0.000567503797f, 0.000594029378f, 0.000596763857f, 0.000576516846f, 0.000534959428f,
+   0.000474514032f, 0.000398241420f, 0.000309703231f, 0.000212790153f, 0.000111563808f, 1.01012383e-05f,
+   -8.76811755e-05f, -0.000178162576f, -0.000258149783f, -0.000324985944f, -0.000376625278f, -0.000411699642f,
+   -0.000429537642f, -0.000430160580f, -0.000414262700f, -0.000383142382f, -0.000338636804f, -0.000283024739f,
+   -0.000218924048f, -0.000149167914f, -7.66875164e-05f, -4.40150689e-06f, 6.49103822e-05f, 0.000128701591f,
+   0.000184750126f, 0.000231233134f, 0.000266774383f, 0.000290488591f, 0.000301987486f, 0.000301376334f,
+   0.000289224001f, 0.000266523421f, 0.000234633684f, 0.000195207977f, 0.000150121021f, 0.000101378355f,
+   5.10348909e-05f, 1.11647785e-06f, -4.64665500e-05f, -8.99834340e-05f, -0.000127944048f, -0.000159146730f,
+   -0.000182708434f, -0.000198089692f, -0.000205097327f, -0.000203871445f, -0.000194868684f, -0.000178827206f,
+   -0.000156723167f, -0.000129720676f, -9.91187117e-05f, -6.62896055e-05f, -3.26222289e-05f, 5.29984561e-07f,
+   3.19067549e-05f, 6.03821645e-05f, 8.50031356e-05f, 0.000105019033f, 0.000119897879f, 0.000129340726f,
+   0.000133277295f, 0.000131857159f, 0.000125433740f, 0.000114537390f, 9.98457108e-05f, 8.21472131e-05f,
+   6.23063461e-05f, 4.12215159e-05f, 1.97887948e-05f, -1.13200804e-06f, -2.07531139e-05f, -3.83838815e-05f,
+   -5.34535102e-05f, -6.55271724e-05f, -7.43138880e-05f, -7.96727327e-05f, -8.16071552e-05f, -8.02567738e-05f,
+   -7.58837123e-05f, -6.88544169e-05f, -5.96180616e-05f, -4.86833451e-05f, -3.65948326e-05f, -2.39072760e-05f,
+   -1.11627232e-05f, 1.12934651e-06f, 1.25129845e-05f, 2.25994972e-05f, 3.10792238e-05f, 3.77286742e-05f,
+   4.24146019e-05f, 4.50933039e-05f, 4.58059767e-05f, 4.46707636e-05f, 4.18732234e-05f, 3.76531170e-05f,
+   3.22909509e-05f, 2.60927663e-05f, 1.93763262e-05f, 1.24557164e-05f, 5.62887681e-06f, -8.33334468e-07f,
+   -6.69766223e-06f, -1.17748250e-05f, -1.59237588e-05f, -1.90555929e-05f, -2.11317001e-05f, -2.21623977e-05f,
+   -2.22018552e-05f, -2.13423227e-05f, -1.97068257e-05f, -1.74411671e-05f, -1.47052606e-05f, -1.16648325e-05f,
+   -8.48347190e-06f, -5.31509249e-06f, -2.29772695e-06f, 4.51104313e-07f, 2.83857685e-06f, 0.00000000f,
+   0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_40[712] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, -1.61745211e-05f, -1.57070499e-05f,
+   -1.37685283e-05f, -1.02775848e-05f, -5.28435839e-06f, 1.01537728e-06f, 8.27891836e-06f, 1.60287327e-05f,
+   2.36765773e-05f, 3.05621434e-05f, 3.60018857e-05f, 3.93450900e-05f, 4.00321624e-05f, 3.76597272e-05f,
+   3.20265317e-05f, 2.31758786e-05f, 1.14191898e-05f, -2.65850167e-06f, -1.82169715e-05f, -3.42030689e-05f,
+   -4.94116284e-05f, -6.25681205e-05f, -7.24251004e-05f, -7.78616377e-05f, -7.79920811e-05f, -7.22544792e-05f,
+   -6.04883717e-05f, -4.29872234e-05f, -2.05163069e-05f, 5.69958956e-06f, 3.40304614e-05f, 6.25328612e-05f,
+   8.90683223e-05f, 0.000111454108f, 0.000127627907f, 0.000135816241f, 0.000134696806f, 0.000123537087f,
+   0.000102302336f, 7.17130242e-05f, 3.32568234e-05f, -1.08634304e-05f, -5.78422296e-05f, -0.000104429266f,
+   -0.000147143408f, -0.000182519885f, -0.000207365054f, -0.000219023612f, -0.000215616543f, -0.000196241090f,
+   -0.000161111937f, -0.000111624584f, -5.03426563e-05f, 1.91096096e-05f, 9.22468753e-05f, 0.000163984820f,
+   0.000228982273f, 0.000282018038f, 0.000318382052f, 0.000334263139f, 0.000327092130f, 0.000295813312f,
+   0.000241068294f, 0.000165253703f, 7.24707425e-05f, -3.16686965e-05f, -0.000140364078f, -0.000246036710f,
+   -0.000340837956f, -0.000417216506f, -0.000468476268f, -0.000489330501f, -0.000476371613f, -0.000428436877f,
+   -0.000346832530f, -0.000235380736f, -0.000100303834f, 5.00885035e-05f, 0.000205895121f, 0.000356224336f,
+   0.000489939936f, 0.000596462982f, 0.000666557055f, 0.000693085371f, 0.000671647838f, 0.000601050386f,
+   0.000483580428f, 0.000325019559f, 0.000134439659f, -7.62802738e-05f, -0.000293176359f, -0.000501059229f,
+   -0.000684563129f, -0.000829256896f, -0.000922708597f, -0.000955508382f, -0.000922097825f, -0.000821374473f,
+   -0.000657007506f, -0.000437405426f, -0.000175380017f, 0.000112566791f, 0.000407247862f, 0.000687999302f,
+   0.000934112817f, 0.00112633139f, 0.00124827342f, 0.00128777022f, 0.00123794319f, 0.00109794899f,
+   0.000873347919f, 0.000575992162f, 0.000223494601f, -0.000161739546f, -0.000553928956f, -0.000925545697f,
+   -0.00124922942f, -0.00149976951f, -0.00165596080f, -0.00170233881f, -0.00163053465f, -0.00144020072f,
+   -0.00113941904f, -0.000744443270f, -0.000278995052f, 0.000227123106f, 0.000739917450f, 0.00122336706f,
+   0.00164193998f, 0.00196316326f, 0.00216001761f, 0.00221313396f, 0.00211249618f, 0.00185856503f,
+   0.00146266806f, 0.000946669956f, 0.000341906765f, -0.000312655844f, -0.000972920447f, -0.00159248163f,
+   -0.00212587207f, -0.00253186049f, -0.00277647655f, -0.00283577922f, -0.00269796210f, -0.00236463198f,
+   -0.00185132294f, -0.00118688284f, -0.000412047870f, 0.000422994053f, 0.00126184267f, 0.00204551429f,
+   0.00271658064f, 0.00322332606f, 0.00352354930f, 0.00358800101f, 0.00340288063f, 0.00297147525f,
+   0.00231459131f, 0.00146969815f, 0.000489036203f, -0.000563656096f, -0.00161705480f, -0.00259707961f,
+   -0.00343202939f, -0.00405770680f, -0.00442223530f, -0.00449016411f, -0.00424560998f, -0.00369410659f,
+   -0.00286299898f, -0.00180031091f, -0.000572178629f, 0.000741226424f, 0.00205079722f, 0.00326439715f,
+   0.00429333420f, 0.00505869230f, 0.00549717899f, 0.00556623982f, 0.00524774380f, 0.00455016457f,
+   0.00350890961f, 0.00218477799f, 0.000660650374f, -0.000963658909f, -0.00257778191f, -0.00406813063f,
+   -0.00532589899f, -0.00625476614f, -0.00677812099f, -0.00684518553f, -0.00643542176f, -0.00556106167f,
+   -0.00426734099f, -0.00263047661f, -0.000753346540f, 0.00124073238f, 0.00321609783f, 0.00503378920f,
+   0.00656110235f, 0.00768125616f, 0.00830204040f, 0.00836311653f, 0.00784135703f, 0.00675367191f,
+   0.00515723042f, 0.00314671756f, 0.000848967582f, -0.00158476038f, -0.00398873864f, -0.00619380875f,
+   -0.00803905539f, -0.00938350335f, -0.0101165492f, -0.0101667149f, -0.00950798206f, -0.00816305168f,
+   -0.00620343443f, -0.00374594540f, -0.000946033164f, 0.00201171893f, 0.00492575346f, 0.00759097748f,
+   0.00981291663f, 0.0114218416f, 0.0122853229f, 0.0123187024f, 0.0114926230f, 0.00983679947f,
+   0.00743995747f, 0.00444542523f, 0.00104291702f, -0.00254308130f, -0.00606809603f, -0.00928397570f,
+   -0.0119560007f, -0.0138799250f, -0.0148970746f, -0.0149069047f, -0.0138759660f, -0.0118423197f,
+   -0.00891533121f, -0.00527019287f, -0.00113788492f, 0.00320895319f, 0.00747396611f, 0.0113568250f,
+   0.0145739159f, 0.0168789066f, 0.0180809647f, 0.0180598628f, 0.0167767499f, 0.0142794196f,
+   0.0107019749f, 0.00625816174f, 0.00122920482f, -0.00405361457f, -0.00923011638f, -0.0139357103f,
+   -0.0178262834f, -0.0206029620f, -0.0220344216f, -0.0219751541f, -0.0203785431f, -0.0173033737f,
+   -0.0129134124f, -0.00746955909f, -0.00131493527f, 0.00514593255f, 0.0114731696f, 0.0172209702f,
+   0.0219681021f, 0.0253481250f, 0.0270767305f, 0.0269742589f, 0.0249818861f, 0.0211700723f,
+   0.0157382656f, 0.00900562014f, 0.00139343680f, -0.00660034269f, -0.0144329183f, -0.0215522293f,
+   -0.0274349302f, -0.0316236876f, -0.0337610729f, -0.0336181261f, -0.0311151743f, -0.0263329688f,
+   -0.0195134599f, -0.0110492986f, -0.00146302546f, 0.00862378161f, 0.0185294431f, 0.0275562219f,
+   0.0350377820f, 0.0403863266f, 0.0431359187f, 0.0429799743f, 0.0397989005f, 0.0336764902f,
+   0.0249032695f, 0.0139656970f, 0.00152227085f, -0.0116338972f, -0.0246222746f, -0.0365308449f,
+   -0.0464765020f, -0.0536660850f, -0.0574547015f, -0.0573966168f, -0.0532854162f, -0.0451804362f,
+   -0.0334167890f, -0.0185978487f, -0.00156969484f, 0.0166213904f, 0.0347871482f, 0.0516674332f,
+   0.0660085678f, 0.0766465366f, 0.0825879052f, 0.0830851197f, 0.0777006820f, 0.0663555488f,
+   0.0493585877f, 0.0274137706f, 0.00160444586f, -0.0266460180f, -0.0556351691f, -0.0834624916f,
+   -0.108125500f, -0.127626330f, -0.140083328f, -0.143841043f, -0.137572885f, -0.120369859f,
+   -0.0918105841f, -0.0520072617f, -0.00162558781f, 0.0581248291f, 0.125527695f, 0.198426217f,
+   0.274313182f, 0.350441098f, 0.423947573f, 0.491988927f, 0.551875055f, 0.601199329f,
+   0.637954950f, 0.660633564f, 0.668299317f, 0.660633564f, 0.637954950f, 0.601199329f,
+   0.551875055f, 0.491988927f, 0.423947573f, 0.350441098f, 0.274313182f, 0.198426217f,
+   0.125527695f, 0.0581248291f, -0.00162558781f, -0.0520072617f, -0.0918105841f, -0.120369859f,
+   -0.137572885f, -0.143841043f, -0.140083328f, -0.127626330f, -0.108125500f, -0.0834624916f,
+   -0.0556351691f, -0.0266460180f, 0.00160444586f, 0.0274137706f, 0.0493585877f, 0.0663555488f,
+   0.0777006820f, 0.0830851197f, 0.0825879052f, 0.0766465366f, 0.0660085678f, 0.0516674332f,
+   0.0347871482f, 0.0166213904f, -0.00156969484f, -0.0185978487f, -0.0334167890f, -0.0451804362f,
+   -0.0532854162f, -0.0573966168f, -0.0574547015f, -0.0536660850f, -0.0464765020f, -0.0365308449f,
+   -0.0246222746f, -0.0116338972f, 0.00152227085f, 0.0139656970f, 0.0249032695f, 0.0336764902f,
+   0.0397989005f, 0.0429799743f, 0.0431359187f, 0.0403863266f, 0.0350377820f, 0.0275562219f,
+   0.0185294431f, 0.00862378161f, -0.00146302546f, -0.0110492986f, -0.0195134599f, -0.0263329688f,
+   -0.0311151743f, -0.0336181261f, -0.0337610729f, -0.0316236876f, -0.0274349302f, -0.0215522293f,
+   -0.0144329183f, -0.00660034269f, 0.00139343680f, 0.00900562014f, 0.0157382656f, 0.0211700723f,
+   0.0249818861f, 0.0269742589f, 0.0270767305f, 0.0253481250f, 0.0219681021f, 0.0172209702f,
+   0.0114731696f, 0.00514593255f, -0.00131493527f, -0.00746955909f, -0.0129134124f, -0.0173033737f,
+   -0.0203785431f, -0.0219751541f, -0.0220344216f, -0.0206029620f, -0.0178262834f, -0.0139357103f,
+   -0.00923011638f, -0.00405361457f, 0.00122920482f, 0.00625816174f, 0.0107019749f, 0.0142794196f,
+   0.0167767499f, 0.0180598628f, 0.0180809647f, 0.0168789066f, 0.0145739159f, 0.0113568250f,
+   0.00747396611f, 0.00320895319f, -0.00113788492f, -0.00527019287f, -0.00891533121f, -0.0118423197f,
+   -0.0138759660f, -0.0149069047f, -0.0148970746f, -0.0138799250f, -0.0119560007f, -0.00928397570f,
+   -0.00606809603f, -0.00254308130f, 0.00104291702f, 0.00444542523f, 0.00743995747f, 0.00983679947f,
+   0.0114926230f, 0.0123187024f, 0.0122853229f, 0.0114218416f, 0.00981291663f, 0.00759097748f,
+   0.00492575346f, 0.00201171893f, -0.000946033164f, -0.00374594540f, -0.00620343443f, -0.00816305168f,
+   -0.00950798206f, -0.0101667149f, -0.0101165492f, -0.00938350335f, -0.00803905539f, -0.00619380875f,
+   -0.00398873864f, -0.00158476038f, 0.000848967582f, 0.00314671756f, 0.00515723042f, 0.00675367191f,
+   0.00784135703f, 0.00836311653f, 0.00830204040f, 0.00768125616f, 0.00656110235f, 0.00503378920f,
+   0.00321609783f, 0.00124073238f, -0.000753346540f, -0.00263047661f, -0.00426734099f, -0.00556106167f,
+   -0.00643542176f, -0.00684518553f, -0.00677812099f, -0.00625476614f, -0.00532589899f, -0.00406813063f,
+   -0.00257778191f, -0.000963658909f, 0.000660650374f, 0.00218477799f, 0.00350890961f, 0.00455016457f,
+   0.00524774380f, 0.00556623982f, 0.00549717899f, 0.00505869230f, 0.00429333420f, 0.00326439715f,
+   0.00205079722f, 0.000741226424f, -0.000572178629f, -0.00180031091f, -0.00286299898f, -0.00369410659f,
+   -0.00424560998f, -0.00449016411f, -0.00442223530f, -0.00405770680f, -0.00343202939f, -0.00259707961f,
+   -0.00161705480f, -0.000563656096f, 0.000489036203f, 0.00146969815f, 0.00231459131f, 0.00297147525f,
+   0.00340288063f, 0.00358800101f, 0.00352354930f, 0.00322332606f, 0.00271658064f, 0.00204551429f,
+   0.00126184267f, 0.000422994053f, -0.000412047870f, -0.00118688284f, -0.00185132294f, -0.00236463198f,
+   -0.00269796210f, -0.00283577922f, -0.00277647655f, -0.00253186049f, -0.00212587207f, -0.00159248163f,
+   -0.000972920447f, -0.000312655844f, 0.000341906765f, 0.000946669956f, 0.00146266806f, 0.00185856503f,
+   0.00211249618f, 0.00221313396f, 0.00216001761f, 0.00196316326f, 0.00164193998f, 0.00122336706f,
+   0.000739917450f, 0.000227123106f, -0.000278995052f, -0.000744443270f, -0.00113941904f, -0.00144020072f,
+   -0.00163053465f, -0.00170233881f, -0.00165596080f, -0.00149976951f, -0.00124922942f, -0.000925545697f,
+   -0.000553928956f, -0.000161739546f, 0.000223494601f, 0.000575992162f, 0.000873347919f, 0.00109794899f,
+   0.00123794319f, 0.00128777022f, 0.00124827342f, 0.00112633139f, 0.000934112817f, 0.000687999302f,
+   0.000407247862f, 0.000112566791f, -0.000175380017f, -0.000437405426f, -0.000657007506f, -0.000821374473f,
+   -0.000922097825f, -0.000955508382f, -0.000922708597f, -0.000829256896f, -0.000684563129f, -0.000501059229f,
+   -0.000293176359f, -7.62802738e-05f, 0.000134439659f, 0.000325019559f, 0.000483580428f, 0.000601050386f,
+   0.000671647838f, 0.000693085371f, 0.000666557055f, 0.000596462982f, 0.000489939936f, 0.000356224336f,
+   0.000205895121f, 5.00885035e-05f, -0.000100303834f, -0.000235380736f, -0.000346832530f, -0.000428436877f,
+   -0.000476371613f, -0.000489330501f, -0.000468476268f, -0.000417216506f, -0.000340837956f, -0.000246036710f,
+   -0.000140364078f, -3.16686965e-05f, 7.24707425e-05f, 0.000165253703f, 0.000241068294f, 0.000295813312f,
+   0.000327092130f, 0.000334263139f, 0.000318382052f, 0.000282018038f, 0.000228982273f, 0.000163984820f,
+   9.22468753e-05f, 1.91096096e-05f, -5.03426563e-05f, -0.000111624584f, -0.000161111937f, -0.000196241090f,
+   -0.000215616543f, -0.000219023612f, -0.000207365054f, -0.000182519885f, -0.000147143408f, -0.000104429266f,
+   -5.78422296e-05f, -1.08634304e-05f, 3.32568234e-05f, 7.17130242e-05f, 0.000102302336f, 0.000123537087f,
+   0.000134696806f, 0.000135816241f, 0.000127627907f, 0.000111454108f, 8.90683223e-05f, 6.25328612e-05f,
+   3.40304614e-05f, 5.69958956e-06f, -2.05163069e-05f, -4.29872234e-05f, -6.04883717e-05f, -7.22544792e-05f,
+   -7.79920811e-05f, -7.78616377e-05f, -7.24251004e-05f, -6.25681205e-05f, -4.94116284e-05f, -3.42030689e-05f,
+   -1.82169715e-05f, -2.65850167e-06f, 1.14191898e-05f, 2.31758786e-05f, 3.20265317e-05f, 3.76597272e-05f,
+   4.00321624e-05f, 3.93450900e-05f, 3.60018857e-05f, 3.05621434e-05f, 2.36765773e-05f, 1.60287327e-05f,
+   8.27891836e-06f, 1.01537728e-06f, -5.28435839e-06f, -1.02775848e-05f, -1.37685283e-05f, -1.57070499e-05f,
+   -1.61745211e-05f, 0.00000000f, 0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_42[384] = {
+   -3.84935220e-06f, -2.64018649e-06f, -2.22114338e-07f, 3.03551633e-06f, 6.39960945e-06f, 8.90939737e-06f,
+   9.61266142e-06f, 7.85459270e-06f, 3.53398787e-06f, -2.74556851e-06f, -9.69835946e-06f, -1.55797443e-05f,
+   -1.85812696e-05f, -1.73216067e-05f, -1.13045935e-05f, -1.21870949e-06f, 1.10367309e-05f, 2.26491156e-05f,
+   3.04872920e-05f, 3.18804377e-05f, 2.53991475e-05f, 1.14301756e-05f, -7.63973185e-06f, -2.77386534e-05f,
+   -4.39121068e-05f, -5.14748608e-05f, -4.72571628e-05f, -3.06354705e-05f, -4.04783304e-06f, 2.72065572e-05f,
+   5.59332366e-05f, 7.46147780e-05f, 7.72742351e-05f, 6.11841024e-05f, 2.79666037e-05f, -1.62739725e-05f,
+   -6.19340499e-05f, -9.78927201e-05f, -0.000114111004f, -0.000104269311f, -6.77717326e-05f, -1.05488753e-05f,
+   5.56813065e-05f, 0.000115672206f, 0.000154039881f, 0.000159051866f, 0.000125916864f, 5.86990827e-05f,
+   -2.97547977e-05f, -0.000120077675f, -0.000190467123f, -0.000221795737f, -0.000202566982f, -0.000132483721f,
+   -2.36096857e-05f, 0.000101394122f, 0.000213783685f, 0.000285170012f, 0.000294479425f, 0.000233752493f,
+   0.000111280729f, -4.89538143e-05f, -0.000211675550f, -0.000337892998f, -0.000394019327f, -0.000360480044f,
+   -0.000237657572f, -4.74891822e-05f, 0.000170007334f, 0.000364889740f, 0.000488527527f, 0.000505439471f,
+   0.000402923382f, 0.000195930930f, -7.43002238e-05f, -0.000348095171f, -0.000560232322f, -0.000655206270f,
+   -0.000601303414f, -0.000400015531f, -8.82269378e-05f, 0.000267951313f, 0.000586865819f, 0.000789711543f,
+   0.000819621899f, 0.000656849530f, 0.000326219073f, -0.000105615625f, -0.000543105474f, -0.000882568129f,
+   -0.00103639346f, -0.000955036143f, -0.000641509483f, -0.000154288384f, 0.000402808771f, 0.000902283122f,
+   0.00122169941f, 0.00127316744f, 0.00102657126f, 0.000520585221f, -0.000141985089f, -0.000814398983f,
+   -0.00133800635f, -0.00157911691f, -0.00146237086f, -0.000992383342f, -0.000257779931f, 0.000584489899f,
+   0.00134200708f, 0.00183027110f, 0.00191689841f, 0.00155625353f, 0.000805663178f, -0.000181740077f,
+   -0.00118736620f, -0.00197479711f, -0.00234464835f, -0.00218395842f, -0.00149818766f, -0.000417132716f,
+   0.000828152697f, 0.00195382629f, 0.00268705469f, 0.00283107883f, 0.00231626164f, 0.00122417370f,
+   -0.000222569433f, -0.00170427491f, -0.00287375483f, -0.00343647157f, -0.00322310603f, -0.00223698909f,
+   -0.000663716521f, 0.00116161385f, 0.00282419519f, 0.00392238935f, 0.00416297326f, 0.00343670882f,
+   0.00185522914f, -0.000261671812f, -0.00244850689f, -0.00419444218f, -0.00506052468f, -0.00478723971f,
+   -0.00336666801f, -0.00106017967f, 0.00164582662f, 0.00413966784f, 0.00581975840f, 0.00623629475f,
+   0.00520660682f, 0.00287564215f, -0.000296102284f, -0.00361903640f, -0.00632015243f, -0.00771802571f,
+   -0.00738852099f, -0.00528227910f, -0.00176331890f, 0.00244545797f, 0.00640394678f, 0.00915729348f,
+   0.00995698385f, 0.00845140126f, 0.00479961047f, -0.000323058601f, -0.00583750708f, -0.0104751457f,
+   -0.0130536705f, -0.0127575062f, -0.00936001074f, -0.00333340769f, 0.00418786891f, 0.0115950387f,
+   0.0171166956f, 0.0191984382f, 0.0168749597f, 0.0100561362f, -0.000340243161f, -0.0124491863f,
+   -0.0237165503f, -0.0313190259f, -0.0326751694f, -0.0259554591f, -0.0104936240f, 0.0129843801f,
+   0.0423664562f, 0.0744071305f, 0.105190933f, 0.130731553f, 0.147604153f, 0.153500006f,
+   0.147604153f, 0.130731553f, 0.105190933f, 0.0744071305f, 0.0423664562f, 0.0129843801f,
+   -0.0104936240f, -0.0259554591f, -0.0326751694f, -0.0313190259f, -0.0237165503f, -0.0124491863f,
+   -0.000340243161f, 0.0100561362f, 0.0168749597f, 0.0191984382f, 0.0171166956f, 0.0115950387f,
+   0.00418786891f, -0.00333340769f, -0.00936001074f, -0.0127575062f, -0.0130536705f, -0.0104751457f,
+   -0.00583750708f, -0.000323058601f, 0.00479961047f, 0.00845140126f, 0.00995698385f, 0.00915729348f,
+   0.00640394678f, 0.00244545797f, -0.00176331890f, -0.00528227910f, -0.00738852099f, -0.00771802571f,
+   -0.00632015243f, -0.00361903640f, -0.000296102284f, 0.00287564215f, 0.00520660682f, 0.00623629475f,
+   0.00581975840f, 0.00413966784f, 0.00164582662f, -0.00106017967f, -0.00336666801f, -0.00478723971f,
+   -0.00506052468f, -0.00419444218f, -0.00244850689f, -0.000261671812f, 0.00185522914f, 0.00343670882f,
+   0.00416297326f, 0.00392238935f, 0.00282419519f, 0.00116161385f, -0.000663716521f, -0.00223698909f,
+   -0.00322310603f, -0.00343647157f, -0.00287375483f, -0.00170427491f, -0.000222569433f, 0.00122417370f,
+   0.00231626164f, 0.00283107883f, 0.00268705469f, 0.00195382629f, 0.000828152697f, -0.000417132716f,
+   -0.00149818766f, -0.00218395842f, -0.00234464835f, -0.00197479711f, -0.00118736620f, -0.000181740077f,
+   0.000805663178f, 0.00155625353f, 0.00191689841f, 0.00183027110f, 0.00134200708f, 0.000584489899f,
+   -0.000257779931f, -0.000992383342f, -0.00146237086f, -0.00157911691f, -0.00133800635f, -0.000814398983f,
+   -0.000141985089f, 0.000520585221f, 0.00102657126f, 0.00127316744f, 0.00122169941f, 0.000902283122f,
+   0.000402808771f, -0.000154288384f, -0.000641509483f, -0.000955036143f, -0.00103639346f, -0.000882568129f,
+   -0.000543105474f, -0.000105615625f, 0.000326219073f, 0.000656849530f, 0.000819621899f, 0.000789711543f,
+   0.000586865819f, 0.000267951313f, -8.82269378e-05f, -0.000400015531f, -0.000601303414f, -0.000655206270f,
+   -0.000560232322f, -0.000348095171f, -7.43002238e-05f, 0.000195930930f, 0.000402923382f, 0.000505439471f,
+   0.000488527527f, 0.000364889740f, 0.000170007334f, -4.74891822e-05f, -0.000237657572f, -0.000360480044f,
+   -0.000394019327f, -0.000337892998f, -0.000211675550f, -4.89538143e-05f, 0.000111280729f, 0.000233752493f,
+   0.000294479425f, 0.000285170012f, 0.000213783685f, 0.000101394122f, -2.36096857e-05f, -0.000132483721f,
+   -0.000202566982f, -0.000221795737f, -0.000190467123f, -0.000120077675f, -2.97547977e-05f, 5.86990827e-05f,
+   0.000125916864f, 0.000159051866f, 0.000154039881f, 0.000115672206f, 5.56813065e-05f, -1.05488753e-05f,
+   -6.77717326e-05f, -0.000104269311f, -0.000114111004f, -9.78927201e-05f, -6.19340499e-05f, -1.62739725e-05f,
+   2.79666037e-05f, 6.11841024e-05f, 7.72742351e-05f, 7.46147780e-05f, 5.59332366e-05f, 2.72065572e-05f,
+   -4.04783304e-06f, -3.06354705e-05f, -4.72571628e-05f, -5.14748608e-05f, -4.39121068e-05f, -2.77386534e-05f,
+   -7.63973185e-06f, 1.14301756e-05f, 2.53991475e-05f, 3.18804377e-05f, 3.04872920e-05f, 2.26491156e-05f,
+   1.10367309e-05f, -1.21870949e-06f, -1.13045935e-05f, -1.73216067e-05f, -1.85812696e-05f, -1.55797443e-05f,
+   -9.69835946e-06f, -2.74556851e-06f, 3.53398787e-06f, 7.85459270e-06f, 9.61266142e-06f, 8.90939737e-06f,
+   6.39960945e-06f, 3.03551633e-06f, -2.22114338e-07f, -2.64018649e-06f, -3.84935220e-06f, -3.86247029e-06f,
+};
+
+static const spx_word16_t resample_table_43[584] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, 2.05331708e-05f, 2.08011552e-05f,
+   1.81996074e-05f, 1.24838252e-05f, 3.82369990e-06f, -7.14947828e-06f, -1.93593823e-05f, -3.13649543e-05f,
+   -4.15077193e-05f, -4.81089010e-05f, -4.96967004e-05f, -4.52488530e-05f, -3.43863394e-05f, -1.75210625e-05f,
+   4.08933965e-06f, 2.83887475e-05f, 5.26877229e-05f, 7.39270254e-05f, 8.90296433e-05f, 9.52905903e-05f,
+   9.07797803e-05f, 7.46763908e-05f, 4.75082015e-05f, 1.12491853e-05f, -3.07639420e-05f, -7.40875039e-05f,
+   -0.000113605704f, -0.000144087040f, -0.000160824435f, -0.000160273557f, -0.000140613309f, -0.000102152866f,
+   -4.75124398e-05f, 1.84556866e-05f, 8.90348529e-05f, 0.000156279129f, 0.000211848703f, 0.000247991353f,
+   0.000258525979f, 0.000239744477f, 0.000191088839f, 0.000115507166f, 1.94283366e-05f, -8.77041311e-05f,
+   -0.000194277716f, -0.000287720002f, -0.000355902914f, -0.000388626155f, -0.000378996192f, -0.000324524008f,
+   -0.000227794837f, -9.65726358e-05f, 5.66774470e-05f, 0.000215897788f, 0.000363022118f, 0.000479970884f,
+   0.000550743775f, 0.000563490670f, 0.000512214028f, 0.000397923373f, 0.000229058263f, 2.10423914e-05f,
+   -0.000204975062f, -0.000424196711f, -0.000610783231f, -0.000740801217f, -0.000795143831f, -0.000762112963f,
+   -0.000639305566f, -0.000434537447f, -0.000165667851f, 0.000140811171f, 0.000452219159f, 0.000733108376f,
+   0.000949122594f, 0.00107110105f, 0.00107876956f, 0.000963695755f, 0.000731021224f, 0.000399772864f,
+   1.52494295e-06f, -0.000422393496f, -0.000825112220f, -0.00115919544f, -0.00138213602f, -0.00146151532f,
+   -0.00137938734f, -0.00113522413f, -0.000747022044f, -0.000250389363f, 0.000304540445f, 0.000857941399f,
+   0.00134664413f, 0.00171111792f, 0.00190257386f, 0.00188914267f, 0.00166051975f, 0.00123039295f,
+   0.000636202283f, -6.37326812e-05f, -0.000795803906f, -0.00147856947f, -0.00203171908f, -0.00238522887f,
+   -0.00248799822f, -0.00231467397f, -0.00186994765f, -0.00118966936f, -0.000338365498f, 0.000596502097f,
+   0.00151340524f, 0.00230743154f, 0.00288218679f, 0.00316111674f, 0.00309731741f, 0.00268037128f,
+   0.00193937996f, 0.000941737730f, -0.000212703395f, -0.00140123954f, -0.00249113305f, -0.00335425884f,
+   -0.00388176576f, -0.00399749121f, -0.00366815086f, -0.00290920679f, -0.00178554642f, -0.000406398001f,
+   0.00108478649f, 0.00252509140f, 0.00374948839f, 0.00460962346f, 0.00499124639f, 0.00482885633f,
+   0.00411534915f, 0.00290551200f, 0.00131279917f, -0.000500991067f, -0.00234159478f, -0.00400286587f,
+   -0.00528947031f, -0.00603953842f, -0.00614440208f, -0.00556327170f, -0.00433088373f, -0.00255695288f,
+   -0.000417055067f, 0.00186420057f, 0.00403638557f, 0.00585037284f, 0.00708649447f, 0.00758059137f,
+   0.00724493479f, 0.00608140836f, 0.00418517273f, 0.00173787458f, -0.00100903946f, -0.00375969941f,
+   -0.00620524585f, -0.00805805903f, -0.00908502657f, -0.00913607981f, -0.00816455483f, -0.00623678090f,
+   -0.00352925877f, -0.000313463301f, 0.00307077332f, 0.00625064690f, 0.00886093173f, 0.0105853360f,
+   0.0111940559f, 0.0105731227f, 0.00874195434f, 0.00585653121f, 0.00219750218f, -0.00185629481f,
+   -0.00586639205f, -0.00938149728f, -0.0119876200f, -0.0133560244f, -0.0132835284f, -0.0117203454f,
+   -0.00878171809f, -0.00474177394f, -8.95596258e-06f, 0.00491430378f, 0.00948417187f, 0.0131747043f,
+   0.0155374873f, 0.0162549429f, 0.0151811149f, 0.0123647870f, 0.00805178378f, 0.00266527245f,
+   -0.00323457597f, -0.00900783297f, -0.0140032498f, -0.0176306721f, -0.0194294713f, -0.0191252213f,
+   -0.0166677721f, -0.0122458069f, -0.00627525989f, 0.000638092286f, 0.00775873987f, 0.0142984167f,
+   0.0195020400f, 0.0227333717f, 0.0235508420f, 0.0217647329f, 0.0174685121f, 0.0110399025f,
+   0.00311029749f, -0.00549532427f, -0.0138425203f, -0.0209869444f, -0.0260794479f, -0.0284644924f,
+   -0.0277613681f, -0.0239180159f, -0.0172306485f, -0.00832543336f, 0.00189721747f, 0.0123511907f,
+   0.0218775626f, 0.0293703806f, 0.0339019224f, 0.0348337553f, 0.0319003053f, 0.0252549220f,
+   0.0154715646f, 0.00349998847f, -0.00942259748f, -0.0218956433f, -0.0325030312f, -0.0399692953f,
+   -0.0433076397f, -0.0419430211f, -0.0357954577f, -0.0253130086f, -0.0114481952f, 0.00442216173f,
+   0.0206275918f, 0.0353733338f, 0.0469317138f, 0.0538362786f, 0.0550569296f, 0.0501368307f,
+   0.0392740481f, 0.0233363174f, 0.00380389905f, -0.0173571818f, -0.0378813408f, -0.0554329641f,
+   -0.0678567514f, -0.0734231845f, -0.0710433349f, -0.0604283959f, -0.0421739556f, -0.0177559946f,
+   0.0105663482f, 0.0399365649f, 0.0671613216f, 0.0890239775f, 0.102622256f, 0.105697289f,
+   0.0969213173f, 0.0761130378f, 0.0443551205f, 0.00399714801f, -0.0414630063f, -0.0876141042f,
+   -0.129468620f, -0.161873385f, -0.179961041f, -0.179602548f, -0.157819569f, -0.113117978f,
+   -0.0457094498f, 0.0424028561f, 0.147486240f, 0.264289528f, 0.386387199f, 0.506631374f,
+   0.617676377f, 0.712531984f, 0.785099208f, 0.830644131f, 0.846168697f, 0.830644131f,
+   0.785099208f, 0.712531984f, 0.617676377f, 0.506631374f, 0.386387199f, 0.264289528f,
+   0.147486240f, 0.0424028561f, -0.0457094498f, -0.113117978f, -0.157819569f, -0.179602548f,
+   -0.179961041f, -0.161873385f, -0.129468620f, -0.0876141042f, -0.0414630063f, 0.00399714801f,
+   0.0443551205f, 0.0761130378f, 0.0969213173f, 0.105697289f, 0.102622256f, 0.0890239775f,
+   0.0671613216f, 0.0399365649f, 0.0105663482f, -0.0177559946f, -0.0421739556f, -0.0604283959f,
+   -0.0710433349f, -0.0734231845f, -0.0678567514f, -0.0554329641f, -0.0378813408f, -0.0173571818f,
+   0.00380389905f, 0.0233363174f, 0.0392740481f, 0.0501368307f, 0.0550569296f, 0.0538362786f,
+   0.0469317138f, 0.0353733338f, 0.0206275918f, 0.00442216173f, -0.0114481952f, -0.0253130086f,
+   -0.0357954577f, -0.0419430211f, -0.0433076397f, -0.0399692953f, -0.0325030312f, -0.0218956433f,
+   -0.00942259748f, 0.00349998847f, 0.0154715646f, 0.0252549220f, 0.0319003053f, 0.0348337553f,
+   0.0339019224f, 0.0293703806f, 0.0218775626f, 0.0123511907f, 0.00189721747f, -0.00832543336f,
+   -0.0172306485f, -0.0239180159f, -0.0277613681f, -0.0284644924f, -0.0260794479f, -0.0209869444f,
+   -0.0138425203f, -0.00549532427f, 0.00311029749f, 0.0110399025f, 0.0174685121f, 0.0217647329f,
+   0.0235508420f, 0.0227333717f, 0.0195020400f, 0.0142984167f, 0.00775873987f, 0.000638092286f,
+   -0.00627525989f, -0.0122458069f, -0.0166677721f, -0.0191252213f, -0.0194294713f, -0.0176306721f,
+   -0.0140032498f, -0.00900783297f, -0.00323457597f, 0.00266527245f, 0.00805178378f, 0.0123647870f,
+   0.0151811149f, 0.0162549429f, 0.0155374873f, 0.0131747043f, 0.00948417187f, 0.00491430378f,
+   -8.95596258e-06f, -0.00474177394f, -0.00878171809f, -0.0117203454f, -0.0132835284f, -0.0133560244f,
+   -0.0119876200f, -0.00938149728f, -0.00586639205f, -0.00185629481f, 0.00219750218f, 0.00585653121f,
+   0.00874195434f, 0.0105731227f, 0.0111940559f, 0.0105853360f, 0.00886093173f, 0.00625064690f,
+   0.00307077332f, -0.000313463301f, -0.00352925877f, -0.00623678090f, -0.00816455483f, -0.00913607981f,
+   -0.00908502657f, -0.00805805903f, -0.00620524585f, -0.00375969941f, -0.00100903946f, 0.00173787458f,
+   0.00418517273f, 0.00608140836f, 0.00724493479f, 0.00758059137f, 0.00708649447f, 0.00585037284f,
+   0.00403638557f, 0.00186420057f, -0.000417055067f, -0.00255695288f, -0.00433088373f, -0.00556327170f,
+   -0.00614440208f, -0.00603953842f, -0.00528947031f, -0.00400286587f, -0.00234159478f, -0.000500991067f,
+   0.00131279917f, 0.00290551200f, 0.00411534915f, 0.00482885633f, 0.00499124639f, 0.00460962346f,
+   0.00374948839f, 0.00252509140f, 0.00108478649f, -0.000406398001f, -0.00178554642f, -0.00290920679f,
+   -0.00366815086f, -0.00399749121f, -0.00388176576f, -0.00335425884f, -0.00249113305f, -0.00140123954f,
+   -0.000212703395f, 0.000941737730f, 0.00193937996f, 0.00268037128f, 0.00309731741f, 0.00316111674f,
+   0.00288218679f, 0.00230743154f, 0.00151340524f, 0.000596502097f, -0.000338365498f, -0.00118966936f,
+   -0.00186994765f, -0.00231467397f, -0.00248799822f, -0.00238522887f, -0.00203171908f, -0.00147856947f,
+   -0.000795803906f, -6.37326812e-05f, 0.000636202283f, 0.00123039295f, 0.00166051975f, 0.00188914267f,
+   0.00190257386f, 0.00171111792f, 0.00134664413f, 0.000857941399f, 0.000304540445f, -0.000250389363f,
+   -0.000747022044f, -0.00113522413f, -0.00137938734f, -0.00146151532f, -0.00138213602f, -0.00115919544f,
+   -0.000825112220f, -0.000422393496f, 1.52494295e-06f, 0.000399772864f, 0.000731021224f, 0.000963695755f,
+   0.00107876956f, 0.00107110105f, 0.000949122594f, 0.000733108376f, 0.000452219159f, 0.000140811171f,
+   -0.000165667851f, -0.000434537447f, -0.000639305566f, -0.000762112963f, -0.000795143831f, -0.000740801217f,
+   -0.000610783231f, -0.000424196711f, -0.000204975062f, 2.10423914e-05f, 0.000229058263f, 0.000397923373f,
+   0.000512214028f, 0.000563490670f, 0.000550743775f, 0.000479970884f, 0.000363022118f, 0.000215897788f,
+   5.66774470e-05f, -9.65726358e-05f, -0.000227794837f, -0.000324524008f, -0.000378996192f, -0.000388626155f,
+   -0.000355902914f, -0.000287720002f, -0.000194277716f, -8.77041311e-05f, 1.94283366e-05f, 0.000115507166f,
+   0.000191088839f, 0.000239744477f, 0.000258525979f, 0.000247991353f, 0.000211848703f, 0.000156279129f,
+   8.90348529e-05f, 1.84556866e-05f, -4.75124398e-05f, -0.000102152866f, -0.000140613309f, -0.000160273557f,
+   -0.000160824435f, -0.000144087040f, -0.000113605704f, -7.40875039e-05f, -3.07639420e-05f, 1.12491853e-05f,
+   4.75082015e-05f, 7.46763908e-05f, 9.07797803e-05f, 9.52905903e-05f, 8.90296433e-05f, 7.39270254e-05f,
+   5.26877229e-05f, 2.83887475e-05f, 4.08933965e-06f, -1.75210625e-05f, -3.43863394e-05f, -4.52488530e-05f,
+   -4.96967004e-05f, -4.81089010e-05f, -4.15077193e-05f, -3.13649543e-05f, -1.93593823e-05f, -7.14947828e-06f,
+   3.82369990e-06f, 1.24838252e-05f, 1.81996074e-05f, 2.08011552e-05f, 2.05331708e-05f, 0.00000000f,
+   0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_44[160] = {
+   6.77687831e-06f, -1.23543869e-05f, 1.85235822e-05f, -2.33608480e-05f, 2.35994758e-05f, -1.44313817e-05f,
+   -1.05318086e-05f, 5.90686504e-05f, -0.000139845521f, 0.000261562411f, -0.000431742228f, 0.000655177573f,
+   -0.000932115770f, 0.00125633040f, -0.00161323010f, 0.00197831145f, -0.00231586234f, 0.00257872208f,
+   -0.00270878663f, 0.00263864640f, -0.00229438581f, 0.00159944769f, -0.000479555980f, -0.00113165763f,
+   0.00328663224f, -0.00601805327f, 0.00933353789f, -0.0132112531f, 0.0175974835f, -0.0224056095f,
+   0.0275176652f, -0.0327879190f, 0.0380488709f, -0.0431189202f, 0.0478115790f, -0.0519451313f,
+   0.0553540327f, -0.0578975342f, 0.0594685562f, 0.939999998f, 0.0594685562f, -0.0578975342f,
+   0.0553540327f, -0.0519451313f, 0.0478115790f, -0.0431189202f, 0.0380488709f, -0.0327879190f,
+   0.0275176652f, -0.0224056095f, 0.0175974835f, -0.0132112531f, 0.00933353789f, -0.00601805327f,
+   0.00328663224f, -0.00113165763f, -0.000479555980f, 0.00159944769f, -0.00229438581f, 0.00263864640f,
+   -0.00270878663f, 0.00257872208f, -0.00231586234f, 0.00197831145f, -0.00161323010f, 0.00125633040f,
+   -0.000932115770f, 0.000655177573f, -0.000431742228f, 0.000261562411f, -0.000139845521f, 5.90686504e-05f,
+   -1.05318086e-05f, -1.44313817e-05f, 2.35994758e-05f, -2.33608480e-05f, 1.85235822e-05f, -1.23543869e-05f,
+   6.77687831e-06f, -2.68787448e-06f, -1.95238158e-06f, 6.40125427e-06f, -1.54635927e-05f, 3.13118180e-05f,
+   -5.61904017e-05f, 9.19487720e-05f, -0.000139439639f, 0.000197777146f, -0.000263515918f, 0.000329850300f,
+   -0.000385897001f, 0.000416276336f, -0.000401076482f, 0.000316384976f, -0.000135366587f, -0.000169845414f,
+   0.000625564135f, -0.00125341816f, 0.00206668652f, -0.00306626013f, 0.00423670607f, -0.00554274721f,
+   0.00692623621f, -0.00830418244f, 0.00956757553f, -0.0105818501f, 0.0111880936f, -0.0112046795f,
+   0.0104287434f, -0.00863551535f, 0.00557297142f, -0.000947305467f, -0.00561170420f, 0.0146239176f,
+   -0.0269227568f, 0.0440446995f, -0.0692936778f, 0.111362047f, -0.202424884f, 0.633321643f,
+   0.633321643f, -0.202424884f, 0.111362047f, -0.0692936778f, 0.0440446995f, -0.0269227568f,
+   0.0146239176f, -0.00561170420f, -0.000947305467f, 0.00557297142f, -0.00863551535f, 0.0104287434f,
+   -0.0112046795f, 0.0111880936f, -0.0105818501f, 0.00956757553f, -0.00830418244f, 0.00692623621f,
+   -0.00554274721f, 0.00423670607f, -0.00306626013f, 0.00206668652f, -0.00125341816f, 0.000625564135f,
+   -0.000169845414f, -0.000135366587f, 0.000316384976f, -0.000401076482f, 0.000416276336f, -0.000385897001f,
+   0.000329850300f, -0.000263515918f, 0.000197777146f, -0.000139439639f, 9.19487720e-05f, -5.61904017e-05f,
+   3.13118180e-05f, -1.54635927e-05f, 6.40125427e-06f, -1.95238158e-06f,
+};
+
+static const spx_word16_t resample_table_45[240] = {
+   6.77687831e-06f, -1.23543869e-05f, 1.85235822e-05f, -2.33608480e-05f, 2.35994758e-05f, -1.44313817e-05f,
+   -1.05318086e-05f, 5.90686504e-05f, -0.000139845521f, 0.000261562411f, -0.000431742228f, 0.000655177573f,
+   -0.000932115770f, 0.00125633040f, -0.00161323010f, 0.00197831145f, -0.00231586234f, 0.00257872208f,
+   -0.00270878663f, 0.00263864640f, -0.00229438581f, 0.00159944769f, -0.000479555980f, -0.00113165763f,
+   0.00328663224f, -0.00601805327f, 0.00933353789f, -0.0132112531f, 0.0175974835f, -0.0224056095f,
+   0.0275176652f, -0.0327879190f, 0.0380488709f, -0.0431189202f, 0.0478115790f, -0.0519451313f,
+   0.0553540327f, -0.0578975342f, 0.0594685562f, 0.939999998f, 0.0594685562f, -0.0578975342f,
+   0.0553540327f, -0.0519451313f, 0.0478115790f, -0.0431189202f, 0.0380488709f, -0.0327879190f,
+   0.0275176652f, -0.0224056095f, 0.0175974835f, -0.0132112531f, 0.00933353789f, -0.00601805327f,
+   0.00328663224f, -0.00113165763f, -0.000479555980f, 0.00159944769f, -0.00229438581f, 0.00263864640f,
+   -0.00270878663f, 0.00257872208f, -0.00231586234f, 0.00197831145f, -0.00161323010f, 0.00125633040f,
+   -0.000932115770f, 0.000655177573f, -0.000431742228f, 0.000261562411f, -0.000139845521f, 5.90686504e-05f,
+   -1.05318086e-05f, -1.44313817e-05f, 2.35994758e-05f, -2.33608480e-05f, 1.85235822e-05f, -1.23543869e-05f,
+   6.77687831e-06f, -2.68787448e-06f, 4.82695100e-07f, 1.33963943e-06f, -6.96592951e-06f, 1.90826395e-05f,
+   -4.09903769e-05f, 7.63291901e-05f, -0.000128573432f, 0.000200315015f, -0.000292353856f, 0.000402645237f,
+   -0.000525173731f, 0.000648900867f, -0.000756942958f, 0.000826159201f, -0.000827259850f, 0.000725610764f,
+   -0.000482923148f, 5.98077604e-05f, 0.000580954715f, -0.00147034682f, 0.00262839813f, -0.00405950798f,
+   0.00574761396f, -0.00765193300f, 0.00970329437f, -0.0118014654f, 0.0138136465f, -0.0155736450f,
+   0.0168812871f, -0.0175005458f, 0.0171545353f, -0.0155118024f, 0.0121555636f, -0.00651430385f,
+   -0.00229634228f, 0.0158630349f, -0.0375797898f, 0.0766082183f, -0.169670820f, 0.795116007f,
+   0.439575374f, -0.185278997f, 0.116847828f, -0.0822451636f, 0.0599217303f, -0.0436650254f,
+   0.0310752653f, -0.0210557710f, 0.0130378520f, -0.00668636011f, 0.00177176634f, 0.00188899529f,
+   -0.00446103932f, 0.00610323343f, -0.00697224867f, 0.00722121354f, -0.00699683512f, 0.00643517217f,
+   -0.00565808918f, 0.00477000233f, -0.00385595765f, 0.00298109069f, -0.00219112542f, 0.00151403050f,
+   -0.000962344639f, 0.000536154199f, -0.000226361008f, 1.77240745e-05f, 0.000108257220f, -0.000170943982f,
+   0.000188672566f, -0.000177500580f, 0.000150462118f, -0.000117321280f, 8.47052288e-05f, -5.65292648e-05f,
+   3.45419867e-05f, -1.89359944e-05f, 8.92656044e-06f, -3.24815005e-06f, -3.24815005e-06f, 8.92656044e-06f,
+   -1.89359944e-05f, 3.45419867e-05f, -5.65292648e-05f, 8.47052288e-05f, -0.000117321280f, 0.000150462118f,
+   -0.000177500580f, 0.000188672566f, -0.000170943982f, 0.000108257220f, 1.77240745e-05f, -0.000226361008f,
+   0.000536154199f, -0.000962344639f, 0.00151403050f, -0.00219112542f, 0.00298109069f, -0.00385595765f,
+   0.00477000233f, -0.00565808918f, 0.00643517217f, -0.00699683512f, 0.00722121354f, -0.00697224867f,
+   0.00610323343f, -0.00446103932f, 0.00188899529f, 0.00177176634f, -0.00668636011f, 0.0130378520f,
+   -0.0210557710f, 0.0310752653f, -0.0436650254f, 0.0599217303f, -0.0822451636f, 0.116847828f,
+   -0.185278967f, 0.439575315f, 0.795116007f, -0.169670776f, 0.0766082183f, -0.0375797898f,
+   0.0158630349f, -0.00229634228f, -0.00651430385f, 0.0121555636f, -0.0155118024f, 0.0171545353f,
+   -0.0175005458f, 0.0168812871f, -0.0155736450f, 0.0138136465f, -0.0118014654f, 0.00970329437f,
+   -0.00765193300f, 0.00574761396f, -0.00405950798f, 0.00262839813f, -0.00147034682f, 0.000580954715f,
+   5.98077604e-05f, -0.000482923148f, 0.000725610764f, -0.000827259850f, 0.000826159201f, -0.000756942958f,
+   0.000648900867f, -0.000525173731f, 0.000402645237f, -0.000292353856f, 0.000200315015f, -0.000128573432f,
+   7.63291901e-05f, -4.09903769e-05f, 1.90826395e-05f, -6.96592951e-06f, 1.33963943e-06f, 4.82695100e-07f,
+};
+
+static const spx_word16_t resample_table_46[320] = {
+   6.77687831e-06f, -1.23543869e-05f, 1.85235822e-05f, -2.33608480e-05f, 2.35994758e-05f, -1.44313817e-05f,
+   -1.05318086e-05f, 5.90686504e-05f, -0.000139845521f, 0.000261562411f, -0.000431742228f, 0.000655177573f,
+   -0.000932115770f, 0.00125633040f, -0.00161323010f, 0.00197831145f, -0.00231586234f, 0.00257872208f,
+   -0.00270878663f, 0.00263864640f, -0.00229438581f, 0.00159944769f, -0.000479555980f, -0.00113165763f,
+   0.00328663224f, -0.00601805327f, 0.00933353789f, -0.0132112531f, 0.0175974835f, -0.0224056095f,
+   0.0275176652f, -0.0327879190f, 0.0380488709f, -0.0431189202f, 0.0478115790f, -0.0519451313f,
+   0.0553540327f, -0.0578975342f, 0.0594685562f, 0.939999998f, 0.0594685562f, -0.0578975342f,
+   0.0553540327f, -0.0519451313f, 0.0478115790f, -0.0431189202f, 0.0380488709f, -0.0327879190f,
+   0.0275176652f, -0.0224056095f, 0.0175974835f, -0.0132112531f, 0.00933353789f, -0.00601805327f,
+   0.00328663224f, -0.00113165763f, -0.000479555980f, 0.00159944769f, -0.00229438581f, 0.00263864640f,
+   -0.00270878663f, 0.00257872208f, -0.00231586234f, 0.00197831145f, -0.00161323010f, 0.00125633040f,
+   -0.000932115770f, 0.000655177573f, -0.000431742228f, 0.000261562411f, -0.000139845521f, 5.90686504e-05f,
+   -1.05318086e-05f, -1.44313817e-05f, 2.35994758e-05f, -2.33608480e-05f, 1.85235822e-05f, -1.23543869e-05f,
+   6.77687831e-06f, -2.68787448e-06f, 2.01666626e-06f, -1.91269260e-06f, -1.19071046e-06f, 1.00229836e-05f,
+   -2.81793273e-05f, 5.99569685e-05f, -0.000109950321f, 0.000182418429f, -0.000280395529f, 0.000404604245f,
+   -0.000552201236f, 0.000715480302f, -0.000880706531f, 0.00102722144f, -0.00112705096f, 0.00114504609f,
+   -0.00103997218f, 0.000766445766f, -0.000277782354f, -0.000470167171f, 0.00151462248f, -0.00288075232f,
+   0.00457633380f, -0.00658681989f, 0.00887066405f, -0.0113551887f, 0.0139340051f, -0.0164648984f,
+   0.0187684223f, -0.0206259005f, 0.0217750724f, -0.0218991507f, 0.0206014998f, -0.0173471048f,
+   0.0113266418f, -0.00111494935f, -0.0163190570f, 0.0492609031f, -0.132438138f, 0.856744528f,
+   0.338829488f, -0.161865801f, 0.109168477f, -0.0811588764f, 0.0622845143f, -0.0479479320f,
+   0.0363768078f, -0.0267829839f, 0.0187793281f, -0.0121534895f, 0.00676814234f, -0.00251308340f,
+   -0.000717573741f, 0.00303477910f, -0.00455746893f, 0.00541051012f, -0.00572113460f, 0.00561395055f,
+   -0.00520625198f, 0.00460389070f, -0.00389776356f, 0.00316210627f, -0.00245371764f, 0.00181240076f,
+   -0.00126243394f, 0.000814660161f, -0.000469266903f, 0.000218570131f, -4.97839537e-05f, -5.25321884e-05f,
+   0.000104382059f, -0.000120775097f, 0.000114680646f, -9.64752762e-05f, 7.37747832e-05f, -5.16338441e-05f,
+   3.29118120e-05f, -1.87702226e-05f, 9.19366721e-06f, -3.45229932e-06f, -1.95238158e-06f, 6.40125427e-06f,
+   -1.54635927e-05f, 3.13118180e-05f, -5.61904017e-05f, 9.19487720e-05f, -0.000139439639f, 0.000197777146f,
+   -0.000263515918f, 0.000329850300f, -0.000385897001f, 0.000416276336f, -0.000401076482f, 0.000316384976f,
+   -0.000135366587f, -0.000169845414f, 0.000625564135f, -0.00125341816f, 0.00206668652f, -0.00306626013f,
+   0.00423670607f, -0.00554274721f, 0.00692623621f, -0.00830418244f, 0.00956757553f, -0.0105818501f,
+   0.0111880936f, -0.0112046795f, 0.0104287434f, -0.00863551535f, 0.00557297142f, -0.000947305467f,
+   -0.00561170420f, 0.0146239176f, -0.0269227568f, 0.0440446995f, -0.0692936778f, 0.111362047f,
+   -0.202424884f, 0.633321643f, 0.633321643f, -0.202424884f, 0.111362047f, -0.0692936778f,
+   0.0440446995f, -0.0269227568f, 0.0146239176f, -0.00561170420f, -0.000947305467f, 0.00557297142f,
+   -0.00863551535f, 0.0104287434f, -0.0112046795f, 0.0111880936f, -0.0105818501f, 0.00956757553f,
+   -0.00830418244f, 0.00692623621f, -0.00554274721f, 0.00423670607f, -0.00306626013f, 0.00206668652f,
+   -0.00125341816f, 0.000625564135f, -0.000169845414f, -0.000135366587f, 0.000316384976f, -0.000401076482f,
+   0.000416276336f, -0.000385897001f, 0.000329850300f, -0.000263515918f, 0.000197777146f, -0.000139439639f,
+   9.19487720e-05f, -5.61904017e-05f, 3.13118180e-05f, -1.54635927e-05f, 6.40125427e-06f, -1.95238158e-06f,
+   -3.45229932e-06f, 9.19366721e-06f, -1.87702226e-05f, 3.29118120e-05f, -5.16338441e-05f, 7.37747832e-05f,
+   -9.64752762e-05f, 0.000114680646f, -0.000120775097f, 0.000104382059f, -5.25321884e-05f, -4.97839537e-05f,
+   0.000218570131f, -0.000469266903f, 0.000814660161f, -0.00126243394f, 0.00181240076f, -0.00245371764f,
+   0.00316210627f, -0.00389776356f, 0.00460389070f, -0.00520625198f, 0.00561395055f, -0.00572113460f,
+   0.00541051012f, -0.00455746893f, 0.00303477910f, -0.000717573741f, -0.00251308340f, 0.00676814234f,
+   -0.0121534895f, 0.0187793281f, -0.0267829839f, 0.0363768078f, -0.0479479320f, 0.0622845143f,
+   -0.0811588764f, 0.109168477f, -0.161865801f, 0.338829488f, 0.856744528f, -0.132438138f,
+   0.0492609031f, -0.0163190570f, -0.00111494935f, 0.0113266418f, -0.0173471048f, 0.0206014998f,
+   -0.0218991507f, 0.0217750724f, -0.0206259005f, 0.0187684223f, -0.0164648984f, 0.0139340051f,
+   -0.0113551887f, 0.00887066405f, -0.00658681989f, 0.00457633380f, -0.00288075232f, 0.00151462248f,
+   -0.000470167171f, -0.000277782354f, 0.000766445766f, -0.00103997218f, 0.00114504609f, -0.00112705096f,
+   0.00102722144f, -0.000880706531f, 0.000715480302f, -0.000552201236f, 0.000404604245f, -0.000280395529f,
+   0.000182418429f, -0.000109950321f, 5.99569685e-05f, -2.81793273e-05f, 1.00229836e-05f, -1.19071046e-06f,
+   -1.91269260e-06f, 2.01666626e-06f,
+};
+
+static const spx_word16_t resample_table_47[1288] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, -2.68787448e-06f, -3.02625358e-06f,
+   -3.28222086e-06f, -3.43157990e-06f, -3.45229932e-06f, -3.32567856e-06f, -3.03776119e-06f, -2.58042473e-06f,
+   -1.95238158e-06f, -1.16000558e-06f, -2.17796185e-07f, 8.51414313e-07f, 2.01666626e-06f, 3.23942459e-06f,
+   4.47456932e-06f, 5.67169855e-06f, 6.77687831e-06f, 7.73463853e-06f, 8.49017488e-06f, 8.99187035e-06f,
+   9.19366721e-06f, 9.05330398e-06f, 8.54851623e-06f, 7.66466655e-06f, 6.40125427e-06f, 4.77303547e-06f,
+   2.81080543e-06f, 5.61434774e-07f, -1.91269260e-06f, -4.53475650e-06f, -7.21607375e-06f, -9.85772476e-06f,
+   -1.23543869e-05f, -1.45977911e-05f, -1.64809298e-05f, -1.79022463e-05f, -1.87702226e-05f, -1.90076989e-05f,
+   -1.85559038e-05f, -1.73783283e-05f, -1.54635927e-05f, -1.28259717e-05f, -9.51362563e-06f, -5.60095577e-06f,
+   -1.19071046e-06f, 3.58806619e-06f, 8.58311796e-06f, 1.36232620e-05f, 1.85235822e-05f, 2.30916885e-05f,
+   2.71343924e-05f, 3.04652040e-05f, 3.29118120e-05f, 3.43234351e-05f, 3.45783374e-05f, 3.35897057e-05f,
+   3.13118180e-05f, 2.77441122e-05f, 2.29340276e-05f, 1.69784580e-05f, 1.00229836e-05f, 2.25944109e-06f,
+   -6.07681159e-06f, -1.47160608e-05f, -2.33608480e-05f, -3.16953083e-05f, -3.93959745e-05f, -4.61433483e-05f,
+   -5.16338441e-05f, -5.55923434e-05f, -5.77836618e-05f, -5.80239721e-05f, -5.61904017e-05f, -5.22288901e-05f,
+   -4.61605123e-05f, -3.80844976e-05f, -2.81793273e-05f, -1.67003764e-05f, -3.97474196e-06f, 9.60583111e-06f,
+   2.35994758e-05f, 3.75209020e-05f, 5.08639132e-05f, 6.31154617e-05f, 7.37747832e-05f, 8.23719893e-05f,
+   8.84872934e-05f, 9.17688303e-05f, 9.19487720e-05f, 8.88580325e-05f, 8.24369199e-05f, 7.27434453e-05f,
+   5.99569685e-05f, 4.43776698e-05f, 2.64221180e-05f, 6.61358263e-06f, -1.44313817e-05f, -3.60202102e-05f,
+   -5.74083060e-05f, -7.78195244e-05f, -9.64752762e-05f, -0.000112620321f, -0.000125556733f, -0.000134666436f,
+   -0.000139439639f, -0.000139497512f, -0.000134612870f, -0.000124725208f, -0.000109950321f, -9.05851484e-05f,
+   -6.71055313e-05f, -4.01545803e-05f, -1.05318086e-05f, 2.08316815e-05f, 5.28998571e-05f, 8.45642426e-05f,
+   0.000114680646f, 0.000142108693f, 0.000165752601f, 0.000184603196f, 0.000197777146f, 0.000204553740f,
+   0.000204411685f, 0.000197051384f, 0.000182418429f, 0.000160714641f, 0.000132402958f, 9.82015044e-05f,
+   5.90686504e-05f, 1.61794633e-05f, -2.91075921e-05f, -7.52912019e-05f, -0.000120775097f, -0.000163920748f,
+   -0.000203104646f, -0.000236775290f, -0.000263515918f, -0.000282094552f, -0.000291518809f, -0.000291081466f,
+   -0.000280395529f, -0.000259422493f, -0.000228486853f, -0.000188278835f, -0.000139845521f, -8.45665927e-05f,
+   -2.41193047e-05f, 3.95678617e-05f, 0.000104382059f, 0.000168081489f, 0.000228378136f, 0.000283015601f,
+   0.000329850300f, 0.000366931257f, 0.000392578135f, 0.000405449333f, 0.000404604245f, 0.000389551045f,
+   0.000360280217f, 0.000317284925f, 0.000261562411f, 0.000194591790f, 0.000118307580f, 3.50439404e-05f,
+   -5.25321884e-05f, -0.000141503595f, -0.000228796780f, -0.000311285141f, -0.000385897001f, -0.000449727348f,
+   -0.000500144961f, -0.000534896972f, -0.000552201236f, -0.000550825731f, -0.000530152000f, -0.000490218168f,
+   -0.000431742228f, -0.000356119650f, -0.000265397306f, -0.000162225449f, -4.97839537e-05f, 6.83110120e-05f,
+   0.000188120117f, 0.000305506488f, 0.000416276336f, 0.000516321103f, 0.000601777923f, 0.000669155270f,
+   0.000715480302f, 0.000738420058f, 0.000736381975f, 0.000708598061f, 0.000655177573f, 0.000577131868f,
+   0.000476370973f, 0.000355663564f, 0.000218570131f, 6.93474940e-05f, -8.71978700e-05f, -0.000245830626f,
+   -0.000401076482f, -0.000547405914f, -0.000679417106f, -0.000792036182f, -0.000880706531f, -0.000941562233f,
+   -0.000971589063f, -0.000968755863f, -0.000932115770f, -0.000861877052f, -0.000759432442f, -0.000627335336f,
+   -0.000469266903f, -0.000289927761f, -9.49098830e-05f, 0.000109473272f, 0.000316384976f, 0.000518689456f,
+   0.000709191605f, 0.000880889187f, 0.00102722144f, 0.00114232325f, 0.00122122548f, 0.00126008352f,
+   0.00125633040f, 0.00120881048f, 0.00111786381f, 0.000985356513f, 0.000814660161f, 0.000610581716f,
+   0.000379234378f, 0.000127865249f, -0.000135366587f, -0.000401647965f, -0.000661801139f, -0.000906585541f,
+   -0.00112705096f, -0.00131481141f, -0.00146238506f, -0.00156347733f, -0.00161323010f, -0.00160844880f,
+   -0.00154772424f, -0.00143156631f, -0.00126243394f, -0.00104469969f, -0.000784555043f, -0.000489854137f,
+   -0.000169845414f, 0.000165050966f, 0.000503614137f, 0.000834181963f, 0.00114504609f, 0.00142485776f,
+   0.00166303653f, 0.00185015658f, 0.00197831145f, 0.00204143021f, 0.00203553564f, 0.00195894693f,
+   0.00181240076f, 0.00159908272f, 0.00132457784f, 0.000996757997f, 0.000625564135f, 0.000222711344f,
+   -0.000198668582f, -0.000624448876f, -0.00103997218f, -0.00143054849f, -0.00178196328f, -0.00208098837f,
+   -0.00231586234f, -0.00247675972f, -0.00255614961f, -0.00254914048f, -0.00245371764f, -0.00227088528f,
+   -0.00200470770f, -0.00166225294f, -0.00125341816f, -0.000790668128f, -0.000288644136f, 0.000236262567f,
+   0.000766445766f, 0.00128364982f, 0.00176965387f, 0.00220680726f, 0.00257872208f, 0.00287086377f,
+   0.00307109510f, 0.00317016640f, 0.00316210627f, 0.00304450723f, 0.00281870645f, 0.00248982408f,
+   0.00206668652f, 0.00156162609f, 0.000990067492f, 0.000370174617f, -0.000277782354f, -0.000932066527f,
+   -0.00157018634f, -0.00216965703f, -0.00270878663f, -0.00316744414f, -0.00352780125f, -0.00377500569f,
+   -0.00389776356f, -0.00388882682f, -0.00374533935f, -0.00346902339f, -0.00306626013f, -0.00254795724f,
+   -0.00192928931f, -0.00122926559f, -0.000470167171f, 0.000323151966f, 0.00112406514f, 0.00190505525f,
+   0.00263864640f, 0.00329837576f, 0.00385967642f, 0.00430087326f, 0.00460389070f, 0.00475503504f,
+   0.00474555092f, 0.00457204133f, 0.00423670607f, 0.00374740013f, 0.00311748520f, 0.00236549764f,
+   0.00151462248f, 0.000591997697f, -0.000372136128f, -0.00134538219f, -0.00229438581f, -0.00318577769f,
+   -0.00398745714f, -0.00466970308f, -0.00520625198f, -0.00557531090f, -0.00576034607f, -0.00575083448f,
+   -0.00554274721f, -0.00513882935f, -0.00454865908f, -0.00378849450f, -0.00288075232f, -0.00185352529f,
+   -0.000739632640f, 0.000424384838f, 0.00159944769f, 0.00274523441f, 0.00382154970f, 0.00478971703f,
+   0.00561395055f, 0.00626265584f, 0.00670961244f, 0.00693500275f, 0.00692623621f, 0.00667855050f,
+   0.00619528862f, 0.00548802782f, 0.00457633380f, 0.00348725426f, 0.00225454452f, 0.000917646044f,
+   -0.000479555980f, -0.00189013185f, -0.00326575548f, -0.00455820700f, -0.00572113460f, -0.00671167113f,
+   -0.00749199325f, -0.00803072285f, -0.00830418244f, -0.00829732139f, -0.00800445769f, -0.00742966263f,
+   -0.00658681989f, -0.00549939089f, -0.00419967668f, -0.00272805314f, -0.00113165763f, 0.000537084125f,
+   0.00222215638f, 0.00386581267f, 0.00541051012f, 0.00680099847f, 0.00798612367f, 0.00892078225f,
+   0.00956757553f, 0.00989826024f, 0.00989491865f, 0.00955077354f, 0.00887066405f, 0.00787111279f,
+   0.00657999748f, 0.00503582228f, 0.00328663224f, 0.00138843979f, -0.000596388709f, -0.00260124402f,
+   -0.00455746893f, -0.00639668200f, -0.00805312023f, -0.00946605857f, -0.0105818501f, -0.0113560315f,
+   -0.0117550064f, -0.0117574297f, -0.0113551887f, -0.0105539663f, -0.00937326625f, -0.00784609560f,
+   -0.00601805327f, -0.00394602166f, -0.00169643294f, 0.000656788121f, 0.00303477910f, 0.00535613252f,
+   0.00753978733f, 0.00950779952f, 0.0111880936f, 0.0125170378f, 0.0134418868f, 0.0139226876f,
+   0.0139340051f, 0.0134660620f, 0.0125253852f, 0.0111349346f, 0.00933353789f, 0.00717501249f,
+   0.00472652353f, 0.00206655310f, -0.000717573741f, -0.00353251980f, -0.00628198637f, -0.00887014531f,
+   -0.0112046795f, -0.0132002169f, -0.0147813400f, -0.0158853941f, -0.0164648984f, -0.0164894871f,
+   -0.0159472600f, -0.0148455938f, -0.0132112531f, -0.0110898660f, -0.00854476169f, -0.00565497205f,
+   -0.00251308340f, 0.000777848065f, 0.00410759076f, 0.00736238621f, 0.0104287434f, 0.0131975403f,
+   0.0155675597f, 0.0174493417f, 0.0187684223f, 0.0194682106f, 0.0195122659f, 0.0188859850f,
+   0.0175974835f, 0.0156778228f, 0.0131803807f, 0.0101794554f, 0.00676814234f, 0.00305556506f,
+   -0.000836797117f, -0.00477866828f, -0.00863551535f, -0.0122730229f, -0.0155617138f, -0.0183814466f,
+   -0.0206259005f, -0.0222062301f, -0.0230546668f, -0.0231272057f, -0.0224056095f, -0.0208985675f,
+   -0.0186418500f, -0.0156977680f, -0.0121534895f, -0.00811856333f, -0.00372162741f, 0.000893621356f,
+   0.00557297142f, 0.0101570738f, 0.0144863464f, 0.0184067413f, 0.0217750724f, 0.0244641397f,
+   0.0263674017f, 0.0274031535f, 0.0275176652f, 0.0266877394f, 0.0249220990f, 0.0222617500f,
+   0.0187793281f, 0.0145770004f, 0.00978398137f, 0.00455241092f, -0.000947305467f, -0.00653189933f,
+   -0.0120114218f, -0.0171953309f, -0.0218991507f, -0.0259510055f, -0.0291975569f, -0.0315097757f,
+   -0.0327879190f, -0.0329654515f, -0.0320121385f, -0.0299358144f, -0.0267829839f, -0.0226380918f,
+   -0.0176213440f, -0.0118855806f, -0.00561170420f, 0.000997053110f, 0.00772125507f, 0.0143325664f,
+   0.0206014998f, 0.0263049006f, 0.0312339254f, 0.0352014080f, 0.0380488709f, 0.0396523774f,
+   0.0399277247f, 0.0388341621f, 0.0363768078f, 0.0326075964f, 0.0276244450f, 0.0215692315f,
+   0.0146239176f, 0.00700511690f, -0.00104210537f, -0.00925204344f, -0.0173471048f, -0.0250465255f,
+   -0.0320761353f, -0.0381779298f, -0.0431189202f, -0.0466998853f, -0.0487630144f, -0.0491981618f,
+   -0.0479479320f, -0.0450108796f, -0.0404430889f, -0.0343577228f, -0.0269227568f, -0.0183564797f,
+   -0.00892180577f, 0.00108157983f, 0.0113266418f, 0.0214688163f, 0.0311574321f, 0.0400476046f,
+   0.0478115790f, 0.0541504584f, 0.0588054433f, 0.0615671761f, 0.0622845143f, 0.0608712398f,
+   0.0573108308f, 0.0516591892f, 0.0440446995f, 0.0346663855f, 0.0237893164f, 0.0117374286f,
+   -0.00111494935f, -0.0143543305f, -0.0275407191f, -0.0402213335f, -0.0519451313f, -0.0622782186f,
+   -0.0708186477f, -0.0772107840f, -0.0811588764f, -0.0824386552f, -0.0809076577f, -0.0765124410f,
+   -0.0692936778f, -0.0593881644f, -0.0470278002f, -0.0325357690f, -0.0163190570f, 0.00114150788f,
+   0.0193038154f, 0.0375801139f, 0.0553540327f, 0.0719991177f, 0.0868990496f, 0.0994675830f,
+   0.109168477f, 0.115535051f, 0.118187718f, 0.116850071f, 0.111362047f, 0.101690225f,
+   0.0879352093f, 0.0703342333f, 0.0492609031f, 0.0252200514f, -0.00116082653f, -0.0291438233f,
+   -0.0578975342f, -0.0865159333f, -0.114040837f, -0.139486596f, -0.161865801f, -0.180216521f,
+   -0.193629354f, -0.201274112f, -0.202424884f, -0.196483329f, -0.182999000f, -0.161686406f,
+   -0.132438138f, -0.0953335315f, -0.0506431088f, 0.00117256027f, 0.0594685562f, 0.123426318f,
+   0.192068875f, 0.264280230f, 0.338829488f, 0.414396971f, 0.489604503f, 0.563046217f,
+   0.633321643f, 0.699068069f, 0.758993208f, 0.811905861f, 0.856744528f, 0.892603159f,
+   0.918753028f, 0.934660435f, 0.939999998f, 0.934660435f, 0.918753028f, 0.892603159f,
+   0.856744528f, 0.811905861f, 0.758993208f, 0.699068069f, 0.633321643f, 0.563046217f,
+   0.489604503f, 0.414396971f, 0.338829488f, 0.264280230f, 0.192068875f, 0.123426318f,
+   0.0594685562f, 0.00117256027f, -0.0506431088f, -0.0953335315f, -0.132438138f, -0.161686406f,
+   -0.182999000f, -0.196483329f, -0.202424884f, -0.201274112f, -0.193629354f, -0.180216521f,
+   -0.161865801f, -0.139486596f, -0.114040837f, -0.0865159333f, -0.0578975342f, -0.0291438233f,
+   -0.00116082653f, 0.0252200514f, 0.0492609031f, 0.0703342333f, 0.0879352093f, 0.101690225f,
+   0.111362047f, 0.116850071f, 0.118187718f, 0.115535051f, 0.109168477f, 0.0994675830f,
+   0.0868990496f, 0.0719991177f, 0.0553540327f, 0.0375801139f, 0.0193038154f, 0.00114150788f,
+   -0.0163190570f, -0.0325357690f, -0.0470278002f, -0.0593881644f, -0.0692936778f, -0.0765124410f,
+   -0.0809076577f, -0.0824386552f, -0.0811588764f, -0.0772107840f, -0.0708186477f, -0.0622782186f,
+   -0.0519451313f, -0.0402213335f, -0.0275407191f, -0.0143543305f, -0.00111494935f, 0.0117374286f,
+   0.0237893164f, 0.0346663855f, 0.0440446995f, 0.0516591892f, 0.0573108308f, 0.0608712398f,
+   0.0622845143f, 0.0615671761f, 0.0588054433f, 0.0541504584f, 0.0478115790f, 0.0400476046f,
+   0.0311574321f, 0.0214688163f, 0.0113266418f, 0.00108157983f, -0.00892180577f, -0.0183564797f,
+   -0.0269227568f, -0.0343577228f, -0.0404430889f, -0.0450108796f, -0.0479479320f, -0.0491981618f,
+   -0.0487630144f, -0.0466998853f, -0.0431189202f, -0.0381779298f, -0.0320761353f, -0.0250465255f,
+   -0.0173471048f, -0.00925204344f, -0.00104210537f, 0.00700511690f, 0.0146239176f, 0.0215692315f,
+   0.0276244450f, 0.0326075964f, 0.0363768078f, 0.0388341621f, 0.0399277247f, 0.0396523774f,
+   0.0380488709f, 0.0352014080f, 0.0312339254f, 0.0263049006f, 0.0206014998f, 0.0143325664f,
+   0.00772125507f, 0.000997053110f, -0.00561170420f, -0.0118855806f, -0.0176213440f, -0.0226380918f,
+   -0.0267829839f, -0.0299358144f, -0.0320121385f, -0.0329654515f, -0.0327879190f, -0.0315097757f,
+   -0.0291975569f, -0.0259510055f, -0.0218991507f, -0.0171953309f, -0.0120114218f, -0.00653189933f,
+   -0.000947305467f, 0.00455241092f, 0.00978398137f, 0.0145770004f, 0.0187793281f, 0.0222617500f,
+   0.0249220990f, 0.0266877394f, 0.0275176652f, 0.0274031535f, 0.0263674017f, 0.0244641397f,
+   0.0217750724f, 0.0184067413f, 0.0144863464f, 0.0101570738f, 0.00557297142f, 0.000893621356f,
+   -0.00372162741f, -0.00811856333f, -0.0121534895f, -0.0156977680f, -0.0186418500f, -0.0208985675f,
+   -0.0224056095f, -0.0231272057f, -0.0230546668f, -0.0222062301f, -0.0206259005f, -0.0183814466f,
+   -0.0155617138f, -0.0122730229f, -0.00863551535f, -0.00477866828f, -0.000836797117f, 0.00305556506f,
+   0.00676814234f, 0.0101794554f, 0.0131803807f, 0.0156778228f, 0.0175974835f, 0.0188859850f,
+   0.0195122659f, 0.0194682106f, 0.0187684223f, 0.0174493417f, 0.0155675597f, 0.0131975403f,
+   0.0104287434f, 0.00736238621f, 0.00410759076f, 0.000777848065f, -0.00251308340f, -0.00565497205f,
+   -0.00854476169f, -0.0110898660f, -0.0132112531f, -0.0148455938f, -0.0159472600f, -0.0164894871f,
+   -0.0164648984f, -0.0158853941f, -0.0147813400f, -0.0132002169f, -0.0112046795f, -0.00887014531f,
+   -0.00628198637f, -0.00353251980f, -0.000717573741f, 0.00206655310f, 0.00472652353f, 0.00717501249f,
+   0.00933353789f, 0.0111349346f, 0.0125253852f, 0.0134660620f, 0.0139340051f, 0.0139226876f,
+   0.0134418868f, 0.0125170378f, 0.0111880936f, 0.00950779952f, 0.00753978733f, 0.00535613252f,
+   0.00303477910f, 0.000656788121f, -0.00169643294f, -0.00394602166f, -0.00601805327f, -0.00784609560f,
+   -0.00937326625f, -0.0105539663f, -0.0113551887f, -0.0117574297f, -0.0117550064f, -0.0113560315f,
+   -0.0105818501f, -0.00946605857f, -0.00805312023f, -0.00639668200f, -0.00455746893f, -0.00260124402f,
+   -0.000596388709f, 0.00138843979f, 0.00328663224f, 0.00503582228f, 0.00657999748f, 0.00787111279f,
+   0.00887066405f, 0.00955077354f, 0.00989491865f, 0.00989826024f, 0.00956757553f, 0.00892078225f,
+   0.00798612367f, 0.00680099847f, 0.00541051012f, 0.00386581267f, 0.00222215638f, 0.000537084125f,
+   -0.00113165763f, -0.00272805314f, -0.00419967668f, -0.00549939089f, -0.00658681989f, -0.00742966263f,
+   -0.00800445769f, -0.00829732139f, -0.00830418244f, -0.00803072285f, -0.00749199325f, -0.00671167113f,
+   -0.00572113460f, -0.00455820700f, -0.00326575548f, -0.00189013185f, -0.000479555980f, 0.000917646044f,
+   0.00225454452f, 0.00348725426f, 0.00457633380f, 0.00548802782f, 0.00619528862f, 0.00667855050f,
+   0.00692623621f, 0.00693500275f, 0.00670961244f, 0.00626265584f, 0.00561395055f, 0.00478971703f,
+   0.00382154970f, 0.00274523441f, 0.00159944769f, 0.000424384838f, -0.000739632640f, -0.00185352529f,
+   -0.00288075232f, -0.00378849450f, -0.00454865908f, -0.00513882935f, -0.00554274721f, -0.00575083448f,
+   -0.00576034607f, -0.00557531090f, -0.00520625198f, -0.00466970308f, -0.00398745714f, -0.00318577769f,
+   -0.00229438581f, -0.00134538219f, -0.000372136128f, 0.000591997697f, 0.00151462248f, 0.00236549764f,
+   0.00311748520f, 0.00374740013f, 0.00423670607f, 0.00457204133f, 0.00474555092f, 0.00475503504f,
+   0.00460389070f, 0.00430087326f, 0.00385967642f, 0.00329837576f, 0.00263864640f, 0.00190505525f,
+   0.00112406514f, 0.000323151966f, -0.000470167171f, -0.00122926559f, -0.00192928931f, -0.00254795724f,
+   -0.00306626013f, -0.00346902339f, -0.00374533935f, -0.00388882682f, -0.00389776356f, -0.00377500569f,
+   -0.00352780125f, -0.00316744414f, -0.00270878663f, -0.00216965703f, -0.00157018634f, -0.000932066527f,
+   -0.000277782354f, 0.000370174617f, 0.000990067492f, 0.00156162609f, 0.00206668652f, 0.00248982408f,
+   0.00281870645f, 0.00304450723f, 0.00316210627f, 0.00317016640f, 0.00307109510f, 0.00287086377f,
+   0.00257872208f, 0.00220680726f, 0.00176965387f, 0.00128364982f, 0.000766445766f, 0.000236262567f,
+   -0.000288644136f, -0.000790668128f, -0.00125341816f, -0.00166225294f, -0.00200470770f, -0.00227088528f,
+   -0.00245371764f, -0.00254914048f, -0.00255614961f, -0.00247675972f, -0.00231586234f, -0.00208098837f,
+   -0.00178196328f, -0.00143054849f, -0.00103997218f, -0.000624448876f, -0.000198668582f, 0.000222711344f,
+   0.000625564135f, 0.000996757997f, 0.00132457784f, 0.00159908272f, 0.00181240076f, 0.00195894693f,
+   0.00203553564f, 0.00204143021f, 0.00197831145f, 0.00185015658f, 0.00166303653f, 0.00142485776f,
+   0.00114504609f, 0.000834181963f, 0.000503614137f, 0.000165050966f, -0.000169845414f, -0.000489854137f,
+   -0.000784555043f, -0.00104469969f, -0.00126243394f, -0.00143156631f, -0.00154772424f, -0.00160844880f,
+   -0.00161323010f, -0.00156347733f, -0.00146238506f, -0.00131481141f, -0.00112705096f, -0.000906585541f,
+   -0.000661801139f, -0.000401647965f, -0.000135366587f, 0.000127865249f, 0.000379234378f, 0.000610581716f,
+   0.000814660161f, 0.000985356513f, 0.00111786381f, 0.00120881048f, 0.00125633040f, 0.00126008352f,
+   0.00122122548f, 0.00114232325f, 0.00102722144f, 0.000880889187f, 0.000709191605f, 0.000518689456f,
+   0.000316384976f, 0.000109473272f, -9.49098830e-05f, -0.000289927761f, -0.000469266903f, -0.000627335336f,
+   -0.000759432442f, -0.000861877052f, -0.000932115770f, -0.000968755863f, -0.000971589063f, -0.000941562233f,
+   -0.000880706531f, -0.000792036182f, -0.000679417106f, -0.000547405914f, -0.000401076482f, -0.000245830626f,
+   -8.71978700e-05f, 6.93474940e-05f, 0.000218570131f, 0.000355663564f, 0.000476370973f, 0.000577131868f,
+   0.000655177573f, 0.000708598061f, 0.000736381975f, 0.000738420058f, 0.000715480302f, 0.000669155270f,
+   0.000601777923f, 0.000516321103f, 0.000416276336f, 0.000305506488f, 0.000188120117f, 6.83110120e-05f,
+   -4.97839537e-05f, -0.000162225449f, -0.000265397306f, -0.000356119650f, -0.000431742228f, -0.000490218168f,
+   -0.000530152000f, -0.000550825731f, -0.000552201236f, -0.000534896972f, -0.000500144961f, -0.000449727348f,
+   -0.000385897001f, -0.000311285141f, -0.000228796780f, -0.000141503595f, -5.25321884e-05f, 3.50439404e-05f,
+   0.000118307580f, 0.000194591790f, 0.000261562411f, 0.000317284925f, 0.000360280217f, 0.000389551045f,
+   0.000404604245f, 0.000405449333f, 0.000392578135f, 0.000366931257f, 0.000329850300f, 0.000283015601f,
+   0.000228378136f, 0.000168081489f, 0.000104382059f, 3.95678617e-05f, -2.41193047e-05f, -8.45665927e-05f,
+   -0.000139845521f, -0.000188278835f, -0.000228486853f, -0.000259422493f, -0.000280395529f, -0.000291081466f,
+   -0.000291518809f, -0.000282094552f, -0.000263515918f, -0.000236775290f, -0.000203104646f, -0.000163920748f,
+   -0.000120775097f, -7.52912019e-05f, -2.91075921e-05f, 1.61794633e-05f, 5.90686504e-05f, 9.82015044e-05f,
+   0.000132402958f, 0.000160714641f, 0.000182418429f, 0.000197051384f, 0.000204411685f, 0.000204553740f,
+   0.000197777146f, 0.000184603196f, 0.000165752601f, 0.000142108693f, 0.000114680646f, 8.45642426e-05f,
+   5.28998571e-05f, 2.08316815e-05f, -1.05318086e-05f, -4.01545803e-05f, -6.71055313e-05f, -9.05851484e-05f,
+   -0.000109950321f, -0.000124725208f, -0.000134612870f, -0.000139497512f, -0.000139439639f, -0.000134666436f,
+   -0.000125556733f, -0.000112620321f, -9.64752762e-05f, -7.78195244e-05f, -5.74083060e-05f, -3.60202102e-05f,
+   -1.44313817e-05f, 6.61358263e-06f, 2.64221180e-05f, 4.43776698e-05f, 5.99569685e-05f, 7.27434453e-05f,
+   8.24369199e-05f, 8.88580325e-05f, 9.19487720e-05f, 9.17688303e-05f, 8.84872934e-05f, 8.23719893e-05f,
+   7.37747832e-05f, 6.31154617e-05f, 5.08639132e-05f, 3.75209020e-05f, 2.35994758e-05f, 9.60583111e-06f,
+   -3.97474196e-06f, -1.67003764e-05f, -2.81793273e-05f, -3.80844976e-05f, -4.61605123e-05f, -5.22288901e-05f,
+   -5.61904017e-05f, -5.80239721e-05f, -5.77836618e-05f, -5.55923434e-05f, -5.16338441e-05f, -4.61433483e-05f,
+   -3.93959745e-05f, -3.16953083e-05f, -2.33608480e-05f, -1.47160608e-05f, -6.07681159e-06f, 2.25944109e-06f,
+   1.00229836e-05f, 1.69784580e-05f, 2.29340276e-05f, 2.77441122e-05f, 3.13118180e-05f, 3.35897057e-05f,
+   3.45783374e-05f, 3.43234351e-05f, 3.29118120e-05f, 3.04652040e-05f, 2.71343924e-05f, 2.30916885e-05f,
+   1.85235822e-05f, 1.36232620e-05f, 8.58311796e-06f, 3.58806619e-06f, -1.19071046e-06f, -5.60095577e-06f,
+   -9.51362563e-06f, -1.28259717e-05f, -1.54635927e-05f, -1.73783283e-05f, -1.85559038e-05f, -1.90076989e-05f,
+   -1.87702226e-05f, -1.79022463e-05f, -1.64809298e-05f, -1.45977911e-05f, -1.23543869e-05f, -9.85772476e-06f,
+   -7.21607375e-06f, -4.53475650e-06f, -1.91269260e-06f, 5.61434774e-07f, 2.81080543e-06f, 4.77303547e-06f,
+   6.40125427e-06f, 7.66466655e-06f, 8.54851623e-06f, 9.05330398e-06f, 9.19366721e-06f, 8.99187035e-06f,
+   8.49017488e-06f, 7.73463853e-06f, 6.77687831e-06f, 5.67169855e-06f, 4.47456932e-06f, 3.23942459e-06f,
+   2.01666626e-06f, 8.51414313e-07f, -2.17796185e-07f, -1.16000558e-06f, -1.95238158e-06f, -2.58042473e-06f,
+   -3.03776119e-06f, -3.32567856e-06f, -3.45229932e-06f, -3.43157990e-06f, -3.28222086e-06f, -3.02625358e-06f,
+   -2.68787448e-06f, 0.00000000f, 0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_48[480] = {
+   6.77687831e-06f, -1.23543869e-05f, 1.85235822e-05f, -2.33608480e-05f, 2.35994758e-05f, -1.44313817e-05f,
+   -1.05318086e-05f, 5.90686504e-05f, -0.000139845521f, 0.000261562411f, -0.000431742228f, 0.000655177573f,
+   -0.000932115770f, 0.00125633040f, -0.00161323010f, 0.00197831145f, -0.00231586234f, 0.00257872208f,
+   -0.00270878663f, 0.00263864640f, -0.00229438581f, 0.00159944769f, -0.000479555980f, -0.00113165763f,
+   0.00328663224f, -0.00601805327f, 0.00933353789f, -0.0132112531f, 0.0175974835f, -0.0224056095f,
+   0.0275176652f, -0.0327879190f, 0.0380488709f, -0.0431189202f, 0.0478115790f, -0.0519451313f,
+   0.0553540327f, -0.0578975342f, 0.0594685562f, 0.939999998f, 0.0594685562f, -0.0578975342f,
+   0.0553540327f, -0.0519451313f, 0.0478115790f, -0.0431189202f, 0.0380488709f, -0.0327879190f,
+   0.0275176652f, -0.0224056095f, 0.0175974835f, -0.0132112531f, 0.00933353789f, -0.00601805327f,
+   0.00328663224f, -0.00113165763f, -0.000479555980f, 0.00159944769f, -0.00229438581f, 0.00263864640f,
+   -0.00270878663f, 0.00257872208f, -0.00231586234f, 0.00197831145f, -0.00161323010f, 0.00125633040f,
+   -0.000932115770f, 0.000655177573f, -0.000431742228f, 0.000261562411f, -0.000139845521f, 5.90686504e-05f,
+   -1.05318086e-05f, -1.44313817e-05f, 2.35994758e-05f, -2.33608480e-05f, 1.85235822e-05f, -1.23543869e-05f,
+   6.77687831e-06f, -2.68787448e-06f, 3.65211099e-06f, -5.42671251e-06f, 5.23695553e-06f, -4.68506244e-07f,
+   -1.25794768e-05f, 3.86335523e-05f, -8.31880971e-05f, 0.000151981643f, -0.000250190380f, 0.000381360238f,
+   -0.000546090305f, 0.000740571297f, -0.000955118041f, 0.00117286085f, -0.00136880856f, 0.00150937482f,
+   -0.00155271252f, 0.00145001977f, -0.00114770117f, 0.000590619980f, 0.000273677782f, -0.00149009458f,
+   0.00309044169f, -0.00508787157f, 0.00747145899f, -0.0102011971f, 0.0132042421f, -0.0163717568f,
+   0.0195569359f, -0.0225730389f, 0.0251904391f, -0.0271295793f, 0.0280436948f, -0.0274773110f,
+   0.0247660074f, -0.0187779553f, 0.00714584906f, 0.0166520774f, -0.0812606364f, 0.902429044f,
+   0.239887193f, -0.131296903f, 0.0955714956f, -0.0753384009f, 0.0608675554f, -0.0492386706f,
+   0.0393514372f, -0.0307506360f, 0.0232441146f, -0.0167505778f, 0.0112303356f, -0.00665103039f,
+   0.00297144032f, -0.000134328264f, -0.00193497655f, 0.00332609750f, -0.00413954165f, 0.00448127417f,
+   -0.00445724791f, 0.00416835677f, -0.00370594789f, 0.00314882142f, -0.00256126164f, 0.00199233857f,
+   -0.00147633615f, 0.00103396876f, -0.000674455659f, 0.000397913944f, -0.000197815287f, 6.34144162e-05f,
+   1.81060459e-05f, -5.98932202e-05f, 7.41249532e-05f, -7.11734538e-05f, 5.91847675e-05f, -4.40195981e-05f,
+   2.94450329e-05f, -1.74857196e-05f, 8.85583540e-06f, -3.39506937e-06f, 4.82695100e-07f, 1.33963943e-06f,
+   -6.96592951e-06f, 1.90826395e-05f, -4.09903769e-05f, 7.63291901e-05f, -0.000128573432f, 0.000200315015f,
+   -0.000292353856f, 0.000402645237f, -0.000525173731f, 0.000648900867f, -0.000756942958f, 0.000826159201f,
+   -0.000827259850f, 0.000725610764f, -0.000482923148f, 5.98077604e-05f, 0.000580954715f, -0.00147034682f,
+   0.00262839813f, -0.00405950798f, 0.00574761396f, -0.00765193300f, 0.00970329437f, -0.0118014654f,
+   0.0138136465f, -0.0155736450f, 0.0168812871f, -0.0175005458f, 0.0171545353f, -0.0155118024f,
+   0.0121555636f, -0.00651430385f, -0.00229634228f, 0.0158630349f, -0.0375797898f, 0.0766082183f,
+   -0.169670820f, 0.795116007f, 0.439575374f, -0.185278997f, 0.116847828f, -0.0822451636f,
+   0.0599217303f, -0.0436650254f, 0.0310752653f, -0.0210557710f, 0.0130378520f, -0.00668636011f,
+   0.00177176634f, 0.00188899529f, -0.00446103932f, 0.00610323343f, -0.00697224867f, 0.00722121354f,
+   -0.00699683512f, 0.00643517217f, -0.00565808918f, 0.00477000233f, -0.00385595765f, 0.00298109069f,
+   -0.00219112542f, 0.00151403050f, -0.000962344639f, 0.000536154199f, -0.000226361008f, 1.77240745e-05f,
+   0.000108257220f, -0.000170943982f, 0.000188672566f, -0.000177500580f, 0.000150462118f, -0.000117321280f,
+   8.47052288e-05f, -5.65292648e-05f, 3.45419867e-05f, -1.89359944e-05f, 8.92656044e-06f, -3.24815005e-06f,
+   -1.95238158e-06f, 6.40125427e-06f, -1.54635927e-05f, 3.13118180e-05f, -5.61904017e-05f, 9.19487720e-05f,
+   -0.000139439639f, 0.000197777146f, -0.000263515918f, 0.000329850300f, -0.000385897001f, 0.000416276336f,
+   -0.000401076482f, 0.000316384976f, -0.000135366587f, -0.000169845414f, 0.000625564135f, -0.00125341816f,
+   0.00206668652f, -0.00306626013f, 0.00423670607f, -0.00554274721f, 0.00692623621f, -0.00830418244f,
+   0.00956757553f, -0.0105818501f, 0.0111880936f, -0.0112046795f, 0.0104287434f, -0.00863551535f,
+   0.00557297142f, -0.000947305467f, -0.00561170420f, 0.0146239176f, -0.0269227568f, 0.0440446995f,
+   -0.0692936778f, 0.111362047f, -0.202424884f, 0.633321643f, 0.633321643f, -0.202424884f,
+   0.111362047f, -0.0692936778f, 0.0440446995f, -0.0269227568f, 0.0146239176f, -0.00561170420f,
+   -0.000947305467f, 0.00557297142f, -0.00863551535f, 0.0104287434f, -0.0112046795f, 0.0111880936f,
+   -0.0105818501f, 0.00956757553f, -0.00830418244f, 0.00692623621f, -0.00554274721f, 0.00423670607f,
+   -0.00306626013f, 0.00206668652f, -0.00125341816f, 0.000625564135f, -0.000169845414f, -0.000135366587f,
+   0.000316384976f, -0.000401076482f, 0.000416276336f, -0.000385897001f, 0.000329850300f, -0.000263515918f,
+   0.000197777146f, -0.000139439639f, 9.19487720e-05f, -5.61904017e-05f, 3.13118180e-05f, -1.54635927e-05f,
+   6.40125427e-06f, -1.95238158e-06f, -3.24815005e-06f, 8.92656044e-06f, -1.89359944e-05f, 3.45419867e-05f,
+   -5.65292648e-05f, 8.47052288e-05f, -0.000117321280f, 0.000150462118f, -0.000177500580f, 0.000188672566f,
+   -0.000170943982f, 0.000108257220f, 1.77240745e-05f, -0.000226361008f, 0.000536154199f, -0.000962344639f,
+   0.00151403050f, -0.00219112542f, 0.00298109069f, -0.00385595765f, 0.00477000233f, -0.00565808918f,
+   0.00643517217f, -0.00699683512f, 0.00722121354f, -0.00697224867f, 0.00610323343f, -0.00446103932f,
+   0.00188899529f, 0.00177176634f, -0.00668636011f, 0.0130378520f, -0.0210557710f, 0.0310752653f,
+   -0.0436650254f, 0.0599217303f, -0.0822451636f, 0.116847828f, -0.185278967f, 0.439575315f,
+   0.795116007f, -0.169670776f, 0.0766082183f, -0.0375797898f, 0.0158630349f, -0.00229634228f,
+   -0.00651430385f, 0.0121555636f, -0.0155118024f, 0.0171545353f, -0.0175005458f, 0.0168812871f,
+   -0.0155736450f, 0.0138136465f, -0.0118014654f, 0.00970329437f, -0.00765193300f, 0.00574761396f,
+   -0.00405950798f, 0.00262839813f, -0.00147034682f, 0.000580954715f, 5.98077604e-05f, -0.000482923148f,
+   0.000725610764f, -0.000827259850f, 0.000826159201f, -0.000756942958f, 0.000648900867f, -0.000525173731f,
+   0.000402645237f, -0.000292353856f, 0.000200315015f, -0.000128573432f, 7.63291901e-05f, -4.09903769e-05f,
+   1.90826395e-05f, -6.96592951e-06f, 1.33963943e-06f, 4.82695100e-07f, -3.39506937e-06f, 8.85583540e-06f,
+   -1.74857196e-05f, 2.94450329e-05f, -4.40195981e-05f, 5.91847675e-05f, -7.11734538e-05f, 7.41249532e-05f,
+   -5.98932202e-05f, 1.81060459e-05f, 6.34144162e-05f, -0.000197815287f, 0.000397913944f, -0.000674455659f,
+   0.00103396876f, -0.00147633615f, 0.00199233857f, -0.00256126164f, 0.00314882142f, -0.00370594789f,
+   0.00416835677f, -0.00445724791f, 0.00448127417f, -0.00413954165f, 0.00332609750f, -0.00193497655f,
+   -0.000134328264f, 0.00297144032f, -0.00665103039f, 0.0112303356f, -0.0167505778f, 0.0232441146f,
+   -0.0307506360f, 0.0393514372f, -0.0492386706f, 0.0608675554f, -0.0753384009f, 0.0955714956f,
+   -0.131296962f, 0.239887193f, 0.902429044f, -0.0812607259f, 0.0166520774f, 0.00714584906f,
+   -0.0187779553f, 0.0247660074f, -0.0274773110f, 0.0280436948f, -0.0271295793f, 0.0251904391f,
+   -0.0225730389f, 0.0195569359f, -0.0163717568f, 0.0132042421f, -0.0102011971f, 0.00747145899f,
+   -0.00508787157f, 0.00309044169f, -0.00149009458f, 0.000273677782f, 0.000590619980f, -0.00114770117f,
+   0.00145001977f, -0.00155271252f, 0.00150937482f, -0.00136880856f, 0.00117286085f, -0.000955118041f,
+   0.000740571297f, -0.000546090305f, 0.000381360238f, -0.000250190380f, 0.000151981643f, -8.31880971e-05f,
+   3.86335523e-05f, -1.25794768e-05f, -4.68506244e-07f, 5.23695553e-06f, -5.42671251e-06f, 3.65211099e-06f,
+};
+
+static const spx_word16_t resample_table_49[160] = {
+   2.37882773e-06f, -5.08721200e-07f, -5.69400436e-06f, -9.04753335e-07f, 1.06322859e-05f, 5.09318352e-06f,
+   -1.67841845e-05f, -1.37538918e-05f, 2.28995159e-05f, 2.86432660e-05f, -2.66014085e-05f, -5.11306316e-05f,
+   2.42460792e-05f, 8.16067259e-05f, -1.09866824e-05f, -0.000118750395f, -1.88595732e-05f, 0.000158804716f,
+   7.10951499e-05f, -0.000194976135f, -0.000150538894f, 0.000217141060f, 0.000259607448f, -0.000211994382f,
+   -0.000396680494f, 0.000163856748f, 0.000554501079f, -5.61799061e-05f, -0.000718760479f, -0.000126180486f,
+   0.000867328839f, 0.000394110917f, -0.000970328227f, -0.000750879233f, 0.000991339795f, 0.00118878053f,
+   -0.000889935473f, -0.00168606581f, 0.000625485904f, 0.00220480235f, -0.000162247336f, -0.00269004144f,
+   -0.000524633506f, 0.00307060382f, 0.00144288898f, -0.00326215383f, -0.00257692789f, 0.00317218481f,
+   0.00388262654f, -0.00270701363f, -0.00528370356f, 0.00178022799f, 0.00667005870f, -0.000321901840f,
+   -0.00789848156f, -0.00171212247f, 0.00879543368f, 0.00433212984f, -0.00916111097f, -0.00750843482f,
+   0.00877341907f, 0.0111681689f, -0.00738856615f, -0.0151956622f, 0.00473288447f, 0.0194367673f,
+   -0.000474657601f, -0.0237068515f, -0.00584975723f, 0.0278022382f, 0.0150250643f, -0.0315138400f,
+   -0.0286860336f, 0.0346428491f, 0.0511280484f, -0.0370154604f, -0.0983573273f, 0.0384964384f,
+   0.315688014f, 0.460999995f, 0.315688014f, 0.0384964384f, -0.0983573273f, -0.0370154604f,
+   0.0511280484f, 0.0346428491f, -0.0286860336f, -0.0315138400f, 0.0150250643f, 0.0278022382f,
+   -0.00584975723f, -0.0237068515f, -0.000474657601f, 0.0194367673f, 0.00473288447f, -0.0151956622f,
+   -0.00738856615f, 0.0111681689f, 0.00877341907f, -0.00750843482f, -0.00916111097f, 0.00433212984f,
+   0.00879543368f, -0.00171212247f, -0.00789848156f, -0.000321901840f, 0.00667005870f, 0.00178022799f,
+   -0.00528370356f, -0.00270701363f, 0.00388262654f, 0.00317218481f, -0.00257692789f, -0.00326215383f,
+   0.00144288898f, 0.00307060382f, -0.000524633506f, -0.00269004144f, -0.000162247336f, 0.00220480235f,
+   0.000625485904f, -0.00168606581f, -0.000889935473f, 0.00118878053f, 0.000991339795f, -0.000750879233f,
+   -0.000970328227f, 0.000394110917f, 0.000867328839f, -0.000126180486f, -0.000718760479f, -5.61799061e-05f,
+   0.000554501079f, 0.000163856748f, -0.000396680494f, -0.000211994382f, 0.000259607448f, 0.000217141060f,
+   -0.000150538894f, -0.000194976135f, 7.10951499e-05f, 0.000158804716f, -1.88595732e-05f, -0.000118750395f,
+   -1.09866824e-05f, 8.16067259e-05f, 2.42460792e-05f, -5.11306316e-05f, -2.66014085e-05f, 2.86432660e-05f,
+   2.28995159e-05f, -1.37538918e-05f, -1.67841845e-05f, 5.09318352e-06f, 1.06322859e-05f, -9.04753335e-07f,
+   -5.69400436e-06f, -5.08721200e-07f, 2.37882773e-06f, 5.20191236e-07f,
+};
+
+static const spx_word16_t resample_table_52[240] = {
+   1.34571167e-06f, 1.42342833e-06f, -3.39147448e-07f, -2.98845180e-06f, -3.76497428e-06f, -6.03168871e-07f,
+   4.96403391e-06f, 7.78977392e-06f, 3.39545568e-06f, -6.60748265e-06f, -1.37297066e-05f, -9.16910267e-06f,
+   6.70254212e-06f, 2.13511630e-05f, 1.90955088e-05f, -3.43046099e-06f, -2.96876351e-05f, -3.40870865e-05f,
+   -5.56254327e-06f, 3.67769608e-05f, 5.44044087e-05f, 2.29336310e-05f, -3.94966919e-05f, -7.91669372e-05f,
+   -5.12215556e-05f, 3.35628756e-05f, 0.000105869804f, 9.22335676e-05f, -1.37619863e-05f, -0.000129984532f,
+   -0.000146268067f, -2.55209015e-05f, 0.000144760706f, 0.000211269216f, 8.94612022e-05f, -0.000141330893f,
+   -0.000282023946f, -0.000181647862f, 0.000109237822f, 0.000349548587f, 0.000302747183f, -3.74558185e-05f,
+   -0.000400848337f, -0.000449078914f, -8.41203218e-05f, 0.000419219170f, 0.000611318508f, 0.000262736925f,
+   -0.000385226245f, -0.000773576961f, -0.000500586117f, 0.000278399122f, 0.000913087279f, 0.000792516570f,
+   -7.96678214e-05f, -0.00100073032f, -0.00112404383f, -0.000225618263f, 0.00100252801f, 0.00146986672f,
+   0.000644228363f, -0.000882184540f, -0.00179336092f, -0.00117164745f, 0.000604753208f, 0.00204707333f,
+   0.00178890757f, -0.000140975972f, -0.00217476906f, -0.00246024807f, -0.000527726428f, 0.00211479631f,
+   0.00313185342f, 0.00140431593f, -0.00180468499f, -0.00373211550f, -0.00247147121f, 0.00118683069f,
+   0.00417341711f, 0.00368785975f, -0.000214615837f, -0.00435542315f, -0.00498564355f, -0.00114139833f,
+   0.00416944595f, 0.00626938837f, 0.00288806856f, -0.00350332074f, -0.00741618825f, -0.00500560552f,
+   0.00224549952f, 0.00827633403f, 0.00744542992f, -0.000286562048f, -0.00867285393f, -0.0101304352f,
+   -0.00248486968f, 0.00839639548f, 0.0129578421f, 0.00619760435f, -0.00718825683f, -0.0158045720f,
+   -0.0110375537f, 0.00469399430f, 0.0185348373f, 0.0173448604f, -0.000339482009f, -0.0210092384f,
+   -0.0258732773f, -0.00703270501f, 0.0230952539f, 0.0386298336f, 0.0204802323f, -0.0246769916f,
+   -0.0627209693f, -0.0522242971f, 0.0256643128f, 0.148742467f, 0.261672527f, 0.307333320f,
+   0.261672527f, 0.148742467f, 0.0256643128f, -0.0522242971f, -0.0627209693f, -0.0246769916f,
+   0.0204802323f, 0.0386298336f, 0.0230952539f, -0.00703270501f, -0.0258732773f, -0.0210092384f,
+   -0.000339482009f, 0.0173448604f, 0.0185348373f, 0.00469399430f, -0.0110375537f, -0.0158045720f,
+   -0.00718825683f, 0.00619760435f, 0.0129578421f, 0.00839639548f, -0.00248486968f, -0.0101304352f,
+   -0.00867285393f, -0.000286562048f, 0.00744542992f, 0.00827633403f, 0.00224549952f, -0.00500560552f,
+   -0.00741618825f, -0.00350332074f, 0.00288806856f, 0.00626938837f, 0.00416944595f, -0.00114139833f,
+   -0.00498564355f, -0.00435542315f, -0.000214615837f, 0.00368785975f, 0.00417341711f, 0.00118683069f,
+   -0.00247147121f, -0.00373211550f, -0.00180468499f, 0.00140431593f, 0.00313185342f, 0.00211479631f,
+   -0.000527726428f, -0.00246024807f, -0.00217476906f, -0.000140975972f, 0.00178890757f, 0.00204707333f,
+   0.000604753208f, -0.00117164745f, -0.00179336092f, -0.000882184540f, 0.000644228363f, 0.00146986672f,
+   0.00100252801f, -0.000225618263f, -0.00112404383f, -0.00100073032f, -7.96678214e-05f, 0.000792516570f,
+   0.000913087279f, 0.000278399122f, -0.000500586117f, -0.000773576961f, -0.000385226245f, 0.000262736925f,
+   0.000611318508f, 0.000419219170f, -8.41203218e-05f, -0.000449078914f, -0.000400848337f, -3.74558185e-05f,
+   0.000302747183f, 0.000349548587f, 0.000109237822f, -0.000181647862f, -0.000282023946f, -0.000141330893f,
+   8.94612022e-05f, 0.000211269216f, 0.000144760706f, -2.55209015e-05f, -0.000146268067f, -0.000129984532f,
+   -1.37619863e-05f, 9.22335676e-05f, 0.000105869804f, 3.35628756e-05f, -5.12215556e-05f, -7.91669372e-05f,
+   -3.94966919e-05f, 2.29336310e-05f, 5.44044087e-05f, 3.67769608e-05f, -5.56254327e-06f, -3.40870865e-05f,
+   -2.96876351e-05f, -3.43046099e-06f, 1.90955088e-05f, 2.13511630e-05f, 6.70254212e-06f, -9.16910267e-06f,
+   -1.37297066e-05f, -6.60748265e-06f, 3.39545568e-06f, 7.78977392e-06f, 4.96403391e-06f, -6.03168871e-07f,
+   -3.76497428e-06f, -2.98845180e-06f, -3.39147448e-07f, 1.42342833e-06f, 1.34571167e-06f, 3.46804683e-07f,
+};
+
+static const spx_word16_t resample_table_53[240] = {
+   2.84685666e-06f, -5.97690359e-06f, -1.20633774e-06f, 1.55795478e-05f, -1.32149653e-05f, -1.83382053e-05f,
+   4.27023260e-05f, -6.86092199e-06f, -6.81741731e-05f, 7.35539215e-05f, 4.58672621e-05f, -0.000158333874f,
+   6.71257512e-05f, 0.000184467135f, -0.000259969063f, -5.10418031e-05f, 0.000422538433f, -0.000282661786f,
+   -0.000363295723f, 0.000699097174f, -7.49116371e-05f, -0.000898157828f, 0.000838438340f, 0.000525473850f,
+   -0.00154715392f, 0.000556798244f, 0.00158503314f, -0.00200146064f, -0.000451236527f, 0.00293973344f,
+   -0.00176436908f, -0.00234329491f, 0.00409414666f, -0.000281951943f, -0.00492049614f, 0.00422959263f,
+   0.00280863186f, -0.00746423099f, 0.00237366138f, 0.00737571949f, -0.00871084630f, -0.00228279666f,
+   0.0125387767f, -0.00700664148f, -0.0100112110f, 0.0165526681f, -0.000573124096f, -0.0202608705f,
+   0.0167927910f, 0.0123952087f, -0.0316091441f, 0.00938798860f, 0.0346897207f, -0.0420184769f,
+   -0.0140654100f, 0.0772596672f, -0.0493539833f, -0.104448594f, 0.297484934f, 0.614666641f,
+   0.297484934f, -0.104448594f, -0.0493539833f, 0.0772596672f, -0.0140654100f, -0.0420184769f,
+   0.0346897207f, 0.00938798860f, -0.0316091441f, 0.0123952087f, 0.0167927910f, -0.0202608705f,
+   -0.000573124096f, 0.0165526681f, -0.0100112110f, -0.00700664148f, 0.0125387767f, -0.00228279666f,
+   -0.00871084630f, 0.00737571949f, 0.00237366138f, -0.00746423099f, 0.00280863186f, 0.00422959263f,
+   -0.00492049614f, -0.000281951943f, 0.00409414666f, -0.00234329491f, -0.00176436908f, 0.00293973344f,
+   -0.000451236527f, -0.00200146064f, 0.00158503314f, 0.000556798244f, -0.00154715392f, 0.000525473850f,
+   0.000838438340f, -0.000898157828f, -7.49116371e-05f, 0.000699097174f, -0.000363295723f, -0.000282661786f,
+   0.000422538433f, -5.10418031e-05f, -0.000259969063f, 0.000184467135f, 6.71257512e-05f, -0.000158333874f,
+   4.58672621e-05f, 7.35539215e-05f, -6.81741731e-05f, -6.86092199e-06f, 4.27023260e-05f, -1.83382053e-05f,
+   -1.32149653e-05f, 1.55795478e-05f, -1.20633774e-06f, -5.97690359e-06f, 2.84685666e-06f, 6.93609365e-07f,
+   2.69142333e-06f, -6.78294896e-07f, -7.52994856e-06f, 9.92806781e-06f, 6.79091136e-06f, -2.74594131e-05f,
+   1.34050842e-05f, 3.81910177e-05f, -5.93752702e-05f, -1.11250865e-05f, 0.000108808817f, -7.89933838e-05f,
+   -0.000102443111f, 0.000211739607f, -2.75239727e-05f, -0.000292536133f, 0.000289521413f, 0.000178922404f,
+   -0.000564047892f, 0.000218475645f, 0.000605494366f, -0.000801696675f, -0.000168240644f, 0.00122263702f,
+   -0.000770452491f, -0.00100117223f, 0.00182617456f, -0.000159335643f, -0.00224808767f, 0.00200505601f,
+   0.00128845673f, -0.00358672184f, 0.00120950642f, 0.00357781514f, -0.00434953813f, -0.00105545286f,
+   0.00626370683f, -0.00360936997f, -0.00494294241f, 0.00834683422f, -0.000429231673f, -0.00997128710f,
+   0.00833889190f, 0.00577613711f, -0.0148323765f, 0.00449099904f, 0.0148908598f, -0.0173457079f,
+   -0.00496973936f, 0.0259156842f, -0.0143765137f, -0.0220751073f, 0.0370696746f, -0.000678964017f,
+   -0.0517465547f, 0.0461905077f, 0.0409604646f, -0.125441939f, 0.0513286255f, 0.523345053f,
+   0.523345053f, 0.0513286255f, -0.125441939f, 0.0409604646f, 0.0461905077f, -0.0517465547f,
+   -0.000678964017f, 0.0370696746f, -0.0220751073f, -0.0143765137f, 0.0259156842f, -0.00496973936f,
+   -0.0173457079f, 0.0148908598f, 0.00449099904f, -0.0148323765f, 0.00577613711f, 0.00833889190f,
+   -0.00997128710f, -0.000429231673f, 0.00834683422f, -0.00494294241f, -0.00360936997f, 0.00626370683f,
+   -0.00105545286f, -0.00434953813f, 0.00357781514f, 0.00120950642f, -0.00358672184f, 0.00128845673f,
+   0.00200505601f, -0.00224808767f, -0.000159335643f, 0.00182617456f, -0.00100117223f, -0.000770452491f,
+   0.00122263702f, -0.000168240644f, -0.000801696675f, 0.000605494366f, 0.000218475645f, -0.000564047892f,
+   0.000178922404f, 0.000289521413f, -0.000292536133f, -2.75239727e-05f, 0.000211739607f, -0.000102443111f,
+   -7.89933838e-05f, 0.000108808817f, -1.11250865e-05f, -5.93752702e-05f, 3.81910177e-05f, 1.34050842e-05f,
+   -2.74594131e-05f, 6.79091136e-06f, 9.92806781e-06f, -7.52994856e-06f, -6.78294896e-07f, 2.69142333e-06f,
+};
+
+static const spx_word16_t resample_table_56[320] = {
+   8.44434680e-07f, 1.18941387e-06f, 8.68789243e-07f, -2.54360600e-07f, -1.78527637e-06f, -2.84700218e-06f,
+   -2.52068276e-06f, -4.52376668e-07f, 2.69520160e-06f, 5.31614296e-06f, 5.58032798e-06f, 2.54659176e-06f,
+   -2.97430302e-06f, -8.39209224e-06f, -1.04170822e-05f, -6.87694592e-06f, 1.64632161e-06f, 1.14497579e-05f,
+   1.71194642e-05f, 1.43216330e-05f, 2.62819663e-06f, -1.33007043e-05f, -2.52793616e-05f, -2.55653158e-05f,
+   -1.14443619e-05f, 1.21230396e-05f, 3.37430392e-05f, 4.08033629e-05f, 2.64253667e-05f, -5.49334118e-06f,
+   -4.04145976e-05f, -5.93751975e-05f, -4.88680089e-05f, -9.42978659e-06f, 4.21536024e-05f, 7.94023581e-05f,
+   7.92646097e-05f, 3.55475750e-05f, -3.48382819e-05f, -9.74880677e-05f, -0.000116757517f, -7.52694468e-05f,
+   1.36408180e-05f, 0.000108570530f, 0.000158588664f, 0.000129803724f, 2.64303835e-05f, -0.000105997191f,
+   -0.000199655682f, -0.000198340247f, -8.97311547e-05f, 8.19283741e-05f, 0.000232253733f, 0.000277250540f,
+   0.000178941671f, -2.80899530e-05f, -0.000246173091f, -0.000359380239f, -0.000293909194f, -6.30902432e-05f,
+   0.000229209094f, 0.000433664420f, 0.000430431595f, 0.000197055459f, -0.000168179758f, -0.000485164113f,
+   -0.000579252956f, -0.000375439617f, 5.04233649e-05f, 0.000495669898f, 0.000725388585f, 0.000594390265f,
+   0.000134240283f, -0.000444967736f, -0.000848020252f, -0.000843032904f, -0.000391256035f, 0.000312742952f,
+   0.000921129656f, 0.00110240118f, 0.000718945987f, -8.11236678e-05f, -0.000914879667f, -0.00134502072f,
+   -0.00110635685f, -0.000262316753f, 0.000797978661f, 0.00153530191f, 0.00153150910f, 0.000721444492f,
+   -0.000540787994f, -0.00163107691f, -0.00196039397f, -0.00128846394f, 0.000118997530f, 0.00158609240f,
+   0.00234701368f, 0.00194131327f, 0.000482335046f, -0.00135350681f, -0.00263454462f, -0.00264185178f,
+   -0.00126477552f, 0.000890113995f, 0.00275765685f, 0.00333502935f, 0.00221289974f, -0.000160950920f,
+   -0.00264585600f, -0.00394924078f, -0.00329145207f, -0.000856061233f, 0.00222744769f, 0.00439771684f,
+   0.00444347411f, 0.00216606492f, -0.00143370731f, -0.00458055548f, -0.00558945956f, -0.00375421741f,
+   0.000202251686f, 0.00438670954f, 0.00662709959f, 0.00558408443f, 0.00152149168f, -0.00369428308f,
+   -0.00743082026f, -0.00759783108f, -0.00378657458f, 0.00236644223f, 0.00784878340f, 0.00971838366f,
+   0.00664605619f, -0.000237328801f, -0.00769254379f, -0.0118534258f, -0.0101808263f, -0.00292487862f,
+   0.00670783222f, 0.0139011191f, 0.0145565541f, 0.00751253217f, -0.00449402397f, -0.0157569200f,
+   -0.0201713182f, -0.0143430168f, 0.000260911038f, 0.0173214246f, 0.0281191785f, 0.0255640242f,
+   0.00808012579f, -0.0185077302f, -0.0422270820f, -0.0491786636f, -0.0292108990f, 0.0192482192f,
+   0.0873277560f, 0.157844007f, 0.210837126f, 0.230499998f, 0.210837126f, 0.157844007f,
+   0.0873277560f, 0.0192482192f, -0.0292108990f, -0.0491786636f, -0.0422270820f, -0.0185077302f,
+   0.00808012579f, 0.0255640242f, 0.0281191785f, 0.0173214246f, 0.000260911038f, -0.0143430168f,
+   -0.0201713182f, -0.0157569200f, -0.00449402397f, 0.00751253217f, 0.0145565541f, 0.0139011191f,
+   0.00670783222f, -0.00292487862f, -0.0101808263f, -0.0118534258f, -0.00769254379f, -0.000237328801f,
+   0.00664605619f, 0.00971838366f, 0.00784878340f, 0.00236644223f, -0.00378657458f, -0.00759783108f,
+   -0.00743082026f, -0.00369428308f, 0.00152149168f, 0.00558408443f, 0.00662709959f, 0.00438670954f,
+   0.000202251686f, -0.00375421741f, -0.00558945956f, -0.00458055548f, -0.00143370731f, 0.00216606492f,
+   0.00444347411f, 0.00439771684f, 0.00222744769f, -0.000856061233f, -0.00329145207f, -0.00394924078f,
+   -0.00264585600f, -0.000160950920f, 0.00221289974f, 0.00333502935f, 0.00275765685f, 0.000890113995f,
+   -0.00126477552f, -0.00264185178f, -0.00263454462f, -0.00135350681f, 0.000482335046f, 0.00194131327f,
+   0.00234701368f, 0.00158609240f, 0.000118997530f, -0.00128846394f, -0.00196039397f, -0.00163107691f,
+   -0.000540787994f, 0.000721444492f, 0.00153150910f, 0.00153530191f, 0.000797978661f, -0.000262316753f,
+   -0.00110635685f, -0.00134502072f, -0.000914879667f, -8.11236678e-05f, 0.000718945987f, 0.00110240118f,
+   0.000921129656f, 0.000312742952f, -0.000391256035f, -0.000843032904f, -0.000848020252f, -0.000444967736f,
+   0.000134240283f, 0.000594390265f, 0.000725388585f, 0.000495669898f, 5.04233649e-05f, -0.000375439617f,
+   -0.000579252956f, -0.000485164113f, -0.000168179758f, 0.000197055459f, 0.000430431595f, 0.000433664420f,
+   0.000229209094f, -6.30902432e-05f, -0.000293909194f, -0.000359380239f, -0.000246173091f, -2.80899530e-05f,
+   0.000178941671f, 0.000277250540f, 0.000232253733f, 8.19283741e-05f, -8.97311547e-05f, -0.000198340247f,
+   -0.000199655682f, -0.000105997191f, 2.64303835e-05f, 0.000129803724f, 0.000158588664f, 0.000108570530f,
+   1.36408180e-05f, -7.52694468e-05f, -0.000116757517f, -9.74880677e-05f, -3.48382819e-05f, 3.55475750e-05f,
+   7.92646097e-05f, 7.94023581e-05f, 4.21536024e-05f, -9.42978659e-06f, -4.88680089e-05f, -5.93751975e-05f,
+   -4.04145976e-05f, -5.49334118e-06f, 2.64253667e-05f, 4.08033629e-05f, 3.37430392e-05f, 1.21230396e-05f,
+   -1.14443619e-05f, -2.55653158e-05f, -2.52793616e-05f, -1.33007043e-05f, 2.62819663e-06f, 1.43216330e-05f,
+   1.71194642e-05f, 1.14497579e-05f, 1.64632161e-06f, -6.87694592e-06f, -1.04170822e-05f, -8.39209224e-06f,
+   -2.97430302e-06f, 2.54659176e-06f, 5.58032798e-06f, 5.31614296e-06f, 2.69520160e-06f, -4.52376668e-07f,
+   -2.52068276e-06f, -2.84700218e-06f, -1.78527637e-06f, -2.54360600e-07f, 8.68789243e-07f, 1.18941387e-06f,
+   8.44434680e-07f, 2.60095618e-07f,
+};
+
+static const spx_word16_t resample_table_57[336] = {
+   4.38803255e-07f, -6.77879689e-06f, 1.11920526e-05f, -2.52335190e-06f, -2.08300517e-05f, 3.85411258e-05f,
+   -1.95226039e-05f, -4.16487383e-05f, 9.70015681e-05f, -7.12129404e-05f, -5.83363908e-05f, 0.000199217771f,
+   -0.000189891784f, -4.28090498e-05f, 0.000348792120f, -0.000416981959f, 5.68482174e-05f, 0.000528178411f,
+   -0.000794651802f, 0.000319468876f, 0.000684608240f, -0.00135074998f, 0.000847322925f, 0.000717246556f,
+   -0.00207791850f, 0.00175398996f, 0.000468989834f, -0.00290985871f, 0.00314362533f, -0.000273918529f,
+   -0.00369843165f, 0.00508407038f, -0.00177496346f, -0.00419383915f, 0.00757962326f, -0.00433913851f,
+   -0.00402680738f, 0.0105499243f, -0.00831958745f, -0.00267673819f, 0.0138217648f, -0.0141796349f,
+   0.000623316620f, 0.0171394553f, -0.0227229837f, 0.00721203675f, 0.0201934911f, -0.0359184630f,
+   0.0202781968f, 0.0226644538f, -0.0607497394f, 0.0520936958f, 0.0242742486f, -0.147627681f,
+   0.262023866f, 0.691500008f, 0.262023866f, -0.147627681f, 0.0242742486f, 0.0520936958f,
+   -0.0607497394f, 0.0226644538f, 0.0202781968f, -0.0359184630f, 0.0201934911f, 0.00721203675f,
+   -0.0227229837f, 0.0171394553f, 0.000623316620f, -0.0141796349f, 0.0138217648f, -0.00267673819f,
+   -0.00831958745f, 0.0105499243f, -0.00402680738f, -0.00433913851f, 0.00757962326f, -0.00419383915f,
+   -0.00177496346f, 0.00508407038f, -0.00369843165f, -0.000273918529f, 0.00314362533f, -0.00290985871f,
+   0.000468989834f, 0.00175398996f, -0.00207791850f, 0.000717246556f, 0.000847322925f, -0.00135074998f,
+   0.000684608240f, 0.000319468876f, -0.000794651802f, 0.000528178411f, 5.68482174e-05f, -0.000416981959f,
+   0.000348792120f, -4.28090498e-05f, -0.000189891784f, 0.000199217771f, -5.83363908e-05f, -7.12129404e-05f,
+   9.70015681e-05f, -4.16487383e-05f, -1.95226039e-05f, 3.85411258e-05f, -2.08300517e-05f, -2.52335190e-06f,
+   1.11920526e-05f, -6.77879689e-06f, 4.38803255e-07f, 1.53915437e-06f, 2.52183145e-06f, -6.28432235e-06f,
+   3.96075620e-06f, 9.34852596e-06f, -2.48076758e-05f, 2.03295531e-05f, 1.72357923e-05f, -6.46781264e-05f,
+   6.62539096e-05f, 1.43258530e-05f, -0.000132374742f, 0.000167035148f, -2.61306504e-05f, -0.000224312549f,
+   0.000352929172f, -0.000150384294f, -0.000316338905f, 0.000650332775f, -0.000424920261f, -0.000352239324f,
+   0.00106731895f, -0.000930619484f, -0.000234492865f, 0.00157463795f, -0.00174867315f, 0.000179226394f,
+   0.00208522496f, -0.00293866592f, 0.00107125961f, 0.00243605091f, -0.00451099360f, 0.00265061110f,
+   0.00237480574f, -0.00639829319f, 0.00513537973f, 0.00155000098f, -0.00843007863f, 0.00874182582f,
+   -0.000507048564f, -0.0103105297f, 0.0137025705f, -0.00444515422f, -0.0115867406f, 0.0203677081f,
+   -0.0113104582f, -0.0115526496f, 0.0295571703f, -0.0233301613f, -0.00884874351f, 0.0439437628f,
+   -0.0474806838f, 0.000784968142f, 0.0768243894f, -0.126788363f, 0.0577605069f, 0.632522404f,
+   0.473564744f, -0.0876703858f, -0.0555844456f, 0.0845340416f, -0.0431750156f, -0.0135497143f,
+   0.0419936292f, -0.0308247060f, -0.000720378594f, 0.0238951147f, -0.0232067220f, 0.00466399407f,
+   0.0135003906f, -0.0172764827f, 0.00672659883f, 0.00695241382f, -0.0123942150f, 0.00698581617f,
+   0.00282774423f, -0.00842611399f, 0.00625376543f, 0.000386296480f, -0.00533828000f, 0.00505624153f,
+   -0.000874075282f, -0.00307863066f, 0.00374866300f, -0.00134528801f, -0.00154815777f, 0.00255568000f,
+   -0.00134055316f, -0.000609121693f, 0.00159468711f, -0.00109844911f, -0.000106812498f, 0.000899786595f,
+   -0.000783919648f, 0.000106741252f, 0.000448775012f, -0.000494971231f, 0.000154904134f, 0.000189317856f,
+   -0.000275688217f, 0.000127318461f, 6.08779774e-05f, -0.000133052730f, 7.95461747e-05f, 9.73871374e-06f,
+   -5.35233739e-05f, 3.90363894e-05f, -3.56427927e-06f, -1.65107976e-05f, 1.40757456e-05f, -3.11448684e-06f,
+   -3.09252323e-06f, 2.66975076e-06f, 2.66975076e-06f, -3.09252323e-06f, -3.11448684e-06f, 1.40757456e-05f,
+   -1.65107976e-05f, -3.56427927e-06f, 3.90363894e-05f, -5.35233739e-05f, 9.73871374e-06f, 7.95461747e-05f,
+   -0.000133052730f, 6.08779774e-05f, 0.000127318461f, -0.000275688217f, 0.000189317856f, 0.000154904134f,
+   -0.000494971231f, 0.000448775012f, 0.000106741252f, -0.000783919648f, 0.000899786595f, -0.000106812498f,
+   -0.00109844911f, 0.00159468711f, -0.000609121693f, -0.00134055316f, 0.00255568000f, -0.00154815777f,
+   -0.00134528801f, 0.00374866300f, -0.00307863066f, -0.000874075282f, 0.00505624153f, -0.00533828000f,
+   0.000386296480f, 0.00625376543f, -0.00842611399f, 0.00282774423f, 0.00698581617f, -0.0123942150f,
+   0.00695241382f, 0.00672659883f, -0.0172764827f, 0.0135003906f, 0.00466399407f, -0.0232067220f,
+   0.0238951147f, -0.000720378594f, -0.0308247060f, 0.0419936292f, -0.0135497143f, -0.0431750156f,
+   0.0845340416f, -0.0555844456f, -0.0876703858f, 0.473564684f, 0.632522404f, 0.0577606000f,
+   -0.126788363f, 0.0768243894f, 0.000784968142f, -0.0474806838f, 0.0439437628f, -0.00884874351f,
+   -0.0233301613f, 0.0295571703f, -0.0115526496f, -0.0113104582f, 0.0203677081f, -0.0115867406f,
+   -0.00444515422f, 0.0137025705f, -0.0103105297f, -0.000507048564f, 0.00874182582f, -0.00843007863f,
+   0.00155000098f, 0.00513537973f, -0.00639829319f, 0.00237480574f, 0.00265061110f, -0.00451099360f,
+   0.00243605091f, 0.00107125961f, -0.00293866592f, 0.00208522496f, 0.000179226394f, -0.00174867315f,
+   0.00157463795f, -0.000234492865f, -0.000930619484f, 0.00106731895f, -0.000352239324f, -0.000424920261f,
+   0.000650332775f, -0.000316338905f, -0.000150384294f, 0.000352929172f, -0.000224312549f, -2.61306504e-05f,
+   0.000167035148f, -0.000132374742f, 1.43258530e-05f, 6.62539096e-05f, -6.46781264e-05f, 1.72357923e-05f,
+   2.03295531e-05f, -2.48076758e-05f, 9.34852596e-06f, 3.96075620e-06f, -6.28432235e-06f, 2.52183145e-06f,
+};
+
+static const spx_word16_t resample_table_59[1800] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, -5.01698366e-07f, -5.17991680e-07f,
+   -5.24391169e-07f, -5.19736318e-07f, -5.03021226e-07f, -4.73444402e-07f, -4.30452531e-07f, -3.73752812e-07f,
+   -3.03350731e-07f, -2.19563447e-07f, -1.23072965e-07f, -1.48795261e-08f, 1.03669720e-07f, 2.30852820e-07f,
+   3.64651981e-07f, 5.02742751e-07f, 6.42491102e-07f, 7.81064102e-07f, 9.15423414e-07f, 1.04241008e-06f,
+   1.15875980e-06f, 1.26123473e-06f, 1.34664742e-06f, 1.41193766e-06f, 1.45427703e-06f, 1.47110529e-06f,
+   1.46024536e-06f, 1.41993235e-06f, 1.34889910e-06f, 1.24602570e-06f, 1.11175416e-06f, 9.46653415e-07f,
+   7.51929633e-07f, 5.29538681e-07f, 2.82054543e-07f, 1.27188260e-08f, -2.74510001e-07f, -5.75144952e-07f,
+   -8.84158339e-07f, -1.19596643e-06f, -1.50468156e-06f, -1.80409154e-06f, -2.08783013e-06f, -2.34939921e-06f,
+   -2.58242449e-06f, -2.78072571e-06f, -2.93840367e-06f, -3.05007643e-06f, -3.11092481e-06f, -3.11688223e-06f,
+   -3.06471111e-06f, -2.95210953e-06f, -2.77789604e-06f, -2.54195425e-06f, -2.24539144e-06f, -1.89049581e-06f,
+   -1.48093443e-06f, -1.02139052e-06f, -5.18088711e-07f, 2.16623377e-08f, 5.89627120e-07f, 1.17661079e-06f,
+   1.77242680e-06f, 2.36637084e-06f, 2.94717734e-06f, 3.50330720e-06f, 4.02300111e-06f, 4.49473146e-06f,
+   4.90731463e-06f, 5.25003998e-06f, 5.51311678e-06f, 5.68773930e-06f, 5.76634375e-06f, 5.74285968e-06f,
+   5.61279239e-06f, 5.37354845e-06f, 5.02437661e-06f, 4.56660518e-06f, 4.00358249e-06f, 3.34097899e-06f,
+   2.58642490e-06f, 1.74958234e-06f, 8.42352620e-07f, -1.21763534e-07f, -1.12760267e-06f, -2.15815567e-06f,
+   -3.19560581e-06f, -4.22121911e-06f, -5.21538777e-06f, -6.15852787e-06f, -7.03104160e-06f, -7.81388189e-06f,
+   -8.48866057e-06f, -9.03839373e-06f, -9.44767271e-06f, -9.70295241e-06f, -9.79308152e-06f, -9.70939709e-06f,
+   -9.44622116e-06f, -9.00085706e-06f, -8.37388689e-06f, -7.56920099e-06f, -6.59436955e-06f, -5.46017873e-06f,
+   -4.18071568e-06f, -2.77371760e-06f, -1.25958877e-06f, 3.38499802e-07f, 1.99446436e-06f, 3.68057340e-06f,
+   5.36745210e-06f, 7.02410443e-06f, 8.61935405e-06f, 1.01214964e-05f, 1.14998966e-05f, 1.27245185e-05f,
+   1.37672896e-05f, 1.46023704e-05f, 1.52065413e-05f, 1.55601574e-05f, 1.56472834e-05f, 1.54563168e-05f,
+   1.49803100e-05f, 1.42172103e-05f, 1.31700590e-05f, 1.18475036e-05f, 1.02632348e-05f, 8.43610087e-06f,
+   6.39062682e-06f, 4.15567683e-06f, 1.76453875e-06f, -7.44764918e-07f, -3.33138291e-06f, -5.95149049e-06f,
+   -8.55885173e-06f, -1.11058298e-05f, -1.35445580e-05f, -1.58269886e-05f, -1.79066737e-05f, -1.97388727e-05f,
+   -2.12819068e-05f, -2.24977211e-05f, -2.33532646e-05f, -2.38207485e-05f, -2.38783887e-05f, -2.35111856e-05f,
+   -2.27111468e-05f, -2.14780175e-05f, -1.98193848e-05f, -1.77505226e-05f, -1.52950688e-05f, -1.24839253e-05f,
+   -9.35587013e-06f, -5.95669553e-06f, -2.33814603e-06f, 1.44172930e-06f, 5.32073909e-06f, 9.23235257e-06f,
+   1.31072793e-05f, 1.68751794e-05f, 2.04648077e-05f, 2.38059401e-05f, 2.68309395e-05f, 2.94751771e-05f,
+   3.16793376e-05f, 3.33897297e-05f, 3.45600565e-05f, 3.51522540e-05f, 3.51375129e-05f, 3.44967630e-05f,
+   3.32219824e-05f, 3.13163400e-05f, 2.87939929e-05f, 2.56812200e-05f, 2.20150396e-05f, 1.78441041e-05f,
+   1.32276500e-05f, 8.23406572e-06f, 2.94153187e-06f, -2.56501721e-06f, -8.19348134e-06f, -1.38467858e-05f,
+   -1.94252698e-05f, -2.48268352e-05f, -2.99495423e-05f, -3.46941233e-05f, -3.89642264e-05f, -4.26699844e-05f,
+   -4.57283459e-05f, -4.80656599e-05f, -4.96191678e-05f, -5.03380543e-05f, -5.01851755e-05f, -4.91377396e-05f,
+   -4.71886051e-05f, -4.43460558e-05f, -4.06352847e-05f, -3.60969425e-05f, -3.07882146e-05f, -2.47819098e-05f,
+   -1.81643973e-05f, -1.10367146e-05f, -3.51053018e-06f, 4.29117608e-06f, 1.22370311e-05f, 2.01904604e-05f,
+   2.80098684e-05f, 3.55521079e-05f, 4.26760380e-05f, 4.92427171e-05f, 5.51205812e-05f, 6.01857755e-05f,
+   6.43257008e-05f, 6.74417533e-05f, 6.94501796e-05f, 7.02852267e-05f, 6.98998847e-05f, 6.82680329e-05f,
+   6.53845782e-05f, 6.12671574e-05f, 5.59552172e-05f, 4.95110435e-05f, 4.20190845e-05f, 3.35834702e-05f,
+   2.43295526e-05f, 1.43988646e-05f, 3.94993867e-06f, -6.84510314e-06f, -1.78049395e-05f, -2.87390776e-05f,
+   -3.94524795e-05f, -4.97504370e-05f, -5.94386402e-05f, -6.83302933e-05f, -7.62467680e-05f, -8.30221907e-05f,
+   -8.85076734e-05f, -9.25722779e-05f, -9.51078982e-05f, -9.60301841e-05f, -9.52816335e-05f, -9.28328518e-05f,
+   -8.86841517e-05f, -8.28655175e-05f, -7.54377979e-05f, -6.64924373e-05f, -5.61486158e-05f, -4.45546757e-05f,
+   -3.18851526e-05f, -1.83360880e-05f, -4.12656027e-06f, 1.05098152e-05f, 2.53240760e-05f, 4.00581412e-05f,
+   5.44507093e-05f, 6.82376703e-05f, 8.11615100e-05f, 9.29720700e-05f, 0.000103432867f, 0.000112327085f,
+   0.000119458680f, 0.000124659360f, 0.000127790321f, 0.000128746251f, 0.000127458014f, 0.000123894584f,
+   0.000118064090f, 0.000110015484f, 9.98385294e-05f, 8.76614431e-05f, 7.36521761e-05f, 5.80156084e-05f,
+   4.09878121e-05f, 2.28382778e-05f, 3.85929570e-06f, -1.56327333e-05f, -3.53049109e-05f, -5.48160424e-05f,
+   -7.38164090e-05f, -9.19605154e-05f, -0.000108907640f, -0.000124331113f, -0.000137924479f, -0.000149404863f,
+   -0.000158522074f, -0.000165060817f, -0.000168846644f, -0.000169750434f, -0.000167690436f, -0.000162635988f,
+   -0.000154607987f, -0.000143681449f, -0.000129982698f, -0.000113691218f, -9.50370159e-05f, -7.42940829e-05f,
+   -5.17831977e-05f, -2.78595635e-05f, -2.91426863e-06f, 2.26346983e-05f, 4.83529620e-05f, 7.37889859e-05f,
+   9.84908111e-05f, 0.000122006022f, 0.000143893689f, 0.000163734527f, 0.000181132971f, 0.000195730754f,
+   0.000207209392f, 0.000215299951f, 0.000219786030f, 0.000220510628f, 0.000217379973f, 0.000210365950f,
+   0.000199509246f, 0.000184917619f, 0.000166768368f, 0.000145306025f, 0.000120835699f, 9.37262230e-05f,
+   6.43960957e-05f, 3.33154640e-05f, 9.95634537e-07f, -3.20240542e-05f, -6.51745795e-05f, -9.78787430e-05f,
+   -0.000129550506f, -0.000159610237f, -0.000187498343f, -0.000212677143f, -0.000234649822f, -0.000252962491f,
+   -0.000267217401f, -0.000277081155f, -0.000282289693f, -0.000282655848f, -0.000278073974f, -0.000268525298f,
+   -0.000254073530f, -0.000234873340f, -0.000211166596f, -0.000183276192f, -0.000151609886f, -0.000116644762f,
+   -7.89298720e-05f, -3.90741880e-05f, 2.26891734e-06f, 4.43994068e-05f, 8.65970069e-05f, 0.000128120024f,
+   0.000168224215f, 0.000206180732f, 0.000241277085f, 0.000272843725f, 0.000300254818f, 0.000322946638f,
+   0.000340429542f, 0.000352293515f, 0.000358219986f, 0.000357988902f, 0.000351484574f, 0.000338697777f,
+   0.000319731218f, 0.000294798781f, 0.000264220114f, 0.000228426419f, 0.000187939935f, 0.000143382334f,
+   9.54591233e-05f, 4.49419422e-05f, -7.32820445e-06f, -6.04728011e-05f, -0.000113574002f, -0.000165697274f,
+   -0.000215914682f, -0.000263306778f, -0.000306987378f, -0.000346123852f, -0.000379941135f, -0.000407748827f,
+   -0.000428944535f, -0.000443032564f, -0.000449633430f, -0.000448491424f, -0.000439481315f, -0.000422614772f,
+   -0.000398042583f, -0.000366049702f, -0.000327062793f, -0.000281631685f, -0.000230435558f, -0.000174267887f,
+   -0.000114016257f, -5.06671131e-05f, 1.47330356e-05f, 8.10729325e-05f, 0.000147204482f, 0.000211971390f,
+   0.000274210994f, 0.000332784781f, 0.000386605301f, 0.000434638961f, 0.000475944282f, 0.000509673846f,
+   0.000535099942f, 0.000551629753f, 0.000558813219f, 0.000556357321f, 0.000544132083f, 0.000522178889f,
+   0.000490706123f, 0.000450098887f, 0.000400901656f, 0.000343825523f, 0.000279733271f, 0.000209616803f,
+   0.000134600312f, 5.59142245e-05f, -2.51359088e-05f, -0.000107165637f, -0.000188763966f, -0.000268492528f,
+   -0.000344919448f, -0.000416656781f, -0.000482360949f, -0.000540783454f, -0.000590772193f, -0.000631305331f,
+   -0.000661513419f, -0.000680687022f, -0.000688302389f, -0.000684025988f, -0.000667729997f, -0.000639491074f,
+   -0.000599602063f, -0.000548557320f, -0.000487061014f, -0.000416014547f, -0.000336491037f, -0.000249740900f,
+   -0.000157162896f, -6.02689834e-05f, 3.93106166e-05f, 0.000139888973f, 0.000239719622f, 0.000337039994f,
+   0.000430115237f, 0.000517238397f, 0.000596794591f, 0.000667264394f, 0.000727260136f, 0.000775563472f,
+   0.000811131555f, 0.000833133527f, 0.000840958033f, 0.000834234350f, 0.000812838320f, 0.000776903820f,
+   0.000726815546f, 0.000663217448f, 0.000587002607f, 0.000499288668f, 0.000401423400f, 0.000294955942f,
+   0.000181596275f, 6.32230804e-05f, -5.81878812e-05f, -0.000180559218f, -0.000301763037f, -0.000419673801f,
+   -0.000532167673f, -0.000637201825f, -0.000732815592f, -0.000817183463f, -0.000888657756f, -0.000945776643f,
+   -0.000987316715f, -0.00101230247f, -0.00102003012f, -0.00101008860f, -0.000982370926f, -0.000937074248f,
+   -0.000874710851f, -0.000796102453f, -0.000702356105f, -0.000594872341f, -0.000475316105f, -0.000345572975f,
+   -0.000207759265f, -6.41412189e-05f, 8.28587072e-05f, 0.000230720470f, 0.000376889599f, 0.000518774497f,
+   0.000653844036f, 0.000779626600f, 0.000893776712f, 0.000994130271f, 0.00107871159f, 0.00114580616f,
+   0.00119396683f, 0.00122205843f, 0.00122928119f, 0.00121518446f, 0.00117968675f, 0.00112307572f,
+   0.00104601611f, 0.000949529815f, 0.000835004961f, 0.000704168866f, 0.000559041742f, 0.000401950208f,
+   0.000235437299f, 6.22714288e-05f, -0.000114619601f, -0.000292222598f, -0.000467437610f, -0.000637175632f,
+   -0.000798392051f, -0.000948148197f, -0.00108365098f, -0.00120232394f, -0.00130184228f, -0.00138018013f,
+   -0.00143565191f, -0.00146694260f, -0.00147314323f, -0.00145376788f, -0.00140876812f, -0.00133854628f,
+   -0.00124394719f, -0.00112625503f, -0.000987176318f, -0.000828814169f, -0.000653646886f, -0.000464474520f,
+   -0.000264386705f, -5.67095594e-05f, 0.000155053567f, 0.000367261440f, 0.000576225575f, 0.000778254529f,
+   0.000969727233f, 0.00114714063f, 0.00130719773f, 0.00144685165f, 0.00156336650f, 0.00165437104f,
+   0.00171789888f, 0.00175244000f, 0.00175696588f, 0.00173095474f, 0.00167441298f, 0.00158787752f,
+   0.00147241668f, 0.00132961897f, 0.00116156891f, 0.000970833760f, 0.000760402181f, 0.000533653947f,
+   0.000294302416f, 4.63293545e-05f, -0.000206059020f, -0.000458534574f, -0.000706699153f, -0.000946170883f,
+   -0.00117263990f, -0.00138197723f, -0.00157028669f, -0.00173398259f, -0.00186985882f, -0.00197514007f,
+   -0.00204755203f, -0.00208535884f, -0.00208740099f, -0.00205312762f, -0.00198261184f, -0.00187655981f,
+   -0.00173630752f, -0.00156380073f, -0.00136158906f, -0.00113276369f, -0.000880928303f, -0.000610132411f,
+   -0.000324833090f, -2.97853676e-05f, 0.000270011689f, 0.000569404685f, 0.000863180088f, 0.00114612898f,
+   0.00141317490f, 0.00165943999f, 0.00188034319f, 0.00207166513f, 0.00222965702f, 0.00235109217f,
+   0.00243333448f, 0.00247439276f, 0.00247296412f, 0.00242846878f, 0.00234106812f, 0.00221167295f,
+   0.00204193406f, 0.00183424086f, 0.00159166579f, 0.00131793600f, 0.00101736723f, 0.000694824499f,
+   0.000355604046f, 5.37433334e-06f, -0.000349924056f, -0.000704186037f, -0.00105121394f, -0.00138487271f,
+   -0.00169916439f, -0.00198834995f, -0.00224702642f, -0.00247026747f, -0.00265368330f, -0.00279351720f,
+   -0.00288671907f, -0.00293100136f, -0.00292490260f, -0.00286781485f, -0.00276000914f, -0.00260263798f,
+   -0.00239774538f, -0.00214822055f, -0.00185777212f, -0.00153086707f, -0.00117269217f, -0.000789029524f,
+   -0.000386193686f, 2.90777680e-05f, 0.000449745072f, 0.000868546020f, 0.00127817702f, 0.00167138071f,
+   0.00204109098f, 0.00238052499f, 0.00268335640f, 0.00294379704f, 0.00315671344f, 0.00331772910f,
+   0.00342329824f, 0.00347080082f, 0.00345858396f, 0.00338600762f, 0.00325347902f, 0.00306244800f,
+   0.00281540444f, 0.00251584686f, 0.00216822838f, 0.00177792553f, 0.00135111029f, 0.000894684636f,
+   0.000416152441f, -7.64574215e-05f, -0.000574789941f, -0.00107026030f, -0.00155421055f, -0.00201806962f,
+   -0.00245346152f, -0.00285241660f, -0.00320747378f, -0.00351182790f, -0.00375946122f, -0.00394524029f,
+   -0.00406504981f, -0.00411585439f, -0.00409577275f, -0.00400413154f, -0.00384148932f, -0.00360964518f,
+   -0.00331162801f, -0.00295164972f, -0.00253508659f, -0.00206834986f, -0.00155882409f, -0.00101473054f,
+   -0.000445049081f, 0.000140702919f, 0.000732577930f, 0.00132037688f, 0.00189383514f, 0.00244274805f,
+   0.00295722671f, 0.00342782238f, 0.00384570868f, 0.00420285156f, 0.00449213060f, 0.00470752222f,
+   0.00484418822f, 0.00489858538f, 0.00486854278f, 0.00475332793f, 0.00455367286f, 0.00427178619f,
+   0.00391132664f, 0.00347739784f, 0.00297642942f, 0.00241611688f, 0.00180528965f, 0.00115382706f,
+   0.000472420274f, -0.000227544893f, -0.000934196636f, -0.00163534295f, -0.00231873407f, -0.00297221076f,
+   -0.00358397677f, -0.00414275052f, -0.00463802321f, -0.00506020151f, -0.00540082948f, -0.00565273082f,
+   -0.00581014762f, -0.00586888008f, -0.00582636939f, -0.00568177085f, -0.00543600088f, -0.00509173889f,
+   -0.00465340726f, -0.00412714481f, -0.00352068711f, -0.00284330803f, -0.00210562674f, -0.00131950853f,
+   -0.000497820554f, 0.000345749257f, 0.00119688537f, 0.00204095058f, 0.00286315638f, 0.00364889088f,
+   0.00438390113f, 0.00505461404f, 0.00564831682f, 0.00615344523f, 0.00655977288f, 0.00685860263f,
+   0.00704296771f, 0.00710775703f, 0.00704984646f, 0.00686818408f, 0.00656383298f, 0.00614000810f,
+   0.00560203427f, 0.00495729409f, 0.00421516551f, 0.00338683627f, 0.00248521264f, 0.00152464956f,
+   0.000520810543f, -0.000509654696f, -0.00154934765f, -0.00258037099f, -0.00358470972f, -0.00454444252f,
+   -0.00544215087f, -0.00626113452f, -0.00698578451f, -0.00760183437f, -0.00809661578f, -0.00845934730f,
+   -0.00868131034f, -0.00875606854f, -0.00867959764f, -0.00845040660f, -0.00806961861f, -0.00754098175f,
+   -0.00687085511f, -0.00606817938f, -0.00514431531f, -0.00411296543f, -0.00298990053f, -0.00179282390f,
+   -0.000541002257f, 0.000744925055f, 0.00204337062f, 0.00333210710f, 0.00458858907f, 0.00579043478f,
+   0.00691569690f, 0.00794335362f, 0.00885358546f, 0.00962820835f, 0.0102510070f, 0.0107080089f,
+   0.0109878182f, 0.0110818222f, 0.0109844245f, 0.0106931888f, 0.0102089467f, 0.00953584723f,
+   0.00868138671f, 0.00765629765f, 0.00647451077f, 0.00515289744f, 0.00371115492f, 0.00217141560f,
+   0.000558057858f, -0.00110278605f, -0.00278353272f, -0.00445562555f, -0.00608998397f, -0.00765747344f,
+   -0.00912942924f, -0.0104780924f, -0.0116771404f, -0.0127021465f, -0.0135310376f, -0.0141445221f,
+   -0.0145264762f, -0.0146642812f, -0.0145491641f, -0.0141763929f, -0.0135454740f, -0.0126602687f,
+   -0.0115290387f, -0.0101644248f, -0.00858335383f, -0.00680687791f, -0.00485989964f, -0.00277092471f,
+   -0.000571651035f, 0.00170345476f, 0.00401764503f, 0.00633242819f, 0.00860813633f, 0.0108045889f,
+   0.0128816515f, 0.0147999432f, 0.0165214799f, 0.0180103350f, 0.0192332696f, 0.0201603565f,
+   0.0207655597f, 0.0210272633f, 0.0209287703f, 0.0204587039f, 0.0196113754f, 0.0183870215f,
+   0.0167920869f, 0.0148392394f, 0.0125474297f, 0.00994175952f, 0.00705338735f, 0.00391921494f,
+   0.000581542903f, -0.00291237095f, -0.00651083933f, -0.0101583367f, -0.0137962149f, -0.0173633751f,
+   -0.0207970850f, -0.0240338389f, -0.0270101577f, -0.0296635013f, -0.0319331512f, -0.0337610915f,
+   -0.0350928716f, -0.0358784311f, -0.0360728949f, -0.0356373079f, -0.0345393121f, -0.0327537321f,
+   -0.0302630961f, -0.0270580463f, -0.0231376346f, -0.0185095537f, -0.0131903067f, -0.00720504345f,
+   -0.000587552611f, 0.00662003597f, 0.0143675832f, 0.0225974359f, 0.0312449802f, 0.0402392782f,
+   0.0495038480f, 0.0589575320f, 0.0685153678f, 0.0780895278f, 0.0875903815f, 0.0969275311f,
+   0.106010869f, 0.114751615f, 0.123063438f, 0.130863458f, 0.138073251f, 0.144619823f,
+   0.150436506f, 0.155463710f, 0.159649760f, 0.162951455f, 0.165334612f, 0.166774526f,
+   0.167256236f, 0.166774526f, 0.165334612f, 0.162951455f, 0.159649760f, 0.155463710f,
+   0.150436506f, 0.144619823f, 0.138073251f, 0.130863458f, 0.123063438f, 0.114751615f,
+   0.106010869f, 0.0969275311f, 0.0875903815f, 0.0780895278f, 0.0685153678f, 0.0589575320f,
+   0.0495038480f, 0.0402392782f, 0.0312449802f, 0.0225974359f, 0.0143675832f, 0.00662003597f,
+   -0.000587552611f, -0.00720504345f, -0.0131903067f, -0.0185095537f, -0.0231376346f, -0.0270580463f,
+   -0.0302630961f, -0.0327537321f, -0.0345393121f, -0.0356373079f, -0.0360728949f, -0.0358784311f,
+   -0.0350928716f, -0.0337610915f, -0.0319331512f, -0.0296635013f, -0.0270101577f, -0.0240338389f,
+   -0.0207970850f, -0.0173633751f, -0.0137962149f, -0.0101583367f, -0.00651083933f, -0.00291237095f,
+   0.000581542903f, 0.00391921494f, 0.00705338735f, 0.00994175952f, 0.0125474297f, 0.0148392394f,
+   0.0167920869f, 0.0183870215f, 0.0196113754f, 0.0204587039f, 0.0209287703f, 0.0210272633f,
+   0.0207655597f, 0.0201603565f, 0.0192332696f, 0.0180103350f, 0.0165214799f, 0.0147999432f,
+   0.0128816515f, 0.0108045889f, 0.00860813633f, 0.00633242819f, 0.00401764503f, 0.00170345476f,
+   -0.000571651035f, -0.00277092471f, -0.00485989964f, -0.00680687791f, -0.00858335383f, -0.0101644248f,
+   -0.0115290387f, -0.0126602687f, -0.0135454740f, -0.0141763929f, -0.0145491641f, -0.0146642812f,
+   -0.0145264762f, -0.0141445221f, -0.0135310376f, -0.0127021465f, -0.0116771404f, -0.0104780924f,
+   -0.00912942924f, -0.00765747344f, -0.00608998397f, -0.00445562555f, -0.00278353272f, -0.00110278605f,
+   0.000558057858f, 0.00217141560f, 0.00371115492f, 0.00515289744f, 0.00647451077f, 0.00765629765f,
+   0.00868138671f, 0.00953584723f, 0.0102089467f, 0.0106931888f, 0.0109844245f, 0.0110818222f,
+   0.0109878182f, 0.0107080089f, 0.0102510070f, 0.00962820835f, 0.00885358546f, 0.00794335362f,
+   0.00691569690f, 0.00579043478f, 0.00458858907f, 0.00333210710f, 0.00204337062f, 0.000744925055f,
+   -0.000541002257f, -0.00179282390f, -0.00298990053f, -0.00411296543f, -0.00514431531f, -0.00606817938f,
+   -0.00687085511f, -0.00754098175f, -0.00806961861f, -0.00845040660f, -0.00867959764f, -0.00875606854f,
+   -0.00868131034f, -0.00845934730f, -0.00809661578f, -0.00760183437f, -0.00698578451f, -0.00626113452f,
+   -0.00544215087f, -0.00454444252f, -0.00358470972f, -0.00258037099f, -0.00154934765f, -0.000509654696f,
+   0.000520810543f, 0.00152464956f, 0.00248521264f, 0.00338683627f, 0.00421516551f, 0.00495729409f,
+   0.00560203427f, 0.00614000810f, 0.00656383298f, 0.00686818408f, 0.00704984646f, 0.00710775703f,
+   0.00704296771f, 0.00685860263f, 0.00655977288f, 0.00615344523f, 0.00564831682f, 0.00505461404f,
+   0.00438390113f, 0.00364889088f, 0.00286315638f, 0.00204095058f, 0.00119688537f, 0.000345749257f,
+   -0.000497820554f, -0.00131950853f, -0.00210562674f, -0.00284330803f, -0.00352068711f, -0.00412714481f,
+   -0.00465340726f, -0.00509173889f, -0.00543600088f, -0.00568177085f, -0.00582636939f, -0.00586888008f,
+   -0.00581014762f, -0.00565273082f, -0.00540082948f, -0.00506020151f, -0.00463802321f, -0.00414275052f,
+   -0.00358397677f, -0.00297221076f, -0.00231873407f, -0.00163534295f, -0.000934196636f, -0.000227544893f,
+   0.000472420274f, 0.00115382706f, 0.00180528965f, 0.00241611688f, 0.00297642942f, 0.00347739784f,
+   0.00391132664f, 0.00427178619f, 0.00455367286f, 0.00475332793f, 0.00486854278f, 0.00489858538f,
+   0.00484418822f, 0.00470752222f, 0.00449213060f, 0.00420285156f, 0.00384570868f, 0.00342782238f,
+   0.00295722671f, 0.00244274805f, 0.00189383514f, 0.00132037688f, 0.000732577930f, 0.000140702919f,
+   -0.000445049081f, -0.00101473054f, -0.00155882409f, -0.00206834986f, -0.00253508659f, -0.00295164972f,
+   -0.00331162801f, -0.00360964518f, -0.00384148932f, -0.00400413154f, -0.00409577275f, -0.00411585439f,
+   -0.00406504981f, -0.00394524029f, -0.00375946122f, -0.00351182790f, -0.00320747378f, -0.00285241660f,
+   -0.00245346152f, -0.00201806962f, -0.00155421055f, -0.00107026030f, -0.000574789941f, -7.64574215e-05f,
+   0.000416152441f, 0.000894684636f, 0.00135111029f, 0.00177792553f, 0.00216822838f, 0.00251584686f,
+   0.00281540444f, 0.00306244800f, 0.00325347902f, 0.00338600762f, 0.00345858396f, 0.00347080082f,
+   0.00342329824f, 0.00331772910f, 0.00315671344f, 0.00294379704f, 0.00268335640f, 0.00238052499f,
+   0.00204109098f, 0.00167138071f, 0.00127817702f, 0.000868546020f, 0.000449745072f, 2.90777680e-05f,
+   -0.000386193686f, -0.000789029524f, -0.00117269217f, -0.00153086707f, -0.00185777212f, -0.00214822055f,
+   -0.00239774538f, -0.00260263798f, -0.00276000914f, -0.00286781485f, -0.00292490260f, -0.00293100136f,
+   -0.00288671907f, -0.00279351720f, -0.00265368330f, -0.00247026747f, -0.00224702642f, -0.00198834995f,
+   -0.00169916439f, -0.00138487271f, -0.00105121394f, -0.000704186037f, -0.000349924056f, 5.37433334e-06f,
+   0.000355604046f, 0.000694824499f, 0.00101736723f, 0.00131793600f, 0.00159166579f, 0.00183424086f,
+   0.00204193406f, 0.00221167295f, 0.00234106812f, 0.00242846878f, 0.00247296412f, 0.00247439276f,
+   0.00243333448f, 0.00235109217f, 0.00222965702f, 0.00207166513f, 0.00188034319f, 0.00165943999f,
+   0.00141317490f, 0.00114612898f, 0.000863180088f, 0.000569404685f, 0.000270011689f, -2.97853676e-05f,
+   -0.000324833090f, -0.000610132411f, -0.000880928303f, -0.00113276369f, -0.00136158906f, -0.00156380073f,
+   -0.00173630752f, -0.00187655981f, -0.00198261184f, -0.00205312762f, -0.00208740099f, -0.00208535884f,
+   -0.00204755203f, -0.00197514007f, -0.00186985882f, -0.00173398259f, -0.00157028669f, -0.00138197723f,
+   -0.00117263990f, -0.000946170883f, -0.000706699153f, -0.000458534574f, -0.000206059020f, 4.63293545e-05f,
+   0.000294302416f, 0.000533653947f, 0.000760402181f, 0.000970833760f, 0.00116156891f, 0.00132961897f,
+   0.00147241668f, 0.00158787752f, 0.00167441298f, 0.00173095474f, 0.00175696588f, 0.00175244000f,
+   0.00171789888f, 0.00165437104f, 0.00156336650f, 0.00144685165f, 0.00130719773f, 0.00114714063f,
+   0.000969727233f, 0.000778254529f, 0.000576225575f, 0.000367261440f, 0.000155053567f, -5.67095594e-05f,
+   -0.000264386705f, -0.000464474520f, -0.000653646886f, -0.000828814169f, -0.000987176318f, -0.00112625503f,
+   -0.00124394719f, -0.00133854628f, -0.00140876812f, -0.00145376788f, -0.00147314323f, -0.00146694260f,
+   -0.00143565191f, -0.00138018013f, -0.00130184228f, -0.00120232394f, -0.00108365098f, -0.000948148197f,
+   -0.000798392051f, -0.000637175632f, -0.000467437610f, -0.000292222598f, -0.000114619601f, 6.22714288e-05f,
+   0.000235437299f, 0.000401950208f, 0.000559041742f, 0.000704168866f, 0.000835004961f, 0.000949529815f,
+   0.00104601611f, 0.00112307572f, 0.00117968675f, 0.00121518446f, 0.00122928119f, 0.00122205843f,
+   0.00119396683f, 0.00114580616f, 0.00107871159f, 0.000994130271f, 0.000893776712f, 0.000779626600f,
+   0.000653844036f, 0.000518774497f, 0.000376889599f, 0.000230720470f, 8.28587072e-05f, -6.41412189e-05f,
+   -0.000207759265f, -0.000345572975f, -0.000475316105f, -0.000594872341f, -0.000702356105f, -0.000796102453f,
+   -0.000874710851f, -0.000937074248f, -0.000982370926f, -0.00101008860f, -0.00102003012f, -0.00101230247f,
+   -0.000987316715f, -0.000945776643f, -0.000888657756f, -0.000817183463f, -0.000732815592f, -0.000637201825f,
+   -0.000532167673f, -0.000419673801f, -0.000301763037f, -0.000180559218f, -5.81878812e-05f, 6.32230804e-05f,
+   0.000181596275f, 0.000294955942f, 0.000401423400f, 0.000499288668f, 0.000587002607f, 0.000663217448f,
+   0.000726815546f, 0.000776903820f, 0.000812838320f, 0.000834234350f, 0.000840958033f, 0.000833133527f,
+   0.000811131555f, 0.000775563472f, 0.000727260136f, 0.000667264394f, 0.000596794591f, 0.000517238397f,
+   0.000430115237f, 0.000337039994f, 0.000239719622f, 0.000139888973f, 3.93106166e-05f, -6.02689834e-05f,
+   -0.000157162896f, -0.000249740900f, -0.000336491037f, -0.000416014547f, -0.000487061014f, -0.000548557320f,
+   -0.000599602063f, -0.000639491074f, -0.000667729997f, -0.000684025988f, -0.000688302389f, -0.000680687022f,
+   -0.000661513419f, -0.000631305331f, -0.000590772193f, -0.000540783454f, -0.000482360949f, -0.000416656781f,
+   -0.000344919448f, -0.000268492528f, -0.000188763966f, -0.000107165637f, -2.51359088e-05f, 5.59142245e-05f,
+   0.000134600312f, 0.000209616803f, 0.000279733271f, 0.000343825523f, 0.000400901656f, 0.000450098887f,
+   0.000490706123f, 0.000522178889f, 0.000544132083f, 0.000556357321f, 0.000558813219f, 0.000551629753f,
+   0.000535099942f, 0.000509673846f, 0.000475944282f, 0.000434638961f, 0.000386605301f, 0.000332784781f,
+   0.000274210994f, 0.000211971390f, 0.000147204482f, 8.10729325e-05f, 1.47330356e-05f, -5.06671131e-05f,
+   -0.000114016257f, -0.000174267887f, -0.000230435558f, -0.000281631685f, -0.000327062793f, -0.000366049702f,
+   -0.000398042583f, -0.000422614772f, -0.000439481315f, -0.000448491424f, -0.000449633430f, -0.000443032564f,
+   -0.000428944535f, -0.000407748827f, -0.000379941135f, -0.000346123852f, -0.000306987378f, -0.000263306778f,
+   -0.000215914682f, -0.000165697274f, -0.000113574002f, -6.04728011e-05f, -7.32820445e-06f, 4.49419422e-05f,
+   9.54591233e-05f, 0.000143382334f, 0.000187939935f, 0.000228426419f, 0.000264220114f, 0.000294798781f,
+   0.000319731218f, 0.000338697777f, 0.000351484574f, 0.000357988902f, 0.000358219986f, 0.000352293515f,
+   0.000340429542f, 0.000322946638f, 0.000300254818f, 0.000272843725f, 0.000241277085f, 0.000206180732f,
+   0.000168224215f, 0.000128120024f, 8.65970069e-05f, 4.43994068e-05f, 2.26891734e-06f, -3.90741880e-05f,
+   -7.89298720e-05f, -0.000116644762f, -0.000151609886f, -0.000183276192f, -0.000211166596f, -0.000234873340f,
+   -0.000254073530f, -0.000268525298f, -0.000278073974f, -0.000282655848f, -0.000282289693f, -0.000277081155f,
+   -0.000267217401f, -0.000252962491f, -0.000234649822f, -0.000212677143f, -0.000187498343f, -0.000159610237f,
+   -0.000129550506f, -9.78787430e-05f, -6.51745795e-05f, -3.20240542e-05f, 9.95634537e-07f, 3.33154640e-05f,
+   6.43960957e-05f, 9.37262230e-05f, 0.000120835699f, 0.000145306025f, 0.000166768368f, 0.000184917619f,
+   0.000199509246f, 0.000210365950f, 0.000217379973f, 0.000220510628f, 0.000219786030f, 0.000215299951f,
+   0.000207209392f, 0.000195730754f, 0.000181132971f, 0.000163734527f, 0.000143893689f, 0.000122006022f,
+   9.84908111e-05f, 7.37889859e-05f, 4.83529620e-05f, 2.26346983e-05f, -2.91426863e-06f, -2.78595635e-05f,
+   -5.17831977e-05f, -7.42940829e-05f, -9.50370159e-05f, -0.000113691218f, -0.000129982698f, -0.000143681449f,
+   -0.000154607987f, -0.000162635988f, -0.000167690436f, -0.000169750434f, -0.000168846644f, -0.000165060817f,
+   -0.000158522074f, -0.000149404863f, -0.000137924479f, -0.000124331113f, -0.000108907640f, -9.19605154e-05f,
+   -7.38164090e-05f, -5.48160424e-05f, -3.53049109e-05f, -1.56327333e-05f, 3.85929570e-06f, 2.28382778e-05f,
+   4.09878121e-05f, 5.80156084e-05f, 7.36521761e-05f, 8.76614431e-05f, 9.98385294e-05f, 0.000110015484f,
+   0.000118064090f, 0.000123894584f, 0.000127458014f, 0.000128746251f, 0.000127790321f, 0.000124659360f,
+   0.000119458680f, 0.000112327085f, 0.000103432867f, 9.29720700e-05f, 8.11615100e-05f, 6.82376703e-05f,
+   5.44507093e-05f, 4.00581412e-05f, 2.53240760e-05f, 1.05098152e-05f, -4.12656027e-06f, -1.83360880e-05f,
+   -3.18851526e-05f, -4.45546757e-05f, -5.61486158e-05f, -6.64924373e-05f, -7.54377979e-05f, -8.28655175e-05f,
+   -8.86841517e-05f, -9.28328518e-05f, -9.52816335e-05f, -9.60301841e-05f, -9.51078982e-05f, -9.25722779e-05f,
+   -8.85076734e-05f, -8.30221907e-05f, -7.62467680e-05f, -6.83302933e-05f, -5.94386402e-05f, -4.97504370e-05f,
+   -3.94524795e-05f, -2.87390776e-05f, -1.78049395e-05f, -6.84510314e-06f, 3.94993867e-06f, 1.43988646e-05f,
+   2.43295526e-05f, 3.35834702e-05f, 4.20190845e-05f, 4.95110435e-05f, 5.59552172e-05f, 6.12671574e-05f,
+   6.53845782e-05f, 6.82680329e-05f, 6.98998847e-05f, 7.02852267e-05f, 6.94501796e-05f, 6.74417533e-05f,
+   6.43257008e-05f, 6.01857755e-05f, 5.51205812e-05f, 4.92427171e-05f, 4.26760380e-05f, 3.55521079e-05f,
+   2.80098684e-05f, 2.01904604e-05f, 1.22370311e-05f, 4.29117608e-06f, -3.51053018e-06f, -1.10367146e-05f,
+   -1.81643973e-05f, -2.47819098e-05f, -3.07882146e-05f, -3.60969425e-05f, -4.06352847e-05f, -4.43460558e-05f,
+   -4.71886051e-05f, -4.91377396e-05f, -5.01851755e-05f, -5.03380543e-05f, -4.96191678e-05f, -4.80656599e-05f,
+   -4.57283459e-05f, -4.26699844e-05f, -3.89642264e-05f, -3.46941233e-05f, -2.99495423e-05f, -2.48268352e-05f,
+   -1.94252698e-05f, -1.38467858e-05f, -8.19348134e-06f, -2.56501721e-06f, 2.94153187e-06f, 8.23406572e-06f,
+   1.32276500e-05f, 1.78441041e-05f, 2.20150396e-05f, 2.56812200e-05f, 2.87939929e-05f, 3.13163400e-05f,
+   3.32219824e-05f, 3.44967630e-05f, 3.51375129e-05f, 3.51522540e-05f, 3.45600565e-05f, 3.33897297e-05f,
+   3.16793376e-05f, 2.94751771e-05f, 2.68309395e-05f, 2.38059401e-05f, 2.04648077e-05f, 1.68751794e-05f,
+   1.31072793e-05f, 9.23235257e-06f, 5.32073909e-06f, 1.44172930e-06f, -2.33814603e-06f, -5.95669553e-06f,
+   -9.35587013e-06f, -1.24839253e-05f, -1.52950688e-05f, -1.77505226e-05f, -1.98193848e-05f, -2.14780175e-05f,
+   -2.27111468e-05f, -2.35111856e-05f, -2.38783887e-05f, -2.38207485e-05f, -2.33532646e-05f, -2.24977211e-05f,
+   -2.12819068e-05f, -1.97388727e-05f, -1.79066737e-05f, -1.58269886e-05f, -1.35445580e-05f, -1.11058298e-05f,
+   -8.55885173e-06f, -5.95149049e-06f, -3.33138291e-06f, -7.44764918e-07f, 1.76453875e-06f, 4.15567683e-06f,
+   6.39062682e-06f, 8.43610087e-06f, 1.02632348e-05f, 1.18475036e-05f, 1.31700590e-05f, 1.42172103e-05f,
+   1.49803100e-05f, 1.54563168e-05f, 1.56472834e-05f, 1.55601574e-05f, 1.52065413e-05f, 1.46023704e-05f,
+   1.37672896e-05f, 1.27245185e-05f, 1.14998966e-05f, 1.01214964e-05f, 8.61935405e-06f, 7.02410443e-06f,
+   5.36745210e-06f, 3.68057340e-06f, 1.99446436e-06f, 3.38499802e-07f, -1.25958877e-06f, -2.77371760e-06f,
+   -4.18071568e-06f, -5.46017873e-06f, -6.59436955e-06f, -7.56920099e-06f, -8.37388689e-06f, -9.00085706e-06f,
+   -9.44622116e-06f, -9.70939709e-06f, -9.79308152e-06f, -9.70295241e-06f, -9.44767271e-06f, -9.03839373e-06f,
+   -8.48866057e-06f, -7.81388189e-06f, -7.03104160e-06f, -6.15852787e-06f, -5.21538777e-06f, -4.22121911e-06f,
+   -3.19560581e-06f, -2.15815567e-06f, -1.12760267e-06f, -1.21763534e-07f, 8.42352620e-07f, 1.74958234e-06f,
+   2.58642490e-06f, 3.34097899e-06f, 4.00358249e-06f, 4.56660518e-06f, 5.02437661e-06f, 5.37354845e-06f,
+   5.61279239e-06f, 5.74285968e-06f, 5.76634375e-06f, 5.68773930e-06f, 5.51311678e-06f, 5.25003998e-06f,
+   4.90731463e-06f, 4.49473146e-06f, 4.02300111e-06f, 3.50330720e-06f, 2.94717734e-06f, 2.36637084e-06f,
+   1.77242680e-06f, 1.17661079e-06f, 5.89627120e-07f, 2.16623377e-08f, -5.18088711e-07f, -1.02139052e-06f,
+   -1.48093443e-06f, -1.89049581e-06f, -2.24539144e-06f, -2.54195425e-06f, -2.77789604e-06f, -2.95210953e-06f,
+   -3.06471111e-06f, -3.11688223e-06f, -3.11092481e-06f, -3.05007643e-06f, -2.93840367e-06f, -2.78072571e-06f,
+   -2.58242449e-06f, -2.34939921e-06f, -2.08783013e-06f, -1.80409154e-06f, -1.50468156e-06f, -1.19596643e-06f,
+   -8.84158339e-07f, -5.75144952e-07f, -2.74510001e-07f, 1.27188260e-08f, 2.82054543e-07f, 5.29538681e-07f,
+   7.51929633e-07f, 9.46653415e-07f, 1.11175416e-06f, 1.24602570e-06f, 1.34889910e-06f, 1.41993235e-06f,
+   1.46024536e-06f, 1.47110529e-06f, 1.45427703e-06f, 1.41193766e-06f, 1.34664742e-06f, 1.26123473e-06f,
+   1.15875980e-06f, 1.04241008e-06f, 9.15423414e-07f, 7.81064102e-07f, 6.42491102e-07f, 5.02742751e-07f,
+   3.64651981e-07f, 2.30852820e-07f, 1.03669720e-07f, -1.48795261e-08f, -1.23072965e-07f, -2.19563447e-07f,
+   -3.03350731e-07f, -3.73752812e-07f, -4.30452531e-07f, -4.73444402e-07f, -5.03021226e-07f, -5.19736318e-07f,
+   -5.24391169e-07f, -5.17991680e-07f, -5.01698366e-07f, 0.00000000f, 0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_60[1800] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, -1.00339673e-06f, -1.03598336e-06f,
+   -1.04878234e-06f, -1.03947264e-06f, -1.00604245e-06f, -9.46888804e-07f, -8.60905061e-07f, -7.47505624e-07f,
+   -6.06701462e-07f, -4.39126893e-07f, -2.46145930e-07f, -2.97590521e-08f, 2.07339440e-07f, 4.61705639e-07f,
+   7.29303963e-07f, 1.00548550e-06f, 1.28498220e-06f, 1.56212820e-06f, 1.83084683e-06f, 2.08482015e-06f,
+   2.31751960e-06f, 2.52246946e-06f, 2.69329485e-06f, 2.82387532e-06f, 2.90855405e-06f, 2.94221059e-06f,
+   2.92049072e-06f, 2.83986469e-06f, 2.69779821e-06f, 2.49205141e-06f, 2.22350832e-06f, 1.89330683e-06f,
+   1.50385927e-06f, 1.05907736e-06f, 5.64109087e-07f, 2.54376520e-08f, -5.49020001e-07f, -1.15028990e-06f,
+   -1.76831668e-06f, -2.39193287e-06f, -3.00936313e-06f, -3.60818308e-06f, -4.17566025e-06f, -4.69879842e-06f,
+   -5.16484897e-06f, -5.56145142e-06f, -5.87680734e-06f, -6.10015286e-06f, -6.22184962e-06f, -6.23376445e-06f,
+   -6.12942222e-06f, -5.90421905e-06f, -5.55579209e-06f, -5.08390849e-06f, -4.49078289e-06f, -3.78099162e-06f,
+   -2.96186886e-06f, -2.04278103e-06f, -1.03617742e-06f, 4.33246754e-08f, 1.17925424e-06f, 2.35322159e-06f,
+   3.54485360e-06f, 4.73274167e-06f, 5.89435467e-06f, 7.00661440e-06f, 8.04600222e-06f, 8.98946291e-06f,
+   9.81462927e-06f, 1.05000800e-05f, 1.10262336e-05f, 1.13754786e-05f, 1.15326875e-05f, 1.14857194e-05f,
+   1.12255848e-05f, 1.07470969e-05f, 1.00487532e-05f, 9.13321037e-06f, 8.00716498e-06f, 6.68195798e-06f,
+   5.17284980e-06f, 3.49916468e-06f, 1.68470524e-06f, -2.43527069e-07f, -2.25520535e-06f, -4.31631133e-06f,
+   -6.39121163e-06f, -8.44243823e-06f, -1.04307755e-05f, -1.23170557e-05f, -1.40620832e-05f, -1.56277638e-05f,
+   -1.69773211e-05f, -1.80767875e-05f, -1.88953454e-05f, -1.94059048e-05f, -1.95861630e-05f, -1.94187942e-05f,
+   -1.88924423e-05f, -1.80017141e-05f, -1.67477738e-05f, -1.51384020e-05f, -1.31887391e-05f, -1.09203575e-05f,
+   -8.36143136e-06f, -5.54743519e-06f, -2.51917754e-06f, 6.76999605e-07f, 3.98892871e-06f, 7.36114680e-06f,
+   1.07349042e-05f, 1.40482089e-05f, 1.72387081e-05f, 2.02429928e-05f, 2.29997931e-05f, 2.54490369e-05f,
+   2.75345792e-05f, 2.92047407e-05f, 3.04130826e-05f, 3.11203148e-05f, 3.12945667e-05f, 3.09126335e-05f,
+   2.99606199e-05f, 2.84344205e-05f, 2.63401180e-05f, 2.36950073e-05f, 2.05264696e-05f, 1.68722017e-05f,
+   1.27812536e-05f, 8.31135367e-06f, 3.52907750e-06f, -1.48952984e-06f, -6.66276583e-06f, -1.19029810e-05f,
+   -1.71177035e-05f, -2.22116596e-05f, -2.70891160e-05f, -3.16539772e-05f, -3.58133475e-05f, -3.94777453e-05f,
+   -4.25638136e-05f, -4.49954423e-05f, -4.67065292e-05f, -4.76414971e-05f, -4.77567773e-05f, -4.70223713e-05f,
+   -4.54222936e-05f, -4.29560350e-05f, -3.96387695e-05f, -3.55010452e-05f, -3.05901376e-05f, -2.49678505e-05f,
+   -1.87117403e-05f, -1.19133911e-05f, -4.67629206e-06f, 2.88345859e-06f, 1.06414782e-05f, 1.84647051e-05f,
+   2.62145586e-05f, 3.37503589e-05f, 4.09296154e-05f, 4.76118803e-05f, 5.36618791e-05f, 5.89503543e-05f,
+   6.33586751e-05f, 6.67794593e-05f, 6.91201130e-05f, 7.03045080e-05f, 7.02750258e-05f, 6.89935259e-05f,
+   6.64439649e-05f, 6.26326801e-05f, 5.75879858e-05f, 5.13624400e-05f, 4.40300792e-05f, 3.56882083e-05f,
+   2.64553000e-05f, 1.64681314e-05f, 5.88306375e-06f, -5.13003442e-06f, -1.63869627e-05f, -2.76935716e-05f,
+   -3.88505396e-05f, -4.96536704e-05f, -5.98990846e-05f, -6.93882466e-05f, -7.79284528e-05f, -8.53399688e-05f,
+   -9.14566917e-05f, -9.61313199e-05f, -9.92383357e-05f, -0.000100676109f, -0.000100370351f, -9.82754791e-05f,
+   -9.43772102e-05f, -8.86921116e-05f, -8.12705694e-05f, -7.21938850e-05f, -6.15764293e-05f, -4.95638196e-05f,
+   -3.63287945e-05f, -2.20734291e-05f, -7.02106036e-06f, 8.58235217e-06f, 2.44740622e-05f, 4.03809208e-05f,
+   5.60197368e-05f, 7.11042157e-05f, 8.53520760e-05f, 9.84854341e-05f, 0.000110241162f, 0.000120371551f,
+   0.000128651402f, 0.000134883507f, 0.000138900359f, 0.000140570453f, 0.000139799769f, 0.000136536066f,
+   0.000130769156f, 0.000122534315f, 0.000111910434f, 9.90220869e-05f, 8.40381690e-05f, 6.71669404e-05f,
+   4.86591052e-05f, 2.87977291e-05f, 7.89987735e-06f, -1.36902063e-05f, -3.56098790e-05f, -5.74781552e-05f,
+   -7.89049591e-05f, -9.95008741e-05f, -0.000118877280f, -0.000136660587f, -0.000152493536f, -0.000166044381f,
+   -0.000177015347f, -0.000185144556f, -0.000190215796f, -0.000192060368f, -0.000190563267f, -0.000185665704f,
+   -0.000177368303f, -0.000165731035f, -0.000150875596f, -0.000132984875f, -0.000112297232f, -8.91093514e-05f,
+   -6.37703051e-05f, -3.66721761e-05f, -8.25312054e-06f, 2.10196304e-05f, 5.06481520e-05f, 8.01162823e-05f,
+   0.000108901419f, 0.000136475341f, 0.000162323020f, 0.000185944140f, 0.000206865734f, 0.000224654170f,
+   0.000238917361f, 0.000249318720f, 0.000255580642f, 0.000257492502f, 0.000254916027f, 0.000247789168f,
+   0.000236128180f, 0.000220030968f, 0.000199677059f, 0.000175322886f, 0.000147304352f, 0.000116031217f,
+   8.19756242e-05f, 4.56765556e-05f, 7.71859141e-06f, -3.12654665e-05f, -7.06098217e-05f, -0.000109632085f,
+   -0.000147632818f, -0.000183921031f, -0.000217815279f, -0.000248662225f, -0.000275848957f, -0.000298809726f,
+   -0.000317044149f, -0.000330121635f, -0.000337693287f, -0.000339500868f, -0.000335380872f, -0.000325271976f,
+   -0.000309215975f, -0.000287362898f, -0.000259965396f, -0.000227382436f, -0.000190074032f, -0.000148588166f,
+   -0.000103566395f, -5.57191270e-05f, -5.82853727e-06f, 4.52693967e-05f, 9.67059241e-05f, 0.000147577972f,
+   0.000196981622f, 0.000244012044f, 0.000287787378f, 0.000327469053f, 0.000362265942f, 0.000391461508f,
+   0.000414418784f, 0.000430599903f, 0.000439572061f, 0.000441021257f, 0.000434759946f, 0.000420731900f,
+   0.000399018492f, 0.000369835238f, 0.000333536736f, 0.000290612050f, 0.000241671398f, 0.000187452446f,
+   0.000128792191f, 6.66309279e-05f, 1.99126907e-06f, -6.40481085e-05f, -0.000130349159f, -0.000195757486f,
+   -0.000259101012f, -0.000319220475f, -0.000374996685f, -0.000425354287f, -0.000469299644f, -0.000505924982f,
+   -0.000534434803f, -0.000554162310f, -0.000564579386f, -0.000565311697f, -0.000556147948f, -0.000537050597f,
+   -0.000508147059f, -0.000469746679f, -0.000422333193f, -0.000366552384f, -0.000303219771f, -0.000233289524f,
+   -0.000157859744f, -7.81483759e-05f, 4.53783468e-06f, 8.87988135e-05f, 0.000173194014f, 0.000256240048f,
+   0.000336448429f, 0.000412361464f, 0.000482554169f, 0.000545687450f, 0.000600509637f, 0.000645893277f,
+   0.000680859084f, 0.000704587030f, 0.000716439972f, 0.000715977803f, 0.000702969148f, 0.000677395554f,
+   0.000639462436f, 0.000589597563f, 0.000528440229f, 0.000456852838f, 0.000375879870f, 0.000286764669f,
+   0.000190918247f, 8.98838844e-05f, -1.46564089e-05f, -0.000120945602f, -0.000227148004f, -0.000331394549f,
+   -0.000431829365f, -0.000526613556f, -0.000613974757f, -0.000692247704f, -0.000759882270f, -0.000815497653f,
+   -0.000857889070f, -0.000886065129f, -0.000899266859f, -0.000896982849f, -0.000878962630f, -0.000845229544f,
+   -0.000796085165f, -0.000732099405f, -0.000654125586f, -0.000563263369f, -0.000460871117f, -0.000348535774f,
+   -0.000228032513f, -0.000101334226f, 2.94660713e-05f, 0.000162145865f, 0.000294408965f, 0.000423942780f,
+   0.000548421987f, 0.000665569562f, 0.000773210602f, 0.000869277923f, 0.000951888564f, 0.00101934769f,
+   0.00107019988f, 0.00110325951f, 0.00111762644f, 0.00111271464f, 0.00108826417f, 0.00104435778f,
+   0.000981412246f, 0.000900197774f, 0.000801803311f, 0.000687651045f, 0.000559466542f, 0.000419233605f,
+   0.000269200624f, 0.000111828449f, -5.02718176e-05f, -0.000214331274f, -0.000377527933f, -0.000536985055f,
+   -0.000689838897f, -0.000833313563f, -0.000964721898f, -0.00108156691f, -0.00118154439f, -0.00126261066f,
+   -0.00132302684f, -0.00136137404f, -0.00137660478f, -0.00136805198f, -0.00133545999f, -0.00127898215f,
+   -0.00119920413f, -0.00109711464f, -0.000974122027f, -0.000832029094f, -0.000672982074f, -0.000499481801f,
+   -0.000314325793f, -0.000120537967f, 7.86212331e-05f, 0.000279777945f, 0.000479439244f, 0.000674079987f,
+   0.000860230473f, 0.00103447679f, 0.00119358918f, 0.00133452879f, 0.00145452027f, 0.00155112694f,
+   0.00162226311f, 0.00166626705f, 0.00168191607f, 0.00166846870f, 0.00162567664f, 0.00155380764f,
+   0.00145363109f, 0.00132643490f, 0.00117400521f, 0.000998577336f, 0.000802846800f, 0.000589911884f,
+   0.000363192550f, 0.000126446161f, -0.000116375762f, -0.000361118437f, -0.000603526074f, -0.000839347602f,
+   -0.00106433535f, -0.00127440365f, -0.00146563118f, -0.00163436693f, -0.00177731551f, -0.00189155329f,
+   -0.00197463343f, -0.00202460494f, -0.00204006024f, -0.00202017720f, -0.00196474185f, -0.00187414850f,
+   -0.00174942170f, -0.00159220491f, -0.00140471221f, -0.00118974468f, -0.000950632209f, -0.000691145950f,
+   -0.000415518531f, -0.000128282438f, 0.000165717414f, 0.000461440941f, 0.000753779197f, 0.00103754899f,
+   0.00130768807f, 0.00155925320f, 0.00178755342f, 0.00198826054f, 0.00215742318f, 0.00229161233f,
+   0.00238793367f, 0.00244411686f, 0.00245856238f, 0.00243036891f, 0.00235937349f, 0.00224615145f,
+   0.00209203223f, 0.00189905963f, 0.00167000992f, 0.00140833773f, 0.00111808348f, 0.000803900417f,
+   0.000470874598f, 0.000124542858f, -0.000229239202f, -0.000584445195f, -0.000934875221f, -0.00127435126f,
+   -0.00159678410f, -0.00189629639f, -0.00216730195f, -0.00240464788f, -0.00260368455f, -0.00276036025f,
+   -0.00287130382f, -0.00293388520f, -0.00294628646f, -0.00290753576f, -0.00281753624f, -0.00267709256f,
+   -0.00248789438f, -0.00225251005f, -0.00197435264f, -0.00165762834f, -0.00130729377f, -0.000928949041f,
+   -0.000528773409f, -0.000113419119f, 0.000310107134f, 0.000734522881f, 0.00115245115f, 0.00155650906f,
+   0.00193945447f, 0.00229428126f, 0.00261439546f, 0.00289370329f, 0.00312673301f, 0.00330874207f,
+   0.00343579776f, 0.00350488001f, 0.00351393176f, 0.00346190948f, 0.00334882597f, 0.00317575503f,
+   0.00294483337f, 0.00265923794f, 0.00232313783f, 0.00194166752f, 0.00152080436f, 0.00106730789f,
+   0.000588604831f, 9.26587090e-05f, -0.000412118039f, -0.000917069148f, -0.00141339831f, -0.00189234177f,
+   -0.00234527979f, -0.00276395446f, -0.00314057339f, -0.00346796517f, -0.00373971765f, -0.00395028014f,
+   -0.00409510406f, -0.00417071767f, -0.00417480199f, -0.00410625525f, -0.00396522367f, -0.00375311961f,
+   -0.00347261503f, -0.00312760146f, -0.00272317813f, -0.00226552738f, -0.00176185661f, -0.00122026482f,
+   -0.000649666181f, -5.95707352e-05f, 0.000540023379f, 0.00113880937f, 0.00172636018f, 0.00229225797f,
+   0.00282634981f, 0.00331887999f, 0.00376068638f, 0.00414333027f, 0.00445931405f, 0.00470218435f,
+   0.00486666895f, 0.00494878553f, 0.00494592823f, 0.00485693756f, 0.00468213623f, 0.00442334590f,
+   0.00408386812f, 0.00366848172f, 0.00318333157f, 0.00263587199f, 0.00203473447f, 0.00138964900f,
+   0.000711208093f, 1.07486667e-05f, -0.000699848111f, -0.00140837207f, -0.00210242788f, -0.00276974542f,
+   -0.00339832879f, -0.00397669990f, -0.00449405285f, -0.00494053494f, -0.00530736661f, -0.00558703439f,
+   -0.00577343814f, -0.00586200273f, -0.00584980519f, -0.00573562970f, -0.00552001828f, -0.00520527596f,
+   -0.00479549076f, -0.00429644110f, -0.00371554424f, -0.00306173414f, -0.00234538433f, -0.00157805905f,
+   -0.000772387371f, 5.81555360e-05f, 0.000899490144f, 0.00173709204f, 0.00255635404f, 0.00334276143f,
+   0.00408218196f, 0.00476104999f, 0.00536671281f, 0.00588759407f, 0.00631342689f, 0.00663545821f,
+   0.00684659649f, 0.00694160163f, 0.00691716792f, 0.00677201524f, 0.00650695805f, 0.00612489600f,
+   0.00563080888f, 0.00503169373f, 0.00433645677f, 0.00355585106f, 0.00270222058f, 0.00178936927f,
+   0.000832304882f, -0.000152914843f, -0.00114957988f, -0.00214052061f, -0.00310842111f, -0.00403613923f,
+   -0.00490692304f, -0.00570483319f, -0.00641494757f, -0.00702365581f, -0.00751892244f, -0.00789048057f,
+   -0.00813009962f, -0.00823170878f, -0.00819154549f, -0.00800826307f, -0.00768297864f, -0.00721929036f,
+   -0.00662325602f, -0.00590329943f, -0.00507017318f, -0.00413669972f, -0.00311764819f, -0.00202946109f,
+   -0.000890098163f, 0.000281405839f, 0.00146515586f, 0.00264075375f, 0.00378767028f, 0.00488549611f,
+   0.00591445342f, 0.00685564475f, 0.00769141736f, 0.00840570312f, 0.00898426119f, 0.00941504445f,
+   0.00968837645f, 0.00979717076f, 0.00973708555f, 0.00950665586f, 0.00910734572f, 0.00854357239f,
+   0.00782265328f, 0.00695479568f, 0.00595285883f, 0.00483223377f, 0.00361057930f, 0.00230765413f,
+   0.000944840547f, -0.000455089787f, -0.00186839327f, -0.00327068591f, -0.00463746814f, -0.00594442151f,
+   -0.00716795353f, -0.00828550104f, -0.00927604642f, -0.0101204030f, -0.0108016590f, -0.0113054616f,
+   -0.0116202952f, -0.0117377602f, -0.0116527388f, -0.0113635417f, -0.0108720018f, -0.0101834778f,
+   -0.00930681452f, -0.00825428963f, -0.00704137422f, -0.00568661606f, -0.00421125349f, -0.00263901707f,
+   -0.000995641109f, 0.000691498513f, 0.00239377073f, 0.00408190116f, 0.00572631275f, 0.00729778176f,
+   0.00876780227f, 0.0101092281f, 0.0112966336f, 0.0123068905f, 0.0131195458f, 0.0137172053f,
+   0.0140859354f, 0.0142155141f, 0.0140996929f, 0.0137363682f, 0.0131276660f, 0.0122800162f,
+   0.0112040685f, 0.00991458818f, 0.00843033101f, 0.00677367253f, 0.00497042527f, 0.00304929912f,
+   0.00104162109f, -0.00101930939f, -0.00309869531f, -0.00516074197f, -0.00716941943f, -0.00908888504f,
+   -0.0108843017f, -0.0125222690f, -0.0139715690f, -0.0152036687f, -0.0161932316f, -0.0169186946f,
+   -0.0173626207f, -0.0175121371f, -0.0173591953f, -0.0169008132f, -0.0161392372f, -0.0150819635f,
+   -0.0137417102f, -0.0121363588f, -0.0102886306f, -0.00822593085f, -0.00597980106f, -0.00358564779f,
+   -0.00108200451f, 0.00148985011f, 0.00408674125f, 0.00666421419f, 0.00917717814f, 0.0115808696f,
+   0.0138313938f, 0.0158867072f, 0.0177071709f, 0.0192564167f, 0.0205020141f, 0.0214160178f,
+   0.0219756365f, 0.0221636444f, 0.0219688490f, 0.0213863775f, 0.0204178933f, 0.0190716945f,
+   0.0173627734f, 0.0153125953f, 0.0129490215f, 0.0103057949f, 0.00742230983f, 0.00434283121f,
+   0.00111611572f, -0.00220557209f, -0.00556706544f, -0.00891125109f, -0.0121799679f, -0.0153149469f,
+   -0.0182588585f, -0.0209561847f, -0.0233542807f, -0.0254042931f, -0.0270620752f, -0.0282890443f,
+   -0.0290529523f, -0.0293285623f, -0.0290983282f, -0.0283527859f, -0.0270909481f, -0.0253205374f,
+   -0.0230580773f, -0.0203288496f, -0.0171667077f, -0.0136137558f, -0.00971979927f, -0.00554184942f,
+   -0.00114330207f, 0.00340690953f, 0.00803529005f, 0.0126648564f, 0.0172162727f, 0.0216091778f,
+   0.0257633030f, 0.0295998864f, 0.0330429599f, 0.0360206701f, 0.0384665392f, 0.0403207131f,
+   0.0415311195f, 0.0420545265f, 0.0418575406f, 0.0409174077f, 0.0392227508f, 0.0367740430f,
+   0.0335841738f, 0.0296784788f, 0.0250948593f, 0.0198835190f, 0.0141067747f, 0.00783842988f,
+   0.00116308581f, -0.00582474191f, -0.0130216787f, -0.0203166734f, -0.0275924299f, -0.0347267501f,
+   -0.0415941700f, -0.0480676778f, -0.0540203154f, -0.0593270026f, -0.0638663024f, -0.0675221831f,
+   -0.0701857433f, -0.0717568621f, -0.0721457899f, -0.0712746158f, -0.0690786242f, -0.0655074641f,
+   -0.0605261922f, -0.0541160926f, -0.0462752692f, -0.0370191075f, -0.0263806134f, -0.0144100869f,
+   -0.00117510522f, 0.0132400719f, 0.0287351664f, 0.0451948717f, 0.0624899603f, 0.0804785565f,
+   0.0990076959f, 0.117915064f, 0.137030736f, 0.156179056f, 0.175180763f, 0.193855062f,
+   0.212021738f, 0.229503229f, 0.246126875f, 0.261726916f, 0.276146501f, 0.289239645f,
+   0.300873011f, 0.310927421f, 0.319299519f, 0.325902909f, 0.330669224f, 0.333549052f,
+   0.334512472f, 0.333549052f, 0.330669224f, 0.325902909f, 0.319299519f, 0.310927421f,
+   0.300873011f, 0.289239645f, 0.276146501f, 0.261726916f, 0.246126875f, 0.229503229f,
+   0.212021738f, 0.193855062f, 0.175180763f, 0.156179056f, 0.137030736f, 0.117915064f,
+   0.0990076959f, 0.0804785565f, 0.0624899603f, 0.0451948717f, 0.0287351664f, 0.0132400719f,
+   -0.00117510522f, -0.0144100869f, -0.0263806134f, -0.0370191075f, -0.0462752692f, -0.0541160926f,
+   -0.0605261922f, -0.0655074641f, -0.0690786242f, -0.0712746158f, -0.0721457899f, -0.0717568621f,
+   -0.0701857433f, -0.0675221831f, -0.0638663024f, -0.0593270026f, -0.0540203154f, -0.0480676778f,
+   -0.0415941700f, -0.0347267501f, -0.0275924299f, -0.0203166734f, -0.0130216787f, -0.00582474191f,
+   0.00116308581f, 0.00783842988f, 0.0141067747f, 0.0198835190f, 0.0250948593f, 0.0296784788f,
+   0.0335841738f, 0.0367740430f, 0.0392227508f, 0.0409174077f, 0.0418575406f, 0.0420545265f,
+   0.0415311195f, 0.0403207131f, 0.0384665392f, 0.0360206701f, 0.0330429599f, 0.0295998864f,
+   0.0257633030f, 0.0216091778f, 0.0172162727f, 0.0126648564f, 0.00803529005f, 0.00340690953f,
+   -0.00114330207f, -0.00554184942f, -0.00971979927f, -0.0136137558f, -0.0171667077f, -0.0203288496f,
+   -0.0230580773f, -0.0253205374f, -0.0270909481f, -0.0283527859f, -0.0290983282f, -0.0293285623f,
+   -0.0290529523f, -0.0282890443f, -0.0270620752f, -0.0254042931f, -0.0233542807f, -0.0209561847f,
+   -0.0182588585f, -0.0153149469f, -0.0121799679f, -0.00891125109f, -0.00556706544f, -0.00220557209f,
+   0.00111611572f, 0.00434283121f, 0.00742230983f, 0.0103057949f, 0.0129490215f, 0.0153125953f,
+   0.0173627734f, 0.0190716945f, 0.0204178933f, 0.0213863775f, 0.0219688490f, 0.0221636444f,
+   0.0219756365f, 0.0214160178f, 0.0205020141f, 0.0192564167f, 0.0177071709f, 0.0158867072f,
+   0.0138313938f, 0.0115808696f, 0.00917717814f, 0.00666421419f, 0.00408674125f, 0.00148985011f,
+   -0.00108200451f, -0.00358564779f, -0.00597980106f, -0.00822593085f, -0.0102886306f, -0.0121363588f,
+   -0.0137417102f, -0.0150819635f, -0.0161392372f, -0.0169008132f, -0.0173591953f, -0.0175121371f,
+   -0.0173626207f, -0.0169186946f, -0.0161932316f, -0.0152036687f, -0.0139715690f, -0.0125222690f,
+   -0.0108843017f, -0.00908888504f, -0.00716941943f, -0.00516074197f, -0.00309869531f, -0.00101930939f,
+   0.00104162109f, 0.00304929912f, 0.00497042527f, 0.00677367253f, 0.00843033101f, 0.00991458818f,
+   0.0112040685f, 0.0122800162f, 0.0131276660f, 0.0137363682f, 0.0140996929f, 0.0142155141f,
+   0.0140859354f, 0.0137172053f, 0.0131195458f, 0.0123068905f, 0.0112966336f, 0.0101092281f,
+   0.00876780227f, 0.00729778176f, 0.00572631275f, 0.00408190116f, 0.00239377073f, 0.000691498513f,
+   -0.000995641109f, -0.00263901707f, -0.00421125349f, -0.00568661606f, -0.00704137422f, -0.00825428963f,
+   -0.00930681452f, -0.0101834778f, -0.0108720018f, -0.0113635417f, -0.0116527388f, -0.0117377602f,
+   -0.0116202952f, -0.0113054616f, -0.0108016590f, -0.0101204030f, -0.00927604642f, -0.00828550104f,
+   -0.00716795353f, -0.00594442151f, -0.00463746814f, -0.00327068591f, -0.00186839327f, -0.000455089787f,
+   0.000944840547f, 0.00230765413f, 0.00361057930f, 0.00483223377f, 0.00595285883f, 0.00695479568f,
+   0.00782265328f, 0.00854357239f, 0.00910734572f, 0.00950665586f, 0.00973708555f, 0.00979717076f,
+   0.00968837645f, 0.00941504445f, 0.00898426119f, 0.00840570312f, 0.00769141736f, 0.00685564475f,
+   0.00591445342f, 0.00488549611f, 0.00378767028f, 0.00264075375f, 0.00146515586f, 0.000281405839f,
+   -0.000890098163f, -0.00202946109f, -0.00311764819f, -0.00413669972f, -0.00507017318f, -0.00590329943f,
+   -0.00662325602f, -0.00721929036f, -0.00768297864f, -0.00800826307f, -0.00819154549f, -0.00823170878f,
+   -0.00813009962f, -0.00789048057f, -0.00751892244f, -0.00702365581f, -0.00641494757f, -0.00570483319f,
+   -0.00490692304f, -0.00403613923f, -0.00310842111f, -0.00214052061f, -0.00114957988f, -0.000152914843f,
+   0.000832304882f, 0.00178936927f, 0.00270222058f, 0.00355585106f, 0.00433645677f, 0.00503169373f,
+   0.00563080888f, 0.00612489600f, 0.00650695805f, 0.00677201524f, 0.00691716792f, 0.00694160163f,
+   0.00684659649f, 0.00663545821f, 0.00631342689f, 0.00588759407f, 0.00536671281f, 0.00476104999f,
+   0.00408218196f, 0.00334276143f, 0.00255635404f, 0.00173709204f, 0.000899490144f, 5.81555360e-05f,
+   -0.000772387371f, -0.00157805905f, -0.00234538433f, -0.00306173414f, -0.00371554424f, -0.00429644110f,
+   -0.00479549076f, -0.00520527596f, -0.00552001828f, -0.00573562970f, -0.00584980519f, -0.00586200273f,
+   -0.00577343814f, -0.00558703439f, -0.00530736661f, -0.00494053494f, -0.00449405285f, -0.00397669990f,
+   -0.00339832879f, -0.00276974542f, -0.00210242788f, -0.00140837207f, -0.000699848111f, 1.07486667e-05f,
+   0.000711208093f, 0.00138964900f, 0.00203473447f, 0.00263587199f, 0.00318333157f, 0.00366848172f,
+   0.00408386812f, 0.00442334590f, 0.00468213623f, 0.00485693756f, 0.00494592823f, 0.00494878553f,
+   0.00486666895f, 0.00470218435f, 0.00445931405f, 0.00414333027f, 0.00376068638f, 0.00331887999f,
+   0.00282634981f, 0.00229225797f, 0.00172636018f, 0.00113880937f, 0.000540023379f, -5.95707352e-05f,
+   -0.000649666181f, -0.00122026482f, -0.00176185661f, -0.00226552738f, -0.00272317813f, -0.00312760146f,
+   -0.00347261503f, -0.00375311961f, -0.00396522367f, -0.00410625525f, -0.00417480199f, -0.00417071767f,
+   -0.00409510406f, -0.00395028014f, -0.00373971765f, -0.00346796517f, -0.00314057339f, -0.00276395446f,
+   -0.00234527979f, -0.00189234177f, -0.00141339831f, -0.000917069148f, -0.000412118039f, 9.26587090e-05f,
+   0.000588604831f, 0.00106730789f, 0.00152080436f, 0.00194166752f, 0.00232313783f, 0.00265923794f,
+   0.00294483337f, 0.00317575503f, 0.00334882597f, 0.00346190948f, 0.00351393176f, 0.00350488001f,
+   0.00343579776f, 0.00330874207f, 0.00312673301f, 0.00289370329f, 0.00261439546f, 0.00229428126f,
+   0.00193945447f, 0.00155650906f, 0.00115245115f, 0.000734522881f, 0.000310107134f, -0.000113419119f,
+   -0.000528773409f, -0.000928949041f, -0.00130729377f, -0.00165762834f, -0.00197435264f, -0.00225251005f,
+   -0.00248789438f, -0.00267709256f, -0.00281753624f, -0.00290753576f, -0.00294628646f, -0.00293388520f,
+   -0.00287130382f, -0.00276036025f, -0.00260368455f, -0.00240464788f, -0.00216730195f, -0.00189629639f,
+   -0.00159678410f, -0.00127435126f, -0.000934875221f, -0.000584445195f, -0.000229239202f, 0.000124542858f,
+   0.000470874598f, 0.000803900417f, 0.00111808348f, 0.00140833773f, 0.00167000992f, 0.00189905963f,
+   0.00209203223f, 0.00224615145f, 0.00235937349f, 0.00243036891f, 0.00245856238f, 0.00244411686f,
+   0.00238793367f, 0.00229161233f, 0.00215742318f, 0.00198826054f, 0.00178755342f, 0.00155925320f,
+   0.00130768807f, 0.00103754899f, 0.000753779197f, 0.000461440941f, 0.000165717414f, -0.000128282438f,
+   -0.000415518531f, -0.000691145950f, -0.000950632209f, -0.00118974468f, -0.00140471221f, -0.00159220491f,
+   -0.00174942170f, -0.00187414850f, -0.00196474185f, -0.00202017720f, -0.00204006024f, -0.00202460494f,
+   -0.00197463343f, -0.00189155329f, -0.00177731551f, -0.00163436693f, -0.00146563118f, -0.00127440365f,
+   -0.00106433535f, -0.000839347602f, -0.000603526074f, -0.000361118437f, -0.000116375762f, 0.000126446161f,
+   0.000363192550f, 0.000589911884f, 0.000802846800f, 0.000998577336f, 0.00117400521f, 0.00132643490f,
+   0.00145363109f, 0.00155380764f, 0.00162567664f, 0.00166846870f, 0.00168191607f, 0.00166626705f,
+   0.00162226311f, 0.00155112694f, 0.00145452027f, 0.00133452879f, 0.00119358918f, 0.00103447679f,
+   0.000860230473f, 0.000674079987f, 0.000479439244f, 0.000279777945f, 7.86212331e-05f, -0.000120537967f,
+   -0.000314325793f, -0.000499481801f, -0.000672982074f, -0.000832029094f, -0.000974122027f, -0.00109711464f,
+   -0.00119920413f, -0.00127898215f, -0.00133545999f, -0.00136805198f, -0.00137660478f, -0.00136137404f,
+   -0.00132302684f, -0.00126261066f, -0.00118154439f, -0.00108156691f, -0.000964721898f, -0.000833313563f,
+   -0.000689838897f, -0.000536985055f, -0.000377527933f, -0.000214331274f, -5.02718176e-05f, 0.000111828449f,
+   0.000269200624f, 0.000419233605f, 0.000559466542f, 0.000687651045f, 0.000801803311f, 0.000900197774f,
+   0.000981412246f, 0.00104435778f, 0.00108826417f, 0.00111271464f, 0.00111762644f, 0.00110325951f,
+   0.00107019988f, 0.00101934769f, 0.000951888564f, 0.000869277923f, 0.000773210602f, 0.000665569562f,
+   0.000548421987f, 0.000423942780f, 0.000294408965f, 0.000162145865f, 2.94660713e-05f, -0.000101334226f,
+   -0.000228032513f, -0.000348535774f, -0.000460871117f, -0.000563263369f, -0.000654125586f, -0.000732099405f,
+   -0.000796085165f, -0.000845229544f, -0.000878962630f, -0.000896982849f, -0.000899266859f, -0.000886065129f,
+   -0.000857889070f, -0.000815497653f, -0.000759882270f, -0.000692247704f, -0.000613974757f, -0.000526613556f,
+   -0.000431829365f, -0.000331394549f, -0.000227148004f, -0.000120945602f, -1.46564089e-05f, 8.98838844e-05f,
+   0.000190918247f, 0.000286764669f, 0.000375879870f, 0.000456852838f, 0.000528440229f, 0.000589597563f,
+   0.000639462436f, 0.000677395554f, 0.000702969148f, 0.000715977803f, 0.000716439972f, 0.000704587030f,
+   0.000680859084f, 0.000645893277f, 0.000600509637f, 0.000545687450f, 0.000482554169f, 0.000412361464f,
+   0.000336448429f, 0.000256240048f, 0.000173194014f, 8.87988135e-05f, 4.53783468e-06f, -7.81483759e-05f,
+   -0.000157859744f, -0.000233289524f, -0.000303219771f, -0.000366552384f, -0.000422333193f, -0.000469746679f,
+   -0.000508147059f, -0.000537050597f, -0.000556147948f, -0.000565311697f, -0.000564579386f, -0.000554162310f,
+   -0.000534434803f, -0.000505924982f, -0.000469299644f, -0.000425354287f, -0.000374996685f, -0.000319220475f,
+   -0.000259101012f, -0.000195757486f, -0.000130349159f, -6.40481085e-05f, 1.99126907e-06f, 6.66309279e-05f,
+   0.000128792191f, 0.000187452446f, 0.000241671398f, 0.000290612050f, 0.000333536736f, 0.000369835238f,
+   0.000399018492f, 0.000420731900f, 0.000434759946f, 0.000441021257f, 0.000439572061f, 0.000430599903f,
+   0.000414418784f, 0.000391461508f, 0.000362265942f, 0.000327469053f, 0.000287787378f, 0.000244012044f,
+   0.000196981622f, 0.000147577972f, 9.67059241e-05f, 4.52693967e-05f, -5.82853727e-06f, -5.57191270e-05f,
+   -0.000103566395f, -0.000148588166f, -0.000190074032f, -0.000227382436f, -0.000259965396f, -0.000287362898f,
+   -0.000309215975f, -0.000325271976f, -0.000335380872f, -0.000339500868f, -0.000337693287f, -0.000330121635f,
+   -0.000317044149f, -0.000298809726f, -0.000275848957f, -0.000248662225f, -0.000217815279f, -0.000183921031f,
+   -0.000147632818f, -0.000109632085f, -7.06098217e-05f, -3.12654665e-05f, 7.71859141e-06f, 4.56765556e-05f,
+   8.19756242e-05f, 0.000116031217f, 0.000147304352f, 0.000175322886f, 0.000199677059f, 0.000220030968f,
+   0.000236128180f, 0.000247789168f, 0.000254916027f, 0.000257492502f, 0.000255580642f, 0.000249318720f,
+   0.000238917361f, 0.000224654170f, 0.000206865734f, 0.000185944140f, 0.000162323020f, 0.000136475341f,
+   0.000108901419f, 8.01162823e-05f, 5.06481520e-05f, 2.10196304e-05f, -8.25312054e-06f, -3.66721761e-05f,
+   -6.37703051e-05f, -8.91093514e-05f, -0.000112297232f, -0.000132984875f, -0.000150875596f, -0.000165731035f,
+   -0.000177368303f, -0.000185665704f, -0.000190563267f, -0.000192060368f, -0.000190215796f, -0.000185144556f,
+   -0.000177015347f, -0.000166044381f, -0.000152493536f, -0.000136660587f, -0.000118877280f, -9.95008741e-05f,
+   -7.89049591e-05f, -5.74781552e-05f, -3.56098790e-05f, -1.36902063e-05f, 7.89987735e-06f, 2.87977291e-05f,
+   4.86591052e-05f, 6.71669404e-05f, 8.40381690e-05f, 9.90220869e-05f, 0.000111910434f, 0.000122534315f,
+   0.000130769156f, 0.000136536066f, 0.000139799769f, 0.000140570453f, 0.000138900359f, 0.000134883507f,
+   0.000128651402f, 0.000120371551f, 0.000110241162f, 9.84854341e-05f, 8.53520760e-05f, 7.11042157e-05f,
+   5.60197368e-05f, 4.03809208e-05f, 2.44740622e-05f, 8.58235217e-06f, -7.02106036e-06f, -2.20734291e-05f,
+   -3.63287945e-05f, -4.95638196e-05f, -6.15764293e-05f, -7.21938850e-05f, -8.12705694e-05f, -8.86921116e-05f,
+   -9.43772102e-05f, -9.82754791e-05f, -0.000100370351f, -0.000100676109f, -9.92383357e-05f, -9.61313199e-05f,
+   -9.14566917e-05f, -8.53399688e-05f, -7.79284528e-05f, -6.93882466e-05f, -5.98990846e-05f, -4.96536704e-05f,
+   -3.88505396e-05f, -2.76935716e-05f, -1.63869627e-05f, -5.13003442e-06f, 5.88306375e-06f, 1.64681314e-05f,
+   2.64553000e-05f, 3.56882083e-05f, 4.40300792e-05f, 5.13624400e-05f, 5.75879858e-05f, 6.26326801e-05f,
+   6.64439649e-05f, 6.89935259e-05f, 7.02750258e-05f, 7.03045080e-05f, 6.91201130e-05f, 6.67794593e-05f,
+   6.33586751e-05f, 5.89503543e-05f, 5.36618791e-05f, 4.76118803e-05f, 4.09296154e-05f, 3.37503589e-05f,
+   2.62145586e-05f, 1.84647051e-05f, 1.06414782e-05f, 2.88345859e-06f, -4.67629206e-06f, -1.19133911e-05f,
+   -1.87117403e-05f, -2.49678505e-05f, -3.05901376e-05f, -3.55010452e-05f, -3.96387695e-05f, -4.29560350e-05f,
+   -4.54222936e-05f, -4.70223713e-05f, -4.77567773e-05f, -4.76414971e-05f, -4.67065292e-05f, -4.49954423e-05f,
+   -4.25638136e-05f, -3.94777453e-05f, -3.58133475e-05f, -3.16539772e-05f, -2.70891160e-05f, -2.22116596e-05f,
+   -1.71177035e-05f, -1.19029810e-05f, -6.66276583e-06f, -1.48952984e-06f, 3.52907750e-06f, 8.31135367e-06f,
+   1.27812536e-05f, 1.68722017e-05f, 2.05264696e-05f, 2.36950073e-05f, 2.63401180e-05f, 2.84344205e-05f,
+   2.99606199e-05f, 3.09126335e-05f, 3.12945667e-05f, 3.11203148e-05f, 3.04130826e-05f, 2.92047407e-05f,
+   2.75345792e-05f, 2.54490369e-05f, 2.29997931e-05f, 2.02429928e-05f, 1.72387081e-05f, 1.40482089e-05f,
+   1.07349042e-05f, 7.36114680e-06f, 3.98892871e-06f, 6.76999605e-07f, -2.51917754e-06f, -5.54743519e-06f,
+   -8.36143136e-06f, -1.09203575e-05f, -1.31887391e-05f, -1.51384020e-05f, -1.67477738e-05f, -1.80017141e-05f,
+   -1.88924423e-05f, -1.94187942e-05f, -1.95861630e-05f, -1.94059048e-05f, -1.88953454e-05f, -1.80767875e-05f,
+   -1.69773211e-05f, -1.56277638e-05f, -1.40620832e-05f, -1.23170557e-05f, -1.04307755e-05f, -8.44243823e-06f,
+   -6.39121163e-06f, -4.31631133e-06f, -2.25520535e-06f, -2.43527069e-07f, 1.68470524e-06f, 3.49916468e-06f,
+   5.17284980e-06f, 6.68195798e-06f, 8.00716498e-06f, 9.13321037e-06f, 1.00487532e-05f, 1.07470969e-05f,
+   1.12255848e-05f, 1.14857194e-05f, 1.15326875e-05f, 1.13754786e-05f, 1.10262336e-05f, 1.05000800e-05f,
+   9.81462927e-06f, 8.98946291e-06f, 8.04600222e-06f, 7.00661440e-06f, 5.89435467e-06f, 4.73274167e-06f,
+   3.54485360e-06f, 2.35322159e-06f, 1.17925424e-06f, 4.33246754e-08f, -1.03617742e-06f, -2.04278103e-06f,
+   -2.96186886e-06f, -3.78099162e-06f, -4.49078289e-06f, -5.08390849e-06f, -5.55579209e-06f, -5.90421905e-06f,
+   -6.12942222e-06f, -6.23376445e-06f, -6.22184962e-06f, -6.10015286e-06f, -5.87680734e-06f, -5.56145142e-06f,
+   -5.16484897e-06f, -4.69879842e-06f, -4.17566025e-06f, -3.60818308e-06f, -3.00936313e-06f, -2.39193287e-06f,
+   -1.76831668e-06f, -1.15028990e-06f, -5.49020001e-07f, 2.54376520e-08f, 5.64109087e-07f, 1.05907736e-06f,
+   1.50385927e-06f, 1.89330683e-06f, 2.22350832e-06f, 2.49205141e-06f, 2.69779821e-06f, 2.83986469e-06f,
+   2.92049072e-06f, 2.94221059e-06f, 2.90855405e-06f, 2.82387532e-06f, 2.69329485e-06f, 2.52246946e-06f,
+   2.31751960e-06f, 2.08482015e-06f, 1.83084683e-06f, 1.56212820e-06f, 1.28498220e-06f, 1.00548550e-06f,
+   7.29303963e-07f, 4.61705639e-07f, 2.07339440e-07f, -2.97590521e-08f, -2.46145930e-07f, -4.39126893e-07f,
+   -6.06701462e-07f, -7.47505624e-07f, -8.60905061e-07f, -9.46888804e-07f, -1.00604245e-06f, -1.03947264e-06f,
+   -1.04878234e-06f, -1.03598336e-06f, -1.00339673e-06f, 0.00000000f, 0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_61[2440] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, 6.09654023e-07f, 4.92925949e-07f,
+   3.60188409e-07f, 2.12002846e-07f, 4.91773520e-08f, -1.27229882e-07f, -3.15910484e-07f, -5.15309182e-07f,
+   -7.23630365e-07f, -9.38848416e-07f, -1.15872433e-06f, -1.38081214e-06f, -1.60249544e-06f, -1.82100155e-06f,
+   -2.03343166e-06f, -2.23679058e-06f, -2.42802093e-06f, -2.60403749e-06f, -2.76176615e-06f, -2.89818286e-06f,
+   -3.01035402e-06f, -3.09547818e-06f, -3.15092848e-06f, -3.17429340e-06f, -3.16341811e-06f, -3.11644453e-06f,
+   -3.03184856e-06f, -2.90847538e-06f, -2.74557306e-06f, -2.54282531e-06f, -2.30039655e-06f, -2.01882972e-06f,
+   -1.69926579e-06f, -1.34331344e-06f, -9.53089625e-07f, -5.31218802e-07f, -8.08252238e-08f, 3.94480423e-07f,
+   8.90621038e-07f, 1.40271709e-06f, 1.92596212e-06f, 2.45508181e-06f, 2.98448549e-06f, 3.50831624e-06f,
+   4.02050728e-06f, 4.51484129e-06f, 4.98501686e-06f, 5.42471435e-06f, 5.82768007e-06f, 6.18775903e-06f,
+   6.49902859e-06f, 6.75583669e-06f, 6.95288736e-06f, 7.08531570e-06f, 7.14876114e-06f, 7.13943746e-06f,
+   7.05419961e-06f, 6.89060698e-06f, 6.64697791e-06f, 6.32244110e-06f, 5.91697881e-06f, 5.43146098e-06f,
+   4.86767294e-06f, 4.22833045e-06f, 3.51709036e-06f, 2.73854357e-06f, 1.89820469e-06f, 1.00248735e-06f,
+   5.86622200e-08f, -9.25177005e-07f, -1.94018048e-06f, -2.97680731e-06f, -4.02490423e-06f, -5.07379264e-06f,
+   -6.11236692e-06f, -7.12919882e-06f, -8.11255086e-06f, -9.05016623e-06f, -9.93087087e-06f, -1.07431588e-05f,
+   -1.14758259e-05f, -1.21180938e-05f, -1.26597488e-05f, -1.30912695e-05f, -1.34039565e-05f, -1.35900555e-05f,
+   -1.36428916e-05f, -1.35569117e-05f, -1.33278882e-05f, -1.29529426e-05f, -1.24306425e-05f, -1.17610634e-05f,
+   -1.09458497e-05f, -9.98824180e-06f, -8.89310468e-06f, -7.66693029e-06f, -6.31782177e-06f, -4.85546661e-06f,
+   -3.29108502e-06f, -1.63736343e-06f, 9.16312217e-08f, 1.88055401e-06f, 3.71290230e-06f, 5.57115209e-06f,
+   7.43691089e-06f, 9.29109410e-06f, 1.11140616e-05f, 1.28858719e-05f, 1.45864396e-05f, 1.61957578e-05f,
+   1.76941103e-05f, 1.90622868e-05f, 2.02818082e-05f, 2.13351414e-05f, 2.22059170e-05f, 2.28782210e-05f,
+   2.33395458e-05f, 2.35782645e-05f, 2.35847001e-05f, 2.33512837e-05f, 2.28726967e-05f, 2.21460068e-05f,
+   2.11707629e-05f, 1.99492861e-05f, 1.84859637e-05f, 1.67883318e-05f, 1.48664685e-05f, 1.27330750e-05f,
+   1.04034343e-05f, 7.89533442e-06f, 5.22895743e-06f, 2.42674241e-06f, -4.86782881e-07f, -3.48519302e-06f,
+   -6.54038467e-06f, -9.62281865e-06f, -1.27017875e-05f, -1.57456943e-05f, -1.87223650e-05f, -2.15993568e-05f,
+   -2.43442937e-05f, -2.69252014e-05f, -2.93108551e-05f, -3.14711506e-05f, -3.33773351e-05f, -3.50025221e-05f,
+   -3.63218969e-05f, -3.73130861e-05f, -3.79564226e-05f, -3.82352700e-05f, -3.81362443e-05f, -3.76494645e-05f,
+   -3.67687535e-05f, -3.54910808e-05f, -3.38189420e-05f, -3.17581325e-05f, -2.93186040e-05f, -2.65144718e-05f,
+   -2.33639748e-05f, -1.98894049e-05f, -1.61169955e-05f, -1.20767490e-05f, -7.80224855e-06f, -3.33036610e-06f,
+   1.29896341e-06f, 6.04311617e-06f, 1.08571330e-05f, 1.56941169e-05f, 2.05056695e-05f, 2.52418067e-05f,
+   2.98535997e-05f, 3.42904095e-05f, 3.85025924e-05f, 4.24414684e-05f, 4.60598494e-05f, 4.93125553e-05f,
+   5.21569418e-05f, 5.45533949e-05f, 5.64658258e-05f, 5.78621148e-05f, 5.87145732e-05f, 5.90003583e-05f,
+   5.87016511e-05f, 5.78062791e-05f, 5.63077592e-05f, 5.42055786e-05f, 5.15053507e-05f, 4.82189062e-05f,
+   4.43643366e-05f, 3.99659730e-05f, 3.50542796e-05f, 2.96654343e-05f, 2.38420489e-05f, 1.76318263e-05f,
+   1.10875908e-05f, 4.26688621e-06f, -2.76850506e-06f, -9.95308073e-06f, -1.72181972e-05f, -2.44926905e-05f,
+   -3.17035629e-05f, -3.87765940e-05f, -4.56371927e-05f, -5.22110677e-05f, -5.84246845e-05f, -6.42073719e-05f,
+   -6.94900518e-05f, -7.42073826e-05f, -7.82981588e-05f, -8.17060427e-05f, -8.43802191e-05f, -8.62760862e-05f,
+   -8.73558383e-05f, -8.75890109e-05f, -8.69529686e-05f, -8.54333048e-05f, -8.30242134e-05f, -7.97287357e-05f,
+   -7.55589135e-05f, -7.05359707e-05f, -6.46900662e-05f, -5.80605592e-05f, -5.06955621e-05f, -4.26517363e-05f,
+   -3.39939143e-05f, -2.47946191e-05f, -1.51335244e-05f, -5.09741676e-06f, 5.22299888e-06f, 1.57301456e-05f,
+   2.63229849e-05f, 3.68973197e-05f, 4.73467589e-05f, 5.75637496e-05f, 6.74406256e-05f, 7.68707250e-05f,
+   8.57494451e-05f, 9.39753882e-05f, 0.000101451515f, 0.000108085937f, 0.000113793380f, 0.000118495926f,
+   0.000122124024f, 0.000124617378f, 0.000125925770f, 0.000126009778f, 0.000124841434f, 0.000122404686f,
+   0.000118695949f, 0.000113724287f, 0.000107511667f, 0.000100093559f, 9.15167184e-05f, 8.18420740e-05f,
+   7.11424291e-05f, 5.95024430e-05f, 4.70180385e-05f, 3.37957135e-05f, 1.99515780e-05f, 5.61056549e-06f,
+   -9.09476694e-06f, -2.40253721e-05f, -3.90369787e-05f, -5.39814428e-05f, -6.87081338e-05f, -8.30654317e-05f,
+   -9.69022003e-05f, -0.000110069363f, -0.000122421377f, -0.000133817855f, -0.000144124991f, -0.000153217145f,
+   -0.000160978205f, -0.000167302991f, -0.000172098356f, -0.000175285109f, -0.000176797970f, -0.000176586982f,
+   -0.000174618792f, -0.000170876796f, -0.000165361838f, -0.000158092487f, -0.000149105283f, -0.000138454678f,
+   -0.000126212864f, -0.000112469446f, -9.73308415e-05f, -8.09195699e-05f, -6.33733580e-05f, -4.48440551e-05f,
+   -2.54963779e-05f, -5.50653294e-06f, 1.49393336e-05f, 3.56467972e-05f, 5.64149523e-05f, 7.70383340e-05f,
+   9.73087226e-05f, 0.000117016301f, 0.000135956128f, 0.000153923364f, 0.000170720072f, 0.000186156103f,
+   0.000200051189f, 0.000212236890f, 0.000222558563f, 0.000230877631f, 0.000237071872f, 0.000241038360f,
+   0.000242694397f, 0.000241978734f, 0.000238852648f, 0.000233300656f, 0.000225331227f, 0.000214977117f,
+   0.000202295560f, 0.000187367783f, 0.000170299318f, 0.000151218919f, 0.000130277855f, 0.000107648833f,
+   8.35261671e-05f, 5.81181594e-05f, 3.16543847e-05f, 4.37777862e-06f, -2.34560775e-05f, -5.15812535e-05f,
+   -7.97239409e-05f, -0.000107605047f, -0.000134942879f, -0.000161455915f, -0.000186865640f, -0.000210899336f,
+   -0.000233292987f, -0.000253794133f, -0.000272164121f, -0.000288181502f, -0.000301644119f, -0.000312371441f,
+   -0.000320206949f, -0.000325020024f, -0.000326707726f, -0.000325196394f, -0.000320442778f, -0.000312436168f,
+   -0.000301196880f, -0.000286776194f, -0.000269260345f, -0.000248767261f, -0.000225446507f, -0.000199478513f,
+   -0.000171073247f, -0.000140468663f, -0.000107928900f, -7.37418159e-05f, -3.82170147e-05f, -1.68278757e-06f,
+   3.55167176e-05f, 7.30246611e-05f, 0.000110474837f, 0.000147495171f, 0.000183711323f, 0.000218750356f,
+   0.000252244528f, 0.000283834990f, 0.000313175551f, 0.000339936349f, 0.000363807427f, 0.000384501094f,
+   0.000401759549f, 0.000415351067f, 0.000425077684f, 0.000430776592f, 0.000432321482f, 0.000429625768f,
+   0.000422643352f, 0.000411369809f, 0.000395843294f, 0.000376144773f, 0.000352398056f, 0.000324769208f,
+   0.000293465622f, 0.000258735672f, 0.000220863687f, 0.000180171250f, 0.000137013296f, 9.17752550e-05f,
+   4.48696410e-05f, -3.26755526e-06f, -5.21808288e-05f, -0.000101399346f, -0.000150438573f, -0.000198816284f,
+   -0.000246040028f, -0.000291623612f, -0.000335089018f, -0.000375971344f, -0.000413823553f, -0.000448221370f,
+   -0.000478767703f, -0.000505097152f, -0.000526880031f, -0.000543826493f, -0.000555689679f, -0.000562269241f,
+   -0.000563413836f, -0.000559023581f, -0.000549051678f, -0.000533506041f, -0.000512449886f, -0.000486002216f,
+   -0.000454336696f, -0.000417682226f, -0.000376320560f, -0.000330584560f, -0.000280859065f, -0.000227564931f,
+   -0.000171174557f, -0.000112195470f, -5.11688704e-05f, 1.13351616e-05f, 7.47232625e-05f, 0.000138383461f,
+   0.000201691364f, 0.000264016242f, 0.000324727094f, 0.000383198931f, 0.000438819116f, 0.000490993611f,
+   0.000539153349f, 0.000582759385f, 0.000621310202f, 0.000654346077f, 0.000681454781f, 0.000702276360f,
+   0.000716507377f, 0.000723904988f, 0.000724290090f, 0.000717551156f, 0.000703643134f, 0.000682592974f,
+   0.000654498290f, 0.000619527826f, 0.000577920990f, 0.000529986341f, 0.000476099987f, 0.000416702387f,
+   0.000352295378f, 0.000283438043f, 0.000210741578f, 0.000134864837f, 5.65079754e-05f, -2.35937350e-05f,
+   -0.000104676670f, -0.000185955956f, -0.000266632996f, -0.000345903041f, -0.000422963261f, -0.000497022411f,
+   -0.000567303796f, -0.000633057789f, -0.000693565118f, -0.000748157676f, -0.000796205306f, -0.000837136758f,
+   -0.000870442775f, -0.000895681675f, -0.000912485411f, -0.000920562714f, -0.000919705257f, -0.000909789698f,
+   -0.000890780124f, -0.000862730143f, -0.000825783238f, -0.000780173112f, -0.000726222119f, -0.000664340099f,
+   -0.000595020771f, -0.000518838875f, -0.000436445029f, -0.000348560716f, -0.000255972118f, -0.000159523232f,
+   -6.01083884e-05f, 4.13296948e-05f, 0.000143833357f, 0.000246402051f, 0.000348026195f, 0.000447691215f,
+   0.000544387265f, 0.000637119461f, 0.000724917569f, 0.000806846423f, 0.000882015389f, 0.000949587731f,
+   0.00100878999f, 0.00105892378f, 0.00109936332f, 0.00112957286f, 0.00114911015f, 0.00115763175f,
+   0.00115489820f, 0.00114077784f, 0.00111524924f, 0.00107840344f, 0.00103044452f, 0.000971688016f,
+   0.000902561529f, 0.000823605980f, 0.000735451060f, 0.000638841128f, 0.000534609368f, 0.000423675781f,
+   0.000307039067f, 0.000185768135f, 6.09923627e-05f, -6.61087615e-05f, -0.000194316526f, -0.000322384527f,
+   -0.000449050567f, -0.000573048950f, -0.000693122915f, -0.000808037177f, -0.000916590390f, -0.00101762789f,
+   -0.00111005222f, -0.00119283702f, -0.00126503641f, -0.00132579624f, -0.00137436332f, -0.00141009456f,
+   -0.00143246399f, -0.00144107279f, -0.00143564877f, -0.00141606061f, -0.00138230529f, -0.00133452401f,
+   -0.00127299805f, -0.00119814801f, -0.00111053116f, -0.00101083831f, -0.000899888226f, -0.000778621703f,
+   -0.000648093701f, -0.000509463891f, -0.000363987900f, -0.000213005187f, -5.79271873e-05f, 9.97756069e-05f,
+   0.000258587417f, 0.000416961499f, 0.000573335099f, 0.000726144470f, 0.000873840414f, 0.00101489574f,
+   0.00114785333f, 0.00127129129f, 0.00138387165f, 0.00148434576f, 0.00157156773f, 0.00164450740f,
+   0.00170226174f, 0.00174406613f, 0.00176930113f, 0.00177750422f, 0.00176837388f, 0.00174177531f,
+   0.00169774413f, 0.00163648778f, 0.00155838591f, 0.00146398891f, 0.00135401450f, 0.00122934673f,
+   0.00109101750f, 0.000940210535f, 0.000778247719f, 0.000606577552f, 0.000426762592f, 0.000240476948f,
+   4.94452361e-05f, -0.000144504884f, -0.000339505350f, -0.000533653831f, -0.000725032296f, -0.000911725860f,
+   -0.00109184138f, -0.00126352662f, -0.00142498862f, -0.00157451280f, -0.00171048020f, -0.00183138472f,
+   -0.00193584990f, -0.00202264334f, -0.00209069112f, -0.00213909056f, -0.00216712058f, -0.00217425148f,
+   -0.00216015242f, -0.00212469744f, -0.00206796895f, -0.00199026009f, -0.00189207925f, -0.00177412410f,
+   -0.00163731375f, -0.00148275821f, -0.00131175562f, -0.00112578168f, -0.000926477544f, -0.000715635775f,
+   -0.000495184155f, -0.000267169351f, -3.37350320e-05f, 0.000202893818f, 0.000440433592f, 0.000676563883f,
+   0.000908949471f, 0.00113526382f, 0.00135321147f, 0.00156055146f, 0.00175511965f, 0.00193485117f,
+   0.00209780224f, 0.00224216958f, 0.00236631185f, 0.00246876152f, 0.00254826108f, 0.00260374765f,
+   0.00263438700f, 0.00263957935f, 0.00261896756f, 0.00257244380f, 0.00250015315f, 0.00240249629f,
+   0.00228012749f, 0.00213395152f, 0.00196511764f, 0.00177501247f, 0.00156524684f, 0.00133764476f,
+   0.00109422673f, 0.000837192696f, 0.000568902411f, 0.000291854318f, 8.66225764e-06f, -0.000277968560f,
+   -0.000565267168f, -0.000850423356f, -0.00113059825f, -0.00140302174f, -0.00166491140f, -0.00191357464f,
+   -0.00214641681f, -0.00236096908f, -0.00255491189f, -0.00272610155f, -0.00287259300f, -0.00299266051f,
+   -0.00308481790f, -0.00314783584f, -0.00318075600f, -0.00318290526f, -0.00315390457f, -0.00309367618f,
+   -0.00300244708f, -0.00288075302f, -0.00272943359f, -0.00254962966f, -0.00234277477f, -0.00211058441f,
+   -0.00185504241f, -0.00157838489f, -0.00128309999f, -0.000971831032f, -0.000647463952f, -0.000313028315f,
+   2.83129430e-05f, 0.000373292714f, 0.000718570838f, 0.00106076605f, 0.00139648863f, 0.00172237388f,
+   0.00203511515f, 0.00233149668f, 0.00260842731f, 0.00286297104f, 0.00309237838f, 0.00329412124f,
+   0.00346590299f, 0.00360570010f, 0.00371178007f, 0.00378272147f, 0.00381743093f, 0.00381515897f,
+   0.00377551047f, 0.00369845890f, 0.00358432624f, 0.00343381823f, 0.00324800005f, 0.00302829570f,
+   0.00277647749f, 0.00249465276f, 0.00218524598f, 0.00185098033f, 0.00149485259f, 0.00112010771f,
+   0.000730209460f, 0.000328808819f, -8.02897630e-05f, -0.000493163941f, -0.000905810739f, -0.00131418474f,
+   -0.00171422586f, -0.00210194639f, -0.00247339904f, -0.00282476447f, -0.00315237767f, -0.00345276669f,
+   -0.00372268772f, -0.00395915937f, -0.00415949663f, -0.00432133721f, -0.00444267178f, -0.00452186540f,
+   -0.00455767801f, -0.00454928959f, -0.00449628849f, -0.00439870311f, -0.00425699959f, -0.00407208269f,
+   -0.00384528842f, -0.00357837952f, -0.00327353086f, -0.00293331314f, -0.00256067119f, -0.00215890049f,
+   -0.00173163088f, -0.00128274201f, -0.000816407148f, -0.000337002770f, 0.000150918931f, 0.000642672647f,
+   0.00113348477f, 0.00161853910f, 0.00209302362f, 0.00255217752f, 0.00299133919f, 0.00340597983f,
+   0.00379179977f, 0.00414469605f, 0.00446085772f, 0.00473679230f, 0.00496936450f, 0.00515582925f,
+   0.00529386429f, 0.00538159581f, 0.00541762402f, 0.00540103903f, 0.00533143803f, 0.00520893745f,
+   0.00503415894f, 0.00480825640f, 0.00453289272f, 0.00421023741f, 0.00384293683f, 0.00343410787f,
+   0.00298730773f, 0.00250650407f, 0.00199603871f, 0.00146059110f, 0.000905152643f, 0.000334912183f,
+   -0.000244690076f, -0.000828081276f, -0.00140959211f, -0.00198351103f, -0.00254414091f, -0.00308585330f,
+   -0.00360314548f, -0.00409069564f, -0.00454341574f, -0.00495650666f, -0.00532549480f, -0.00564632332f,
+   -0.00591532979f, -0.00612933328f, -0.00628565764f, -0.00638216082f, -0.00641726656f, -0.00638998207f,
+   -0.00629991386f, -0.00614727987f, -0.00593291316f, -0.00565825915f, -0.00532537978f, -0.00493689626f,
+   -0.00449603423f, -0.00400655298f, -0.00347273005f, -0.00289932056f, -0.00229151780f, -0.00165490725f,
+   -0.000995411421f, -0.000319241371f, 0.000367163360f, 0.00105717476f, 0.00174412271f, 0.00242123380f,
+   0.00308178132f, 0.00371912960f, 0.00432680128f, 0.00489853974f, 0.00542837707f, 0.00591069041f,
+   0.00634026388f, 0.00671234448f, 0.00702268863f, 0.00726760924f, 0.00744403992f, 0.00754953036f,
+   0.00758230546f, 0.00754128536f, 0.00742609799f, 0.00723709492f, 0.00697535370f, 0.00664267270f,
+   0.00624156371f, 0.00577523559f, 0.00524756638f, 0.00466309581f, 0.00402690843f, 0.00334470440f,
+   0.00262267352f, 0.00186746113f, 0.00108610571f, 0.000285974616f, -0.000525303883f, -0.00133991346f,
+   -0.00214992347f, -0.00294736703f, -0.00372429239f, -0.00447293650f, -0.00518565997f, -0.00585512025f,
+   -0.00647432031f, -0.00703668268f, -0.00753611652f, -0.00796708278f, -0.00832465384f, -0.00860456936f,
+   -0.00880328380f, -0.00891800690f, -0.00894674379f, -0.00888831727f, -0.00874238741f, -0.00850946922f,
+   -0.00819093175f, -0.00778899761f, -0.00730672572f, -0.00674799224f, -0.00611746171f, -0.00542054838f,
+   -0.00466337241f, -0.00385270570f, -0.00299594132f, -0.00210091937f, -0.00117601478f, -0.000229955738f,
+   0.000728231913f, 0.00168930984f, 0.00264391489f, 0.00358264986f, 0.00449617440f, 0.00537529681f,
+   0.00621106615f, 0.00699483883f, 0.00771845784f, 0.00837420020f, 0.00895494595f, 0.00945423543f,
+   0.00986633636f, 0.0101863099f, 0.0104100630f, 0.0105344020f, 0.0105570694f, 0.0104767783f,
+   0.0102932332f, 0.0100071551f, 0.00962024461f, 0.00913523231f, 0.00855582487f, 0.00788669474f,
+   0.00713343266f, 0.00630251644f, 0.00540124625f, 0.00443768688f, 0.00342059694f, 0.00235934905f,
+   0.00126384571f, 0.000144462610f, -0.000988185056f, -0.00212313817f, -0.00324933324f, -0.00435567647f,
+   -0.00543114962f, -0.00646492047f, -0.00744644972f, -0.00836559478f, -0.00921271741f, -0.00997877773f,
+   -0.0106554152f, -0.0112351105f, -0.0117111495f, -0.0120777795f, -0.0123302573f, -0.0124648977f,
+   -0.0124791330f, -0.0123715391f, -0.0121418666f, -0.0117910560f, -0.0113212373f, -0.0107357260f,
+   -0.0100390259f, -0.00923670456f, -0.00833548605f, -0.00734311016f, -0.00626828801f, -0.00512062944f,
+   -0.00391055783f, -0.00264921715f, -0.00134837173f, -2.02975025e-05f, 0.00132233161f, 0.00266652228f,
+   0.00399924815f, 0.00530733122f, 0.00657773204f, 0.00779763795f, 0.00895458926f, 0.0100366054f,
+   0.0110323057f, 0.0119310291f, 0.0127229420f, 0.0133991465f, 0.0139517756f, 0.0143740699f,
+   0.0146605028f, 0.0148067707f, 0.0148099074f, 0.0146683054f, 0.0143817523f, 0.0139514459f,
+   0.0133799985f, 0.0126714231f, 0.0118311206f, 0.0108658327f, 0.00978359301f, 0.00859370083f,
+   0.00730649801f, 0.00593349710f, 0.00448714057f, 0.00298072351f, 0.00142827432f, -0.000155572576f,
+   -0.00175571325f, -0.00335669145f, -0.00494294195f, -0.00649879500f, -0.00800872408f, -0.00945747644f,
+   -0.0108302198f, -0.0121126790f, -0.0132913506f, -0.0143535305f, -0.0152875250f, -0.0160827544f,
+   -0.0167298708f, -0.0172208529f, -0.0175491273f, -0.0177096128f, -0.0176988021f, -0.0175148211f,
+   -0.0171574578f, -0.0166281946f, -0.0159301776f, -0.0150682544f, -0.0140489200f, -0.0128802732f,
+   -0.0115719624f, -0.0101351291f, -0.00858223066f, -0.00692705950f, -0.00518455496f, -0.00337067572f,
+   -0.00150229211f, 0.000403081009f, 0.00232727546f, 0.00425175298f, 0.00615774980f, 0.00802645925f,
+   0.00983918365f, 0.0115776276f, 0.0132239144f, 0.0147608742f, 0.0161721930f, 0.0174425803f,
+   0.0185579136f, 0.0195054542f, 0.0202738848f, 0.0208535101f, 0.0212363470f, 0.0214162301f,
+   0.0213888884f, 0.0211520083f, 0.0207052790f, 0.0200504325f, 0.0191912372f, 0.0181334931f,
+   0.0168850254f, 0.0154555449f, 0.0138567025f, 0.0121019213f, 0.0102063073f, 0.00818652660f,
+   0.00606069481f, 0.00384809286f, 0.00156918599f, -0.000754684443f, -0.00310146529f, -0.00544855557f,
+   -0.00777316978f, -0.0100523327f, -0.0122632468f, -0.0143834762f, -0.0163911674f, -0.0182652418f,
+   -0.0199857205f, -0.0215337612f, -0.0228919666f, -0.0240445491f, -0.0249774996f, -0.0256787352f,
+   -0.0261382870f, -0.0263483543f, -0.0263034608f, -0.0260005184f, -0.0254388973f, -0.0246204790f,
+   -0.0235496107f, -0.0222331844f, -0.0206805468f, -0.0189034659f, -0.0169160422f, -0.0147346482f,
+   -0.0123776589f, -0.00986550841f, -0.00722039258f, -0.00446610991f, -0.00162785780f, 0.00126794539f,
+   0.00419407338f, 0.00712247565f, 0.0100247124f, 0.0128721744f, 0.0156363174f, 0.0182891004f,
+   0.0208030101f, 0.0231514815f, 0.0253091790f, 0.0272522047f, 0.0289583430f, 0.0304073952f,
+   0.0315812491f, 0.0324641913f, 0.0330430642f, 0.0333074294f, 0.0332497247f, 0.0328653455f,
+   0.0321527719f, 0.0311136115f, 0.0297526419f, 0.0280778054f, 0.0261002295f, 0.0238340292f,
+   0.0212964229f, 0.0185074825f, 0.0154900337f, 0.0122694690f, 0.00887361448f, 0.00533228740f,
+   0.00167736446f, -0.00205769576f, -0.00583806168f, -0.00962795131f, -0.0133907786f, -0.0170895793f,
+   -0.0206874274f, -0.0241476279f, -0.0274341423f, -0.0305120181f, -0.0333475880f, -0.0359088890f,
+   -0.0381660424f, -0.0400914550f, -0.0416602008f, -0.0428502709f, -0.0436428785f, -0.0440226607f,
+   -0.0439778604f, -0.0435005538f, -0.0425867401f, -0.0412365124f, -0.0394541100f, -0.0372479074f,
+   -0.0346305147f, -0.0316186994f, -0.0282332227f, -0.0244988911f, -0.0204443205f, -0.0161016565f,
+   -0.0115065379f, -0.00669774320f, -0.00171678618f, 0.00339219067f, 0.00858287420f, 0.0138072828f,
+   0.0190159325f, 0.0241583791f, 0.0291837715f, 0.0340410769f, 0.0386796594f, 0.0430498458f,
+   0.0471032001f, 0.0507930852f, 0.0540752113f, 0.0569079220f, 0.0592527129f, 0.0610747002f,
+   0.0623429045f, 0.0630307049f, 0.0631161407f, 0.0625822246f, 0.0614172183f, 0.0596147887f,
+   0.0571744181f, 0.0541012734f, 0.0504064783f, 0.0461071320f, 0.0412261970f, 0.0357926339f,
+   0.0298412349f, 0.0234123226f, 0.0165518224f, 0.00931089278f, 0.00174545555f, -0.00608378090f,
+   -0.0141120441f, -0.0222706553f, -0.0304877050f, -0.0386884585f, -0.0467957854f, -0.0547309220f,
+   -0.0624138974f, -0.0697642192f, -0.0767013580f, -0.0831455588f, -0.0890183523f, -0.0942431688f,
+   -0.0987460613f, -0.102456242f, -0.105306700f, -0.107234821f, -0.108182892f, -0.108098678f,
+   -0.106935896f, -0.104654655f, -0.101221927f, -0.0966118649f, -0.0908061191f, -0.0837942064f,
+   -0.0755735859f, -0.0661498532f, -0.0555369630f, -0.0437572375f, -0.0308411550f, -0.0168273970f,
+   -0.00176286616f, 0.0142978635f, 0.0312924758f, 0.0491514988f, 0.0677984431f, 0.0871504769f,
+   0.107118689f, 0.127608716f, 0.148521423f, 0.169753313f, 0.191197276f, 0.212743402f,
+   0.234279424f, 0.255691618f, 0.276865602f, 0.297686934f, 0.318042010f, 0.337818742f,
+   0.356907338f, 0.375201046f, 0.392596900f, 0.408996403f, 0.424306244f, 0.438438773f,
+   0.451312870f, 0.462854296f, 0.472996354f, 0.481680155f, 0.488855273f, 0.494479865f,
+   0.498521149f, 0.500955522f, 0.501768708f, 0.500955522f, 0.498521149f, 0.494479865f,
+   0.488855273f, 0.481680155f, 0.472996354f, 0.462854296f, 0.451312870f, 0.438438773f,
+   0.424306244f, 0.408996403f, 0.392596900f, 0.375201046f, 0.356907338f, 0.337818742f,
+   0.318042010f, 0.297686934f, 0.276865602f, 0.255691618f, 0.234279424f, 0.212743402f,
+   0.191197276f, 0.169753313f, 0.148521423f, 0.127608716f, 0.107118689f, 0.0871504769f,
+   0.0677984431f, 0.0491514988f, 0.0312924758f, 0.0142978635f, -0.00176286616f, -0.0168273970f,
+   -0.0308411550f, -0.0437572375f, -0.0555369630f, -0.0661498532f, -0.0755735859f, -0.0837942064f,
+   -0.0908061191f, -0.0966118649f, -0.101221927f, -0.104654655f, -0.106935896f, -0.108098678f,
+   -0.108182892f, -0.107234821f, -0.105306700f, -0.102456242f, -0.0987460613f, -0.0942431688f,
+   -0.0890183523f, -0.0831455588f, -0.0767013580f, -0.0697642192f, -0.0624138974f, -0.0547309220f,
+   -0.0467957854f, -0.0386884585f, -0.0304877050f, -0.0222706553f, -0.0141120441f, -0.00608378090f,
+   0.00174545555f, 0.00931089278f, 0.0165518224f, 0.0234123226f, 0.0298412349f, 0.0357926339f,
+   0.0412261970f, 0.0461071320f, 0.0504064783f, 0.0541012734f, 0.0571744181f, 0.0596147887f,
+   0.0614172183f, 0.0625822246f, 0.0631161407f, 0.0630307049f, 0.0623429045f, 0.0610747002f,
+   0.0592527129f, 0.0569079220f, 0.0540752113f, 0.0507930852f, 0.0471032001f, 0.0430498458f,
+   0.0386796594f, 0.0340410769f, 0.0291837715f, 0.0241583791f, 0.0190159325f, 0.0138072828f,
+   0.00858287420f, 0.00339219067f, -0.00171678618f, -0.00669774320f, -0.0115065379f, -0.0161016565f,
+   -0.0204443205f, -0.0244988911f, -0.0282332227f, -0.0316186994f, -0.0346305147f, -0.0372479074f,
+   -0.0394541100f, -0.0412365124f, -0.0425867401f, -0.0435005538f, -0.0439778604f, -0.0440226607f,
+   -0.0436428785f, -0.0428502709f, -0.0416602008f, -0.0400914550f, -0.0381660424f, -0.0359088890f,
+   -0.0333475880f, -0.0305120181f, -0.0274341423f, -0.0241476279f, -0.0206874274f, -0.0170895793f,
+   -0.0133907786f, -0.00962795131f, -0.00583806168f, -0.00205769576f, 0.00167736446f, 0.00533228740f,
+   0.00887361448f, 0.0122694690f, 0.0154900337f, 0.0185074825f, 0.0212964229f, 0.0238340292f,
+   0.0261002295f, 0.0280778054f, 0.0297526419f, 0.0311136115f, 0.0321527719f, 0.0328653455f,
+   0.0332497247f, 0.0333074294f, 0.0330430642f, 0.0324641913f, 0.0315812491f, 0.0304073952f,
+   0.0289583430f, 0.0272522047f, 0.0253091790f, 0.0231514815f, 0.0208030101f, 0.0182891004f,
+   0.0156363174f, 0.0128721744f, 0.0100247124f, 0.00712247565f, 0.00419407338f, 0.00126794539f,
+   -0.00162785780f, -0.00446610991f, -0.00722039258f, -0.00986550841f, -0.0123776589f, -0.0147346482f,
+   -0.0169160422f, -0.0189034659f, -0.0206805468f, -0.0222331844f, -0.0235496107f, -0.0246204790f,
+   -0.0254388973f, -0.0260005184f, -0.0263034608f, -0.0263483543f, -0.0261382870f, -0.0256787352f,
+   -0.0249774996f, -0.0240445491f, -0.0228919666f, -0.0215337612f, -0.0199857205f, -0.0182652418f,
+   -0.0163911674f, -0.0143834762f, -0.0122632468f, -0.0100523327f, -0.00777316978f, -0.00544855557f,
+   -0.00310146529f, -0.000754684443f, 0.00156918599f, 0.00384809286f, 0.00606069481f, 0.00818652660f,
+   0.0102063073f, 0.0121019213f, 0.0138567025f, 0.0154555449f, 0.0168850254f, 0.0181334931f,
+   0.0191912372f, 0.0200504325f, 0.0207052790f, 0.0211520083f, 0.0213888884f, 0.0214162301f,
+   0.0212363470f, 0.0208535101f, 0.0202738848f, 0.0195054542f, 0.0185579136f, 0.0174425803f,
+   0.0161721930f, 0.0147608742f, 0.0132239144f, 0.0115776276f, 0.00983918365f, 0.00802645925f,
+   0.00615774980f, 0.00425175298f, 0.00232727546f, 0.000403081009f, -0.00150229211f, -0.00337067572f,
+   -0.00518455496f, -0.00692705950f, -0.00858223066f, -0.0101351291f, -0.0115719624f, -0.0128802732f,
+   -0.0140489200f, -0.0150682544f, -0.0159301776f, -0.0166281946f, -0.0171574578f, -0.0175148211f,
+   -0.0176988021f, -0.0177096128f, -0.0175491273f, -0.0172208529f, -0.0167298708f, -0.0160827544f,
+   -0.0152875250f, -0.0143535305f, -0.0132913506f, -0.0121126790f, -0.0108302198f, -0.00945747644f,
+   -0.00800872408f, -0.00649879500f, -0.00494294195f, -0.00335669145f, -0.00175571325f, -0.000155572576f,
+   0.00142827432f, 0.00298072351f, 0.00448714057f, 0.00593349710f, 0.00730649801f, 0.00859370083f,
+   0.00978359301f, 0.0108658327f, 0.0118311206f, 0.0126714231f, 0.0133799985f, 0.0139514459f,
+   0.0143817523f, 0.0146683054f, 0.0148099074f, 0.0148067707f, 0.0146605028f, 0.0143740699f,
+   0.0139517756f, 0.0133991465f, 0.0127229420f, 0.0119310291f, 0.0110323057f, 0.0100366054f,
+   0.00895458926f, 0.00779763795f, 0.00657773204f, 0.00530733122f, 0.00399924815f, 0.00266652228f,
+   0.00132233161f, -2.02975025e-05f, -0.00134837173f, -0.00264921715f, -0.00391055783f, -0.00512062944f,
+   -0.00626828801f, -0.00734311016f, -0.00833548605f, -0.00923670456f, -0.0100390259f, -0.0107357260f,
+   -0.0113212373f, -0.0117910560f, -0.0121418666f, -0.0123715391f, -0.0124791330f, -0.0124648977f,
+   -0.0123302573f, -0.0120777795f, -0.0117111495f, -0.0112351105f, -0.0106554152f, -0.00997877773f,
+   -0.00921271741f, -0.00836559478f, -0.00744644972f, -0.00646492047f, -0.00543114962f, -0.00435567647f,
+   -0.00324933324f, -0.00212313817f, -0.000988185056f, 0.000144462610f, 0.00126384571f, 0.00235934905f,
+   0.00342059694f, 0.00443768688f, 0.00540124625f, 0.00630251644f, 0.00713343266f, 0.00788669474f,
+   0.00855582487f, 0.00913523231f, 0.00962024461f, 0.0100071551f, 0.0102932332f, 0.0104767783f,
+   0.0105570694f, 0.0105344020f, 0.0104100630f, 0.0101863099f, 0.00986633636f, 0.00945423543f,
+   0.00895494595f, 0.00837420020f, 0.00771845784f, 0.00699483883f, 0.00621106615f, 0.00537529681f,
+   0.00449617440f, 0.00358264986f, 0.00264391489f, 0.00168930984f, 0.000728231913f, -0.000229955738f,
+   -0.00117601478f, -0.00210091937f, -0.00299594132f, -0.00385270570f, -0.00466337241f, -0.00542054838f,
+   -0.00611746171f, -0.00674799224f, -0.00730672572f, -0.00778899761f, -0.00819093175f, -0.00850946922f,
+   -0.00874238741f, -0.00888831727f, -0.00894674379f, -0.00891800690f, -0.00880328380f, -0.00860456936f,
+   -0.00832465384f, -0.00796708278f, -0.00753611652f, -0.00703668268f, -0.00647432031f, -0.00585512025f,
+   -0.00518565997f, -0.00447293650f, -0.00372429239f, -0.00294736703f, -0.00214992347f, -0.00133991346f,
+   -0.000525303883f, 0.000285974616f, 0.00108610571f, 0.00186746113f, 0.00262267352f, 0.00334470440f,
+   0.00402690843f, 0.00466309581f, 0.00524756638f, 0.00577523559f, 0.00624156371f, 0.00664267270f,
+   0.00697535370f, 0.00723709492f, 0.00742609799f, 0.00754128536f, 0.00758230546f, 0.00754953036f,
+   0.00744403992f, 0.00726760924f, 0.00702268863f, 0.00671234448f, 0.00634026388f, 0.00591069041f,
+   0.00542837707f, 0.00489853974f, 0.00432680128f, 0.00371912960f, 0.00308178132f, 0.00242123380f,
+   0.00174412271f, 0.00105717476f, 0.000367163360f, -0.000319241371f, -0.000995411421f, -0.00165490725f,
+   -0.00229151780f, -0.00289932056f, -0.00347273005f, -0.00400655298f, -0.00449603423f, -0.00493689626f,
+   -0.00532537978f, -0.00565825915f, -0.00593291316f, -0.00614727987f, -0.00629991386f, -0.00638998207f,
+   -0.00641726656f, -0.00638216082f, -0.00628565764f, -0.00612933328f, -0.00591532979f, -0.00564632332f,
+   -0.00532549480f, -0.00495650666f, -0.00454341574f, -0.00409069564f, -0.00360314548f, -0.00308585330f,
+   -0.00254414091f, -0.00198351103f, -0.00140959211f, -0.000828081276f, -0.000244690076f, 0.000334912183f,
+   0.000905152643f, 0.00146059110f, 0.00199603871f, 0.00250650407f, 0.00298730773f, 0.00343410787f,
+   0.00384293683f, 0.00421023741f, 0.00453289272f, 0.00480825640f, 0.00503415894f, 0.00520893745f,
+   0.00533143803f, 0.00540103903f, 0.00541762402f, 0.00538159581f, 0.00529386429f, 0.00515582925f,
+   0.00496936450f, 0.00473679230f, 0.00446085772f, 0.00414469605f, 0.00379179977f, 0.00340597983f,
+   0.00299133919f, 0.00255217752f, 0.00209302362f, 0.00161853910f, 0.00113348477f, 0.000642672647f,
+   0.000150918931f, -0.000337002770f, -0.000816407148f, -0.00128274201f, -0.00173163088f, -0.00215890049f,
+   -0.00256067119f, -0.00293331314f, -0.00327353086f, -0.00357837952f, -0.00384528842f, -0.00407208269f,
+   -0.00425699959f, -0.00439870311f, -0.00449628849f, -0.00454928959f, -0.00455767801f, -0.00452186540f,
+   -0.00444267178f, -0.00432133721f, -0.00415949663f, -0.00395915937f, -0.00372268772f, -0.00345276669f,
+   -0.00315237767f, -0.00282476447f, -0.00247339904f, -0.00210194639f, -0.00171422586f, -0.00131418474f,
+   -0.000905810739f, -0.000493163941f, -8.02897630e-05f, 0.000328808819f, 0.000730209460f, 0.00112010771f,
+   0.00149485259f, 0.00185098033f, 0.00218524598f, 0.00249465276f, 0.00277647749f, 0.00302829570f,
+   0.00324800005f, 0.00343381823f, 0.00358432624f, 0.00369845890f, 0.00377551047f, 0.00381515897f,
+   0.00381743093f, 0.00378272147f, 0.00371178007f, 0.00360570010f, 0.00346590299f, 0.00329412124f,
+   0.00309237838f, 0.00286297104f, 0.00260842731f, 0.00233149668f, 0.00203511515f, 0.00172237388f,
+   0.00139648863f, 0.00106076605f, 0.000718570838f, 0.000373292714f, 2.83129430e-05f, -0.000313028315f,
+   -0.000647463952f, -0.000971831032f, -0.00128309999f, -0.00157838489f, -0.00185504241f, -0.00211058441f,
+   -0.00234277477f, -0.00254962966f, -0.00272943359f, -0.00288075302f, -0.00300244708f, -0.00309367618f,
+   -0.00315390457f, -0.00318290526f, -0.00318075600f, -0.00314783584f, -0.00308481790f, -0.00299266051f,
+   -0.00287259300f, -0.00272610155f, -0.00255491189f, -0.00236096908f, -0.00214641681f, -0.00191357464f,
+   -0.00166491140f, -0.00140302174f, -0.00113059825f, -0.000850423356f, -0.000565267168f, -0.000277968560f,
+   8.66225764e-06f, 0.000291854318f, 0.000568902411f, 0.000837192696f, 0.00109422673f, 0.00133764476f,
+   0.00156524684f, 0.00177501247f, 0.00196511764f, 0.00213395152f, 0.00228012749f, 0.00240249629f,
+   0.00250015315f, 0.00257244380f, 0.00261896756f, 0.00263957935f, 0.00263438700f, 0.00260374765f,
+   0.00254826108f, 0.00246876152f, 0.00236631185f, 0.00224216958f, 0.00209780224f, 0.00193485117f,
+   0.00175511965f, 0.00156055146f, 0.00135321147f, 0.00113526382f, 0.000908949471f, 0.000676563883f,
+   0.000440433592f, 0.000202893818f, -3.37350320e-05f, -0.000267169351f, -0.000495184155f, -0.000715635775f,
+   -0.000926477544f, -0.00112578168f, -0.00131175562f, -0.00148275821f, -0.00163731375f, -0.00177412410f,
+   -0.00189207925f, -0.00199026009f, -0.00206796895f, -0.00212469744f, -0.00216015242f, -0.00217425148f,
+   -0.00216712058f, -0.00213909056f, -0.00209069112f, -0.00202264334f, -0.00193584990f, -0.00183138472f,
+   -0.00171048020f, -0.00157451280f, -0.00142498862f, -0.00126352662f, -0.00109184138f, -0.000911725860f,
+   -0.000725032296f, -0.000533653831f, -0.000339505350f, -0.000144504884f, 4.94452361e-05f, 0.000240476948f,
+   0.000426762592f, 0.000606577552f, 0.000778247719f, 0.000940210535f, 0.00109101750f, 0.00122934673f,
+   0.00135401450f, 0.00146398891f, 0.00155838591f, 0.00163648778f, 0.00169774413f, 0.00174177531f,
+   0.00176837388f, 0.00177750422f, 0.00176930113f, 0.00174406613f, 0.00170226174f, 0.00164450740f,
+   0.00157156773f, 0.00148434576f, 0.00138387165f, 0.00127129129f, 0.00114785333f, 0.00101489574f,
+   0.000873840414f, 0.000726144470f, 0.000573335099f, 0.000416961499f, 0.000258587417f, 9.97756069e-05f,
+   -5.79271873e-05f, -0.000213005187f, -0.000363987900f, -0.000509463891f, -0.000648093701f, -0.000778621703f,
+   -0.000899888226f, -0.00101083831f, -0.00111053116f, -0.00119814801f, -0.00127299805f, -0.00133452401f,
+   -0.00138230529f, -0.00141606061f, -0.00143564877f, -0.00144107279f, -0.00143246399f, -0.00141009456f,
+   -0.00137436332f, -0.00132579624f, -0.00126503641f, -0.00119283702f, -0.00111005222f, -0.00101762789f,
+   -0.000916590390f, -0.000808037177f, -0.000693122915f, -0.000573048950f, -0.000449050567f, -0.000322384527f,
+   -0.000194316526f, -6.61087615e-05f, 6.09923627e-05f, 0.000185768135f, 0.000307039067f, 0.000423675781f,
+   0.000534609368f, 0.000638841128f, 0.000735451060f, 0.000823605980f, 0.000902561529f, 0.000971688016f,
+   0.00103044452f, 0.00107840344f, 0.00111524924f, 0.00114077784f, 0.00115489820f, 0.00115763175f,
+   0.00114911015f, 0.00112957286f, 0.00109936332f, 0.00105892378f, 0.00100878999f, 0.000949587731f,
+   0.000882015389f, 0.000806846423f, 0.000724917569f, 0.000637119461f, 0.000544387265f, 0.000447691215f,
+   0.000348026195f, 0.000246402051f, 0.000143833357f, 4.13296948e-05f, -6.01083884e-05f, -0.000159523232f,
+   -0.000255972118f, -0.000348560716f, -0.000436445029f, -0.000518838875f, -0.000595020771f, -0.000664340099f,
+   -0.000726222119f, -0.000780173112f, -0.000825783238f, -0.000862730143f, -0.000890780124f, -0.000909789698f,
+   -0.000919705257f, -0.000920562714f, -0.000912485411f, -0.000895681675f, -0.000870442775f, -0.000837136758f,
+   -0.000796205306f, -0.000748157676f, -0.000693565118f, -0.000633057789f, -0.000567303796f, -0.000497022411f,
+   -0.000422963261f, -0.000345903041f, -0.000266632996f, -0.000185955956f, -0.000104676670f, -2.35937350e-05f,
+   5.65079754e-05f, 0.000134864837f, 0.000210741578f, 0.000283438043f, 0.000352295378f, 0.000416702387f,
+   0.000476099987f, 0.000529986341f, 0.000577920990f, 0.000619527826f, 0.000654498290f, 0.000682592974f,
+   0.000703643134f, 0.000717551156f, 0.000724290090f, 0.000723904988f, 0.000716507377f, 0.000702276360f,
+   0.000681454781f, 0.000654346077f, 0.000621310202f, 0.000582759385f, 0.000539153349f, 0.000490993611f,
+   0.000438819116f, 0.000383198931f, 0.000324727094f, 0.000264016242f, 0.000201691364f, 0.000138383461f,
+   7.47232625e-05f, 1.13351616e-05f, -5.11688704e-05f, -0.000112195470f, -0.000171174557f, -0.000227564931f,
+   -0.000280859065f, -0.000330584560f, -0.000376320560f, -0.000417682226f, -0.000454336696f, -0.000486002216f,
+   -0.000512449886f, -0.000533506041f, -0.000549051678f, -0.000559023581f, -0.000563413836f, -0.000562269241f,
+   -0.000555689679f, -0.000543826493f, -0.000526880031f, -0.000505097152f, -0.000478767703f, -0.000448221370f,
+   -0.000413823553f, -0.000375971344f, -0.000335089018f, -0.000291623612f, -0.000246040028f, -0.000198816284f,
+   -0.000150438573f, -0.000101399346f, -5.21808288e-05f, -3.26755526e-06f, 4.48696410e-05f, 9.17752550e-05f,
+   0.000137013296f, 0.000180171250f, 0.000220863687f, 0.000258735672f, 0.000293465622f, 0.000324769208f,
+   0.000352398056f, 0.000376144773f, 0.000395843294f, 0.000411369809f, 0.000422643352f, 0.000429625768f,
+   0.000432321482f, 0.000430776592f, 0.000425077684f, 0.000415351067f, 0.000401759549f, 0.000384501094f,
+   0.000363807427f, 0.000339936349f, 0.000313175551f, 0.000283834990f, 0.000252244528f, 0.000218750356f,
+   0.000183711323f, 0.000147495171f, 0.000110474837f, 7.30246611e-05f, 3.55167176e-05f, -1.68278757e-06f,
+   -3.82170147e-05f, -7.37418159e-05f, -0.000107928900f, -0.000140468663f, -0.000171073247f, -0.000199478513f,
+   -0.000225446507f, -0.000248767261f, -0.000269260345f, -0.000286776194f, -0.000301196880f, -0.000312436168f,
+   -0.000320442778f, -0.000325196394f, -0.000326707726f, -0.000325020024f, -0.000320206949f, -0.000312371441f,
+   -0.000301644119f, -0.000288181502f, -0.000272164121f, -0.000253794133f, -0.000233292987f, -0.000210899336f,
+   -0.000186865640f, -0.000161455915f, -0.000134942879f, -0.000107605047f, -7.97239409e-05f, -5.15812535e-05f,
+   -2.34560775e-05f, 4.37777862e-06f, 3.16543847e-05f, 5.81181594e-05f, 8.35261671e-05f, 0.000107648833f,
+   0.000130277855f, 0.000151218919f, 0.000170299318f, 0.000187367783f, 0.000202295560f, 0.000214977117f,
+   0.000225331227f, 0.000233300656f, 0.000238852648f, 0.000241978734f, 0.000242694397f, 0.000241038360f,
+   0.000237071872f, 0.000230877631f, 0.000222558563f, 0.000212236890f, 0.000200051189f, 0.000186156103f,
+   0.000170720072f, 0.000153923364f, 0.000135956128f, 0.000117016301f, 9.73087226e-05f, 7.70383340e-05f,
+   5.64149523e-05f, 3.56467972e-05f, 1.49393336e-05f, -5.50653294e-06f, -2.54963779e-05f, -4.48440551e-05f,
+   -6.33733580e-05f, -8.09195699e-05f, -9.73308415e-05f, -0.000112469446f, -0.000126212864f, -0.000138454678f,
+   -0.000149105283f, -0.000158092487f, -0.000165361838f, -0.000170876796f, -0.000174618792f, -0.000176586982f,
+   -0.000176797970f, -0.000175285109f, -0.000172098356f, -0.000167302991f, -0.000160978205f, -0.000153217145f,
+   -0.000144124991f, -0.000133817855f, -0.000122421377f, -0.000110069363f, -9.69022003e-05f, -8.30654317e-05f,
+   -6.87081338e-05f, -5.39814428e-05f, -3.90369787e-05f, -2.40253721e-05f, -9.09476694e-06f, 5.61056549e-06f,
+   1.99515780e-05f, 3.37957135e-05f, 4.70180385e-05f, 5.95024430e-05f, 7.11424291e-05f, 8.18420740e-05f,
+   9.15167184e-05f, 0.000100093559f, 0.000107511667f, 0.000113724287f, 0.000118695949f, 0.000122404686f,
+   0.000124841434f, 0.000126009778f, 0.000125925770f, 0.000124617378f, 0.000122124024f, 0.000118495926f,
+   0.000113793380f, 0.000108085937f, 0.000101451515f, 9.39753882e-05f, 8.57494451e-05f, 7.68707250e-05f,
+   6.74406256e-05f, 5.75637496e-05f, 4.73467589e-05f, 3.68973197e-05f, 2.63229849e-05f, 1.57301456e-05f,
+   5.22299888e-06f, -5.09741676e-06f, -1.51335244e-05f, -2.47946191e-05f, -3.39939143e-05f, -4.26517363e-05f,
+   -5.06955621e-05f, -5.80605592e-05f, -6.46900662e-05f, -7.05359707e-05f, -7.55589135e-05f, -7.97287357e-05f,
+   -8.30242134e-05f, -8.54333048e-05f, -8.69529686e-05f, -8.75890109e-05f, -8.73558383e-05f, -8.62760862e-05f,
+   -8.43802191e-05f, -8.17060427e-05f, -7.82981588e-05f, -7.42073826e-05f, -6.94900518e-05f, -6.42073719e-05f,
+   -5.84246845e-05f, -5.22110677e-05f, -4.56371927e-05f, -3.87765940e-05f, -3.17035629e-05f, -2.44926905e-05f,
+   -1.72181972e-05f, -9.95308073e-06f, -2.76850506e-06f, 4.26688621e-06f, 1.10875908e-05f, 1.76318263e-05f,
+   2.38420489e-05f, 2.96654343e-05f, 3.50542796e-05f, 3.99659730e-05f, 4.43643366e-05f, 4.82189062e-05f,
+   5.15053507e-05f, 5.42055786e-05f, 5.63077592e-05f, 5.78062791e-05f, 5.87016511e-05f, 5.90003583e-05f,
+   5.87145732e-05f, 5.78621148e-05f, 5.64658258e-05f, 5.45533949e-05f, 5.21569418e-05f, 4.93125553e-05f,
+   4.60598494e-05f, 4.24414684e-05f, 3.85025924e-05f, 3.42904095e-05f, 2.98535997e-05f, 2.52418067e-05f,
+   2.05056695e-05f, 1.56941169e-05f, 1.08571330e-05f, 6.04311617e-06f, 1.29896341e-06f, -3.33036610e-06f,
+   -7.80224855e-06f, -1.20767490e-05f, -1.61169955e-05f, -1.98894049e-05f, -2.33639748e-05f, -2.65144718e-05f,
+   -2.93186040e-05f, -3.17581325e-05f, -3.38189420e-05f, -3.54910808e-05f, -3.67687535e-05f, -3.76494645e-05f,
+   -3.81362443e-05f, -3.82352700e-05f, -3.79564226e-05f, -3.73130861e-05f, -3.63218969e-05f, -3.50025221e-05f,
+   -3.33773351e-05f, -3.14711506e-05f, -2.93108551e-05f, -2.69252014e-05f, -2.43442937e-05f, -2.15993568e-05f,
+   -1.87223650e-05f, -1.57456943e-05f, -1.27017875e-05f, -9.62281865e-06f, -6.54038467e-06f, -3.48519302e-06f,
+   -4.86782881e-07f, 2.42674241e-06f, 5.22895743e-06f, 7.89533442e-06f, 1.04034343e-05f, 1.27330750e-05f,
+   1.48664685e-05f, 1.67883318e-05f, 1.84859637e-05f, 1.99492861e-05f, 2.11707629e-05f, 2.21460068e-05f,
+   2.28726967e-05f, 2.33512837e-05f, 2.35847001e-05f, 2.35782645e-05f, 2.33395458e-05f, 2.28782210e-05f,
+   2.22059170e-05f, 2.13351414e-05f, 2.02818082e-05f, 1.90622868e-05f, 1.76941103e-05f, 1.61957578e-05f,
+   1.45864396e-05f, 1.28858719e-05f, 1.11140616e-05f, 9.29109410e-06f, 7.43691089e-06f, 5.57115209e-06f,
+   3.71290230e-06f, 1.88055401e-06f, 9.16312217e-08f, -1.63736343e-06f, -3.29108502e-06f, -4.85546661e-06f,
+   -6.31782177e-06f, -7.66693029e-06f, -8.89310468e-06f, -9.98824180e-06f, -1.09458497e-05f, -1.17610634e-05f,
+   -1.24306425e-05f, -1.29529426e-05f, -1.33278882e-05f, -1.35569117e-05f, -1.36428916e-05f, -1.35900555e-05f,
+   -1.34039565e-05f, -1.30912695e-05f, -1.26597488e-05f, -1.21180938e-05f, -1.14758259e-05f, -1.07431588e-05f,
+   -9.93087087e-06f, -9.05016623e-06f, -8.11255086e-06f, -7.12919882e-06f, -6.11236692e-06f, -5.07379264e-06f,
+   -4.02490423e-06f, -2.97680731e-06f, -1.94018048e-06f, -9.25177005e-07f, 5.86622200e-08f, 1.00248735e-06f,
+   1.89820469e-06f, 2.73854357e-06f, 3.51709036e-06f, 4.22833045e-06f, 4.86767294e-06f, 5.43146098e-06f,
+   5.91697881e-06f, 6.32244110e-06f, 6.64697791e-06f, 6.89060698e-06f, 7.05419961e-06f, 7.13943746e-06f,
+   7.14876114e-06f, 7.08531570e-06f, 6.95288736e-06f, 6.75583669e-06f, 6.49902859e-06f, 6.18775903e-06f,
+   5.82768007e-06f, 5.42471435e-06f, 4.98501686e-06f, 4.51484129e-06f, 4.02050728e-06f, 3.50831624e-06f,
+   2.98448549e-06f, 2.45508181e-06f, 1.92596212e-06f, 1.40271709e-06f, 8.90621038e-07f, 3.94480423e-07f,
+   -8.08252238e-08f, -5.31218802e-07f, -9.53089625e-07f, -1.34331344e-06f, -1.69926579e-06f, -2.01882972e-06f,
+   -2.30039655e-06f, -2.54282531e-06f, -2.74557306e-06f, -2.90847538e-06f, -3.03184856e-06f, -3.11644453e-06f,
+   -3.16341811e-06f, -3.17429340e-06f, -3.15092848e-06f, -3.09547818e-06f, -3.01035402e-06f, -2.89818286e-06f,
+   -2.76176615e-06f, -2.60403749e-06f, -2.42802093e-06f, -2.23679058e-06f, -2.03343166e-06f, -1.82100155e-06f,
+   -1.60249544e-06f, -1.38081214e-06f, -1.15872433e-06f, -9.38848416e-07f, -7.23630365e-07f, -5.15309182e-07f,
+   -3.15910484e-07f, -1.27229882e-07f, 4.91773520e-08f, 2.12002846e-07f, 3.60188409e-07f, 4.92925949e-07f,
+   6.09654023e-07f, 0.00000000f, 0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_62[1800] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, -2.00679347e-06f, -2.07196672e-06f,
+   -2.09756467e-06f, -2.07894527e-06f, -2.01208491e-06f, -1.89377761e-06f, -1.72181012e-06f, -1.49501125e-06f,
+   -1.21340292e-06f, -8.78253786e-07f, -4.92291861e-07f, -5.95181042e-08f, 4.14678880e-07f, 9.23411278e-07f,
+   1.45860793e-06f, 2.01097100e-06f, 2.56996441e-06f, 3.12425641e-06f, 3.66169365e-06f, 4.16964031e-06f,
+   4.63503920e-06f, 5.04493892e-06f, 5.38658969e-06f, 5.64775064e-06f, 5.81710810e-06f, 5.88442117e-06f,
+   5.84098143e-06f, 5.67972938e-06f, 5.39559642e-06f, 4.98410282e-06f, 4.44701664e-06f, 3.78661366e-06f,
+   3.00771853e-06f, 2.11815473e-06f, 1.12821817e-06f, 5.08753040e-08f, -1.09804000e-06f, -2.30057981e-06f,
+   -3.53663336e-06f, -4.78386573e-06f, -6.01872625e-06f, -7.21636616e-06f, -8.35132050e-06f, -9.39759684e-06f,
+   -1.03296979e-05f, -1.11229028e-05f, -1.17536147e-05f, -1.22003057e-05f, -1.24436992e-05f, -1.24675289e-05f,
+   -1.22588444e-05f, -1.18084381e-05f, -1.11115842e-05f, -1.01678170e-05f, -8.98156577e-06f, -7.56198324e-06f,
+   -5.92373772e-06f, -4.08556207e-06f, -2.07235485e-06f, 8.66493508e-08f, 2.35850848e-06f, 4.70644318e-06f,
+   7.08970720e-06f, 9.46548334e-06f, 1.17887093e-05f, 1.40132288e-05f, 1.60920044e-05f, 1.79789258e-05f,
+   1.96292585e-05f, 2.10001599e-05f, 2.20524671e-05f, 2.27509572e-05f, 2.30653750e-05f, 2.29714387e-05f,
+   2.24511696e-05f, 2.14941938e-05f, 2.00975064e-05f, 1.82664207e-05f, 1.60143300e-05f, 1.33639160e-05f,
+   1.03456996e-05f, 6.99832935e-06f, 3.36941048e-06f, -4.87054137e-07f, -4.51041069e-06f, -8.63262267e-06f,
+   -1.27824233e-05f, -1.68848765e-05f, -2.08615511e-05f, -2.46341115e-05f, -2.81241664e-05f, -3.12555276e-05f,
+   -3.39546423e-05f, -3.61535749e-05f, -3.77906908e-05f, -3.88118096e-05f, -3.91723261e-05f, -3.88375884e-05f,
+   -3.77848846e-05f, -3.60034282e-05f, -3.34955475e-05f, -3.02768040e-05f, -2.63774782e-05f, -2.18407149e-05f,
+   -1.67228627e-05f, -1.10948704e-05f, -5.03835508e-06f, 1.35399921e-06f, 7.97785742e-06f, 1.47222936e-05f,
+   2.14698084e-05f, 2.80964177e-05f, 3.44774162e-05f, 4.04859857e-05f, 4.59995863e-05f, 5.08980738e-05f,
+   5.50691584e-05f, 5.84094814e-05f, 6.08261653e-05f, 6.22406296e-05f, 6.25891334e-05f, 6.18252670e-05f,
+   5.99212399e-05f, 5.68688411e-05f, 5.26802360e-05f, 4.73900145e-05f, 4.10529392e-05f, 3.37444035e-05f,
+   2.55625073e-05f, 1.66227073e-05f, 7.05815501e-06f, -2.97905967e-06f, -1.33255317e-05f, -2.38059620e-05f,
+   -3.42354069e-05f, -4.44233192e-05f, -5.41782319e-05f, -6.33079544e-05f, -7.16266950e-05f, -7.89554906e-05f,
+   -8.51276272e-05f, -8.99908846e-05f, -9.34130585e-05f, -9.52829942e-05f, -9.55135547e-05f, -9.40447426e-05f,
+   -9.08445872e-05f, -8.59120701e-05f, -7.92775390e-05f, -7.10020904e-05f, -6.11802752e-05f, -4.99357011e-05f,
+   -3.74234805e-05f, -2.38267821e-05f, -9.35258413e-06f, 5.76691718e-06f, 2.12829564e-05f, 3.69294103e-05f,
+   5.24291172e-05f, 6.75007177e-05f, 8.18592307e-05f, 9.52237606e-05f, 0.000107323758f, 0.000117900709f,
+   0.000126717350f, 0.000133558919f, 0.000138240226f, 0.000140609016f, 0.000140550052f, 0.000137987052f,
+   0.000132887930f, 0.000125265360f, 0.000115175972f, 0.000102724880f, 8.80601583e-05f, 7.13764166e-05f,
+   5.29106001e-05f, 3.29362629e-05f, 1.17661275e-05f, -1.02600688e-05f, -3.27739253e-05f, -5.53871432e-05f,
+   -7.77010791e-05f, -9.93073409e-05f, -0.000119798169f, -0.000138776493f, -0.000155856906f, -0.000170679938f,
+   -0.000182913383f, -0.000192262640f, -0.000198476671f, -0.000201352217f, -0.000200740702f, -0.000196550958f,
+   -0.000188754420f, -0.000177384223f, -0.000162541139f, -0.000144387770f, -0.000123152859f, -9.91276393e-05f,
+   -7.26575890e-05f, -4.41468583e-05f, -1.40421207e-05f, 1.71647043e-05f, 4.89481245e-05f, 8.07618417e-05f,
+   0.000112039474f, 0.000142208431f, 0.000170704152f, 0.000196970868f, 0.000220482325f, 0.000240743102f,
+   0.000257302803f, 0.000269767013f, 0.000277800718f, 0.000281140907f, 0.000279599539f, 0.000273072132f,
+   0.000261538313f, 0.000245068630f, 0.000223820869f, 0.000198044174f, 0.000168076338f, 0.000134333881f,
+   9.73182105e-05f, 5.75954582e-05f, 1.57997547e-05f, -2.73804126e-05f, -7.12197580e-05f, -0.000114956310f,
+   -0.000157809918f, -0.000199001748f, -0.000237754561f, -0.000273321173f, -0.000304987072f, -0.000332088763f,
+   -0.000354030693f, -0.000370289112f, -0.000380431593f, -0.000384120736f, -0.000381126534f, -0.000371331407f,
+   -0.000354736607f, -0.000331462070f, -0.000301751192f, -0.000265969749f, -0.000224594463f, -0.000178218703f,
+   -0.000127540610f, -7.33443521e-05f, -1.65062411e-05f, 4.20392607e-05f, 0.000101296304f, 0.000160232565f,
+   0.000217802837f, 0.000272950681f, 0.000324646040f, 0.000371888280f, 0.000413731468f, 0.000449308340f,
+   0.000477834721f, 0.000498637441f, 0.000511161285f, 0.000514985004f, 0.000509832054f, 0.000495578337f,
+   0.000472256361f, 0.000440061936f, 0.000399354118f, 0.000350645772f, 0.000294608704f, 0.000232062433f,
+   0.000163951248f, 9.13531112e-05f, 1.54371828e-05f, -6.25309331e-05f, -0.000141219643f, -0.000219264170f,
+   -0.000295265636f, -0.000367842062f, -0.000435630558f, -0.000497324450f, -0.000551697914f, -0.000597619452f,
+   -0.000634088297f, -0.000660243270f, -0.000675386575f, -0.000679001736f, -0.000670761743f, -0.000650543952f,
+   -0.000618431950f, -0.000574725796f, -0.000519930793f, -0.000454764871f, -0.000380148063f, -0.000297176332f,
+   -0.000207132791f, -0.000111438254f, -1.16570745e-05f, 9.05387933e-05f, 0.000193411848f, 0.000295155944f,
+   0.000393963244f, 0.000488024089f, 0.000575574755f, 0.000654938107f, 0.000724531885f, 0.000782923016f,
+   0.000828837568f, 0.000861199806f, 0.000879144121f, 0.000882042514f, 0.000869519892f, 0.000841463800f,
+   0.000798036985f, 0.000739670475f, 0.000667073473f, 0.000581224100f, 0.000483342796f, 0.000374904892f,
+   0.000257584383f, 0.000133261856f, 3.98253815e-06f, -0.000128096217f, -0.000260698318f, -0.000391514972f,
+   -0.000518202025f, -0.000638440950f, -0.000749993371f, -0.000850708573f, -0.000938599289f, -0.00101184996f,
+   -0.00106886961f, -0.00110832462f, -0.00112915877f, -0.00113062339f, -0.00111229590f, -0.00107410119f,
+   -0.00101629412f, -0.000939493359f, -0.000844666385f, -0.000733104767f, -0.000606439542f, -0.000466579047f,
+   -0.000315719488f, -0.000156296752f, 9.07566937e-06f, 0.000177597627f, 0.000346388028f, 0.000512480095f,
+   0.000672896858f, 0.000824722927f, 0.000965108338f, 0.00109137490f, 0.00120101927f, 0.00129178655f,
+   0.00136171817f, 0.00140917406f, 0.00143287994f, 0.00143195561f, 0.00140593830f, 0.00135479111f,
+   0.00127892487f, 0.00117919513f, 0.00105688046f, 0.000913705677f, 0.000751759741f, 0.000573529338f,
+   0.000381836493f, 0.000179767769f, -2.93128178e-05f, -0.000241891204f, -0.000454296009f, -0.000662789098f,
+   -0.000863658730f, -0.00105322711f, -0.00122794951f, -0.00138449541f, -0.00151976454f, -0.00163099531f,
+   -0.00171577814f, -0.00177213026f, -0.00179853372f, -0.00179396570f, -0.00175792526f, -0.00169045909f,
+   -0.00159217033f, -0.00146419881f, -0.00130825117f, -0.00112652674f, -0.000921742234f, -0.000697071548f,
+   -0.000456065027f, -0.000202668452f, 5.89321426e-05f, 0.000324291730f, 0.000588817929f, 0.000847885560f,
+   0.00109684397f, 0.00133113912f, 0.00154642120f, 0.00173855585f, 0.00190377713f, 0.00203869538f,
+   0.00214039977f, 0.00220651901f, 0.00223525288f, 0.00222542929f, 0.00217652833f, 0.00208871556f,
+   0.00196282449f, 0.00180039555f, 0.00160360662f, 0.00137530209f, 0.00111893308f, 0.000838467211f,
+   0.000538401247f, 0.000223656898f, -0.000100543635f, -0.000428662548f, -0.000755055866f, -0.00107397011f,
+   -0.00137967779f, -0.00166662713f, -0.00192944380f, -0.00216313382f, -0.00236308877f, -0.00252522132f,
+   -0.00264605368f, -0.00272274809f, -0.00275320956f, -0.00273610395f, -0.00267091999f, -0.00255796430f,
+   -0.00239840825f, -0.00219422928f, -0.00194824405f, -0.00166405819f, -0.00134596415f, -0.000998963602f,
+   -0.000628651585f, -0.000241075933f, 0.000157242466f, 0.000559555891f, 0.000958878489f, 0.00134815997f,
+   0.00172046095f, 0.00206895359f, 0.00238717836f, 0.00266905758f, 0.00290904054f, 0.00310225389f,
+   0.00324452622f, 0.00333253411f, 0.00336383213f, 0.00333693740f, 0.00325135328f, 0.00310761528f,
+   0.00290726218f, 0.00265286979f, 0.00234801043f, 0.00199715467f, 0.00160569360f, 0.00117982377f,
+   0.000726385100f, 0.000252892321f, -0.000232751525f, -0.000722236873f, -0.00120705215f, -0.00167869520f,
+   -0.00212867069f, -0.00254880730f, -0.00293126237f, -0.00326873385f, -0.00355463102f, -0.00378310657f,
+   -0.00394926686f, -0.00404920988f, -0.00408012047f, -0.00404035440f, -0.00392948370f, -0.00374829699f,
+   -0.00349884341f, -0.00318440981f, -0.00280942442f, -0.00237948936f, -0.00190126442f, -0.00138229190f,
+   -0.000831037061f, -0.000256564876f, 0.000331434829f, 0.000922881882f, 0.00150755839f, 0.00207509799f,
+   0.00261537614f, 0.00311850640f, 0.00357510685f, 0.00397652108f, 0.00431484636f, 0.00458322465f,
+   0.00477586733f, 0.00488823373f, 0.00491712475f, 0.00486073783f, 0.00471874699f, 0.00449230289f,
+   0.00418406446f, 0.00379811926f, 0.00334001984f, 0.00281667546f, 0.00223616697f, 0.00160780083f,
+   0.000941749196f, 0.000249085715f, -0.000458478404f, -0.00116889039f, -0.00186975044f, -0.00254870253f,
+   -0.00319356821f, -0.00379259279f, -0.00433460390f, -0.00480929576f, -0.00520736910f, -0.00552072050f,
+   -0.00574260764f, -0.00586777041f, -0.00589257292f, -0.00581507152f, -0.00563507248f, -0.00535418512f,
+   -0.00497578876f, -0.00450502010f, -0.00394870527f, -0.00331525668f, -0.00261458755f, -0.00185789808f,
+   -0.00105754682f, -0.000226838238f, 0.000620214269f, 0.00146904576f, 0.00230490230f, 0.00311301812f,
+   0.00387890893f, 0.00458856253f, 0.00522879092f, 0.00578740658f, 0.00625346601f, 0.00661748415f,
+   0.00687159551f, 0.00700976001f, 0.00702786352f, 0.00692381896f, 0.00669765193f, 0.00635151006f,
+   0.00588966673f, 0.00531847589f, 0.00464627566f, 0.00388333504f, 0.00304160872f, 0.00213461579f,
+   0.00117720966f, 0.000185317418f, -0.000824236078f, -0.00183413830f, -0.00282679661f, -0.00378468353f,
+   -0.00469055958f, -0.00552790891f, -0.00628114678f, -0.00693593035f, -0.00747943530f, -0.00790056027f,
+   -0.00819020811f, -0.00834143534f, -0.00834960397f, -0.00821251050f, -0.00793044735f, -0.00750623923f,
+   -0.00694523007f, -0.00625520293f, -0.00544635626f, -0.00453105476f, -0.00352371321f, -0.00244052964f,
+   -0.00129933236f, -0.000119141470f, 0.00108004676f, 0.00227761874f, 0.00345272035f, 0.00458451593f,
+   0.00565269962f, 0.00663775997f, 0.00752137275f, 0.00828666054f, 0.00891862810f, 0.00940436870f,
+   0.00973333791f, 0.00989757106f, 0.00989185646f, 0.00971387513f, 0.00936427247f, 0.00884669181f,
+   0.00816773623f, 0.00733696343f, 0.00636666315f, 0.00527174398f, 0.00406946894f, 0.00277929800f,
+   0.00142241619f, 2.14973334e-05f, -0.00139969622f, -0.00281674415f, -0.00420485577f, -0.00553949084f,
+   -0.00679665757f, -0.00795339979f, -0.00898810569f, -0.00988106988f, -0.0106147332f, -0.0111740688f,
+   -0.0115468763f, -0.0117240055f, -0.0116996104f, -0.0114712594f, -0.0110400366f, -0.0104105519f,
+   -0.00959098153f, -0.00859288219f, -0.00743108848f, -0.00612346828f, -0.00469076866f, -0.00315611809f,
+   -0.00154477474f, 0.000116311072f, 0.00179898029f, 0.00347418408f, 0.00511270808f, 0.00668552285f,
+   0.00816436391f, 0.00952209998f, 0.0107334256f, 0.0117751881f, 0.0126268538f, 0.0132709164f,
+   0.0136931930f, 0.0138832033f, 0.0138343358f, 0.0135440305f, 0.0130139161f, 0.0122497920f,
+   0.0112616178f, 0.0100633875f, 0.00867291354f, 0.00711170211f, 0.00540444115f, 0.00357873854f,
+   0.00166460976f, -0.000305829686f, -0.00229915977f, -0.00428104121f, -0.00621684222f, -0.00807227846f,
+   -0.00981384609f, -0.0114096664f, -0.0128298951f, -0.0140473116f, -0.0150378449f, -0.0157809611f,
+   -0.0162601992f, -0.0164634176f, -0.0163830910f, -0.0160165261f, -0.0153659573f, -0.0144385807f,
+   -0.0132465120f, -0.0118065989f, -0.0101403464f, -0.00827339943f, -0.00623529637f, -0.00405892218f,
+   -0.00178019633f, 0.000562811678f, 0.00293031172f, 0.00528150750f, 0.00757534057f, 0.00977099221f,
+   0.0118289068f, 0.0137112895f, 0.0153828347f, 0.0168114062f, 0.0179685224f, 0.0188300889f,
+   0.0193767529f, 0.0195943415f, 0.0194741711f, 0.0190133117f, 0.0182146914f, 0.0170871448f,
+   0.0156453066f, 0.0139095914f, 0.0119057177f, 0.00966446754f, 0.00722115859f, 0.00461530825f,
+   0.00188968109f, -0.000910179573f, -0.00373678654f, -0.00654137181f, -0.00927493628f, -0.0118888430f,
+   -0.0143359071f, -0.0165710021f, -0.0185520928f, -0.0202408060f, -0.0216033179f, -0.0226109233f,
+   -0.0232405905f, -0.0234755203f, -0.0233054776f, -0.0227270834f, -0.0217440035f, -0.0203669555f,
+   -0.0186136290f, -0.0165085793f, -0.0140827484f, -0.0113732321f, -0.00842250697f, -0.00527803414f,
+   -0.00199128222f, 0.00138299703f, 0.00478754146f, 0.00816380233f, 0.0114526255f, 0.0145955635f,
+   0.0175356045f, 0.0202184562f, 0.0225932673f, 0.0246137809f, 0.0262390915f, 0.0274344105f,
+   0.0281718709f, 0.0284310281f, 0.0281993859f, 0.0274727363f, 0.0262553319f, 0.0245600324f,
+   0.0224081371f, 0.0198291764f, 0.0168606620f, 0.0135473451f, 0.00994085055f, 0.00609859824f,
+   0.00208324217f, -0.00203861878f, -0.00619739061f, -0.0103214839f, -0.0143388389f, -0.0181777701f,
+   -0.0217686035f, -0.0250445381f, -0.0279431380f, -0.0304073375f, -0.0323864631f, -0.0338373892f,
+   -0.0347252414f, -0.0350242741f, -0.0347183906f, -0.0338016264f, -0.0322784744f, -0.0301639270f,
+   -0.0274834204f, -0.0242727175f, -0.0205772612f, -0.0164518617f, -0.0119596021f, -0.00717129558f,
+   -0.00216400903f, 0.00297970022f, 0.00817348249f, 0.0133284284f, 0.0183543563f, 0.0231617391f,
+   0.0276627876f, 0.0317734145f, 0.0354143418f, 0.0385128334f, 0.0410040282f, 0.0428320356f,
+   0.0439512730f, 0.0443272889f, 0.0439376980f, 0.0427727550f, 0.0408357866f, 0.0381433889f,
+   0.0347255468f, 0.0306251906f, 0.0258980431f, 0.0206115898f, 0.0148446197f, 0.00868566241f,
+   0.00223223143f, -0.00441114418f, -0.0111341309f, -0.0178225022f, -0.0243599359f, -0.0306298938f,
+   -0.0365177169f, -0.0419123694f, -0.0467085615f, -0.0508085862f, -0.0541241504f, -0.0565780886f,
+   -0.0581059046f, -0.0586571246f, -0.0581966564f, -0.0567055717f, -0.0541818962f, -0.0506410748f,
+   -0.0461161546f, -0.0406576991f, -0.0343334153f, -0.0272275116f, -0.0194395985f, -0.0110836988f,
+   -0.00228660414f, 0.00681381905f, 0.0160705801f, 0.0253297128f, 0.0344325453f, 0.0432183556f,
+   0.0515266061f, 0.0591997728f, 0.0660859197f, 0.0720413402f, 0.0769330785f, 0.0806414261f,
+   0.0830622390f, 0.0841090530f, 0.0837150812f, 0.0818348154f, 0.0784455016f, 0.0735480860f,
+   0.0671683475f, 0.0593569577f, 0.0501897186f, 0.0397670381f, 0.0282135494f, 0.0156768598f,
+   0.00232617161f, -0.0116494838f, -0.0260433573f, -0.0406333469f, -0.0551848598f, -0.0694535002f,
+   -0.0831883401f, -0.0961353555f, -0.108040631f, -0.118654005f, -0.127732605f, -0.135044366f,
+   -0.140371487f, -0.143513724f, -0.144291580f, -0.142549232f, -0.138157248f, -0.131014928f,
+   -0.121052384f, -0.108232185f, -0.0925505385f, -0.0740382150f, -0.0527612269f, -0.0288201738f,
+   -0.00235021045f, 0.0264801439f, 0.0574703328f, 0.0903897434f, 0.124979921f, 0.160957113f,
+   0.198015392f, 0.235830128f, 0.274061471f, 0.312358111f, 0.350361526f, 0.387710124f,
+   0.424043477f, 0.459006459f, 0.492253751f, 0.523453832f, 0.552293003f, 0.578479290f,
+   0.601746023f, 0.621854842f, 0.638599038f, 0.651805818f, 0.661338449f, 0.667098105f,
+   0.669024944f, 0.667098105f, 0.661338449f, 0.651805818f, 0.638599038f, 0.621854842f,
+   0.601746023f, 0.578479290f, 0.552293003f, 0.523453832f, 0.492253751f, 0.459006459f,
+   0.424043477f, 0.387710124f, 0.350361526f, 0.312358111f, 0.274061471f, 0.235830128f,
+   0.198015392f, 0.160957113f, 0.124979921f, 0.0903897434f, 0.0574703328f, 0.0264801439f,
+   -0.00235021045f, -0.0288201738f, -0.0527612269f, -0.0740382150f, -0.0925505385f, -0.108232185f,
+   -0.121052384f, -0.131014928f, -0.138157248f, -0.142549232f, -0.144291580f, -0.143513724f,
+   -0.140371487f, -0.135044366f, -0.127732605f, -0.118654005f, -0.108040631f, -0.0961353555f,
+   -0.0831883401f, -0.0694535002f, -0.0551848598f, -0.0406333469f, -0.0260433573f, -0.0116494838f,
+   0.00232617161f, 0.0156768598f, 0.0282135494f, 0.0397670381f, 0.0501897186f, 0.0593569577f,
+   0.0671683475f, 0.0735480860f, 0.0784455016f, 0.0818348154f, 0.0837150812f, 0.0841090530f,
+   0.0830622390f, 0.0806414261f, 0.0769330785f, 0.0720413402f, 0.0660859197f, 0.0591997728f,
+   0.0515266061f, 0.0432183556f, 0.0344325453f, 0.0253297128f, 0.0160705801f, 0.00681381905f,
+   -0.00228660414f, -0.0110836988f, -0.0194395985f, -0.0272275116f, -0.0343334153f, -0.0406576991f,
+   -0.0461161546f, -0.0506410748f, -0.0541818962f, -0.0567055717f, -0.0581966564f, -0.0586571246f,
+   -0.0581059046f, -0.0565780886f, -0.0541241504f, -0.0508085862f, -0.0467085615f, -0.0419123694f,
+   -0.0365177169f, -0.0306298938f, -0.0243599359f, -0.0178225022f, -0.0111341309f, -0.00441114418f,
+   0.00223223143f, 0.00868566241f, 0.0148446197f, 0.0206115898f, 0.0258980431f, 0.0306251906f,
+   0.0347255468f, 0.0381433889f, 0.0408357866f, 0.0427727550f, 0.0439376980f, 0.0443272889f,
+   0.0439512730f, 0.0428320356f, 0.0410040282f, 0.0385128334f, 0.0354143418f, 0.0317734145f,
+   0.0276627876f, 0.0231617391f, 0.0183543563f, 0.0133284284f, 0.00817348249f, 0.00297970022f,
+   -0.00216400903f, -0.00717129558f, -0.0119596021f, -0.0164518617f, -0.0205772612f, -0.0242727175f,
+   -0.0274834204f, -0.0301639270f, -0.0322784744f, -0.0338016264f, -0.0347183906f, -0.0350242741f,
+   -0.0347252414f, -0.0338373892f, -0.0323864631f, -0.0304073375f, -0.0279431380f, -0.0250445381f,
+   -0.0217686035f, -0.0181777701f, -0.0143388389f, -0.0103214839f, -0.00619739061f, -0.00203861878f,
+   0.00208324217f, 0.00609859824f, 0.00994085055f, 0.0135473451f, 0.0168606620f, 0.0198291764f,
+   0.0224081371f, 0.0245600324f, 0.0262553319f, 0.0274727363f, 0.0281993859f, 0.0284310281f,
+   0.0281718709f, 0.0274344105f, 0.0262390915f, 0.0246137809f, 0.0225932673f, 0.0202184562f,
+   0.0175356045f, 0.0145955635f, 0.0114526255f, 0.00816380233f, 0.00478754146f, 0.00138299703f,
+   -0.00199128222f, -0.00527803414f, -0.00842250697f, -0.0113732321f, -0.0140827484f, -0.0165085793f,
+   -0.0186136290f, -0.0203669555f, -0.0217440035f, -0.0227270834f, -0.0233054776f, -0.0234755203f,
+   -0.0232405905f, -0.0226109233f, -0.0216033179f, -0.0202408060f, -0.0185520928f, -0.0165710021f,
+   -0.0143359071f, -0.0118888430f, -0.00927493628f, -0.00654137181f, -0.00373678654f, -0.000910179573f,
+   0.00188968109f, 0.00461530825f, 0.00722115859f, 0.00966446754f, 0.0119057177f, 0.0139095914f,
+   0.0156453066f, 0.0170871448f, 0.0182146914f, 0.0190133117f, 0.0194741711f, 0.0195943415f,
+   0.0193767529f, 0.0188300889f, 0.0179685224f, 0.0168114062f, 0.0153828347f, 0.0137112895f,
+   0.0118289068f, 0.00977099221f, 0.00757534057f, 0.00528150750f, 0.00293031172f, 0.000562811678f,
+   -0.00178019633f, -0.00405892218f, -0.00623529637f, -0.00827339943f, -0.0101403464f, -0.0118065989f,
+   -0.0132465120f, -0.0144385807f, -0.0153659573f, -0.0160165261f, -0.0163830910f, -0.0164634176f,
+   -0.0162601992f, -0.0157809611f, -0.0150378449f, -0.0140473116f, -0.0128298951f, -0.0114096664f,
+   -0.00981384609f, -0.00807227846f, -0.00621684222f, -0.00428104121f, -0.00229915977f, -0.000305829686f,
+   0.00166460976f, 0.00357873854f, 0.00540444115f, 0.00711170211f, 0.00867291354f, 0.0100633875f,
+   0.0112616178f, 0.0122497920f, 0.0130139161f, 0.0135440305f, 0.0138343358f, 0.0138832033f,
+   0.0136931930f, 0.0132709164f, 0.0126268538f, 0.0117751881f, 0.0107334256f, 0.00952209998f,
+   0.00816436391f, 0.00668552285f, 0.00511270808f, 0.00347418408f, 0.00179898029f, 0.000116311072f,
+   -0.00154477474f, -0.00315611809f, -0.00469076866f, -0.00612346828f, -0.00743108848f, -0.00859288219f,
+   -0.00959098153f, -0.0104105519f, -0.0110400366f, -0.0114712594f, -0.0116996104f, -0.0117240055f,
+   -0.0115468763f, -0.0111740688f, -0.0106147332f, -0.00988106988f, -0.00898810569f, -0.00795339979f,
+   -0.00679665757f, -0.00553949084f, -0.00420485577f, -0.00281674415f, -0.00139969622f, 2.14973334e-05f,
+   0.00142241619f, 0.00277929800f, 0.00406946894f, 0.00527174398f, 0.00636666315f, 0.00733696343f,
+   0.00816773623f, 0.00884669181f, 0.00936427247f, 0.00971387513f, 0.00989185646f, 0.00989757106f,
+   0.00973333791f, 0.00940436870f, 0.00891862810f, 0.00828666054f, 0.00752137275f, 0.00663775997f,
+   0.00565269962f, 0.00458451593f, 0.00345272035f, 0.00227761874f, 0.00108004676f, -0.000119141470f,
+   -0.00129933236f, -0.00244052964f, -0.00352371321f, -0.00453105476f, -0.00544635626f, -0.00625520293f,
+   -0.00694523007f, -0.00750623923f, -0.00793044735f, -0.00821251050f, -0.00834960397f, -0.00834143534f,
+   -0.00819020811f, -0.00790056027f, -0.00747943530f, -0.00693593035f, -0.00628114678f, -0.00552790891f,
+   -0.00469055958f, -0.00378468353f, -0.00282679661f, -0.00183413830f, -0.000824236078f, 0.000185317418f,
+   0.00117720966f, 0.00213461579f, 0.00304160872f, 0.00388333504f, 0.00464627566f, 0.00531847589f,
+   0.00588966673f, 0.00635151006f, 0.00669765193f, 0.00692381896f, 0.00702786352f, 0.00700976001f,
+   0.00687159551f, 0.00661748415f, 0.00625346601f, 0.00578740658f, 0.00522879092f, 0.00458856253f,
+   0.00387890893f, 0.00311301812f, 0.00230490230f, 0.00146904576f, 0.000620214269f, -0.000226838238f,
+   -0.00105754682f, -0.00185789808f, -0.00261458755f, -0.00331525668f, -0.00394870527f, -0.00450502010f,
+   -0.00497578876f, -0.00535418512f, -0.00563507248f, -0.00581507152f, -0.00589257292f, -0.00586777041f,
+   -0.00574260764f, -0.00552072050f, -0.00520736910f, -0.00480929576f, -0.00433460390f, -0.00379259279f,
+   -0.00319356821f, -0.00254870253f, -0.00186975044f, -0.00116889039f, -0.000458478404f, 0.000249085715f,
+   0.000941749196f, 0.00160780083f, 0.00223616697f, 0.00281667546f, 0.00334001984f, 0.00379811926f,
+   0.00418406446f, 0.00449230289f, 0.00471874699f, 0.00486073783f, 0.00491712475f, 0.00488823373f,
+   0.00477586733f, 0.00458322465f, 0.00431484636f, 0.00397652108f, 0.00357510685f, 0.00311850640f,
+   0.00261537614f, 0.00207509799f, 0.00150755839f, 0.000922881882f, 0.000331434829f, -0.000256564876f,
+   -0.000831037061f, -0.00138229190f, -0.00190126442f, -0.00237948936f, -0.00280942442f, -0.00318440981f,
+   -0.00349884341f, -0.00374829699f, -0.00392948370f, -0.00404035440f, -0.00408012047f, -0.00404920988f,
+   -0.00394926686f, -0.00378310657f, -0.00355463102f, -0.00326873385f, -0.00293126237f, -0.00254880730f,
+   -0.00212867069f, -0.00167869520f, -0.00120705215f, -0.000722236873f, -0.000232751525f, 0.000252892321f,
+   0.000726385100f, 0.00117982377f, 0.00160569360f, 0.00199715467f, 0.00234801043f, 0.00265286979f,
+   0.00290726218f, 0.00310761528f, 0.00325135328f, 0.00333693740f, 0.00336383213f, 0.00333253411f,
+   0.00324452622f, 0.00310225389f, 0.00290904054f, 0.00266905758f, 0.00238717836f, 0.00206895359f,
+   0.00172046095f, 0.00134815997f, 0.000958878489f, 0.000559555891f, 0.000157242466f, -0.000241075933f,
+   -0.000628651585f, -0.000998963602f, -0.00134596415f, -0.00166405819f, -0.00194824405f, -0.00219422928f,
+   -0.00239840825f, -0.00255796430f, -0.00267091999f, -0.00273610395f, -0.00275320956f, -0.00272274809f,
+   -0.00264605368f, -0.00252522132f, -0.00236308877f, -0.00216313382f, -0.00192944380f, -0.00166662713f,
+   -0.00137967779f, -0.00107397011f, -0.000755055866f, -0.000428662548f, -0.000100543635f, 0.000223656898f,
+   0.000538401247f, 0.000838467211f, 0.00111893308f, 0.00137530209f, 0.00160360662f, 0.00180039555f,
+   0.00196282449f, 0.00208871556f, 0.00217652833f, 0.00222542929f, 0.00223525288f, 0.00220651901f,
+   0.00214039977f, 0.00203869538f, 0.00190377713f, 0.00173855585f, 0.00154642120f, 0.00133113912f,
+   0.00109684397f, 0.000847885560f, 0.000588817929f, 0.000324291730f, 5.89321426e-05f, -0.000202668452f,
+   -0.000456065027f, -0.000697071548f, -0.000921742234f, -0.00112652674f, -0.00130825117f, -0.00146419881f,
+   -0.00159217033f, -0.00169045909f, -0.00175792526f, -0.00179396570f, -0.00179853372f, -0.00177213026f,
+   -0.00171577814f, -0.00163099531f, -0.00151976454f, -0.00138449541f, -0.00122794951f, -0.00105322711f,
+   -0.000863658730f, -0.000662789098f, -0.000454296009f, -0.000241891204f, -2.93128178e-05f, 0.000179767769f,
+   0.000381836493f, 0.000573529338f, 0.000751759741f, 0.000913705677f, 0.00105688046f, 0.00117919513f,
+   0.00127892487f, 0.00135479111f, 0.00140593830f, 0.00143195561f, 0.00143287994f, 0.00140917406f,
+   0.00136171817f, 0.00129178655f, 0.00120101927f, 0.00109137490f, 0.000965108338f, 0.000824722927f,
+   0.000672896858f, 0.000512480095f, 0.000346388028f, 0.000177597627f, 9.07566937e-06f, -0.000156296752f,
+   -0.000315719488f, -0.000466579047f, -0.000606439542f, -0.000733104767f, -0.000844666385f, -0.000939493359f,
+   -0.00101629412f, -0.00107410119f, -0.00111229590f, -0.00113062339f, -0.00112915877f, -0.00110832462f,
+   -0.00106886961f, -0.00101184996f, -0.000938599289f, -0.000850708573f, -0.000749993371f, -0.000638440950f,
+   -0.000518202025f, -0.000391514972f, -0.000260698318f, -0.000128096217f, 3.98253815e-06f, 0.000133261856f,
+   0.000257584383f, 0.000374904892f, 0.000483342796f, 0.000581224100f, 0.000667073473f, 0.000739670475f,
+   0.000798036985f, 0.000841463800f, 0.000869519892f, 0.000882042514f, 0.000879144121f, 0.000861199806f,
+   0.000828837568f, 0.000782923016f, 0.000724531885f, 0.000654938107f, 0.000575574755f, 0.000488024089f,
+   0.000393963244f, 0.000295155944f, 0.000193411848f, 9.05387933e-05f, -1.16570745e-05f, -0.000111438254f,
+   -0.000207132791f, -0.000297176332f, -0.000380148063f, -0.000454764871f, -0.000519930793f, -0.000574725796f,
+   -0.000618431950f, -0.000650543952f, -0.000670761743f, -0.000679001736f, -0.000675386575f, -0.000660243270f,
+   -0.000634088297f, -0.000597619452f, -0.000551697914f, -0.000497324450f, -0.000435630558f, -0.000367842062f,
+   -0.000295265636f, -0.000219264170f, -0.000141219643f, -6.25309331e-05f, 1.54371828e-05f, 9.13531112e-05f,
+   0.000163951248f, 0.000232062433f, 0.000294608704f, 0.000350645772f, 0.000399354118f, 0.000440061936f,
+   0.000472256361f, 0.000495578337f, 0.000509832054f, 0.000514985004f, 0.000511161285f, 0.000498637441f,
+   0.000477834721f, 0.000449308340f, 0.000413731468f, 0.000371888280f, 0.000324646040f, 0.000272950681f,
+   0.000217802837f, 0.000160232565f, 0.000101296304f, 4.20392607e-05f, -1.65062411e-05f, -7.33443521e-05f,
+   -0.000127540610f, -0.000178218703f, -0.000224594463f, -0.000265969749f, -0.000301751192f, -0.000331462070f,
+   -0.000354736607f, -0.000371331407f, -0.000381126534f, -0.000384120736f, -0.000380431593f, -0.000370289112f,
+   -0.000354030693f, -0.000332088763f, -0.000304987072f, -0.000273321173f, -0.000237754561f, -0.000199001748f,
+   -0.000157809918f, -0.000114956310f, -7.12197580e-05f, -2.73804126e-05f, 1.57997547e-05f, 5.75954582e-05f,
+   9.73182105e-05f, 0.000134333881f, 0.000168076338f, 0.000198044174f, 0.000223820869f, 0.000245068630f,
+   0.000261538313f, 0.000273072132f, 0.000279599539f, 0.000281140907f, 0.000277800718f, 0.000269767013f,
+   0.000257302803f, 0.000240743102f, 0.000220482325f, 0.000196970868f, 0.000170704152f, 0.000142208431f,
+   0.000112039474f, 8.07618417e-05f, 4.89481245e-05f, 1.71647043e-05f, -1.40421207e-05f, -4.41468583e-05f,
+   -7.26575890e-05f, -9.91276393e-05f, -0.000123152859f, -0.000144387770f, -0.000162541139f, -0.000177384223f,
+   -0.000188754420f, -0.000196550958f, -0.000200740702f, -0.000201352217f, -0.000198476671f, -0.000192262640f,
+   -0.000182913383f, -0.000170679938f, -0.000155856906f, -0.000138776493f, -0.000119798169f, -9.93073409e-05f,
+   -7.77010791e-05f, -5.53871432e-05f, -3.27739253e-05f, -1.02600688e-05f, 1.17661275e-05f, 3.29362629e-05f,
+   5.29106001e-05f, 7.13764166e-05f, 8.80601583e-05f, 0.000102724880f, 0.000115175972f, 0.000125265360f,
+   0.000132887930f, 0.000137987052f, 0.000140550052f, 0.000140609016f, 0.000138240226f, 0.000133558919f,
+   0.000126717350f, 0.000117900709f, 0.000107323758f, 9.52237606e-05f, 8.18592307e-05f, 6.75007177e-05f,
+   5.24291172e-05f, 3.69294103e-05f, 2.12829564e-05f, 5.76691718e-06f, -9.35258413e-06f, -2.38267821e-05f,
+   -3.74234805e-05f, -4.99357011e-05f, -6.11802752e-05f, -7.10020904e-05f, -7.92775390e-05f, -8.59120701e-05f,
+   -9.08445872e-05f, -9.40447426e-05f, -9.55135547e-05f, -9.52829942e-05f, -9.34130585e-05f, -8.99908846e-05f,
+   -8.51276272e-05f, -7.89554906e-05f, -7.16266950e-05f, -6.33079544e-05f, -5.41782319e-05f, -4.44233192e-05f,
+   -3.42354069e-05f, -2.38059620e-05f, -1.33255317e-05f, -2.97905967e-06f, 7.05815501e-06f, 1.66227073e-05f,
+   2.55625073e-05f, 3.37444035e-05f, 4.10529392e-05f, 4.73900145e-05f, 5.26802360e-05f, 5.68688411e-05f,
+   5.99212399e-05f, 6.18252670e-05f, 6.25891334e-05f, 6.22406296e-05f, 6.08261653e-05f, 5.84094814e-05f,
+   5.50691584e-05f, 5.08980738e-05f, 4.59995863e-05f, 4.04859857e-05f, 3.44774162e-05f, 2.80964177e-05f,
+   2.14698084e-05f, 1.47222936e-05f, 7.97785742e-06f, 1.35399921e-06f, -5.03835508e-06f, -1.10948704e-05f,
+   -1.67228627e-05f, -2.18407149e-05f, -2.63774782e-05f, -3.02768040e-05f, -3.34955475e-05f, -3.60034282e-05f,
+   -3.77848846e-05f, -3.88375884e-05f, -3.91723261e-05f, -3.88118096e-05f, -3.77906908e-05f, -3.61535749e-05f,
+   -3.39546423e-05f, -3.12555276e-05f, -2.81241664e-05f, -2.46341115e-05f, -2.08615511e-05f, -1.68848765e-05f,
+   -1.27824233e-05f, -8.63262267e-06f, -4.51041069e-06f, -4.87054137e-07f, 3.36941048e-06f, 6.99832935e-06f,
+   1.03456996e-05f, 1.33639160e-05f, 1.60143300e-05f, 1.82664207e-05f, 2.00975064e-05f, 2.14941938e-05f,
+   2.24511696e-05f, 2.29714387e-05f, 2.30653750e-05f, 2.27509572e-05f, 2.20524671e-05f, 2.10001599e-05f,
+   1.96292585e-05f, 1.79789258e-05f, 1.60920044e-05f, 1.40132288e-05f, 1.17887093e-05f, 9.46548334e-06f,
+   7.08970720e-06f, 4.70644318e-06f, 2.35850848e-06f, 8.66493508e-08f, -2.07235485e-06f, -4.08556207e-06f,
+   -5.92373772e-06f, -7.56198324e-06f, -8.98156577e-06f, -1.01678170e-05f, -1.11115842e-05f, -1.18084381e-05f,
+   -1.22588444e-05f, -1.24675289e-05f, -1.24436992e-05f, -1.22003057e-05f, -1.17536147e-05f, -1.11229028e-05f,
+   -1.03296979e-05f, -9.39759684e-06f, -8.35132050e-06f, -7.21636616e-06f, -6.01872625e-06f, -4.78386573e-06f,
+   -3.53663336e-06f, -2.30057981e-06f, -1.09804000e-06f, 5.08753040e-08f, 1.12821817e-06f, 2.11815473e-06f,
+   3.00771853e-06f, 3.78661366e-06f, 4.44701664e-06f, 4.98410282e-06f, 5.39559642e-06f, 5.67972938e-06f,
+   5.84098143e-06f, 5.88442117e-06f, 5.81710810e-06f, 5.64775064e-06f, 5.38658969e-06f, 5.04493892e-06f,
+   4.63503920e-06f, 4.16964031e-06f, 3.66169365e-06f, 3.12425641e-06f, 2.56996441e-06f, 2.01097100e-06f,
+   1.45860793e-06f, 9.23411278e-07f, 4.14678880e-07f, -5.95181042e-08f, -4.92291861e-07f, -8.78253786e-07f,
+   -1.21340292e-06f, -1.49501125e-06f, -1.72181012e-06f, -1.89377761e-06f, -2.01208491e-06f, -2.07894527e-06f,
+   -2.09756467e-06f, -2.07196672e-06f, -2.00679347e-06f, 0.00000000f, 0.00000000f, 0.00000000f,
+};
+
+static const spx_word16_t resample_table_64[480] = {
+   4.35611980e-07f, 6.72855833e-07f, 7.92942501e-07f, 7.11714165e-07f, 3.84067761e-07f, -1.69573724e-07f,
+   -8.51266464e-07f, -1.49422590e-06f, -1.89800130e-06f, -1.88248714e-06f, -1.34341280e-06f, -3.01584436e-07f,
+   1.07413200e-06f, 2.48201695e-06f, 3.54410599e-06f, 3.89488696e-06f, 3.29096679e-06f, 1.69772784e-06f,
+   -6.58850013e-07f, -3.30374132e-06f, -5.59472801e-06f, -6.86485328e-06f, -6.59579928e-06f, -4.58455133e-06f,
+   -1.05084928e-06f, 3.35127106e-06f, 7.63317166e-06f, 1.06755815e-05f, 1.15004677e-05f, 9.54775442e-06f,
+   4.88432806e-06f, -1.71523050e-06f, -8.86721409e-06f, -1.48438176e-05f, -1.79668150e-05f, -1.70435433e-05f,
+   -1.17393911e-05f, -2.78127163e-06f, 8.08202640e-06f, 1.83884804e-05f, 2.54909737e-05f, 2.72022044e-05f,
+   2.24044452e-05f, 1.14668155e-05f, -3.66242625e-06f, -1.97483459e-05f, -3.29246795e-05f, -3.95834686e-05f,
+   -3.73072326e-05f, -2.56107778e-05f, -6.28652424e-06f, 1.67814378e-05f, 3.83433653e-05f, 5.29349018e-05f,
+   5.62052301e-05f, 4.61167838e-05f, 2.36980304e-05f, -6.88099317e-06f, -3.90065725e-05f, -6.49922658e-05f,
+   -7.78617032e-05f, -7.31340333e-05f, -5.01796312e-05f, -1.27604508e-05f, 3.14532590e-05f, 7.23803532e-05f,
+   9.97574898e-05f, 0.000105634608f, 8.65353868e-05f, 4.47306011e-05f, -1.17763948e-05f, -7.06654464e-05f,
+   -0.000117904819f, -0.000141011973f, -0.000132226822f, -9.08239308e-05f, -2.39074252e-05f, 5.46189112e-05f,
+   0.000126828774f, 0.000174774294f, 0.000184833465f, 0.000151373592f, 7.87885583e-05f, -1.87279093e-05f,
+   -0.000119795535f, -0.000200424169f, -0.000239586821f, -0.000224539457f, -0.000154555237f, -4.20601609e-05f,
+   8.93302422e-05f, 0.000209609585f, 0.000289110118f, 0.000305659254f, 0.000250490819f, 0.000131368462f,
+   -2.80292497e-05f, -0.000192613123f, -0.000323442713f, -0.000386788481f, -0.000362595281f, -0.000250293058f,
+   -7.03313344e-05f, 0.000139199561f, 0.000330446579f, 0.000456543639f, 0.000482885167f, 0.000396258285f,
+   0.000209490958f, -3.98339107e-05f, -0.000296645158f, -0.000500365160f, -0.000598979183f, -0.000562021916f,
+   -0.000389268767f, -0.000112809132f, 0.000208495287f, 0.000501264003f, 0.000694143993f, 0.000734933361f,
+   0.000604230270f, 0.000322114181f, -5.40824440e-05f, -0.000441092270f, -0.000747852784f, -0.000896680460f,
+   -0.000842555251f, -0.000585823727f, -0.000174877816f, 0.000302376604f, 0.000736983086f, 0.00102353666f,
+   0.00108536624f, 0.000894453784f, 0.000480962975f, -7.04879858e-05f, -0.000637645309f, -0.00108738453f,
+   -0.00130659563f, -0.00123012403f, -0.000858972780f, -0.000263863214f, 0.000427501567f, 0.00105739816f,
+   0.00147364568f, 0.00156592671f, 0.00129420881f, 0.000702157966f, -8.84914407e-05f, -0.000902342494f,
+   -0.00154876232f, -0.00186605775f, -0.00176123437f, -0.00123573560f, -0.000390290195f, 0.000593415345f,
+   0.00149114383f, 0.00208670855f, 0.00222335267f, 0.00184392987f, 0.00100978324f, -0.000107307918f,
+   -0.00125960505f, -0.00217771158f, -0.00263282727f, -0.00249282178f, -0.00175852701f, -0.000570699165f,
+   0.000815558305f, 0.00208472298f, 0.00293181115f, 0.00313469418f, 0.00261080009f, 0.00144403428f,
+   -0.000125937120f, -0.00175166037f, -0.00305370358f, -0.00370809413f, -0.00352544896f, -0.00250280276f,
+   -0.000834475621f, 0.00112274976f, 0.00292447302f, 0.00413816702f, 0.00444535725f, 0.00372271496f,
+   0.00208192877f, -0.000143281024f, -0.00246285531f, -0.00433642697f, -0.00529710855f, -0.00506521761f,
+   -0.00362471165f, -0.00124243484f, 0.00157763693f, 0.00419819774f, 0.00598985841f, 0.00647892104f,
+   0.00546786003f, 0.00309880218f, -0.000158229988f, -0.00359412841f, -0.00641091820f, -0.00790228602f,
+   -0.00762468483f, -0.00551877683f, -0.00194990635f, 0.00234699715f, 0.00641207490f, 0.00926741865f,
+   0.0101431329f, 0.00867243018f, 0.00500834035f, -0.000169741004f, -0.00576983532f, -0.0105046192f,
+   -0.0131713916f, -0.0129366387f, -0.00956200343f, -0.00351635250f, 0.00406061392f, 0.0115476269f,
+   0.0171564519f, 0.0193149168f, 0.0170426741f, 0.0102401162f, -0.000177007969f, -0.0123384958f,
+   -0.0236790553f, -0.0313604847f, -0.0327857733f, -0.0261121485f, -0.0106648672f, 0.0128321564f,
+   0.0422625802f, 0.0743712336f, 0.105229340f, 0.130836263f, 0.147754505f, 0.153666660f,
+   0.147754505f, 0.130836263f, 0.105229340f, 0.0743712336f, 0.0422625802f, 0.0128321564f,
+   -0.0106648672f, -0.0261121485f, -0.0327857733f, -0.0313604847f, -0.0236790553f, -0.0123384958f,
+   -0.000177007969f, 0.0102401162f, 0.0170426741f, 0.0193149168f, 0.0171564519f, 0.0115476269f,
+   0.00406061392f, -0.00351635250f, -0.00956200343f, -0.0129366387f, -0.0131713916f, -0.0105046192f,
+   -0.00576983532f, -0.000169741004f, 0.00500834035f, 0.00867243018f, 0.0101431329f, 0.00926741865f,
+   0.00641207490f, 0.00234699715f, -0.00194990635f, -0.00551877683f, -0.00762468483f, -0.00790228602f,
+   -0.00641091820f, -0.00359412841f, -0.000158229988f, 0.00309880218f, 0.00546786003f, 0.00647892104f,
+   0.00598985841f, 0.00419819774f, 0.00157763693f, -0.00124243484f, -0.00362471165f, -0.00506521761f,
+   -0.00529710855f, -0.00433642697f, -0.00246285531f, -0.000143281024f, 0.00208192877f, 0.00372271496f,
+   0.00444535725f, 0.00413816702f, 0.00292447302f, 0.00112274976f, -0.000834475621f, -0.00250280276f,
+   -0.00352544896f, -0.00370809413f, -0.00305370358f, -0.00175166037f, -0.000125937120f, 0.00144403428f,
+   0.00261080009f, 0.00313469418f, 0.00293181115f, 0.00208472298f, 0.000815558305f, -0.000570699165f,
+   -0.00175852701f, -0.00249282178f, -0.00263282727f, -0.00217771158f, -0.00125960505f, -0.000107307918f,
+   0.00100978324f, 0.00184392987f, 0.00222335267f, 0.00208670855f, 0.00149114383f, 0.000593415345f,
+   -0.000390290195f, -0.00123573560f, -0.00176123437f, -0.00186605775f, -0.00154876232f, -0.000902342494f,
+   -8.84914407e-05f, 0.000702157966f, 0.00129420881f, 0.00156592671f, 0.00147364568f, 0.00105739816f,
+   0.000427501567f, -0.000263863214f, -0.000858972780f, -0.00123012403f, -0.00130659563f, -0.00108738453f,
+   -0.000637645309f, -7.04879858e-05f, 0.000480962975f, 0.000894453784f, 0.00108536624f, 0.00102353666f,
+   0.000736983086f, 0.000302376604f, -0.000174877816f, -0.000585823727f, -0.000842555251f, -0.000896680460f,
+   -0.000747852784f, -0.000441092270f, -5.40824440e-05f, 0.000322114181f, 0.000604230270f, 0.000734933361f,
+   0.000694143993f, 0.000501264003f, 0.000208495287f, -0.000112809132f, -0.000389268767f, -0.000562021916f,
+   -0.000598979183f, -0.000500365160f, -0.000296645158f, -3.98339107e-05f, 0.000209490958f, 0.000396258285f,
+   0.000482885167f, 0.000456543639f, 0.000330446579f, 0.000139199561f, -7.03313344e-05f, -0.000250293058f,
+   -0.000362595281f, -0.000386788481f, -0.000323442713f, -0.000192613123f, -2.80292497e-05f, 0.000131368462f,
+   0.000250490819f, 0.000305659254f, 0.000289110118f, 0.000209609585f, 8.93302422e-05f, -4.20601609e-05f,
+   -0.000154555237f, -0.000224539457f, -0.000239586821f, -0.000200424169f, -0.000119795535f, -1.87279093e-05f,
+   7.87885583e-05f, 0.000151373592f, 0.000184833465f, 0.000174774294f, 0.000126828774f, 5.46189112e-05f,
+   -2.39074252e-05f, -9.08239308e-05f, -0.000132226822f, -0.000141011973f, -0.000117904819f, -7.06654464e-05f,
+   -1.17763948e-05f, 4.47306011e-05f, 8.65353868e-05f, 0.000105634608f, 9.97574898e-05f, 7.23803532e-05f,
+   3.14532590e-05f, -1.27604508e-05f, -5.01796312e-05f, -7.31340333e-05f, -7.78617032e-05f, -6.49922658e-05f,
+   -3.90065725e-05f, -6.88099317e-06f, 2.36980304e-05f, 4.61167838e-05f, 5.62052301e-05f, 5.29349018e-05f,
+   3.83433653e-05f, 1.67814378e-05f, -6.28652424e-06f, -2.56107778e-05f, -3.73072326e-05f, -3.95834686e-05f,
+   -3.29246795e-05f, -1.97483459e-05f, -3.66242625e-06f, 1.14668155e-05f, 2.24044452e-05f, 2.72022044e-05f,
+   2.54909737e-05f, 1.83884804e-05f, 8.08202640e-06f, -2.78127163e-06f, -1.17393911e-05f, -1.70435433e-05f,
+   -1.79668150e-05f, -1.48438176e-05f, -8.86721409e-06f, -1.71523050e-06f, 4.88432806e-06f, 9.54775442e-06f,
+   1.15004677e-05f, 1.06755815e-05f, 7.63317166e-06f, 3.35127106e-06f, -1.05084928e-06f, -4.58455133e-06f,
+   -6.59579928e-06f, -6.86485328e-06f, -5.59472801e-06f, -3.30374132e-06f, -6.58850013e-07f, 1.69772784e-06f,
+   3.29096679e-06f, 3.89488696e-06f, 3.54410599e-06f, 2.48201695e-06f, 1.07413200e-06f, -3.01584436e-07f,
+   -1.34341280e-06f, -1.88248714e-06f, -1.89800130e-06f, -1.49422590e-06f, -8.51266464e-07f, -1.69573724e-07f,
+   3.84067761e-07f, 7.11714165e-07f, 7.92942501e-07f, 6.72855833e-07f, 4.35611980e-07f, 1.73402341e-07f,
+};
+
+static const spx_word16_t resample_table_65[1416] = {
+   0.00000000f, 0.00000000f, 0.00000000f, 0.00000000f, -1.93708115e-06f, -1.74904892e-06f,
+   -1.46877073e-06f, -1.09497535e-06f, -6.30032503e-07f, -8.00918869e-08f, 5.44704392e-07f, 1.23039831e-06f,
+   1.95910570e-06f, 2.70945725e-06f, 3.45720969e-06f, 4.17556930e-06f, 4.83615077e-06f, 5.40992687e-06f,
+   5.86799069e-06f, 6.18282274e-06f, 6.32931369e-06f, 6.28588259e-06f, 6.03555964e-06f, 5.56687837e-06f,
+   4.87492753e-06f, 3.96202722e-06f, 2.83791405e-06f, 1.51988991e-06f, 3.59228984e-08f, -1.58058799e-06f,
+   -3.28878423e-06f, -5.04159652e-06f, -6.78662173e-06f, -8.46784951e-06f, -1.00266225e-05f, -1.14037330e-05f,
+   -1.25415072e-05f, -1.33852845e-05f, -1.38858632e-05f, -1.40013317e-05f, -1.36988756e-05f, -1.29567497e-05f,
+   -1.17652680e-05f, -1.01285341e-05f, -8.06504886e-06f, -5.60756735e-06f, -2.80400423e-06f, 2.83506807e-07f,
+   3.58039597e-06f, 6.99882594e-06f, 1.04424198e-05f, 1.38082441e-05f, 1.69883206e-05f, 1.98736034e-05f,
+   2.23569987e-05f, 2.43372197e-05f, 2.57216398e-05f, 2.64302307e-05f, 2.63986494e-05f, 2.55810846e-05f,
+   2.39532328e-05f, 2.15134733e-05f, 1.82852400e-05f, 1.43176594e-05f, 9.68424774e-06f, 4.48408491e-06f,
+   -1.16063029e-06f, -7.10829408e-06f, -1.31986353e-05f, -1.92578518e-05f, -2.51042620e-05f, -3.05489375e-05f,
+   -3.54082622e-05f, -3.95051902e-05f, -4.26748957e-05f, -4.47715283e-05f, -4.56734924e-05f, -4.52880595e-05f,
+   -4.35561269e-05f, -4.04559687e-05f, -3.60046215e-05f, -3.02611043e-05f, -2.33265218e-05f, -1.53410529e-05f,
+   -6.48509649e-06f, 3.02544436e-06f, 1.29461687e-05f, 2.30058231e-05f, 3.29151590e-05f, 4.23767306e-05f,
+   5.10892314e-05f, 5.87587347e-05f, 6.51086884e-05f, 6.98840959e-05f, 7.28691957e-05f, 7.38882809e-05f,
+   7.28149316e-05f, 6.95783674e-05f, 6.41687730e-05f, 5.66380768e-05f, 4.71047679e-05f, 3.57522913e-05f,
+   2.28235258e-05f, 8.62168781e-06f, -6.49866206e-06f, -2.21406626e-05f, -3.78731893e-05f, -5.32431186e-05f,
+   -6.77856151e-05f, -8.10405327e-05f, -9.25640852e-05f, -0.000101942256f, -0.000108806220f, -0.000112843823f,
+   -0.000113811213f, -0.000111541907f, -0.000105960869f, -9.70837136e-05f, -8.50227079e-05f, -6.99892771e-05f,
+   -5.22891714e-05f, -3.23184977e-05f, -1.05589206e-05f, 1.24376156e-05f, 3.60598606e-05f, 5.96499231e-05f,
+   8.25265233e-05f, 0.000103997445f, 0.000123384598f, 0.000140042073f, 0.000153374916f, 0.000162861921f,
+   0.000168071056f, 0.000168676954f, 0.000164474637f, 0.000155389600f, 0.000141486802f, 0.000122970916f,
+   0.000100192730f, 7.36368529e-05f, 4.39162213e-05f, 1.17627660e-05f, -2.19958602e-05f, -5.64533038e-05f,
+   -9.06440255e-05f, -0.000123576450f, -0.000154256835f, -0.000181714786f, -0.000205039876f, -0.000223402923f,
+   -0.000236088192f, -0.000242516136f, -0.000242265378f, -0.000235091764f, -0.000220939954f, -0.000199956121f,
+   -0.000172486602f, -0.000139076525f, -0.000100465812f, -5.75660488e-05f, -1.14515387e-05f, 3.66766217e-05f,
+   8.55158214e-05f, 0.000133690686f, 0.000179800743f, 0.000222453746f, 0.000260303030f, 0.000292096112f,
+   0.000316709251f, 0.000333182310f, 0.000340757804f, 0.000338905898f, 0.000327348564f, 0.000306075613f,
+   0.000275357947f, 0.000235744097f, 0.000188054866f, 0.000133376918f, 7.30287211e-05f, 8.53565780e-06f,
+   -5.83991932e-05f, -0.000125954888f, -0.000192221240f, -0.000255267601f, -0.000313190161f, -0.000364162232f,
+   -0.000406501233f, -0.000438713556f, -0.000459543662f, -0.000468022947f, -0.000463502336f, -0.000445683749f,
+   -0.000414637645f, -0.000370819063f, -0.000315058132f, -0.000248552184f, -0.000172851593f, -8.98115250e-05f,
+   -1.55516591e-06f, 8.95675839e-05f, 0.000181060052f, 0.000270335644f, 0.000354779506f, 0.000431846769f,
+   0.000499108108f, 0.000554346479f, 0.000595617166f, 0.000621309504f, 0.000630211027f, 0.000621546758f,
+   0.000595021527f, 0.000550838187f, 0.000489706465f, 0.000412847468f, 0.000321957312f, 0.000219195965f,
+   0.000107115964f, -1.13883298e-05f, -0.000133139722f, -0.000254786457f, -0.000372878712f, -0.000483952870f,
+   -0.000584654510f, -0.000671823334f, -0.000742580974f, -0.000794447085f, -0.000825388299f, -0.000833914673f,
+   -0.000819127716f, -0.000780768052f, -0.000719236792f, -0.000635600474f, -0.000531596190f, -0.000409579341f,
+   -0.000272482517f, -0.000123765582f, 3.27032903e-05f, 0.000192703854f, 0.000351812749f, 0.000505506294f,
+   0.000649270893f, 0.000778764312f, 0.000889924064f, 0.000979084522f, 0.00104311272f, 0.00107949856f,
+   0.00108644215f, 0.00106293848f, 0.00100880675f, 0.000924731488f, 0.000812262821f, 0.000673811068f,
+   0.000512576255f, 0.000332487602f, 0.000138136485f, -6.53775860e-05f, -0.000272558653f, -0.000477636291f,
+   -0.000674773939f, -0.000858175918f, -0.00102230057f, -0.00116200256f, -0.00127267721f, -0.00135043508f,
+   -0.00139220874f, -0.00139586802f, -0.00136030861f, -0.00128550176f, -0.00117253745f, -0.00102360616f,
+   -0.000841978064f, -0.000631923380f, -0.000398624834f, -0.000148082108f, 0.000113088608f, 0.000377801509f,
+   0.000638660451f, 0.000888218055f, 0.00111915474f, 0.00132446643f, 0.00149772642f, 0.00163322652f,
+   0.00172619766f, 0.00177294796f, 0.00177099602f, 0.00171917898f, 0.00161770452f, 0.00146820385f,
+   0.00127369259f, 0.00103852665f, 0.000768343743f, 0.000469876279f, 0.000150852735f, -0.000180254894f,
+   -0.000514426269f, -0.000842298323f, -0.00115449436f, -0.00144184765f, -0.00169564178f, -0.00190792710f,
+   -0.00207172753f, -0.00218124921f, -0.00223211059f, -0.00222147047f, -0.00214815745f, -0.00201273314f,
+   -0.00181754120f, -0.00156665186f, -0.00126579264f, -0.000922272680f, -0.000544741866f, -0.000143008525f,
+   0.000272162608f, 0.000689437904f, 0.00109709776f, 0.00148346345f, 0.00183718186f, 0.00214751996f,
+   0.00240475684f, 0.00260043307f, 0.00272761309f, 0.00278115110f, 0.00275784824f, 0.00265660044f,
+   0.00247847359f, 0.00222671148f, 0.00190673501f, 0.00152596727f, 0.00109376363f, 0.000621096755f,
+   0.000120320627f, -0.000395085546f, -0.000910983304f, -0.00141290319f, -0.00188639131f, -0.00231753895f,
+   -0.00269329338f, -0.00300183799f, -0.00323303416f, -0.00337865972f, -0.00343274372f, -0.00339174271f,
+   -0.00325472304f, -0.00302342558f, -0.00270226877f, -0.00229833159f, -0.00182114216f, -0.00128248672f,
+   -0.000696194940f, -7.76554880e-05f, 0.000556416868f, 0.00118857808f, 0.00180105970f, 0.00237620110f,
+   0.00289707864f, 0.00334792444f, 0.00371455424f, 0.00398491789f, 0.00414936431f, 0.00420101872f,
+   0.00413603941f, 0.00395378936f, 0.00365690305f, 0.00325127714f, 0.00274603488f, 0.00215324690f,
+   0.00148768281f, 0.000766541634f, 8.86887938e-06f, -0.000764870550f, -0.00153325137f, -0.00227466342f,
+   -0.00296770083f, -0.00359195238f, -0.00412850827f, -0.00456047663f, -0.00487361429f, -0.00505670207f,
+   -0.00510193128f, -0.00500523951f, -0.00476640603f, -0.00438924879f, -0.00388149638f, -0.00325476844f,
+   -0.00252420269f, -0.00170814502f, -0.000827801297f, 9.34789787e-05f, 0.00103073241f, 0.00195794436f,
+   0.00284896162f, 0.00367811625f, 0.00442087697f, 0.00505475374f, 0.00555977225f, 0.00591923995f,
+   0.00612019654f, 0.00615385454f, 0.00601596804f, 0.00570698967f, 0.00523222517f, 0.00460170861f,
+   0.00382998725f, 0.00293596066f, 0.00194220489f, 0.000874673191f, -0.000238234701f, -0.00136619597f,
+   -0.00247795461f, -0.00354203978f, -0.00452770805f, -0.00540587120f, -0.00614983542f, -0.00673617003f,
+   -0.00714540761f, -0.00736268377f, -0.00737820799f, -0.00718766171f, -0.00679242983f, -0.00619963137f,
+   -0.00542208180f, -0.00447802944f, -0.00339068240f, -0.00218776264f, -0.000900725194f, 0.000435984490f,
+   0.00178594782f, 0.00311161089f, 0.00437541213f, 0.00554079376f, 0.00657332130f, 0.00744157098f,
+   0.00811813492f, 0.00858049374f, 0.00881166384f, 0.00880082883f, 0.00854375679f, 0.00804300606f,
+   0.00730802631f, 0.00635499274f, 0.00520651462f, 0.00389102451f, 0.00244222628f, 0.000898189086f,
+   -0.000699727680f, -0.00230780873f, -0.00388126681f, -0.00537542766f, -0.00674708514f, -0.00795558188f,
+   -0.00896410085f, -0.00974073168f, -0.0102594988f, -0.0105011212f, -0.0104537364f, -0.0101133427f,
+   -0.00948406383f, -0.00857818034f, -0.00741596380f, -0.00602515461f, -0.00444046501f, -0.00270264200f,
+   -0.000857497682f, 0.00104541925f, 0.00295393798f, 0.00481477892f, 0.00657512387f, 0.00818390958f,
+   0.00959339738f, 0.0107605420f, 0.0116483457f, 0.0122268880f, 0.0124743702f, 0.0123778610f,
+   0.0119337961f, 0.0111482712f, 0.0100370590f, 0.00862525776f, 0.00694688037f, 0.00504398951f,
+   0.00296572456f, 0.000766898447f, -0.00149320008f, -0.00375253498f, -0.00594793214f, -0.00801697839f,
+   -0.00989954360f, -0.0115396352f, -0.0128871109f, -0.0138990143f, -0.0145410011f, -0.0147884535f,
+   -0.0146273300f, -0.0140547436f, -0.0130792446f, -0.0117208306f, -0.0100104669f, -0.00798958540f,
+   -0.00570905628f, -0.00322779315f, -0.000611501397f, 0.00206919643f, 0.00474055763f, 0.00732791098f,
+   0.00975743867f, 0.0119584426f, 0.0138652995f, 0.0154195055f, 0.0165712442f, 0.0172810555f,
+   0.0175211392f, 0.0172762610f, 0.0165444557f, 0.0153373471f, 0.0136799542f, 0.0116103878f,
+   0.00917897467f, 0.00644691940f, 0.00348505541f, 0.000371876755f, -0.00280841789f, -0.00596839702f,
+   -0.00901942886f, -0.0118743628f, -0.0144498879f, -0.0166690964f, -0.0184634756f, -0.0197751354f,
+   -0.0205586590f, -0.0207824409f, -0.0204299465f, -0.0195004158f, -0.0180091187f, -0.0159873087f,
+   -0.0134815993f, -0.0105530126f, -0.00727532245f, -0.00373355625f, -2.16973458e-05f, 0.00375998928f,
+   0.00750722643f, 0.0111148227f, 0.0144794602f, 0.0175028406f, 0.0200941525f, 0.0221729819f,
+   0.0236716717f, 0.0245375223f, 0.0247343909f, 0.0242441334f, 0.0230673719f, 0.0212238822f,
+   0.0187523849f, 0.0157098863f, 0.0121702086f, 0.00822259113f, 0.00396930240f, -0.000476884103f,
+   -0.00499573490f, -0.00946263690f, -0.0137520526f, -0.0177408345f, -0.0213119593f, -0.0243576113f,
+   -0.0267826132f, -0.0285070930f, -0.0294691790f, -0.0296269413f, -0.0289600231f, -0.0274706092f,
+   -0.0251837950f, -0.0221473295f, -0.0184308439f, -0.0141241662f, -0.00933548249f, -0.00418840488f,
+   0.00118080305f, 0.00662711449f, 0.0120002041f, 0.0171488989f, 0.0219249632f, 0.0261875950f,
+   0.0298073180f, 0.0326697305f, 0.0346791856f, 0.0357616432f, 0.0358672887f, 0.0349723734f,
+   0.0330803990f, 0.0302226823f, 0.0264579263f, 0.0218714010f, 0.0165729281f, 0.0106944516f,
+   0.00438705646f, -0.00218317239f, -0.00883895624f, -0.0153969415f, -0.0216721576f, -0.0274835154f,
+   -0.0326585285f, -0.0370386168f, -0.0404834226f, -0.0428754129f, -0.0441234559f, -0.0441659577f,
+   -0.0429732837f, -0.0405493267f, -0.0369320735f, -0.0321935564f, -0.0264384076f, -0.0198020916f,
+   -0.0124475835f, -0.00456168735f, 0.00364928343f, 0.0119651929f, 0.0201571956f, 0.0279943943f,
+   0.0352495313f, 0.0417058580f, 0.0471628308f, 0.0514423959f, 0.0543942563f, 0.0559007935f,
+   0.0558810309f, 0.0542938672f, 0.0511402152f, 0.0464642122f, 0.0403529629f, 0.0329356790f,
+   0.0243808590f, 0.0148933548f, 0.00470919115f, -0.00590927713f, -0.0166804083f, -0.0273098331f,
+   -0.0374982990f, -0.0469495617f, -0.0553784892f, -0.0625190437f, -0.0681321695f, -0.0720128492f,
+   -0.0739968121f, -0.0739660636f, -0.0718538463f, -0.0676477551f, -0.0613918938f, -0.0531875789f,
+   -0.0431925058f, -0.0316184685f, -0.0187276099f, -0.00482697552f, 0.00973769370f, 0.0245899484f,
+   0.0393313840f, 0.0535513163f, 0.0668370575f, 0.0787846446f, 0.0890096426f, 0.0971579030f,
+   0.102915809f, 0.106020093f, 0.106266387f, 0.103516944f, 0.0977068394f, 0.0888484642f,
+   0.0770349801f, 0.0624409057f, 0.0453214683f, 0.0260098744f, 0.00491262227f, -0.0174970143f,
+   -0.0406875089f, -0.0640787184f, -0.0870534331f, -0.108970068f, -0.129175931f, -0.147021532f,
+   -0.161875129f, -0.173137188f, -0.180254743f, -0.182734847f, -0.180157363f, -0.172186226f,
+   -0.158579484f, -0.139197126f, -0.114007406f, -0.0830904841f, -0.0466406047f, -0.00496471254f,
+   0.0415204130f, 0.0922938138f, 0.146738037f, 0.204148963f, 0.263747722f, 0.324694604f,
+   0.386103600f, 0.447059184f, 0.506632805f, 0.563900828f, 0.617961884f, 0.667954326f,
+   0.713073015f, 0.752584815f, 0.785842836f, 0.812299728f, 0.831517935f, 0.843178451f,
+   0.847087502f, 0.843178451f, 0.831517935f, 0.812299728f, 0.785842836f, 0.752584815f,
+   0.713073015f, 0.667954326f, 0.617961884f, 0.563900828f, 0.506632805f, 0.447059184f,
+   0.386103600f, 0.324694604f, 0.263747722f, 0.204148963f, 0.146738037f, 0.0922938138f,
+   0.0415204130f, -0.00496471254f, -0.0466406047f, -0.0830904841f, -0.114007406f, -0.139197126f,
+   -0.158579484f, -0.172186226f, -0.180157363f, -0.182734847f, -0.180254743f, -0.173137188f,
+   -0.161875129f, -0.147021532f, -0.129175931f, -0.108970068f, -0.0870534331f, -0.0640787184f,
+   -0.0406875089f, -0.0174970143f, 0.00491262227f, 0.0260098744f, 0.0453214683f, 0.0624409057f,
+   0.0770349801f, 0.0888484642f, 0.0977068394f, 0.103516944f, 0.106266387f, 0.106020093f,
+   0.102915809f, 0.0971579030f, 0.0890096426f, 0.0787846446f, 0.0668370575f, 0.0535513163f,
+   0.0393313840f, 0.0245899484f, 0.00973769370f, -0.00482697552f, -0.0187276099f, -0.0316184685f,
+   -0.0431925058f, -0.0531875789f, -0.0613918938f, -0.0676477551f, -0.0718538463f, -0.0739660636f,
+   -0.0739968121f, -0.0720128492f, -0.0681321695f, -0.0625190437f, -0.0553784892f, -0.0469495617f,
+   -0.0374982990f, -0.0273098331f, -0.0166804083f, -0.00590927713f, 0.00470919115f, 0.0148933548f,
+   0.0243808590f, 0.0329356790f, 0.0403529629f, 0.0464642122f, 0.0511402152f, 0.0542938672f,
+   0.0558810309f, 0.0559007935f, 0.0543942563f, 0.0514423959f, 0.0471628308f, 0.0417058580f,
+   0.0352495313f, 0.0279943943f, 0.0201571956f, 0.0119651929f, 0.00364928343f, -0.00456168735f,
+   -0.0124475835f, -0.0198020916f, -0.0264384076f, -0.0321935564f, -0.0369320735f, -0.0405493267f,
+   -0.0429732837f, -0.0441659577f, -0.0441234559f, -0.0428754129f, -0.0404834226f, -0.0370386168f,
+   -0.0326585285f, -0.0274835154f, -0.0216721576f, -0.0153969415f, -0.00883895624f, -0.00218317239f,
+   0.00438705646f, 0.0106944516f, 0.0165729281f, 0.0218714010f, 0.0264579263f, 0.0302226823f,
+   0.0330803990f, 0.0349723734f, 0.0358672887f, 0.0357616432f, 0.0346791856f, 0.0326697305f,
+   0.0298073180f, 0.0261875950f, 0.0219249632f, 0.0171488989f, 0.0120002041f, 0.00662711449f,
+   0.00118080305f, -0.00418840488f, -0.00933548249f, -0.0141241662f, -0.0184308439f, -0.0221473295f,
+   -0.0251837950f, -0.0274706092f, -0.0289600231f, -0.0296269413f, -0.0294691790f, -0.0285070930f,
+   -0.0267826132f, -0.0243576113f, -0.0213119593f, -0.0177408345f, -0.0137520526f, -0.00946263690f,
+   -0.00499573490f, -0.000476884103f, 0.00396930240f, 0.00822259113f, 0.0121702086f, 0.0157098863f,
+   0.0187523849f, 0.0212238822f, 0.0230673719f, 0.0242441334f, 0.0247343909f, 0.0245375223f,
+   0.0236716717f, 0.0221729819f, 0.0200941525f, 0.0175028406f, 0.0144794602f, 0.0111148227f,
+   0.00750722643f, 0.00375998928f, -2.16973458e-05f, -0.00373355625f, -0.00727532245f, -0.0105530126f,
+   -0.0134815993f, -0.0159873087f, -0.0180091187f, -0.0195004158f, -0.0204299465f, -0.0207824409f,
+   -0.0205586590f, -0.0197751354f, -0.0184634756f, -0.0166690964f, -0.0144498879f, -0.0118743628f,
+   -0.00901942886f, -0.00596839702f, -0.00280841789f, 0.000371876755f, 0.00348505541f, 0.00644691940f,
+   0.00917897467f, 0.0116103878f, 0.0136799542f, 0.0153373471f, 0.0165444557f, 0.0172762610f,
+   0.0175211392f, 0.0172810555f, 0.0165712442f, 0.0154195055f, 0.0138652995f, 0.0119584426f,
+   0.00975743867f, 0.00732791098f, 0.00474055763f, 0.00206919643f, -0.000611501397f, -0.00322779315f,
+   -0.00570905628f, -0.00798958540f, -0.0100104669f, -0.0117208306f, -0.0130792446f, -0.0140547436f,
+   -0.0146273300f, -0.0147884535f, -0.0145410011f, -0.0138990143f, -0.0128871109f, -0.0115396352f,
+   -0.00989954360f, -0.00801697839f, -0.00594793214f, -0.00375253498f, -0.00149320008f, 0.000766898447f,
+   0.00296572456f, 0.00504398951f, 0.00694688037f, 0.00862525776f, 0.0100370590f, 0.0111482712f,
+   0.0119337961f, 0.0123778610f, 0.0124743702f, 0.0122268880f, 0.0116483457f, 0.0107605420f,
+   0.00959339738f, 0.00818390958f, 0.00657512387f, 0.00481477892f, 0.00295393798f, 0.00104541925f,
+   -0.000857497682f, -0.00270264200f, -0.00444046501f, -0.00602515461f, -0.00741596380f, -0.00857818034f,
+   -0.00948406383f, -0.0101133427f, -0.0104537364f, -0.0105011212f, -0.0102594988f, -0.00974073168f,
+   -0.00896410085f, -0.00795558188f, -0.00674708514f, -0.00537542766f, -0.00388126681f, -0.00230780873f,
+   -0.000699727680f, 0.000898189086f, 0.00244222628f, 0.00389102451f, 0.00520651462f, 0.00635499274f,
+   0.00730802631f, 0.00804300606f, 0.00854375679f, 0.00880082883f, 0.00881166384f, 0.00858049374f,
+   0.00811813492f, 0.00744157098f, 0.00657332130f, 0.00554079376f, 0.00437541213f, 0.00311161089f,
+   0.00178594782f, 0.000435984490f, -0.000900725194f, -0.00218776264f, -0.00339068240f, -0.00447802944f,
+   -0.00542208180f, -0.00619963137f, -0.00679242983f, -0.00718766171f, -0.00737820799f, -0.00736268377f,
+   -0.00714540761f, -0.00673617003f, -0.00614983542f, -0.00540587120f, -0.00452770805f, -0.00354203978f,
+   -0.00247795461f, -0.00136619597f, -0.000238234701f, 0.000874673191f, 0.00194220489f, 0.00293596066f,
+   0.00382998725f, 0.00460170861f, 0.00523222517f, 0.00570698967f, 0.00601596804f, 0.00615385454f,
+   0.00612019654f, 0.00591923995f, 0.00555977225f, 0.00505475374f, 0.00442087697f, 0.00367811625f,
+   0.00284896162f, 0.00195794436f, 0.00103073241f, 9.34789787e-05f, -0.000827801297f, -0.00170814502f,
+   -0.00252420269f, -0.00325476844f, -0.00388149638f, -0.00438924879f, -0.00476640603f, -0.00500523951f,
+   -0.00510193128f, -0.00505670207f, -0.00487361429f, -0.00456047663f, -0.00412850827f, -0.00359195238f,
+   -0.00296770083f, -0.00227466342f, -0.00153325137f, -0.000764870550f, 8.86887938e-06f, 0.000766541634f,
+   0.00148768281f, 0.00215324690f, 0.00274603488f, 0.00325127714f, 0.00365690305f, 0.00395378936f,
+   0.00413603941f, 0.00420101872f, 0.00414936431f, 0.00398491789f, 0.00371455424f, 0.00334792444f,
+   0.00289707864f, 0.00237620110f, 0.00180105970f, 0.00118857808f, 0.000556416868f, -7.76554880e-05f,
+   -0.000696194940f, -0.00128248672f, -0.00182114216f, -0.00229833159f, -0.00270226877f, -0.00302342558f,
+   -0.00325472304f, -0.00339174271f, -0.00343274372f, -0.00337865972f, -0.00323303416f, -0.00300183799f,
+   -0.00269329338f, -0.00231753895f, -0.00188639131f, -0.00141290319f, -0.000910983304f, -0.000395085546f,
+   0.000120320627f, 0.000621096755f, 0.00109376363f, 0.00152596727f, 0.00190673501f, 0.00222671148f,
+   0.00247847359f, 0.00265660044f, 0.00275784824f, 0.00278115110f, 0.00272761309f, 0.00260043307f,
+   0.00240475684f, 0.00214751996f, 0.00183718186f, 0.00148346345f, 0.00109709776f, 0.000689437904f,
+   0.000272162608f, -0.000143008525f, -0.000544741866f, -0.000922272680f, -0.00126579264f, -0.00156665186f,
+   -0.00181754120f, -0.00201273314f, -0.00214815745f, -0.00222147047f, -0.00223211059f, -0.00218124921f,
+   -0.00207172753f, -0.00190792710f, -0.00169564178f, -0.00144184765f, -0.00115449436f, -0.000842298323f,
+   -0.000514426269f, -0.000180254894f, 0.000150852735f, 0.000469876279f, 0.000768343743f, 0.00103852665f,
+   0.00127369259f, 0.00146820385f, 0.00161770452f, 0.00171917898f, 0.00177099602f, 0.00177294796f,
+   0.00172619766f, 0.00163322652f, 0.00149772642f, 0.00132446643f, 0.00111915474f, 0.000888218055f,
+   0.000638660451f, 0.000377801509f, 0.000113088608f, -0.000148082108f, -0.000398624834f, -0.000631923380f,
+   -0.000841978064f, -0.00102360616f, -0.00117253745f, -0.00128550176f, -0.00136030861f, -0.00139586802f,
+   -0.00139220874f, -0.00135043508f, -0.00127267721f, -0.00116200256f, -0.00102230057f, -0.000858175918f,
+   -0.000674773939f, -0.000477636291f, -0.000272558653f, -6.53775860e-05f, 0.000138136485f, 0.000332487602f,
+   0.000512576255f, 0.000673811068f, 0.000812262821f, 0.000924731488f, 0.00100880675f, 0.00106293848f,
+   0.00108644215f, 0.00107949856f, 0.00104311272f, 0.000979084522f, 0.000889924064f, 0.000778764312f,
+   0.000649270893f, 0.000505506294f, 0.000351812749f, 0.000192703854f, 3.27032903e-05f, -0.000123765582f,
+   -0.000272482517f, -0.000409579341f, -0.000531596190f, -0.000635600474f, -0.000719236792f, -0.000780768052f,
+   -0.000819127716f, -0.000833914673f, -0.000825388299f, -0.000794447085f, -0.000742580974f, -0.000671823334f,
+   -0.000584654510f, -0.000483952870f, -0.000372878712f, -0.000254786457f, -0.000133139722f, -1.13883298e-05f,
+   0.000107115964f, 0.000219195965f, 0.000321957312f, 0.000412847468f, 0.000489706465f, 0.000550838187f,
+   0.000595021527f, 0.000621546758f, 0.000630211027f, 0.000621309504f, 0.000595617166f, 0.000554346479f,
+   0.000499108108f, 0.000431846769f, 0.000354779506f, 0.000270335644f, 0.000181060052f, 8.95675839e-05f,
+   -1.55516591e-06f, -8.98115250e-05f, -0.000172851593f, -0.000248552184f, -0.000315058132f, -0.000370819063f,
+   -0.000414637645f, -0.000445683749f, -0.000463502336f, -0.000468022947f, -0.000459543662f, -0.000438713556f,
+   -0.000406501233f, -0.000364162232f, -0.000313190161f, -0.000255267601f, -0.000192221240f, -0.000125954888f,
+   -5.83991932e-05f, 8.53565780e-06f, 7.30287211e-05f, 0.000133376918f, 0.000188054866f, 0.000235744097f,
+   0.000275357947f, 0.000306075613f, 0.000327348564f, 0.000338905898f, 0.000340757804f, 0.000333182310f,
+   0.000316709251f, 0.000292096112f, 0.000260303030f, 0.000222453746f, 0.000179800743f, 0.000133690686f,
+   8.55158214e-05f, 3.66766217e-05f, -1.14515387e-05f, -5.75660488e-05f, -0.000100465812f, -0.000139076525f,
+   -0.000172486602f, -0.000199956121f, -0.000220939954f, -0.000235091764f, -0.000242265378f, -0.000242516136f,
+   -0.000236088192f, -0.000223402923f, -0.000205039876f, -0.000181714786f, -0.000154256835f, -0.000123576450f,
+   -9.06440255e-05f, -5.64533038e-05f, -2.19958602e-05f, 1.17627660e-05f, 4.39162213e-05f, 7.36368529e-05f,
+   0.000100192730f, 0.000122970916f, 0.000141486802f, 0.000155389600f, 0.000164474637f, 0.000168676954f,
+   0.000168071056f, 0.000162861921f, 0.000153374916f, 0.000140042073f, 0.000123384598f, 0.000103997445f,
+   8.25265233e-05f, 5.96499231e-05f, 3.60598606e-05f, 1.24376156e-05f, -1.05589206e-05f, -3.23184977e-05f,
+   -5.22891714e-05f, -6.99892771e-05f, -8.50227079e-05f, -9.70837136e-05f, -0.000105960869f, -0.000111541907f,
+   -0.000113811213f, -0.000112843823f, -0.000108806220f, -0.000101942256f, -9.25640852e-05f, -8.10405327e-05f,
+   -6.77856151e-05f, -5.32431186e-05f, -3.78731893e-05f, -2.21406626e-05f, -6.49866206e-06f, 8.62168781e-06f,
+   2.28235258e-05f, 3.57522913e-05f, 4.71047679e-05f, 5.66380768e-05f, 6.41687730e-05f, 6.95783674e-05f,
+   7.28149316e-05f, 7.38882809e-05f, 7.28691957e-05f, 6.98840959e-05f, 6.51086884e-05f, 5.87587347e-05f,
+   5.10892314e-05f, 4.23767306e-05f, 3.29151590e-05f, 2.30058231e-05f, 1.29461687e-05f, 3.02544436e-06f,
+   -6.48509649e-06f, -1.53410529e-05f, -2.33265218e-05f, -3.02611043e-05f, -3.60046215e-05f, -4.04559687e-05f,
+   -4.35561269e-05f, -4.52880595e-05f, -4.56734924e-05f, -4.47715283e-05f, -4.26748957e-05f, -3.95051902e-05f,
+   -3.54082622e-05f, -3.05489375e-05f, -2.51042620e-05f, -1.92578518e-05f, -1.31986353e-05f, -7.10829408e-06f,
+   -1.16063029e-06f, 4.48408491e-06f, 9.68424774e-06f, 1.43176594e-05f, 1.82852400e-05f, 2.15134733e-05f,
+   2.39532328e-05f, 2.55810846e-05f, 2.63986494e-05f, 2.64302307e-05f, 2.57216398e-05f, 2.43372197e-05f,
+   2.23569987e-05f, 1.98736034e-05f, 1.69883206e-05f, 1.38082441e-05f, 1.04424198e-05f, 6.99882594e-06f,
+   3.58039597e-06f, 2.83506807e-07f, -2.80400423e-06f, -5.60756735e-06f, -8.06504886e-06f, -1.01285341e-05f,
+   -1.17652680e-05f, -1.29567497e-05f, -1.36988756e-05f, -1.40013317e-05f, -1.38858632e-05f, -1.33852845e-05f,
+   -1.25415072e-05f, -1.14037330e-05f, -1.00266225e-05f, -8.46784951e-06f, -6.78662173e-06f, -5.04159652e-06f,
+   -3.28878423e-06f, -1.58058799e-06f, 3.59228984e-08f, 1.51988991e-06f, 2.83791405e-06f, 3.96202722e-06f,
+   4.87492753e-06f, 5.56687837e-06f, 6.03555964e-06f, 6.28588259e-06f, 6.32931369e-06f, 6.18282274e-06f,
+   5.86799069e-06f, 5.40992687e-06f, 4.83615077e-06f, 4.17556930e-06f, 3.45720969e-06f, 2.70945725e-06f,
+   1.95910570e-06f, 1.23039831e-06f, 5.44704392e-07f, -8.00918869e-08f, -6.30032503e-07f, -1.09497535e-06f,
+   -1.46877073e-06f, -1.74904892e-06f, -1.93708115e-06f, 0.00000000f, 0.00000000f, 0.00000000f,
+};
+
+static const struct builtin_sinc_table builtin_sinc_tables[] = {
+   {3, 1, 2, 1, 96, resample_table_0},
+   {3, 1, 3, 1, 144, resample_table_1},
+   {3, 1, 4, 1, 192, resample_table_2},
+   {3, 80, 441, 0, 392, resample_table_3},
+   {3, 1, 6, 1, 288, resample_table_4},
+   {3, 2, 1, 1, 96, resample_table_5},
+   {3, 2, 3, 1, 144, resample_table_1},
+   {3, 160, 441, 0, 392, resample_table_3},
+   {3, 3, 1, 1, 144, resample_table_8},
+   {3, 3, 2, 1, 144, resample_table_9},
+   {3, 3, 4, 1, 192, resample_table_2},
+   {3, 80, 147, 0, 392, resample_table_3},
+   {3, 4, 1, 1, 192, resample_table_12},
+   {3, 4, 3, 1, 192, resample_table_13},
+   {3, 320, 441, 0, 392, resample_table_3},
+   {3, 441, 80, 0, 536, resample_table_15},
+   {3, 441, 160, 0, 552, resample_table_16},
+   {3, 147, 80, 0, 712, resample_table_17},
+   {3, 441, 320, 0, 584, resample_table_18},
+   {3, 147, 160, 0, 392, resample_table_3},
+   {3, 6, 1, 1, 288, resample_table_20},
+   {3, 160, 147, 0, 456, resample_table_21},
+   {4, 1, 2, 1, 128, resample_table_22},
+   {4, 1, 3, 1, 192, resample_table_23},
+   {4, 1, 4, 1, 256, resample_table_24},
+   {4, 80, 441, 0, 520, resample_table_25},
+   {4, 1, 6, 1, 384, resample_table_26},
+   {4, 2, 1, 1, 128, resample_table_27},
+   {4, 2, 3, 1, 192, resample_table_23},
+   {4, 160, 441, 0, 520, resample_table_25},
+   {4, 3, 1, 1, 192, resample_table_30},
+   {4, 3, 2, 1, 192, resample_table_31},
+   {4, 3, 4, 1, 256, resample_table_24},
+   {4, 80, 147, 0, 520, resample_table_25},
+   {4, 4, 1, 1, 256, resample_table_34},
+   {4, 4, 3, 1, 264, resample_table_35},
+   {4, 320, 441, 0, 520, resample_table_25},
+   {4, 441, 80, 0, 712, resample_table_37},
+   {4, 441, 160, 0, 712, resample_table_38},
+   {4, 147, 80, 0, 968, resample_table_39},
+   {4, 441, 320, 0, 712, resample_table_40},
+   {4, 147, 160, 0, 520, resample_table_25},
+   {4, 6, 1, 1, 384, resample_table_42},
+   {4, 160, 147, 0, 584, resample_table_43},
+   {5, 1, 2, 1, 160, resample_table_44},
+   {5, 1, 3, 1, 240, resample_table_45},
+   {5, 1, 4, 1, 320, resample_table_46},
+   {5, 80, 441, 0, 1288, resample_table_47},
+   {5, 1, 6, 1, 480, resample_table_48},
+   {5, 2, 1, 1, 160, resample_table_49},
+   {5, 2, 3, 1, 240, resample_table_45},
+   {5, 160, 441, 0, 1288, resample_table_47},
+   {5, 3, 1, 1, 240, resample_table_52},
+   {5, 3, 2, 1, 240, resample_table_53},
+   {5, 3, 4, 1, 320, resample_table_46},
+   {5, 80, 147, 0, 1288, resample_table_47},
+   {5, 4, 1, 1, 320, resample_table_56},
+   {5, 4, 3, 1, 336, resample_table_57},
+   {5, 320, 441, 0, 1288, resample_table_47},
+   {5, 441, 80, 0, 1800, resample_table_59},
+   {5, 441, 160, 0, 1800, resample_table_60},
+   {5, 147, 80, 0, 2440, resample_table_61},
+   {5, 441, 320, 0, 1800, resample_table_62},
+   {5, 147, 160, 0, 1288, resample_table_47},
+   {5, 6, 1, 1, 480, resample_table_64},
+   {5, 160, 147, 0, 1416, resample_table_65},
+};
+
+#endif
@@ -0,0 +1,38 @@
+/* File: resample_xtensa.h
+   Resampler inner product for the ESP32 / ESP32-S3 FPU
+
+   The Xtensa FPU is scalar (the S3 vector unit only has integer lanes), but
+   madd.s has several cycles of latency. The scalar loop in resample.c chains
+   every multiply-add on a single accumulator; four independent accumulators
+   let consecutive madd.s issue back to back. The sum is taken in a different
+   order than in resample.c, so results may differ in the last bit.
+
+   Only the single-precision direct product is replaced: the interpolating
+   kernel already keeps four accumulators, and the double kernels (quality
+   9-10) run in software double arithmetic either way.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted under the same terms as resample.c.
+*/
+
+#ifndef RESAMPLE_XTENSA_H
+#define RESAMPLE_XTENSA_H
+
+#define OVERRIDE_INNER_PRODUCT_SINGLE
+static inline float inner_product_single(const float *a, const float *b, unsigned int len)
+{
+   unsigned int i = 0;
+   float sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+   for (;i+4<=len;i+=4)
+   {
+      sum0 += a[i]*b[i];
+      sum1 += a[i+1]*b[i+1];
+      sum2 += a[i+2]*b[i+2];
+      sum3 += a[i+3]*b[i+3];
+   }
+   for (;i<len;i++)
+      sum0 += a[i]*b[i];
+   return (sum0 + sum1) + (sum2 + sum3);
+}
+
+#endif
@@ -2,7 +2,8 @@
 
    File: speex_buffer.h
    This is a very simple ring buffer implementation. It is not thread-safe
-   so you need to do your own locking.
+   so you need to do your own locking, except for buffers created with
+   speex_buffer_init_spsc().
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -43,8 +44,26 @@ extern "C" {
 struct SpeexBuffer_;
 typedef struct SpeexBuffer_ SpeexBuffer;
 
+/** Contiguous region inside a buffer's storage. Regions that wrap around the
+    end of the buffer are described by two spans, the second one starting at
+    the beginning of the storage (its len is 0 if there is no wrap). */
+typedef struct {
+   char *data;
+   int   len;
+} SpeexBufferSpan;
+
 SpeexBuffer *speex_buffer_init(int size);
 
+/** Creates a lock-free buffer for exactly one producer (write/writezeros) and
+    one consumer (read) thread, e.g. an I2S capture task and a DSP task on the
+    other core. The capacity is size rounded up to a power of two. Unlike the
+    default buffer, a write never overwrites unread data: it stores what fits
+    and returns that length. Resizing is not supported.
+ @param size Minimum capacity in bytes
+ @return Newly created buffer, or NULL if size is not in 1..2^30
+*/
+SpeexBuffer *speex_buffer_init_spsc(int size);
+
 void speex_buffer_destroy(SpeexBuffer *st);
 
 int speex_buffer_write(SpeexBuffer *st, void *data, int len);
@@ -55,8 +74,45 @@ int speex_buffer_read(SpeexBuffer *st, void *data, int len);
 
 int speex_buffer_get_available(SpeexBuffer *st);
 
+/** Changes the capacity, keeping the buffered data (if it does not fit, the
+    oldest bytes are dropped). SPSC buffers are rounded up to a power of two
+    and must not be used by another thread during the call.
+ @param len New capacity in bytes
+ @return New capacity, or -1 on failure (the buffer is then left unchanged)
+*/
 int speex_buffer_resize(SpeexBuffer *st, int len);
 
+/** Lets writes that do not fit grow the buffer (doubling) instead of dropping
+    old data, up to max_size bytes. Not available on SPSC buffers.
+ @param max_size Largest capacity in bytes, 0 to disable growth (the default)
+ @return 0 on success, -1 on an SPSC buffer
+*/
+int speex_buffer_set_max_size(SpeexBuffer *st, int max_size);
+
+/** Gives direct access to up to len bytes of free space, e.g. as a DMA target.
+    Nothing is visible to the reader until speex_buffer_commit_write().
+ @param spans Array of two spans filled with the writable region
+ @return Number of writable bytes (spans[0].len + spans[1].len), at most len
+*/
+int speex_buffer_acquire_write(SpeexBuffer *st, int len, SpeexBufferSpan *spans);
+
+/** Publishes len bytes written through speex_buffer_acquire_write()
+ @return Number of bytes committed (len, clipped to the free space)
+*/
+int speex_buffer_commit_write(SpeexBuffer *st, int len);
+
+/** Gives direct access to up to len bytes of buffered data without copying.
+    The data stays in the buffer until speex_buffer_consume().
+ @param spans Array of two spans filled with the readable region
+ @return Number of readable bytes (spans[0].len + spans[1].len), at most len
+*/
+int speex_buffer_peek_read(SpeexBuffer *st, int len, SpeexBufferSpan *spans);
+
+/** Drops len bytes from the front of the buffer (after speex_buffer_peek_read())
+ @return Number of bytes consumed (len, clipped to what is available)
+*/
+int speex_buffer_consume(SpeexBuffer *st, int len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,6 +38,7 @@
  *  @{
  */
 #include "speexdsp_types.h"
+#include "speexdsp_profile.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -59,6 +60,84 @@ extern "C" {
 /** Get impulse response (int32[]) */
 #define SPEEX_ECHO_GET_IMPULSE_RESPONSE 29
 
+/** Set how many filter partitions get the gradient constraint (an IFFT/FFT pair
+    each) per frame: the first one every frame and the others in turn. 2 by
+    default (AUMDF), the number of partitions (filter length / frame size) for a
+    full MDF, 1 to have the first partition take turns too. Fewer saves CPU,
+    more converges faster */
+#define SPEEX_ECHO_SET_CONSTRAINT_PARTITIONS 30
+/** Get partitions constrained per frame */
+#define SPEEX_ECHO_GET_CONSTRAINT_PARTITIONS 31
+/** Set partitions constrained per frame while the filter is converging or
+    recovering from a bad adaptation step (0, the default: no change) */
+#define SPEEX_ECHO_SET_CONSTRAINT_BOOST 32
+/** Get partitions constrained per frame while converging */
+#define SPEEX_ECHO_GET_CONSTRAINT_BOOST 33
+
+/** Runs job(arg, 0) to job(arg, count-1), concurrently where possible, and only
+    returns once all of them have finished. count never exceeds the workers given
+    with SPEEX_ECHO_SET_PARALLEL, and no two jobs of a batch share an index */
+typedef void (*speex_echo_parallel_func)(void *ctx, void (*job)(void *arg, int index), void *arg, int count);
+
+/** Worker pool the echo canceller splits a frame across */
+typedef struct {
+   int workers;                  /**< Jobs that can run at the same time (1: serial) */
+   speex_echo_parallel_func run; /**< Runs a batch of jobs and waits for all of them */
+   void *ctx;                    /**< Passed back to run */
+} SpeexEchoParallel;
+
+/** Split the filtering, error computation and weight update of each frame across
+    a worker pool (SpeexEchoParallel, run NULL for serial). The weight update is
+    split by filter partition, the rest by microphone, with a barrier between the
+    stages; the output is identical to the serial one. With a single microphone
+    and speaker only the weight update is split, which rarely pays for the
+    hand-offs. Allocates one FFT scratch per extra worker */
+#define SPEEX_ECHO_SET_PARALLEL 34
+/** Get the worker pool (SpeexEchoParallel) */
+#define SPEEX_ECHO_GET_PARALLEL 35
+
+/** Get the time spent per stage (SpeexProfile), SPEEXDSP_PROFILE builds only */
+#define SPEEX_ECHO_GET_PROFILE 36
+/** Clear the stage counters (no argument) */
+#define SPEEX_ECHO_RESET_PROFILE 37
+
+/** Stages of SpeexProfile for the echo canceller */
+#define SPEEX_ECHO_STAGE_INPUT 0      /**< DC notch and pre-emphasis of both inputs */
+#define SPEEX_ECHO_STAGE_FFT 1        /**< Forward FFTs of the far end, error and echo estimate */
+#define SPEEX_ECHO_STAGE_FILTER 2     /**< Foreground and background filtering (accumulate + inverse FFT) */
+#define SPEEX_ECHO_STAGE_ADAPT 3      /**< Proportional step sizes and gradient step */
+#define SPEEX_ECHO_STAGE_CONSTRAINT 4 /**< Gradient constraint (IFFT/FFT pair per partition) */
+#define SPEEX_ECHO_STAGE_OUTPUT 5     /**< Filter switch decision, output and error signals */
+#define SPEEX_ECHO_STAGE_RESIDUAL 6   /**< Power spectra, leak estimate and learning rate */
+#define SPEEX_ECHO_STAGES 7
+
+/** How well the echo canceller is doing. The frame values describe the last
+    frame processed, the counts and averages run since the state was created or
+    the telemetry was reset (an echo canceller reset keeps them). Microphone
+    and output energies include near-end speech, so the ERLE drops during
+    double talk while the leak estimate stays put */
+typedef struct {
+   float erle;           /**< Echo return loss enhancement of the last frame (dB): microphone over output energy */
+   float erle_avg;       /**< Same on energies smoothed over about 50 frames */
+   float echo_level;     /**< Echo estimate energy over microphone energy (dB, smoothed), very low when there is no echo */
+   float leak;           /**< Share of the echo estimate still found in the output (0..1) */
+   float residual_ratio; /**< Residual echo over output energy behind the step size (0..0.5), drops with near-end speech */
+   float adapt_rate;     /**< Normalised step size for the next frame (0..0.5) */
+   int adapted;          /**< The filter has passed its initial convergence phase */
+   int saturated;        /**< Frames adaptation stays frozen for after clipping */
+   spx_uint32_t frames;             /**< Frames processed */
+   spx_uint32_t foreground_updates; /**< Adapted (background) filter copied to the output (foreground) one */
+   spx_uint32_t background_resets;  /**< Background filter thrown away for diverging from the foreground */
+   spx_uint32_t resets;             /**< Full resets after the filter blew up */
+   spx_uint32_t saturations;        /**< Frames with a clipped microphone sample */
+} SpeexEchoTelemetry;
+
+/** Get the quality telemetry (SpeexEchoTelemetry). Kept as raw energies and
+    counters while processing, only converted when read */
+#define SPEEX_ECHO_GET_TELEMETRY 38
+/** Clear the telemetry counts and averages (no argument) */
+#define SPEEX_ECHO_RESET_TELEMETRY 39
+
 /** Internal echo canceller state. Should never be accessed directly. */
 struct SpeexEchoState_;
 
@@ -85,6 +164,27 @@ SpeexEchoState *speex_echo_state_init(int frame_size, int filter_length);
  */
 SpeexEchoState *speex_echo_state_init_mc(int frame_size, int filter_length, int nb_mic, int nb_speakers);
 
+/** Returns the size of the single memory block used by a multi-channel echo canceller state
+ * @param frame_size Number of samples to process at one time (should correspond to 10-20 ms)
+ * @param filter_length Number of samples of echo to cancel (should generally correspond to 100-500 ms)
+ * @param nb_mic Number of microphone channels
+ * @param nb_speakers Number of speaker channels
+ * @return Size in bytes (any alignment is accepted)
+ */
+int speex_echo_state_get_size_mc(int frame_size, int filter_length, int nb_mic, int nb_speakers);
+
+/** Creates a new multi-channel echo canceller state inside a caller-provided block. Apart from
+ * the FFT tables shared with other states, nothing is allocated on the heap.
+ * @param frame_size Number of samples to process at one time (should correspond to 10-20 ms)
+ * @param filter_length Number of samples of echo to cancel (should generally correspond to 100-500 ms)
+ * @param nb_mic Number of microphone channels
+ * @param nb_speakers Number of speaker channels
+ * @param mem Block of at least speex_echo_state_get_size_mc() bytes, or NULL to allocate one
+ * @param mem_size Size of mem in bytes
+ * @return Newly-created echo canceller state (NULL if mem is too small). The block must outlive it
+ */
+SpeexEchoState *speex_echo_state_init_mc_mem(int frame_size, int filter_length, int nb_mic, int nb_speakers, void *mem, int mem_size);
+
 /** Destroys an echo canceller state
  * @param st Echo canceller state
 */
@@ -100,6 +200,17 @@ void speex_echo_state_destroy(SpeexEchoState *st);
  */
 void speex_echo_cancellation(SpeexEchoState *st, const spx_int16_t *rec, const spx_int16_t *play, spx_int16_t *out);
 
+/** Same as speex_echo_cancellation() on float samples. They use the 16-bit
+ * scale (full scale is +/-32768) but are neither rounded nor clipped, so
+ * 24-bit input keeps its extra resolution and the output does not saturate
+ *
+ * @param st Echo canceller state
+ * @param rec Signal from the microphone (near end + far end echo)
+ * @param play Signal played to the speaker (received from far end)
+ * @param out Returns near-end signal with echo removed
+ */
+void speex_echo_cancellation_float(SpeexEchoState *st, const float *rec, const float *play, float *out);
+
 /** Performs echo cancellation a frame (deprecated) */
 void speex_echo_cancel(SpeexEchoState *st, const spx_int16_t *rec, const spx_int16_t *play, spx_int16_t *out, spx_int32_t *Yout);
 
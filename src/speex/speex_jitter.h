@@ -53,6 +53,12 @@ struct JitterBuffer_;
 /** Generic adaptive jitter buffer state */
 typedef struct JitterBuffer_ JitterBuffer;
 
+/** Jitter buffers of several streams sharing one payload pool */
+struct JitterBufferGroup_;
+
+/** Jitter buffers of several streams sharing one payload pool */
+typedef struct JitterBufferGroup_ JitterBufferGroup;
+
 /** Definition of an incoming packet */
 typedef struct _JitterBufferPacket JitterBufferPacket;
 
@@ -113,6 +119,27 @@ struct _JitterBufferPacket {
 #define JITTER_BUFFER_SET_LATE_COST 12
 #define JITTER_BUFFER_GET_LATE_COST 13
 
+/** Preallocate one payload slot of this many bytes per buffered packet, so that
+    copying packets in and out does no heap operation (0, the default, disables
+    the pool). Larger packets still come from the heap. Resets the buffer. */
+#define JITTER_BUFFER_SET_MAX_PACKET_SIZE 14
+#define JITTER_BUFFER_GET_MAX_PACKET_SIZE 15
+
+/** Counters of a jitter buffer since it was created (they survive resets) */
+typedef struct {
+   spx_uint32_t received;     /**< Packets put into the buffer */
+   spx_uint32_t late;         /**< Packets that arrived after they were due (some still get played) */
+   spx_uint32_t dropped;      /**< Packets discarded unplayed (too late, stale or pushed out by a full buffer) */
+   spx_uint32_t returned;     /**< Packets returned by jitter_buffer_get() and jitter_buffer_get_another() */
+   spx_uint32_t missing;      /**< jitter_buffer_get() calls that found nothing to play */
+   spx_uint32_t inserted;     /**< jitter_buffer_get() calls asking for a "fake" packet to increase buffering */
+   spx_uint32_t heap_packets; /**< Payloads copied to the heap because no pool slot was left (or large enough) */
+   spx_int32_t  buffered;     /**< Packets held right now */
+} JitterBufferStats;
+
+/** Get the counters of the jitter buffer (JitterBufferStats) */
+#define JITTER_BUFFER_GET_STATS 16
+
 
 /** Initialises jitter buffer
  *
@@ -188,6 +215,48 @@ int jitter_buffer_ctl(JitterBuffer *jitter, int request, void *ptr);
 
 int jitter_buffer_update_delay(JitterBuffer *jitter, JitterBufferPacket *packet, spx_int32_t *start_offset);
 
+/** Initialises jitter buffers for many streams in one block. Each stream holds
+ * at most stream_packets packets (instead of 200) and copied payloads share
+ * pool_packets slots, so memory follows the packets in flight rather than the
+ * number of streams. The streams are used from a single task.
+ *
+ * @param nb_streams Number of streams
+ * @param step_size Same as for jitter_buffer_init()
+ * @param stream_packets Packets a stream can hold (the earliest one is dropped beyond that)
+ * @param pool_packets Payload slots shared by all streams (0: payloads come from the heap)
+ * @param max_packet_size Size of a slot in bytes, larger packets come from the heap
+ * @return Newly created group, NULL on bad arguments or if out of memory
+ */
+JitterBufferGroup *jitter_buffer_group_init(int nb_streams, int step_size, int stream_packets, int pool_packets, int max_packet_size);
+
+/** Destroys the group and all its streams
+ *
+ * @param group Group state
+ */
+void jitter_buffer_group_destroy(JitterBufferGroup *group);
+
+/** Jitter buffer of one stream, used with the jitter_buffer_*() calls (including
+ * jitter_buffer_ctl() for the per-stream JITTER_BUFFER_GET_STATS). Don't pass it
+ * to jitter_buffer_destroy().
+ *
+ * @param group Group state
+ * @param stream Stream index, from 0 to nb_streams-1
+ * @return Stream state, NULL if stream is out of range
+ */
+JitterBuffer *jitter_buffer_group_stream(JitterBufferGroup *group, int stream);
+
+/** Advance all streams by one tick (jitter_buffer_tick() on each)
+ *
+ * @param group Group state
+ */
+void jitter_buffer_group_tick(JitterBufferGroup *group);
+
+/** Number of pool slots not holding a payload right now
+ *
+ * @param group Group state
+ */
+int jitter_buffer_group_get_free(JitterBufferGroup *group);
+
 /* @} */
 
 #ifdef __cplusplus
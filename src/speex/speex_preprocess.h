@@ -44,6 +44,7 @@
  */
 
 #include "speexdsp_types.h"
+#include "speexdsp_profile.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -64,6 +65,23 @@ typedef struct SpeexPreprocessState_ SpeexPreprocessState;
 */
 SpeexPreprocessState *speex_preprocess_state_init(int frame_size, int sampling_rate);
 
+/** Returns the size of the single memory block used by a preprocessor state
+ * @param frame_size Number of samples to process at one time (should correspond to 10-20 ms)
+ * @param sampling_rate Sampling rate used for the input.
+ * @return Size in bytes (any alignment is accepted)
+*/
+int speex_preprocess_state_get_size(int frame_size, int sampling_rate);
+
+/** Creates a new preprocessing state inside a caller-provided block. Apart from the FFT
+ * tables shared with other states, nothing is allocated on the heap.
+ * @param frame_size Number of samples to process at one time (should correspond to 10-20 ms)
+ * @param sampling_rate Sampling rate used for the input.
+ * @param mem Block of at least speex_preprocess_state_get_size() bytes, or NULL to allocate one
+ * @param mem_size Size of mem in bytes
+ * @return Newly created preprocessor state (NULL if mem is too small). The block must outlive it
+*/
+SpeexPreprocessState *speex_preprocess_state_init_mem(int frame_size, int sampling_rate, void *mem, int mem_size);
+
 /** Destroys a preprocessor state
  * @param st Preprocessor state to destroy
 */
@@ -76,6 +94,14 @@ void speex_preprocess_state_destroy(SpeexPreprocessState *st);
 */
 int speex_preprocess_run(SpeexPreprocessState *st, spx_int16_t *x);
 
+/** Same as speex_preprocess_run() on float samples. They use the 16-bit scale (full scale
+ * is +/-32768) but are neither rounded nor clipped
+ * @param st Preprocessor state
+ * @param x Audio sample vector (in and out). Must be same size as specified in speex_preprocess_state_init().
+ * @return Bool value for voice activity (1 for speech, 0 for noise/silence), ONLY if VAD turned on.
+*/
+int speex_preprocess_run_float(SpeexPreprocessState *st, float *x);
+
 /** Preprocess a frame (deprecated, use speex_preprocess_run() instead)*/
 int speex_preprocess(SpeexPreprocessState *st, spx_int16_t *x, spx_int32_t *echo);
 
@@ -211,6 +237,27 @@ int speex_preprocess_ctl(SpeexPreprocessState *st, int request, void *ptr);
 /** Get preprocessor Automatic Gain Control level (int32) */
 #define SPEEX_PREPROCESS_GET_AGC_TARGET 47
 
+/** Set fused residual echo estimation (int32): reuse the echo canceller's spectrum of the
+    current frame instead of re-analysing its echo estimate. Saves one FFT per frame, but
+    requires speex_echo_cancellation() to run on the same frame right before the preprocessor */
+#define SPEEX_PREPROCESS_SET_ECHO_FUSED 48
+/** Get fused residual echo estimation (int32) */
+#define SPEEX_PREPROCESS_GET_ECHO_FUSED 49
+
+/** Get the time spent per stage (SpeexProfile), SPEEXDSP_PROFILE builds only */
+#define SPEEX_PREPROCESS_GET_PROFILE 50
+/** Clear the stage counters (no argument) */
+#define SPEEX_PREPROCESS_RESET_PROFILE 51
+
+/** Stages of SpeexProfile for the preprocessor */
+#define SPEEX_PREPROCESS_STAGE_ECHO 0      /**< Residual echo spectrum from the echo canceller */
+#define SPEEX_PREPROCESS_STAGE_ANALYSIS 1  /**< Framing, window, FFT and power spectrum */
+#define SPEEX_PREPROCESS_STAGE_NOISE 2     /**< Noise estimate update */
+#define SPEEX_PREPROCESS_STAGE_GAIN 3      /**< SNR, speech probability and gain computation */
+#define SPEEX_PREPROCESS_STAGE_AGC 4       /**< Automatic gain control */
+#define SPEEX_PREPROCESS_STAGE_SYNTHESIS 5 /**< Inverse FFT, window and overlap-add */
+#define SPEEX_PREPROCESS_STAGES 6
+
 #ifdef __cplusplus
 }
 #endif
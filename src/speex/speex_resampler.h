@@ -76,6 +76,10 @@
 #define speex_resampler_skip_zeros CAT_PREFIX(RANDOM_PREFIX,_resampler_skip_zeros)
 #define speex_resampler_reset_mem CAT_PREFIX(RANDOM_PREFIX,_resampler_reset_mem)
 #define speex_resampler_strerror CAT_PREFIX(RANDOM_PREFIX,_resampler_strerror)
+#define speex_resampler_cache_trim CAT_PREFIX(RANDOM_PREFIX,_resampler_cache_trim)
+#define speex_resampler_set_drift CAT_PREFIX(RANDOM_PREFIX,_resampler_set_drift)
+#define speex_resampler_get_drift CAT_PREFIX(RANDOM_PREFIX,_resampler_get_drift)
+#define speex_resampler_track_fill CAT_PREFIX(RANDOM_PREFIX,_resampler_track_fill)
 
 #define spx_int16_t short
 #define spx_int32_t int
@@ -251,6 +255,34 @@ int speex_resampler_set_rate_frac(SpeexResamplerState *st,
                                    spx_uint32_t in_rate,
                                    spx_uint32_t out_rate);
 
+/** Correct the conversion ratio by a small amount, e.g. to follow the drift
+ * between two crystal clocks. A positive value consumes input faster
+ * (produces less output per input sample). The first call switches the
+ * resampler to a fine-grained ratio (about 1 ppm steps) with an interpolated
+ * filter; after that, changing the correction never rebuilds the filter and
+ * never drops or repeats samples. Setting the rate again leaves drift mode.
+ * @param st Resampler state
+ * @param ppb Correction in parts per billion, clamped to +/-1000 ppm
+ */
+int speex_resampler_set_drift(SpeexResamplerState *st, spx_int32_t ppb);
+
+/** Get the correction set by speex_resampler_set_drift() or
+ * speex_resampler_track_fill().
+ * @param st Resampler state
+ * @param ppb Correction in parts per billion
+ */
+void speex_resampler_get_drift(SpeexResamplerState *st, spx_int32_t *ppb);
+
+/** Track clock drift from the level of a buffer between the two clock
+ * domains, typically a SpeexBuffer the resampler writes into (or reads from).
+ * Call it once per processed block; the correction is steered so that the
+ * level settles at the target (within ~20 s by default).
+ * @param st Resampler state
+ * @param fill Current buffer level in samples
+ * @param target Level to hold in samples
+ */
+int speex_resampler_track_fill(SpeexResamplerState *st, spx_int32_t fill, spx_int32_t target);
+
 /** Get the current resampling ratio. This will be reduced to the least
  * common denominator.
  * @param st Resampler state
@@ -330,6 +362,15 @@ int speex_resampler_skip_zeros(SpeexResamplerState *st);
  */
 int speex_resampler_reset_mem(SpeexResamplerState *st);
 
+/** Free the cached sinc tables no resampler is using any more.
+ *
+ * Resamplers with the same ratio and quality share one read-only sinc table.
+ * When the last of them is destroyed the table is kept (up to
+ * RESAMPLER_CACHE_IDLE_BYTES in total) so the next one starts without
+ * recomputing it. Call this to give that memory back.
+ */
+void speex_resampler_cache_trim(void);
+
 /** Returns the English meaning for an error code
  * @param err Error code
  * @return English string
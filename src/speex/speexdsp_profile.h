@@ -0,0 +1,42 @@
+/* File: speexdsp_profile.h
+   Per-stage timing of the DSP states
+
+   Builds with SPEEXDSP_PROFILE defined time every stage of
+   speex_echo_cancellation() and speex_preprocess_run() into counters kept in
+   the state, read with SPEEX_ECHO_GET_PROFILE and SPEEX_PREPROCESS_GET_PROFILE.
+   Without it the counters and clock reads are compiled out and the requests
+   fail.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted under the same terms as the rest of SpeexDSP.
+*/
+
+#ifndef SPEEXDSP_PROFILE_H
+#define SPEEXDSP_PROFILE_H
+
+#include <stdint.h>
+#include "speexdsp_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Most stages a state reports */
+#define SPEEX_PROFILE_MAX_STAGES 8
+
+/** Time spent in each stage since the state was created or its counters were
+    reset. Work split across workers is added up over all of them (CPU time,
+    barrier waits excluded) */
+typedef struct {
+   spx_uint32_t frames;           /**< Frames timed */
+   spx_uint32_t ticks_per_second; /**< CPU cycles per second on the ESP32, 1000000000 (ns) on the host */
+   int nb_stages;                 /**< Entries used below, see SPEEX_ECHO_STAGE_* and SPEEX_PREPROCESS_STAGE_* */
+   const char *names[SPEEX_PROFILE_MAX_STAGES]; /**< Short stage names, for printing */
+   uint64_t ticks[SPEEX_PROFILE_MAX_STAGES];    /**< Ticks spent in each stage */
+} SpeexProfile;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
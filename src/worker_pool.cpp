@@ -0,0 +1,146 @@
+#include "worker_pool.h"
+#include <new>
+#ifndef ESP_PLATFORM
+#include <system_error>
+#endif
+
+SpeexWorkerPool::SpeexWorkerPool(int workers)
+    : workers(workers), job(nullptr), arg(nullptr), count(0), stopping(false),
+#ifdef ESP_PLATFORM
+      threads(nullptr), done(nullptr)
+#else
+      batch(0), pending(0)
+#endif
+{}
+
+SpeexWorkerPool *SpeexWorkerPool::create(int workers) {
+    SpeexWorkerPool *pool = new (std::nothrow) SpeexWorkerPool(workers < 1 ? 1 : workers);
+    if (pool && !pool->start()) {
+        delete pool;
+        pool = nullptr;
+    }
+    return pool;
+}
+
+void SpeexWorkerPool::run(void *ctx, void (*job)(void *arg, int index), void *arg, int count) {
+    static_cast<SpeexWorkerPool *>(ctx)->dispatch(job, arg, count);
+}
+
+#ifdef ESP_PLATFORM
+
+// Worker i sits on the core i steps away from the caller's, at the caller's priority
+bool SpeexWorkerPool::start() {
+    threads = new (std::nothrow) Worker[workers];
+    done = xSemaphoreCreateCounting(workers, 0);
+    if (!threads || !done) return false;
+    UBaseType_t priority = uxTaskPriorityGet(nullptr);
+    int core = xPortGetCoreID();
+    for (int i = 0; i < workers; i++) {
+        threads[i].pool = this;
+        threads[i].index = i;
+        threads[i].task = nullptr;
+    }
+    for (int i = 1; i < workers; i++) {
+        if (xTaskCreatePinnedToCore(taskEntry, "speex_worker", 4096, &threads[i], priority,
+                                    &threads[i].task, (core + i) % portNUM_PROCESSORS) != pdPASS) {
+            threads[i].task = nullptr;
+            return false;
+        }
+    }
+    return true;
+}
+
+SpeexWorkerPool::~SpeexWorkerPool() {
+    stopping = true;
+    if (threads) {
+        for (int i = 1; i < workers; i++) {
+            if (!threads[i].task) continue;
+            xTaskNotifyGive(threads[i].task);
+            xSemaphoreTake(done, portMAX_DELAY); // The task is about to delete itself
+        }
+        delete[] threads;
+    }
+    if (done) vSemaphoreDelete(done);
+}
+
+void SpeexWorkerPool::taskEntry(void *param) {
+    Worker *worker = static_cast<Worker *>(param);
+    worker->pool->work(worker->index);
+    vTaskDelete(nullptr);
+}
+
+void SpeexWorkerPool::work(int index) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (stopping) break;
+        job(arg, index);
+        xSemaphoreGive(done);
+    }
+    xSemaphoreGive(done);
+}
+
+void SpeexWorkerPool::dispatch(void (*job)(void *, int), void *arg, int count) {
+    this->job = job;
+    this->arg = arg;
+    this->count = count;
+    for (int i = 1; i < count; i++) xTaskNotifyGive(threads[i].task);
+    job(arg, 0);
+    for (int i = 1; i < count; i++) xSemaphoreTake(done, portMAX_DELAY);
+}
+
+#else
+
+bool SpeexWorkerPool::start() {
+    try {
+        for (int i = 1; i < workers; i++) threads.emplace_back(&SpeexWorkerPool::work, this, i);
+    } catch (const std::system_error &) {
+        return false;
+    }
+    return true;
+}
+
+SpeexWorkerPool::~SpeexWorkerPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (size_t i = 0; i < threads.size(); i++) threads[i].join();
+}
+
+void SpeexWorkerPool::work(int index) {
+    unsigned seen = 0;
+    for (;;) {
+        void (*todo)(void *, int);
+        void *todoArg;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            wake.wait(guard, [&] { return stopping || batch != seen; });
+            if (stopping) return;
+            seen = batch;
+            if (index >= count) continue;
+            todo = job;
+            todoArg = arg;
+        }
+        todo(todoArg, index);
+        std::lock_guard<std::mutex> guard(lock);
+        if (--pending == 0) finished.notify_one();
+    }
+}
+
+void SpeexWorkerPool::dispatch(void (*job)(void *, int), void *arg, int count) {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        this->job = job;
+        this->arg = arg;
+        this->count = count;
+        pending = count - 1;
+        batch++;
+    }
+    wake.notify_all();
+    job(arg, 0);
+    std::unique_lock<std::mutex> guard(lock);
+    finished.wait(guard, [&] { return pending == 0; });
+}
+
+#endif
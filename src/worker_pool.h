@@ -0,0 +1,60 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include "config.h"
+
+#ifdef ESP_PLATFORM
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#else
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+// Fixed set of threads running batches of jobs for the DSP states: FreeRTOS
+// tasks pinned to the other cores on the ESP32, std::thread on the host. The
+// calling thread runs job 0 itself, so a pool of n workers starts n - 1 threads.
+// run() matches speex_echo_parallel_func.
+class SpeexWorkerPool {
+public:
+    static SpeexWorkerPool *create(int workers); // nullptr if a thread could not be started
+    ~SpeexWorkerPool();
+
+    int size() const { return workers; }
+    // Runs job(arg, 0) .. job(arg, count - 1), count <= size(), and waits for all of them
+    static void run(void *ctx, void (*job)(void *arg, int index), void *arg, int count);
+
+private:
+    explicit SpeexWorkerPool(int workers);
+    bool start();
+    void dispatch(void (*job)(void *, int), void *arg, int count);
+    void work(int index);
+
+    int workers;
+    void (*job)(void *, int);
+    void *arg;
+    int count;
+    bool stopping;
+#ifdef ESP_PLATFORM
+    struct Worker {
+        SpeexWorkerPool *pool;
+        int index;
+        TaskHandle_t task;
+    };
+    static void taskEntry(void *param);
+    Worker *threads;
+    SemaphoreHandle_t done;
+#else
+    std::vector<std::thread> threads;
+    std::mutex lock;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    unsigned batch;
+    int pending;
+#endif
+};
+
+#endif